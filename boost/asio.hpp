@@ -21,6 +21,7 @@
 #include <boost/asio/basic_deadline_timer.hpp>
 #include <boost/asio/basic_io_object.hpp>
 #include <boost/asio/basic_raw_socket.hpp>
+#include <boost/asio/basic_reuse_port_acceptor.hpp>
 #include <boost/asio/basic_seq_packet_socket.hpp>
 #include <boost/asio/basic_serial_port.hpp>
 #include <boost/asio/basic_signal_set.hpp>
@@ -40,6 +41,7 @@
 #include <boost/asio/buffers_iterator.hpp>
 #include <boost/asio/completion_condition.hpp>
 #include <boost/asio/connect.hpp>
+#include <boost/asio/datagram_message.hpp>
 #include <boost/asio/datagram_socket_service.hpp>
 #include <boost/asio/deadline_timer_service.hpp>
 #include <boost/asio/deadline_timer.hpp>
@@ -47,6 +49,7 @@
 #include <boost/asio/handler_alloc_hook.hpp>
 #include <boost/asio/handler_invoke_hook.hpp>
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/io_service_metrics.hpp>
 #include <boost/asio/ip/address.hpp>
 #include <boost/asio/ip/address_v4.hpp>
 #include <boost/asio/ip/address_v6.hpp>
@@ -80,6 +83,7 @@
 #include <boost/asio/read.hpp>
 #include <boost/asio/read_at.hpp>
 #include <boost/asio/read_until.hpp>
+#include <boost/asio/send_file.hpp>
 #include <boost/asio/seq_packet_socket_service.hpp>
 #include <boost/asio/serial_port.hpp>
 #include <boost/asio/serial_port_base.hpp>
@@ -92,6 +96,7 @@
 #include <boost/asio/stream_socket_service.hpp>
 #include <boost/asio/streambuf.hpp>
 #include <boost/asio/time_traits.hpp>
+#include <boost/asio/timer_wheel_traits.hpp>
 #include <boost/asio/version.hpp>
 #include <boost/asio/wait_traits.hpp>
 #include <boost/asio/waitable_timer_service.hpp>
@@ -18,6 +18,8 @@
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
 #include <boost/asio/basic_socket.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_message.hpp>
 #include <boost/asio/datagram_socket_service.hpp>
 #include <boost/asio/detail/handler_type_requirements.hpp>
 #include <boost/asio/detail/throw_error.hpp>
@@ -56,6 +58,15 @@ public:
   /// The endpoint type.
   typedef typename Protocol::endpoint endpoint_type;
 
+#if defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+  /// The type of a message used with send_to_batch and async_send_to_batch.
+  typedef datagram_message<const_buffer, endpoint_type> send_message_type;
+
+  /// The type of a message used with receive_from_batch and
+  /// async_receive_from_batch.
+  typedef datagram_message<mutable_buffer, endpoint_type> receive_message_type;
+#endif // defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+
   /// Construct a basic_datagram_socket without opening it.
   /**
    * This constructor creates a datagram socket without opening it. The open()
@@ -878,6 +889,290 @@ public:
     this->get_service().async_receive_from(this->get_implementation(), buffers,
         sender_endpoint, flags, BOOST_ASIO_MOVE_CAST(ReadHandler)(handler));
   }
+
+#if defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+  /// Send a batch of datagrams.
+  /**
+   * This function is used to send several datagrams, each to the endpoint
+   * given by its message, using a single system call where possible. The
+   * function call will block until at least one datagram has been sent
+   * successfully or an error occurs.
+   *
+   * @param messages An array of messages to be sent.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @returns The number of messages sent, starting from the beginning of the
+   * array. The number of bytes sent for each of these messages is stored in
+   * the message. This may be fewer than @c count.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t send_to_batch(send_message_type* messages, std::size_t count)
+  {
+    boost::system::error_code ec;
+    std::size_t s = this->get_service().send_to_batch(
+        this->get_implementation(), messages, count, 0, ec);
+    boost::asio::detail::throw_error(ec, "send_to_batch");
+    return s;
+  }
+
+  /// Send a batch of datagrams.
+  /**
+   * This function is used to send several datagrams, each to the endpoint
+   * given by its message, using a single system call where possible. The
+   * function call will block until at least one datagram has been sent
+   * successfully or an error occurs.
+   *
+   * @param messages An array of messages to be sent.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of messages sent, starting from the beginning of the
+   * array. The number of bytes sent for each of these messages is stored in
+   * the message. This may be fewer than @c count.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t send_to_batch(send_message_type* messages, std::size_t count,
+      socket_base::message_flags flags, boost::system::error_code& ec)
+  {
+    return this->get_service().send_to_batch(
+        this->get_implementation(), messages, count, flags, ec);
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send several datagrams, each to
+   * the endpoint given by its message. The function call always returns
+   * immediately. Each time the socket becomes ready, as many of the messages
+   * as possible are sent with a single system call, after which the operation
+   * completes.
+   *
+   * @param messages An array of messages to be sent. Ownership of the array,
+   * and of the data referred to by each message, is retained by the caller,
+   * which must guarantee that they remain valid until the handler is called.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param handler The handler to be called when the send operation completes.
+   * Copies will be made of the handler as required. The function signature of
+   * the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred        // Number of messages sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is available only on Linux.
+   */
+  template <typename WriteHandler>
+  void async_send_to_batch(send_message_type* messages, std::size_t count,
+      BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    // If you get an error on the following line it means that your handler does
+    // not meet the documented type requirements for a WriteHandler.
+    BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    this->get_service().async_send_to_batch(this->get_implementation(),
+        messages, count, 0, BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send several datagrams, each to
+   * the endpoint given by its message. The function call always returns
+   * immediately. Each time the socket becomes ready, as many of the messages
+   * as possible are sent with a single system call, after which the operation
+   * completes.
+   *
+   * @param messages An array of messages to be sent. Ownership of the array,
+   * and of the data referred to by each message, is retained by the caller,
+   * which must guarantee that they remain valid until the handler is called.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param handler The handler to be called when the send operation completes.
+   * Copies will be made of the handler as required. The function signature of
+   * the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred        // Number of messages sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is available only on Linux.
+   */
+  template <typename WriteHandler>
+  void async_send_to_batch(send_message_type* messages, std::size_t count,
+      socket_base::message_flags flags,
+      BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    // If you get an error on the following line it means that your handler does
+    // not meet the documented type requirements for a WriteHandler.
+    BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    this->get_service().async_send_to_batch(this->get_implementation(),
+        messages, count, flags, BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  /**
+   * This function is used to receive several datagrams using a single system
+   * call where possible. The function call will block until at least one
+   * datagram has been received successfully or an error occurs. Any further
+   * datagrams that are already queued on the socket are also received.
+   *
+   * @param messages An array of messages into which datagrams will be
+   * received.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @returns The number of messages received, starting from the beginning of
+   * the array. The number of bytes received and the endpoint of the sender
+   * are stored in each of these messages.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t receive_from_batch(receive_message_type* messages,
+      std::size_t count)
+  {
+    boost::system::error_code ec;
+    std::size_t s = this->get_service().receive_from_batch(
+        this->get_implementation(), messages, count, 0, ec);
+    boost::asio::detail::throw_error(ec, "receive_from_batch");
+    return s;
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  /**
+   * This function is used to receive several datagrams using a single system
+   * call where possible. The function call will block until at least one
+   * datagram has been received successfully or an error occurs. Any further
+   * datagrams that are already queued on the socket are also received.
+   *
+   * @param messages An array of messages into which datagrams will be
+   * received.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of messages received, starting from the beginning of
+   * the array. The number of bytes received and the endpoint of the sender
+   * are stored in each of these messages.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t receive_from_batch(receive_message_type* messages,
+      std::size_t count, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    return this->get_service().receive_from_batch(
+        this->get_implementation(), messages, count, flags, ec);
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive several datagrams. The
+   * function call always returns immediately. When the socket becomes ready,
+   * all queued datagrams that fit in the array are received with a single
+   * system call, after which the operation completes.
+   *
+   * @param messages An array of messages into which datagrams will be
+   * received. Ownership of the array, and of the buffers referred to by each
+   * message, is retained by the caller, which must guarantee that they remain
+   * valid until the handler is called.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param handler The handler to be called when the receive operation
+   * completes. Copies will be made of the handler as required. The function
+   * signature of the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred        // Number of messages received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is available only on Linux.
+   */
+  template <typename ReadHandler>
+  void async_receive_from_batch(receive_message_type* messages,
+      std::size_t count, BOOST_ASIO_MOVE_ARG(ReadHandler) handler)
+  {
+    // If you get an error on the following line it means that your handler does
+    // not meet the documented type requirements for a ReadHandler.
+    BOOST_ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+    this->get_service().async_receive_from_batch(this->get_implementation(),
+        messages, count, 0, BOOST_ASIO_MOVE_CAST(ReadHandler)(handler));
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive several datagrams. The
+   * function call always returns immediately. When the socket becomes ready,
+   * all queued datagrams that fit in the array are received with a single
+   * system call, after which the operation completes.
+   *
+   * @param messages An array of messages into which datagrams will be
+   * received. Ownership of the array, and of the buffers referred to by each
+   * message, is retained by the caller, which must guarantee that they remain
+   * valid until the handler is called.
+   *
+   * @param count The number of messages in the array.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param handler The handler to be called when the receive operation
+   * completes. Copies will be made of the handler as required. The function
+   * signature of the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred        // Number of messages received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is available only on Linux.
+   */
+  template <typename ReadHandler>
+  void async_receive_from_batch(receive_message_type* messages,
+      std::size_t count, socket_base::message_flags flags,
+      BOOST_ASIO_MOVE_ARG(ReadHandler) handler)
+  {
+    // If you get an error on the following line it means that your handler does
+    // not meet the documented type requirements for a ReadHandler.
+    BOOST_ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+    this->get_service().async_receive_from_batch(this->get_implementation(),
+        messages, count, flags, BOOST_ASIO_MOVE_CAST(ReadHandler)(handler));
+  }
+#endif // defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
 };
 
 } // namespace asio
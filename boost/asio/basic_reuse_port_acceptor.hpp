@@ -0,0 +1,256 @@
+//
+// basic_reuse_port_acceptor.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_BASIC_REUSE_PORT_ACCEPTOR_HPP
+#define BOOST_ASIO_BASIC_REUSE_PORT_ACCEPTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_REUSE_PORT) || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <vector>
+#include <boost/asio/basic_socket_acceptor.hpp>
+#include <boost/asio/detail/noncopyable.hpp>
+#include <boost/asio/detail/throw_error.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/socket_acceptor_service.hpp>
+#include <boost/asio/socket_base.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// Accepts connections on one endpoint using several listening sockets.
+/**
+ * The basic_reuse_port_acceptor class template manages a group of acceptors
+ * that are all bound to the same endpoint using the @c SO_REUSEPORT socket
+ * option. Each acceptor may belong to a different io_service. The kernel
+ * spreads incoming connections across the acceptors, so that when each
+ * io_service is run by its own thread, the threads do not compete for
+ * connections on a single listening socket.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe. Each acceptor in the group may be used
+ * from the thread that runs its io_service.
+ *
+ * @par Example
+ * Accepting connections on port 8080 with one thread per io_service:
+ * @code
+ * boost::asio::io_service io_services[4];
+ * boost::asio::ip::tcp::reuse_port_acceptor acceptors(
+ *     boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), 8080));
+ * for (int i = 0; i < 4; ++i)
+ * {
+ *   acceptors.add(io_services[i]);
+ *   start_accept(acceptors.acceptor(i));
+ * }
+ * ... run each io_service on its own thread ...
+ * @endcode
+ *
+ * @note This class is available only on Linux 3.9 and later.
+ */
+template <typename Protocol,
+    typename SocketAcceptorService = socket_acceptor_service<Protocol> >
+class basic_reuse_port_acceptor
+  : private noncopyable
+{
+public:
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of each acceptor in the group.
+  typedef basic_socket_acceptor<Protocol, SocketAcceptorService> acceptor_type;
+
+  /// Construct a group with no acceptors.
+  /**
+   * @param endpoint The endpoint on which the acceptors will listen. If the
+   * port is zero, the first acceptor to be added chooses a port and the other
+   * acceptors use the same one.
+   *
+   * @param backlog The maximum length of the queue of pending connections of
+   * each acceptor.
+   */
+  explicit basic_reuse_port_acceptor(const endpoint_type& endpoint,
+      int backlog = socket_base::max_connections)
+    : endpoint_(endpoint),
+      backlog_(backlog)
+  {
+  }
+
+  /// Destructor closes all of the acceptors.
+  ~basic_reuse_port_acceptor()
+  {
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+      delete acceptors_[i];
+  }
+
+  /// Add an acceptor.
+  /**
+   * This function opens a new acceptor on the given io_service, binds it to
+   * the group's endpoint and puts it into the listening state.
+   *
+   * @param io_service The io_service object that the acceptor will use to
+   * dispatch handlers for any asynchronous operations performed on it.
+   *
+   * @returns The new acceptor.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  acceptor_type& add(boost::asio::io_service& io_service)
+  {
+    boost::system::error_code ec;
+    add(io_service, ec);
+    boost::asio::detail::throw_error(ec, "add");
+    return *acceptors_.back();
+  }
+
+  /// Add an acceptor.
+  /**
+   * This function opens a new acceptor on the given io_service, binds it to
+   * the group's endpoint and puts it into the listening state.
+   *
+   * @param io_service The io_service object that the acceptor will use to
+   * dispatch handlers for any asynchronous operations performed on it.
+   *
+   * @param ec Set to indicate what error occurred, if any. The group is
+   * unchanged if an error occurs.
+   */
+  boost::system::error_code add(boost::asio::io_service& io_service,
+      boost::system::error_code& ec)
+  {
+    acceptors_.reserve(acceptors_.size() + 1);
+    acceptor_type* new_acceptor = new acceptor_type(io_service);
+    if (open_acceptor(*new_acceptor, ec))
+    {
+      delete new_acceptor;
+      return ec;
+    }
+    acceptors_.push_back(new_acceptor);
+    return ec;
+  }
+
+  /// Get the number of acceptors in the group.
+  std::size_t size() const
+  {
+    return acceptors_.size();
+  }
+
+  /// Get an acceptor in the group.
+  /**
+   * @param index The position of the acceptor, in the order in which the
+   * acceptors were added.
+   */
+  acceptor_type& acceptor(std::size_t index)
+  {
+    return *acceptors_[index];
+  }
+
+  /// Get the endpoint on which the acceptors listen.
+  /**
+   * Once an acceptor has been added, the endpoint's port is the one that was
+   * chosen by the first acceptor.
+   */
+  endpoint_type local_endpoint() const
+  {
+    return endpoint_;
+  }
+
+  /// Close all of the acceptors.
+  /**
+   * Any asynchronous accept operations are cancelled immediately. The
+   * acceptors remain in the group, and are destroyed with it.
+   *
+   * @throws boost::system::system_error Thrown on failure.
+   */
+  void close()
+  {
+    boost::system::error_code ec;
+    close(ec);
+    boost::asio::detail::throw_error(ec, "close");
+  }
+
+  /// Close all of the acceptors.
+  /**
+   * Any asynchronous accept operations are cancelled immediately. The
+   * acceptors remain in the group, and are destroyed with it.
+   *
+   * @param ec Set to indicate what error occurred, if any. All of the
+   * acceptors are closed even if an error occurs.
+   */
+  boost::system::error_code close(boost::system::error_code& ec)
+  {
+    ec = boost::system::error_code();
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+    {
+      boost::system::error_code close_ec;
+      if (acceptors_[i]->close(close_ec) && !ec)
+        ec = close_ec;
+    }
+    return ec;
+  }
+
+private:
+  // Open an acceptor and make it listen on the group's endpoint.
+  boost::system::error_code open_acceptor(
+      acceptor_type& a, boost::system::error_code& ec)
+  {
+    if (a.open(endpoint_.protocol(), ec))
+      return ec;
+    if (a.set_option(socket_base::reuse_address(true), ec))
+      return ec;
+    if (a.set_option(socket_base::reuse_port(true), ec))
+      return ec;
+    if (a.bind(endpoint_, ec))
+      return ec;
+    if (a.listen(backlog_, ec))
+      return ec;
+
+    // Later acceptors must use the port chosen by the first.
+    if (acceptors_.empty())
+    {
+      endpoint_type bound_endpoint = a.local_endpoint(ec);
+      if (ec)
+        return ec;
+      endpoint_ = bound_endpoint;
+    }
+
+    return ec;
+  }
+
+  // The endpoint on which the acceptors listen.
+  endpoint_type endpoint_;
+
+  // The maximum length of each acceptor's queue of pending connections.
+  int backlog_;
+
+  // The acceptors in the group.
+  std::vector<acceptor_type*> acceptors_;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_REUSE_PORT)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // BOOST_ASIO_BASIC_REUSE_PORT_ACCEPTOR_HPP
@@ -1067,6 +1067,123 @@ public:
     this->get_service().async_accept(this->get_implementation(), peer,
         &peer_endpoint, BOOST_ASIO_MOVE_CAST(AcceptHandler)(handler));
   }
+
+#if !defined(BOOST_ASIO_HAS_IOCP) || defined(GENERATING_DOCUMENTATION)
+  /// Accept a batch of new connections.
+  /**
+   * This function is used to accept one or more new connections, each into
+   * its own socket. The function call will block until at least one
+   * connection has been accepted successfully or an error occurs. Any further
+   * connections that are already pending are then accepted without blocking.
+   * Where available, @c accept4 is used so that each new socket is created
+   * with its close-on-exec flag set.
+   *
+   * @param peers An array of pointers to the sockets into which the new
+   * connections will be accepted. None of the sockets may be open.
+   *
+   * @param count The number of sockets in the array.
+   *
+   * @returns The number of connections accepted. The connections are
+   * accepted into the sockets at the beginning of the array.
+   *
+   * @throws boost::system::system_error Thrown on failure. If a connection
+   * cannot be assigned to its socket after others have been accepted, the
+   * connection is closed and an exception is thrown, but the sockets that
+   * were opened remain open.
+   *
+   * @par Example
+   * @code
+   * boost::asio::ip::tcp::acceptor acceptor(io_service);
+   * ...
+   * boost::asio::ip::tcp::socket* sockets[16];
+   * for (int i = 0; i < 16; ++i)
+   *   sockets[i] = new boost::asio::ip::tcp::socket(io_service);
+   * std::size_t n = acceptor.accept_batch(sockets, 16);
+   * @endcode
+   *
+   * @note This function is not available when I/O completion ports are used.
+   */
+  template <typename Socket>
+  std::size_t accept_batch(Socket* const* peers, std::size_t count)
+  {
+    boost::system::error_code ec;
+    std::size_t n = this->get_service().accept_batch(
+        this->get_implementation(), peers, count, ec);
+    boost::asio::detail::throw_error(ec, "accept_batch");
+    return n;
+  }
+
+  /// Accept a batch of new connections.
+  /**
+   * This function is used to accept one or more new connections, each into
+   * its own socket. The function call will block until at least one
+   * connection has been accepted successfully or an error occurs. Any further
+   * connections that are already pending are then accepted without blocking.
+   * Where available, @c accept4 is used so that each new socket is created
+   * with its close-on-exec flag set.
+   *
+   * @param peers An array of pointers to the sockets into which the new
+   * connections will be accepted. None of the sockets may be open.
+   *
+   * @param count The number of sockets in the array.
+   *
+   * @param ec Set to indicate what error occurred, if any. If a connection
+   * cannot be assigned to its socket after others have been accepted, the
+   * connection is closed and @c ec is set along with a non-zero result.
+   *
+   * @returns The number of connections accepted. The connections are
+   * accepted into the sockets at the beginning of the array.
+   *
+   * @note This function is not available when I/O completion ports are used.
+   */
+  template <typename Socket>
+  std::size_t accept_batch(Socket* const* peers, std::size_t count,
+      boost::system::error_code& ec)
+  {
+    return this->get_service().accept_batch(
+        this->get_implementation(), peers, count, ec);
+  }
+
+  /// Start an asynchronous accept of a batch of new connections.
+  /**
+   * This function is used to asynchronously accept one or more new
+   * connections, each into its own socket. The function call always returns
+   * immediately. When the acceptor becomes ready, all pending connections are
+   * accepted, up to the number of sockets given, after which the operation
+   * completes.
+   *
+   * @param peers An array of pointers to the sockets into which the new
+   * connections will be accepted. None of the sockets may be open. Ownership
+   * of the array and the sockets is retained by the caller, which must
+   * guarantee that they are valid until the handler is called.
+   *
+   * @param count The number of sockets in the array.
+   *
+   * @param handler The handler to be called when the accept operation
+   * completes. Copies will be made of the handler as required. The function
+   * signature of the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t connections_accepted        // Number of sockets used.
+   * ); @endcode
+   * If a connection cannot be assigned to its socket after others have been
+   * accepted, the connection is closed and the handler receives the error
+   * along with the number of sockets used.
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is not available when I/O completion ports are used.
+   */
+  template <typename Socket, typename AcceptHandler>
+  void async_accept_batch(Socket* const* peers, std::size_t count,
+      BOOST_ASIO_MOVE_ARG(AcceptHandler) handler)
+  {
+    this->get_service().async_accept_batch(this->get_implementation(),
+        peers, count, BOOST_ASIO_MOVE_CAST(AcceptHandler)(handler));
+  }
+#endif // !defined(BOOST_ASIO_HAS_IOCP) || defined(GENERATING_DOCUMENTATION)
 };
 
 } // namespace asio
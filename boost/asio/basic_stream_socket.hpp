@@ -17,6 +17,7 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
+#include <boost/cstdint.hpp>
 #include <boost/asio/basic_socket.hpp>
 #include <boost/asio/detail/handler_type_requirements.hpp>
 #include <boost/asio/detail/throw_error.hpp>
@@ -677,6 +678,118 @@ public:
         buffers, 0, BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
   }
 
+#if defined(BOOST_ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+  /// Send data from a file descriptor on the socket.
+  /**
+   * This function is used to send data from a file descriptor without copying
+   * it through user space. The function call will block until all of the
+   * requested data has been sent, or until an error occurs.
+   *
+   * @param fd A file descriptor from which the data is read. A regular file is
+   * sent using @c sendfile. A pipe is sent using @c splice, in which case the
+   * offset is ignored and the call returns early if the pipe has no more data
+   * available.
+   *
+   * @param offset The position in the file at which to start reading. The
+   * file's own position is not changed.
+   *
+   * @param length The number of bytes to send.
+   *
+   * @returns The number of bytes sent.
+   *
+   * @throws boost::system::system_error Thrown on failure. An error code of
+   * boost::asio::error::eof indicates that the end of the file was reached
+   * before @c length bytes were sent.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t send_file(int fd, boost::uint64_t offset, std::size_t length)
+  {
+    boost::system::error_code ec;
+    std::size_t s = this->get_service().send_file(
+        this->get_implementation(), fd, offset, length, ec);
+    boost::asio::detail::throw_error(ec, "send_file");
+    return s;
+  }
+
+  /// Send data from a file descriptor on the socket.
+  /**
+   * This function is used to send data from a file descriptor without copying
+   * it through user space. The function call will block until all of the
+   * requested data has been sent, or until an error occurs.
+   *
+   * @param fd A file descriptor from which the data is read. A regular file is
+   * sent using @c sendfile. A pipe is sent using @c splice, in which case the
+   * offset is ignored and the call returns early if the pipe has no more data
+   * available.
+   *
+   * @param offset The position in the file at which to start reading. The
+   * file's own position is not changed.
+   *
+   * @param length The number of bytes to send.
+   *
+   * @param ec Set to indicate what error occurred, if any. An error code of
+   * boost::asio::error::eof indicates that the end of the file was reached
+   * before @c length bytes were sent.
+   *
+   * @returns The number of bytes sent.
+   *
+   * @note This function is available only on Linux.
+   */
+  std::size_t send_file(int fd, boost::uint64_t offset, std::size_t length,
+      boost::system::error_code& ec)
+  {
+    return this->get_service().send_file(
+        this->get_implementation(), fd, offset, length, ec);
+  }
+
+  /// Start an asynchronous send of data from a file descriptor.
+  /**
+   * This function is used to asynchronously send data from a file descriptor
+   * without copying it through user space. The function call always returns
+   * immediately. The data is sent as the socket becomes ready for writing,
+   * and the operation completes when all of the requested data has been sent
+   * or an error occurs.
+   *
+   * @param fd A file descriptor from which the data is read. A regular file is
+   * sent using @c sendfile. A pipe is sent using @c splice, in which case the
+   * offset is ignored and the operation completes early if the pipe has no
+   * more data available. Use boost::asio::async_send_file to send from a
+   * pipe that is wrapped by a posix::stream_descriptor. The descriptor must
+   * remain open until the handler is called.
+   *
+   * @param offset The position in the file at which to start reading. The
+   * file's own position is not changed.
+   *
+   * @param length The number of bytes to send.
+   *
+   * @param handler The handler to be called when the send operation completes.
+   * Copies will be made of the handler as required. The function signature of
+   * the handler must be:
+   * @code void handler(
+   *   const boost::system::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred           // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the handler will not be invoked from within this function. Invocation
+   * of the handler will be performed in a manner equivalent to using
+   * boost::asio::io_service::post().
+   *
+   * @note This function is available only on Linux.
+   */
+  template <typename WriteHandler>
+  void async_send_file(int fd, boost::uint64_t offset, std::size_t length,
+      BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    // If you get an error on the following line it means that your handler does
+    // not meet the documented type requirements for a WriteHandler.
+    BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+    this->get_service().async_send_file(this->get_implementation(),
+        fd, offset, length, BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+#endif // defined(BOOST_ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+
   /// Read some data from the socket.
   /**
    * This function is used to read data from the stream socket. The function
@@ -0,0 +1,130 @@
+//
+// datagram_message.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DATAGRAM_MESSAGE_HPP
+#define BOOST_ASIO_DATAGRAM_MESSAGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// A single datagram in a batched send or receive operation.
+/**
+ * The boost::asio::datagram_message class template associates a buffer with
+ * the remote endpoint of a datagram. Arrays of messages are used with the
+ * @c send_to_batch and @c receive_from_batch functions of
+ * boost::asio::basic_datagram_socket, which transfer several datagrams with a
+ * single system call.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+template <typename Buffer, typename Endpoint>
+class datagram_message
+{
+public:
+  /// The type of the buffer holding the datagram's data.
+  typedef Buffer buffer_type;
+
+  /// The type of the remote endpoint.
+  typedef Endpoint endpoint_type;
+
+  /// Default constructor.
+  datagram_message()
+    : buffer_(),
+      endpoint_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Construct a message for receiving into the specified buffer.
+  explicit datagram_message(const Buffer& buffer)
+    : buffer_(buffer),
+      endpoint_(),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Construct a message for sending the specified buffer to an endpoint.
+  datagram_message(const Buffer& buffer, const Endpoint& endpoint)
+    : buffer_(buffer),
+      endpoint_(endpoint),
+      bytes_transferred_(0)
+  {
+  }
+
+  /// Get the buffer associated with the message.
+  const Buffer& buffer() const
+  {
+    return buffer_;
+  }
+
+  /// Set the buffer associated with the message.
+  void buffer(const Buffer& b)
+  {
+    buffer_ = b;
+  }
+
+  /// Get the remote endpoint of the message.
+  /**
+   * For a send operation this is the destination of the datagram. For a
+   * receive operation it is set to the endpoint of the sender.
+   */
+  Endpoint& endpoint()
+  {
+    return endpoint_;
+  }
+
+  /// Get the remote endpoint of the message.
+  const Endpoint& endpoint() const
+  {
+    return endpoint_;
+  }
+
+  /// Set the remote endpoint of the message.
+  void endpoint(const Endpoint& e)
+  {
+    endpoint_ = e;
+  }
+
+  /// Get the number of bytes transferred by the last batched operation that
+  /// included the message.
+  std::size_t bytes_transferred() const
+  {
+    return bytes_transferred_;
+  }
+
+  /// Set the number of bytes transferred.
+  void bytes_transferred(std::size_t n)
+  {
+    bytes_transferred_ = n;
+  }
+
+private:
+  Buffer buffer_;
+  Endpoint endpoint_;
+  std::size_t bytes_transferred_;
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DATAGRAM_MESSAGE_HPP
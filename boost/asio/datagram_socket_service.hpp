@@ -17,6 +17,8 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_message.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_service.hpp>
 
@@ -359,6 +361,48 @@ public:
         BOOST_ASIO_MOVE_CAST(ReadHandler)(handler));
   }
 
+#if defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+  /// Send a batch of datagrams to the endpoints given by the messages.
+  std::size_t send_to_batch(implementation_type& impl,
+      datagram_message<const_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    return service_impl_.send_to_batch(impl, messages, count, flags, ec);
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  template <typename WriteHandler>
+  void async_send_to_batch(implementation_type& impl,
+      datagram_message<const_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    service_impl_.async_send_to_batch(impl, messages, count, flags,
+        BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  std::size_t receive_from_batch(implementation_type& impl,
+      datagram_message<mutable_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    return service_impl_.receive_from_batch(impl, messages, count, flags, ec);
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  template <typename ReadHandler>
+  void async_receive_from_batch(implementation_type& impl,
+      datagram_message<mutable_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      BOOST_ASIO_MOVE_ARG(ReadHandler) handler)
+  {
+    service_impl_.async_receive_from_batch(impl, messages, count, flags,
+        BOOST_ASIO_MOVE_CAST(ReadHandler)(handler));
+  }
+#endif // defined(BOOST_ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+
 private:
   // Destroy all user-defined handler objects owned by the service.
   void shutdown_service()
@@ -0,0 +1,78 @@
+//
+// detail/concurrency_hint.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_CONCURRENCY_HINT_HPP
+#define BOOST_ASIO_DETAIL_CONCURRENCY_HINT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+
+// The concurrency hint ID and mask are used to identify when a "well-known"
+// concurrency hint value has been passed to the io_service. Such a value
+// carries scheduler flags in bits 12-15 and a thread count in bits 0-11.
+#define BOOST_ASIO_CONCURRENCY_HINT_ID 0xA5100000u
+#define BOOST_ASIO_CONCURRENCY_HINT_ID_MASK 0xFFFF0000u
+#define BOOST_ASIO_CONCURRENCY_HINT_FLAGS_MASK 0x0000F000u
+#define BOOST_ASIO_CONCURRENCY_HINT_THREADS_MASK 0x00000FFFu
+
+// Give each thread calling run() its own queue of ready handlers. Handlers
+// posted from within a handler stay on the posting thread's queue, and idle
+// threads steal from the queues of their peers.
+#define BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING 0x1000u
+
+// Divide the reactor into one shard per thread, where supported. Each shard
+// waits on its own subset of the registered descriptors, so that several
+// threads may wait for readiness at the same time.
+#define BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS 0x2000u
+
+// Time every handler, so that the io_service's metrics include histograms of
+// scheduling delay and execution time.
+#define BOOST_ASIO_CONCURRENCY_HINT_METRICS 0x4000u
+
+// Construct a well-known concurrency hint from a set of flags and the number
+// of threads expected to run the io_service (0 if unknown).
+#define BOOST_ASIO_CONCURRENCY_HINT(flags, threads) \
+  static_cast<std::size_t>(BOOST_ASIO_CONCURRENCY_HINT_ID \
+      | ((flags) & BOOST_ASIO_CONCURRENCY_HINT_FLAGS_MASK) \
+      | ((threads) & BOOST_ASIO_CONCURRENCY_HINT_THREADS_MASK))
+
+// Convenience hint that selects the work-stealing scheduler.
+#define BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING_THREADS(threads) \
+  BOOST_ASIO_CONCURRENCY_HINT( \
+      BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING, threads)
+
+// Convenience hint that selects a sharded reactor.
+#define BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS_THREADS(threads) \
+  BOOST_ASIO_CONCURRENCY_HINT( \
+      BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS, threads)
+
+// Determine whether a concurrency hint is a well-known value.
+#define BOOST_ASIO_CONCURRENCY_HINT_IS_SPECIAL(hint) \
+  ((static_cast<std::size_t>(hint) \
+    & ~static_cast<std::size_t>(~BOOST_ASIO_CONCURRENCY_HINT_ID_MASK)) \
+      == BOOST_ASIO_CONCURRENCY_HINT_ID)
+
+// Determine whether a concurrency hint has the specified flag set.
+#define BOOST_ASIO_CONCURRENCY_HINT_HAS_FLAG(hint, flag) \
+  (BOOST_ASIO_CONCURRENCY_HINT_IS_SPECIAL(hint) \
+    && ((static_cast<std::size_t>(hint) & (flag)) != 0))
+
+// Obtain the number of threads indicated by a concurrency hint.
+#define BOOST_ASIO_CONCURRENCY_HINT_THREADS(hint) \
+  (BOOST_ASIO_CONCURRENCY_HINT_IS_SPECIAL(hint) \
+    ? (static_cast<std::size_t>(hint) \
+      & BOOST_ASIO_CONCURRENCY_HINT_THREADS_MASK) \
+    : static_cast<std::size_t>(hint))
+
+#endif // BOOST_ASIO_DETAIL_CONCURRENCY_HINT_HPP
@@ -264,7 +264,8 @@
 # endif // defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0400)
 #endif // defined(BOOST_WINDOWS) || defined(__CYGWIN__)
 
-// Linux: epoll, eventfd and timerfd.
+// Linux: epoll, eventfd, timerfd, io_uring, sendmmsg/recvmmsg,
+// sendfile/splice, accept4 and SO_REUSEPORT.
 #if defined(__linux__)
 # include <linux/version.h>
 # if !defined(BOOST_ASIO_DISABLE_EPOLL)
@@ -282,6 +283,37 @@
 #   define BOOST_ASIO_HAS_TIMERFD 1
 #  endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 8)
 # endif // defined(BOOST_ASIO_HAS_EPOLL)
+# if defined(BOOST_ASIO_ENABLE_IO_URING) && defined(BOOST_ASIO_HAS_EVENTFD)
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(5,9,0)
+#   define BOOST_ASIO_HAS_IO_URING 1
+#  endif // LINUX_VERSION_CODE >= KERNEL_VERSION(5,9,0)
+# endif // defined(BOOST_ASIO_ENABLE_IO_URING) && defined(BOOST_ASIO_HAS_EVENTFD)
+# if !defined(BOOST_ASIO_DISABLE_MMSG)
+#  if defined(_GNU_SOURCE) && defined(__GLIBC__)
+#   if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14)
+#    define BOOST_ASIO_HAS_MMSG 1
+#   endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14)
+#  endif // defined(_GNU_SOURCE) && defined(__GLIBC__)
+# endif // !defined(BOOST_ASIO_DISABLE_MMSG)
+# if !defined(BOOST_ASIO_DISABLE_SENDFILE)
+#  if defined(_GNU_SOURCE) && defined(__GLIBC__)
+#   if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 5)
+#    define BOOST_ASIO_HAS_SENDFILE 1
+#   endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 5)
+#  endif // defined(_GNU_SOURCE) && defined(__GLIBC__)
+# endif // !defined(BOOST_ASIO_DISABLE_SENDFILE)
+# if !defined(BOOST_ASIO_DISABLE_ACCEPT4)
+#  if defined(_GNU_SOURCE) && defined(__GLIBC__)
+#   if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 10)
+#    define BOOST_ASIO_HAS_ACCEPT4 1
+#   endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 10)
+#  endif // defined(_GNU_SOURCE) && defined(__GLIBC__)
+# endif // !defined(BOOST_ASIO_DISABLE_ACCEPT4)
+# if !defined(BOOST_ASIO_DISABLE_REUSE_PORT)
+#  if LINUX_VERSION_CODE >= KERNEL_VERSION(3,9,0)
+#   define BOOST_ASIO_HAS_REUSE_PORT 1
+#  endif // LINUX_VERSION_CODE >= KERNEL_VERSION(3,9,0)
+# endif // !defined(BOOST_ASIO_DISABLE_REUSE_PORT)
 #endif // defined(__linux__)
 
 // Mac OS X, FreeBSD, NetBSD, OpenBSD: kqueue.
@@ -0,0 +1,131 @@
+//
+// detail/datagram_message_adapter.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
+#define BOOST_ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_MMSG)
+
+#include <cstddef>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_message.hpp>
+#include <boost/asio/detail/socket_ops.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// Builds the native message headers for a batch of datagram messages. At most
+// max_messages are transferred by a single system call.
+template <typename Buffer, typename Endpoint>
+class datagram_message_adapter
+{
+public:
+  BOOST_STATIC_CONSTANT(std::size_t, max_messages = 64);
+
+  datagram_message_adapter(datagram_message<Buffer, Endpoint>* messages,
+      std::size_t count)
+    : messages_(messages),
+      count_(count < max_messages ? count : std::size_t(max_messages))
+  {
+    for (std::size_t i = 0; i < count_; ++i)
+    {
+      Endpoint& endpoint = messages_[i].endpoint();
+      msgs_[i] = socket_ops::mmsg();
+      socket_ops::init_buf(bufs_[i], data(messages_[i].buffer()),
+          boost::asio::buffer_size(messages_[i].buffer()));
+      msgs_[i].msg_hdr.msg_iov = &bufs_[i];
+      msgs_[i].msg_hdr.msg_iovlen = 1;
+      msgs_[i].msg_hdr.msg_name = endpoint.data();
+      msgs_[i].msg_hdr.msg_namelen = static_cast<socklen_t>(
+          name_length(endpoint, messages_[i].buffer()));
+    }
+  }
+
+  socket_ops::mmsg* msgs()
+  {
+    return msgs_;
+  }
+
+  std::size_t count() const
+  {
+    return count_;
+  }
+
+  // Record the results of the first n messages.
+  void complete(std::size_t n)
+  {
+    for (std::size_t i = 0; i < n && i < count_; ++i)
+    {
+      messages_[i].bytes_transferred(msgs_[i].msg_len);
+      update_endpoint(messages_[i].endpoint(),
+          msgs_[i].msg_hdr.msg_namelen, messages_[i].buffer());
+    }
+  }
+
+private:
+  static const void* data(const boost::asio::const_buffer& b)
+  {
+    return boost::asio::buffer_cast<const void*>(b);
+  }
+
+  static void* data(const boost::asio::mutable_buffer& b)
+  {
+    return boost::asio::buffer_cast<void*>(b);
+  }
+
+  // A message being sent names its destination.
+  static std::size_t name_length(const Endpoint& e,
+      const boost::asio::const_buffer&)
+  {
+    return e.size();
+  }
+
+  // A message being received has room for the sender's address.
+  static std::size_t name_length(const Endpoint& e,
+      const boost::asio::mutable_buffer&)
+  {
+    return e.capacity();
+  }
+
+  static void update_endpoint(Endpoint&, std::size_t,
+      const boost::asio::const_buffer&)
+  {
+  }
+
+  static void update_endpoint(Endpoint& e, std::size_t length,
+      const boost::asio::mutable_buffer&)
+  {
+    e.resize(length);
+  }
+
+  datagram_message<Buffer, Endpoint>* messages_;
+  std::size_t count_;
+  socket_ops::mmsg msgs_[max_messages];
+  socket_ops::buf bufs_[max_messages];
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
+#endif // BOOST_ASIO_DETAIL_DATAGRAM_MESSAGE_ADAPTER_HPP
@@ -19,6 +19,7 @@
 
 #if defined(BOOST_ASIO_HAS_EPOLL)
 
+#include <vector>
 #include <boost/cstdint.hpp>
 #include <boost/limits.hpp>
 #include <boost/asio/io_service.hpp>
@@ -35,6 +36,10 @@
 #include <boost/asio/detail/timer_queue_set.hpp>
 #include <boost/asio/detail/wait_op.hpp>
 
+#if !defined(BOOST_ASIO_EPOLL_MAX_EVENTS)
+# define BOOST_ASIO_EPOLL_MAX_EVENTS 128
+#endif // !defined(BOOST_ASIO_EPOLL_MAX_EVENTS)
+
 #include <boost/asio/detail/push_options.hpp>
 
 namespace boost {
@@ -60,6 +65,7 @@ public:
     mutex mutex_;
     epoll_reactor* reactor_;
     int descriptor_;
+    std::size_t shard_;
     boost::uint32_t registered_events_;
     op_queue<reactor_op> op_queue_[max_ops];
     bool shutdown_;
@@ -157,10 +163,17 @@ public:
       std::size_t max_cancelled = (std::numeric_limits<std::size_t>::max)());
 
   // Run epoll once until interrupted or events are ready to be dispatched.
-  BOOST_ASIO_DECL void run(bool block, op_queue<operation>& ops);
+  // Only the descriptors assigned to the given shard are waited on.
+  BOOST_ASIO_DECL void run(bool block, op_queue<operation>& ops,
+      std::size_t shard = 0);
+
+  // Wait until events are ready to be dispatched on any of the given shards,
+  // or until one of them is interrupted. The events are not dispatched.
+  BOOST_ASIO_DECL void wait_any(const std::size_t* shards,
+      std::size_t num_shards);
 
-  // Interrupt the select loop.
-  BOOST_ASIO_DECL void interrupt();
+  // Interrupt a wait on the given shard.
+  BOOST_ASIO_DECL void interrupt(std::size_t shard = 0);
 
 private:
   // The hint to pass to epoll_create to size its data structures.
@@ -170,6 +183,16 @@ private:
   // cannot be created.
   BOOST_ASIO_DECL static int do_epoll_create();
 
+  // Create the epoll file descriptors for all shards and add the interrupter
+  // and timer descriptors to them.
+  BOOST_ASIO_DECL void create_shards();
+
+  // Close the epoll file descriptors for all shards.
+  BOOST_ASIO_DECL void close_shards();
+
+  // Choose the shard to which a new descriptor is assigned.
+  BOOST_ASIO_DECL std::size_t next_shard();
+
   // Create the timerfd file descriptor. Does not throw.
   BOOST_ASIO_DECL static int do_timerfd_create();
 
@@ -208,8 +231,12 @@ private:
   // The interrupter is used to break a blocking epoll_wait call.
   select_interrupter interrupter_;
 
-  // The epoll file descriptor.
-  int epoll_fd_;
+  // The epoll file descriptor for each shard. The timer descriptor is waited
+  // on by every shard if EPOLLEXCLUSIVE is supported, or by the first shard.
+  std::vector<int> epoll_fds_;
+
+  // Used to distribute descriptors across the shards.
+  atomic_count next_shard_;
 
   // The timer file descriptor.
   int timer_fd_;
@@ -226,6 +253,10 @@ private:
   // Keep track of all registered descriptors.
   object_pool<descriptor_state> registered_descriptors_;
 
+  // Helper class to close the descriptors if creating the shards fails.
+  struct create_shards_cleanup;
+  friend struct create_shards_cleanup;
+
   // Helper class to do post-perform_io cleanup.
   struct perform_io_cleanup_on_block_exit;
   friend struct perform_io_cleanup_on_block_exit;
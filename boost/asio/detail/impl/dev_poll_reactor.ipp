@@ -250,7 +250,8 @@ void dev_poll_reactor::deregister_internal_descriptor(
     op_queue_[i].cancel_operations(descriptor, ops, ec);
 }
 
-void dev_poll_reactor::run(bool block, op_queue<operation>& ops)
+void dev_poll_reactor::run(bool block, op_queue<operation>& ops,
+    std::size_t)
 {
   boost::asio::detail::mutex::scoped_lock lock(mutex_);
 
@@ -367,7 +368,7 @@ void dev_poll_reactor::run(bool block, op_queue<operation>& ops)
   timer_queues_.get_ready_timers(ops);
 }
 
-void dev_poll_reactor::interrupt()
+void dev_poll_reactor::interrupt(std::size_t)
 {
   interrupter_.interrupt();
 }
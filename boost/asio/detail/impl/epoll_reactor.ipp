@@ -20,7 +20,9 @@
 #if defined(BOOST_ASIO_HAS_EPOLL)
 
 #include <cstddef>
+#include <poll.h>
 #include <sys/epoll.h>
+#include <boost/asio/detail/concurrency_hint.hpp>
 #include <boost/asio/detail/epoll_reactor.hpp>
 #include <boost/asio/detail/throw_error.hpp>
 #include <boost/asio/error.hpp>
@@ -40,30 +42,30 @@ epoll_reactor::epoll_reactor(boost::asio::io_service& io_service)
     io_service_(use_service<io_service_impl>(io_service)),
     mutex_(),
     interrupter_(),
-    epoll_fd_(do_epoll_create()),
+    epoll_fds_(),
+    next_shard_(0),
     timer_fd_(do_timerfd_create()),
     shutdown_(false)
 {
-  // Add the interrupter's descriptor to epoll.
-  epoll_event ev = { 0, { 0 } };
-  ev.events = EPOLLIN | EPOLLERR | EPOLLET;
-  ev.data.ptr = &interrupter_;
-  epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, interrupter_.read_descriptor(), &ev);
-  interrupter_.interrupt();
-
-  // Add the timer descriptor to epoll.
-  if (timer_fd_ != -1)
+  std::size_t num_shards = 1;
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
+  std::size_t concurrency_hint = io_service_.concurrency_hint();
+  if (BOOST_ASIO_CONCURRENCY_HINT_HAS_FLAG(concurrency_hint,
+        BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS))
   {
-    ev.events = EPOLLIN | EPOLLERR;
-    ev.data.ptr = &timer_fd_;
-    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd_, &ev);
+    num_shards = BOOST_ASIO_CONCURRENCY_HINT_THREADS(concurrency_hint);
+    if (num_shards == 0)
+      num_shards = 1;
   }
+#endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
+
+  epoll_fds_.resize(num_shards, -1);
+  create_shards();
 }
 
 epoll_reactor::~epoll_reactor()
 {
-  if (epoll_fd_ != -1)
-    close(epoll_fd_);
+  close_shards();
   if (timer_fd_ != -1)
     close(timer_fd_);
 }
@@ -93,10 +95,7 @@ void epoll_reactor::fork_service(boost::asio::io_service::fork_event fork_ev)
 {
   if (fork_ev == boost::asio::io_service::fork_child)
   {
-    if (epoll_fd_ != -1)
-      ::close(epoll_fd_);
-    epoll_fd_ = -1;
-    epoll_fd_ = do_epoll_create();
+    close_shards();
 
     if (timer_fd_ != -1)
       ::close(timer_fd_);
@@ -105,20 +104,7 @@ void epoll_reactor::fork_service(boost::asio::io_service::fork_event fork_ev)
 
     interrupter_.recreate();
 
-    // Add the interrupter's descriptor to epoll.
-    epoll_event ev = { 0, { 0 } };
-    ev.events = EPOLLIN | EPOLLERR | EPOLLET;
-    ev.data.ptr = &interrupter_;
-    epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, interrupter_.read_descriptor(), &ev);
-    interrupter_.interrupt();
-
-    // Add the timer descriptor to epoll.
-    if (timer_fd_ != -1)
-    {
-      ev.events = EPOLLIN | EPOLLERR;
-      ev.data.ptr = &timer_fd_;
-      epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timer_fd_, &ev);
-    }
+    create_shards();
 
     update_timeout();
 
@@ -127,9 +113,11 @@ void epoll_reactor::fork_service(boost::asio::io_service::fork_event fork_ev)
     for (descriptor_state* state = registered_descriptors_.first();
         state != 0; state = state->next_)
     {
+      epoll_event ev = { 0, { 0 } };
       ev.events = state->registered_events_;
       ev.data.ptr = state;
-      int result = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, state->descriptor_, &ev);
+      int result = epoll_ctl(epoll_fds_[state->shard_],
+          EPOLL_CTL_ADD, state->descriptor_, &ev);
       if (result != 0)
       {
         boost::system::error_code ec(errno,
@@ -142,7 +130,7 @@ void epoll_reactor::fork_service(boost::asio::io_service::fork_event fork_ev)
 
 void epoll_reactor::init_task()
 {
-  io_service_.init_task();
+  io_service_.init_task(epoll_fds_.size());
 }
 
 int epoll_reactor::register_descriptor(socket_type descriptor,
@@ -155,6 +143,7 @@ int epoll_reactor::register_descriptor(socket_type descriptor,
 
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
+    descriptor_data->shard_ = next_shard();
     descriptor_data->shutdown_ = false;
   }
 
@@ -162,7 +151,8 @@ int epoll_reactor::register_descriptor(socket_type descriptor,
   ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLPRI | EPOLLET;
   descriptor_data->registered_events_ = ev.events;
   ev.data.ptr = descriptor_data;
-  int result = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, descriptor, &ev);
+  int result = epoll_ctl(epoll_fds_[descriptor_data->shard_],
+      EPOLL_CTL_ADD, descriptor, &ev);
   if (result != 0)
     return errno;
 
@@ -180,6 +170,7 @@ int epoll_reactor::register_internal_descriptor(
 
     descriptor_data->reactor_ = this;
     descriptor_data->descriptor_ = descriptor;
+    descriptor_data->shard_ = next_shard();
     descriptor_data->shutdown_ = false;
     descriptor_data->op_queue_[op_type].push(op);
   }
@@ -188,7 +179,8 @@ int epoll_reactor::register_internal_descriptor(
   ev.events = EPOLLIN | EPOLLERR | EPOLLHUP | EPOLLPRI | EPOLLET;
   descriptor_data->registered_events_ = ev.events;
   ev.data.ptr = descriptor_data;
-  int result = epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, descriptor, &ev);
+  int result = epoll_ctl(epoll_fds_[descriptor_data->shard_],
+      EPOLL_CTL_ADD, descriptor, &ev);
   if (result != 0)
     return errno;
 
@@ -242,7 +234,8 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
           epoll_event ev = { 0, { 0 } };
           ev.events = descriptor_data->registered_events_ | EPOLLOUT;
           ev.data.ptr = descriptor_data;
-          if (epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, descriptor, &ev) == 0)
+          if (epoll_ctl(epoll_fds_[descriptor_data->shard_],
+                EPOLL_CTL_MOD, descriptor, &ev) == 0)
           {
             descriptor_data->registered_events_ |= ev.events;
           }
@@ -266,7 +259,8 @@ void epoll_reactor::start_op(int op_type, socket_type descriptor,
       epoll_event ev = { 0, { 0 } };
       ev.events = descriptor_data->registered_events_;
       ev.data.ptr = descriptor_data;
-      epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, descriptor, &ev);
+      epoll_ctl(epoll_fds_[descriptor_data->shard_],
+          EPOLL_CTL_MOD, descriptor, &ev);
     }
   }
 
@@ -316,7 +310,8 @@ void epoll_reactor::deregister_descriptor(socket_type descriptor,
     else
     {
       epoll_event ev = { 0, { 0 } };
-      epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, descriptor, &ev);
+      epoll_ctl(epoll_fds_[descriptor_data->shard_],
+          EPOLL_CTL_DEL, descriptor, &ev);
     }
 
     op_queue<operation> ops;
@@ -353,7 +348,8 @@ void epoll_reactor::deregister_internal_descriptor(socket_type descriptor,
   if (!descriptor_data->shutdown_)
   {
     epoll_event ev = { 0, { 0 } };
-    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, descriptor, &ev);
+    epoll_ctl(epoll_fds_[descriptor_data->shard_],
+        EPOLL_CTL_DEL, descriptor, &ev);
 
     op_queue<operation> ops;
     for (int i = 0; i < max_ops; ++i)
@@ -369,7 +365,8 @@ void epoll_reactor::deregister_internal_descriptor(socket_type descriptor,
   }
 }
 
-void epoll_reactor::run(bool block, op_queue<operation>& ops)
+void epoll_reactor::run(bool block, op_queue<operation>& ops,
+    std::size_t shard)
 {
   // This code relies on the fact that the task_io_service queues the reactor
   // task behind all descriptor operations generated by this function. This
@@ -377,9 +374,11 @@ void epoll_reactor::run(bool block, op_queue<operation>& ops)
   // descriptor operations have already been dequeued. Therefore it is now safe
   // for us to reuse and return them for the task_io_service to queue again.
 
-  // Calculate a timeout only if timerfd is not used.
+  // Without timerfd, timers are only handled by the first shard, which
+  // calculates a timeout for the wait.
+  bool timer_shard = (shard == 0);
   int timeout;
-  if (timer_fd_ != -1)
+  if (timer_fd_ != -1 || !timer_shard)
     timeout = block ? -1 : 0;
   else
   {
@@ -388,13 +387,14 @@ void epoll_reactor::run(bool block, op_queue<operation>& ops)
   }
 
   // Block on the epoll descriptor.
-  epoll_event events[128];
-  int num_events = epoll_wait(epoll_fd_, events, 128, timeout);
+  epoll_event events[BOOST_ASIO_EPOLL_MAX_EVENTS];
+  int num_events = epoll_wait(epoll_fds_[shard],
+      events, BOOST_ASIO_EPOLL_MAX_EVENTS, timeout);
 
 #if defined(BOOST_ASIO_HAS_TIMERFD)
-  bool check_timers = (timer_fd_ == -1);
+  bool check_timers = (timer_fd_ == -1 && timer_shard);
 #else // defined(BOOST_ASIO_HAS_TIMERFD)
-  bool check_timers = true;
+  bool check_timers = timer_shard;
 #endif // defined(BOOST_ASIO_HAS_TIMERFD)
 
   // Dispatch the waiting events.
@@ -410,9 +410,9 @@ void epoll_reactor::run(bool block, op_queue<operation>& ops)
 
 #if defined(BOOST_ASIO_HAS_TIMERFD)
       if (timer_fd_ == -1)
-        check_timers = true;
+        check_timers = timer_shard;
 #else // defined(BOOST_ASIO_HAS_TIMERFD)
-      check_timers = true;
+      check_timers = timer_shard;
 #endif // defined(BOOST_ASIO_HAS_TIMERFD)
     }
 #if defined(BOOST_ASIO_HAS_TIMERFD)
@@ -449,12 +449,38 @@ void epoll_reactor::run(bool block, op_queue<operation>& ops)
   }
 }
 
-void epoll_reactor::interrupt()
+void epoll_reactor::wait_any(const std::size_t* shards,
+    std::size_t num_shards)
+{
+  // An epoll descriptor is readable while it has events ready, so the shards
+  // can be waited on together using poll. A timeout is needed only if
+  // timerfd is not used, in which case timers are handled by the first shard.
+  std::vector<pollfd> fds(num_shards);
+  int timeout = -1;
+  for (std::size_t i = 0; i < num_shards; ++i)
+  {
+    fds[i].fd = epoll_fds_[shards[i]];
+    fds[i].events = POLLIN;
+    fds[i].revents = 0;
+    if (shards[i] == 0 && timer_fd_ == -1)
+    {
+      mutex::scoped_lock lock(mutex_);
+      timeout = get_timeout();
+    }
+  }
+
+  ::poll(&fds[0], static_cast<nfds_t>(num_shards), timeout);
+}
+
+void epoll_reactor::interrupt(std::size_t shard)
 {
+  // The interrupter is registered with every shard. Modifying its
+  // registration generates a new edge-triggered event for this shard only.
   epoll_event ev = { 0, { 0 } };
   ev.events = EPOLLIN | EPOLLERR | EPOLLET;
   ev.data.ptr = &interrupter_;
-  epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, interrupter_.read_descriptor(), &ev);
+  epoll_ctl(epoll_fds_[shard], EPOLL_CTL_MOD,
+      interrupter_.read_descriptor(), &ev);
 }
 
 int epoll_reactor::do_epoll_create()
@@ -483,6 +509,87 @@ int epoll_reactor::do_epoll_create()
   return fd;
 }
 
+struct epoll_reactor::create_shards_cleanup
+{
+  ~create_shards_cleanup()
+  {
+    // The destructor is not run if the constructor throws, so close the
+    // timer descriptor and any epoll descriptors created before the failure.
+    if (reactor_)
+    {
+      reactor_->close_shards();
+      if (reactor_->timer_fd_ != -1)
+        ::close(reactor_->timer_fd_);
+      reactor_->timer_fd_ = -1;
+    }
+  }
+
+  epoll_reactor* reactor_;
+};
+
+void epoll_reactor::create_shards()
+{
+  create_shards_cleanup on_exit = { this };
+
+  for (std::size_t i = 0; i < epoll_fds_.size(); ++i)
+  {
+    epoll_fds_[i] = do_epoll_create();
+
+    // Add the interrupter's descriptor to epoll.
+    epoll_event ev = { 0, { 0 } };
+    ev.events = EPOLLIN | EPOLLERR | EPOLLET;
+    ev.data.ptr = &interrupter_;
+    epoll_ctl(epoll_fds_[i], EPOLL_CTL_ADD,
+        interrupter_.read_descriptor(), &ev);
+  }
+
+  on_exit.reactor_ = 0;
+
+  interrupter_.interrupt();
+
+  // Add the timer descriptor to the epoll of every shard, so that expired
+  // timers are handled by whichever thread is woken. EPOLLEXCLUSIVE means
+  // that only one of the threads waiting in epoll_wait is woken. If it is
+  // not supported, the timer descriptor is added to the first shard only.
+  if (timer_fd_ != -1)
+  {
+    epoll_event ev = { 0, { 0 } };
+    ev.events = EPOLLIN | EPOLLERR;
+    ev.data.ptr = &timer_fd_;
+#if defined(EPOLLEXCLUSIVE)
+    if (epoll_fds_.size() > 1)
+    {
+      ev.events |= EPOLLEXCLUSIVE;
+      if (epoll_ctl(epoll_fds_[0], EPOLL_CTL_ADD, timer_fd_, &ev) == 0)
+      {
+        for (std::size_t i = 1; i < epoll_fds_.size(); ++i)
+          epoll_ctl(epoll_fds_[i], EPOLL_CTL_ADD, timer_fd_, &ev);
+        return;
+      }
+      ev.events &= ~EPOLLEXCLUSIVE;
+    }
+#endif // defined(EPOLLEXCLUSIVE)
+    epoll_ctl(epoll_fds_[0], EPOLL_CTL_ADD, timer_fd_, &ev);
+  }
+}
+
+void epoll_reactor::close_shards()
+{
+  for (std::size_t i = 0; i < epoll_fds_.size(); ++i)
+  {
+    if (epoll_fds_[i] != -1)
+      ::close(epoll_fds_[i]);
+    epoll_fds_[i] = -1;
+  }
+}
+
+std::size_t epoll_reactor::next_shard()
+{
+  if (epoll_fds_.size() == 1)
+    return 0;
+  return static_cast<std::size_t>(++next_shard_) % epoll_fds_.size();
+}
+
 int epoll_reactor::do_timerfd_create()
 {
 #if defined(BOOST_ASIO_HAS_TIMERFD)
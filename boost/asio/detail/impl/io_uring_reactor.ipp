@@ -0,0 +1,1105 @@
+//
+// detail/impl/io_uring_reactor.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IMPL_IO_URING_REACTOR_IPP
+#define BOOST_ASIO_DETAIL_IMPL_IO_URING_REACTOR_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+
+#include <cstddef>
+#include <cstring>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <boost/assert.hpp>
+#include <boost/asio/detail/io_uring_reactor.hpp>
+#include <boost/asio/detail/throw_error.hpp>
+#include <boost/asio/error.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+namespace io_uring_ops {
+
+// The completion queue entry's user data identifies what has completed.
+// Descriptor polls and operations carry the descriptor_state pointer with the
+// operation type in the low bits, and a flag to tell them apart. Requests
+// whose completion is of no interest carry zero.
+enum { op_type_mask = 3, io_request_flag = 4, user_data_mask = 7,
+  ignored_user_data = 0 };
+
+// Ready events are passed to perform_io() in the low bits, with a bit for each
+// operation type whose poll has completed above them, and a bit for each
+// operation type whose ring request has completed above those.
+enum { events_mask = 0xFFFF, completed_shift = 16, io_completed_shift = 19 };
+
+inline int setup(unsigned entries, io_uring_params* p)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, p));
+}
+
+inline int enter_nothrow(int fd, unsigned to_submit,
+    unsigned min_complete, unsigned flags)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_enter,
+        fd, to_submit, min_complete, flags, 0, 0));
+}
+
+// Returns false if the call was interrupted by a signal, or if the kernel
+// cannot take more requests until completions have been reaped. Any other
+// failure means that the ring can no longer be used, and is thrown.
+inline bool enter(int fd, unsigned to_submit,
+    unsigned min_complete, unsigned flags)
+{
+  if (enter_nothrow(fd, to_submit, min_complete, flags) >= 0)
+    return true;
+
+  int error = errno;
+  if (error == EINTR || error == EAGAIN || error == EBUSY)
+    return false;
+
+  boost::system::error_code ec(error,
+      boost::asio::error::get_system_category());
+  boost::asio::detail::throw_error(ec, "io_uring_enter");
+  return false;
+}
+
+inline boost::uint32_t poll_events(unsigned events)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  // The kernel reads the poll mask as two 16-bit halves.
+  return (events << 16) | (events >> 16);
+#else // defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return events;
+#endif // defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+}
+
+inline unsigned load_acquire(const unsigned* p)
+{
+  return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+inline void store_release(unsigned* p, unsigned v)
+{
+  __atomic_store_n(p, v, __ATOMIC_RELEASE);
+}
+
+} // namespace io_uring_ops
+
+io_uring_reactor::io_uring_reactor(boost::asio::io_service& io_service)
+  : boost::asio::detail::service_base<io_uring_reactor>(io_service),
+    io_service_(use_service<io_service_impl>(io_service)),
+    mutex_(),
+    interrupter_(),
+    ring_fd_(-1),
+    sq_ring_(0),
+    sq_ring_size_(0),
+    cq_ring_(0),
+    cq_ring_size_(0),
+    sqes_(0),
+    sqes_size_(0),
+    sq_local_tail_(0),
+    waiting_(false),
+    timeouts_outstanding_(0),
+    io_requests_outstanding_(0),
+    run_count_(0),
+    shutdown_(false)
+{
+  open_ring();
+
+  // Wait for the interrupter's descriptor to become readable.
+  mutex::scoped_lock lock(mutex_);
+  start_interrupter_poll(lock);
+}
+
+io_uring_reactor::~io_uring_reactor()
+{
+  close_ring();
+}
+
+void io_uring_reactor::shutdown_service()
+{
+  mutex::scoped_lock lock(mutex_);
+  shutdown_ = true;
+
+  // The kernel may still be using the buffers of operations that were
+  // submitted as ring requests, so the requests are cancelled and their
+  // completions awaited before any operation is destroyed.
+  for (descriptor_state* state = registered_descriptors_.first();
+      state != 0; state = state->next_)
+  {
+    for (int i = 0; i < max_ops; ++i)
+    {
+      if (state->io_pending_[i] && !state->io_cancelled_[i])
+      {
+        reserve_sqes(lock, 1);
+        io_uring_sqe* sqe = get_sqe();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<std::size_t>(state)
+          | io_uring_ops::io_request_flag | i;
+        sqe->user_data = io_uring_ops::ignored_user_data;
+        state->io_cancelled_[i] = true;
+      }
+    }
+  }
+  io_uring_ops::store_release(sq_tail_, sq_local_tail_);
+
+  for (std::size_t i = 0; i < reaped_cqes_.size(); ++i)
+    if (is_io_completion(reaped_cqes_[i]))
+      --io_requests_outstanding_;
+  reaped_cqes_.clear();
+
+  unsigned to_submit = sq_local_tail_ - io_uring_ops::load_acquire(sq_head_);
+  while (io_requests_outstanding_ > 0)
+  {
+    unsigned head = *cq_head_;
+    unsigned tail = io_uring_ops::load_acquire(cq_tail_);
+    for (; head != tail; ++head)
+      if (is_io_completion(cqes_[head & cq_mask_]))
+        --io_requests_outstanding_;
+    io_uring_ops::store_release(cq_head_, head);
+
+    // Closing the ring cancels whatever is left, so give up waiting if the
+    // kernel reports an error that reaping completions will not clear.
+    if (io_requests_outstanding_ > 0)
+    {
+      if (io_uring_ops::enter_nothrow(ring_fd_, to_submit,
+            1, IORING_ENTER_GETEVENTS) >= 0)
+        to_submit = 0;
+      else if (errno != EINTR && errno != EAGAIN && errno != EBUSY)
+        break;
+    }
+  }
+
+  lock.unlock();
+
+  close_ring();
+
+  op_queue<operation> ops;
+
+  while (descriptor_state* state = registered_descriptors_.first())
+  {
+    for (int i = 0; i < max_ops; ++i)
+      ops.push(state->op_queue_[i]);
+    state->shutdown_ = true;
+    registered_descriptors_.free(state);
+  }
+
+  timer_queues_.get_all_timers(ops);
+
+  io_service_.abandon_operations(ops);
+}
+
+void io_uring_reactor::fork_service(
+    boost::asio::io_service::fork_event fork_ev)
+{
+  if (fork_ev == boost::asio::io_service::fork_child)
+  {
+    // The rings are shared with the parent, so the child needs its own.
+    close_ring();
+    open_ring();
+
+    interrupter_.recreate();
+
+    mutex::scoped_lock lock(mutex_);
+    waiting_ = false;
+    reaped_cqes_.clear();
+    timeouts_outstanding_ = 0;
+    io_requests_outstanding_ = 0;
+    start_interrupter_poll(lock);
+    update_timeout(lock);
+    lock.unlock();
+
+    // Outstanding requests belonged to the parent's rings, so start them
+    // again.
+    mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+    for (descriptor_state* state = registered_descriptors_.first();
+        state != 0; state = state->next_)
+    {
+      mutex::scoped_lock descriptor_lock(state->mutex_);
+      for (int i = 0; i < max_ops; ++i)
+      {
+        state->poll_pending_[i] = false;
+        state->io_pending_[i] = false;
+        state->io_cancelled_[i] = false;
+        if (!state->shutdown_ && !state->op_queue_[i].empty())
+          if (!start_io(state, i))
+            start_poll(state, i);
+      }
+    }
+  }
+}
+
+void io_uring_reactor::init_task()
+{
+  io_service_.init_task();
+}
+
+int io_uring_reactor::register_descriptor(socket_type descriptor,
+    io_uring_reactor::per_descriptor_data& descriptor_data)
+{
+  descriptor_data = allocate_descriptor_state();
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  descriptor_data->reactor_ = this;
+  descriptor_data->descriptor_ = descriptor;
+  descriptor_data->shutdown_ = false;
+  for (int i = 0; i < max_ops; ++i)
+  {
+    descriptor_data->poll_pending_[i] = false;
+    descriptor_data->io_pending_[i] = false;
+    descriptor_data->io_cancelled_[i] = false;
+  }
+
+  return 0;
+}
+
+int io_uring_reactor::register_internal_descriptor(
+    int op_type, socket_type descriptor,
+    io_uring_reactor::per_descriptor_data& descriptor_data, reactor_op* op)
+{
+  descriptor_data = allocate_descriptor_state();
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  descriptor_data->reactor_ = this;
+  descriptor_data->descriptor_ = descriptor;
+  descriptor_data->shutdown_ = false;
+  for (int i = 0; i < max_ops; ++i)
+  {
+    descriptor_data->poll_pending_[i] = false;
+    descriptor_data->io_pending_[i] = false;
+    descriptor_data->io_cancelled_[i] = false;
+  }
+  descriptor_data->op_queue_[op_type].push(op);
+  start_poll(descriptor_data, op_type);
+
+  return 0;
+}
+
+void io_uring_reactor::move_descriptor(socket_type,
+    io_uring_reactor::per_descriptor_data& target_descriptor_data,
+    io_uring_reactor::per_descriptor_data& source_descriptor_data)
+{
+  target_descriptor_data = source_descriptor_data;
+  source_descriptor_data = 0;
+}
+
+void io_uring_reactor::start_op(int op_type, socket_type,
+    io_uring_reactor::per_descriptor_data& descriptor_data,
+    reactor_op* op, bool allow_speculative)
+{
+  if (!descriptor_data)
+  {
+    op->ec_ = boost::asio::error::bad_descriptor;
+    post_immediate_completion(op);
+    return;
+  }
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  if (descriptor_data->shutdown_)
+  {
+    post_immediate_completion(op);
+    return;
+  }
+
+  if (descriptor_data->op_queue_[op_type].empty())
+  {
+    if (allow_speculative
+        && (op_type != read_op
+          || descriptor_data->op_queue_[except_op].empty()))
+    {
+      if (op->perform())
+      {
+        descriptor_lock.unlock();
+        io_service_.post_immediate_completion(op);
+        return;
+      }
+    }
+
+    descriptor_data->op_queue_[op_type].push(op);
+    io_service_.work_started();
+
+    if (!descriptor_data->poll_pending_[op_type])
+      if (!start_io(descriptor_data, op_type))
+        start_poll(descriptor_data, op_type);
+    return;
+  }
+
+  descriptor_data->op_queue_[op_type].push(op);
+  io_service_.work_started();
+}
+
+void io_uring_reactor::cancel_ops(socket_type,
+    io_uring_reactor::per_descriptor_data& descriptor_data)
+{
+  if (!descriptor_data)
+    return;
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  op_queue<operation> ops;
+  cancel_queued_ops(descriptor_data, ops);
+
+  descriptor_lock.unlock();
+
+  io_service_.post_deferred_completions(ops);
+}
+
+void io_uring_reactor::deregister_descriptor(socket_type,
+    io_uring_reactor::per_descriptor_data& descriptor_data, bool)
+{
+  if (!descriptor_data)
+    return;
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  if (!descriptor_data->shutdown_)
+  {
+    // Unlike epoll, closing the descriptor does not remove an outstanding
+    // request, so the requests are always cancelled explicitly. The state
+    // object cannot be reused until the kernel has finished with it.
+    cancel_polls(descriptor_data);
+
+    op_queue<operation> ops;
+    cancel_queued_ops(descriptor_data, ops);
+
+    bool requests_pending = false;
+    for (int i = 0; i < max_ops; ++i)
+      requests_pending = requests_pending
+        || descriptor_data->poll_pending_[i]
+        || descriptor_data->io_pending_[i];
+
+    descriptor_data->descriptor_ = -1;
+    descriptor_data->shutdown_ = true;
+
+    descriptor_lock.unlock();
+
+    if (!requests_pending)
+      free_descriptor_state(descriptor_data);
+    descriptor_data = 0;
+
+    io_service_.post_deferred_completions(ops);
+  }
+}
+
+void io_uring_reactor::deregister_internal_descriptor(socket_type,
+    io_uring_reactor::per_descriptor_data& descriptor_data)
+{
+  if (!descriptor_data)
+    return;
+
+  mutex::scoped_lock descriptor_lock(descriptor_data->mutex_);
+
+  if (!descriptor_data->shutdown_)
+  {
+    cancel_polls(descriptor_data);
+
+    op_queue<operation> ops;
+    for (int i = 0; i < max_ops; ++i)
+      ops.push(descriptor_data->op_queue_[i]);
+
+    bool polls_pending = false;
+    for (int i = 0; i < max_ops; ++i)
+      polls_pending = polls_pending || descriptor_data->poll_pending_[i];
+
+    descriptor_data->descriptor_ = -1;
+    descriptor_data->shutdown_ = true;
+
+    descriptor_lock.unlock();
+
+    if (!polls_pending)
+      free_descriptor_state(descriptor_data);
+    descriptor_data = 0;
+  }
+}
+
+void io_uring_reactor::run(bool block, op_queue<operation>& ops,
+    std::size_t)
+{
+  // This code relies on the fact that the task_io_service queues the reactor
+  // task behind all descriptor operations generated by this function. This
+  // means, that by the time we reach this point, any previously returned
+  // descriptor operations have already been dequeued. Therefore it is now safe
+  // for us to reuse and return them for the task_io_service to queue again.
+  ++run_count_;
+
+  // Hand over everything queued since the last call, and wait for at least
+  // one completion if blocking, using a single system call. Completions that
+  // have already been reaped are dispatched without waiting.
+  mutex::scoped_lock lock(mutex_);
+  unsigned to_submit = sq_local_tail_ - io_uring_ops::load_acquire(sq_head_);
+  if (!reaped_cqes_.empty())
+    block = false;
+  waiting_ = block;
+  lock.unlock();
+
+  if (to_submit > 0 || block)
+  {
+    io_uring_ops::enter(ring_fd_, to_submit,
+        block ? 1 : 0, block ? IORING_ENTER_GETEVENTS : 0);
+  }
+
+  bool check_timers = false;
+  bool check_interrupter = false;
+
+  // Dispatch the completed requests. The completion queue is also read by
+  // threads waiting for space in the submission queue, so the mutex is held.
+  lock.lock();
+  waiting_ = false;
+
+  for (std::size_t i = 0; i < reaped_cqes_.size(); ++i)
+    dispatch_cqe(reaped_cqes_[i], ops, check_timers, check_interrupter);
+  reaped_cqes_.clear();
+
+  unsigned head = *cq_head_;
+  unsigned tail = io_uring_ops::load_acquire(cq_tail_);
+  for (; head != tail; ++head)
+    dispatch_cqe(cqes_[head & cq_mask_], ops, check_timers, check_interrupter);
+  io_uring_ops::store_release(cq_head_, head);
+
+  if (check_interrupter)
+  {
+    interrupter_.reset();
+    start_interrupter_poll(lock);
+  }
+
+  if (check_timers)
+  {
+    timer_queues_.get_ready_timers(ops);
+    if (!timer_queues_.all_empty())
+      update_timeout(lock);
+  }
+}
+
+void io_uring_reactor::dispatch_cqe(const io_uring_cqe& cqe,
+    op_queue<operation>& ops, bool& check_timers, bool& check_interrupter)
+{
+  boost::uint64_t user_data = cqe.user_data;
+  void* ptr = reinterpret_cast<void*>(static_cast<std::size_t>(user_data));
+
+  if (user_data == io_uring_ops::ignored_user_data)
+  {
+    // Nothing to do for cancellation requests.
+  }
+  else if (ptr == &interrupter_)
+  {
+    check_interrupter = true;
+  }
+  else if (ptr == &timeout_)
+  {
+    // A timeout that was replaced by a later request completes with
+    // ECANCELED and can be ignored.
+    --timeouts_outstanding_;
+    if (cqe.res != -ECANCELED)
+      check_timers = true;
+  }
+  else
+  {
+    // The descriptor operation doesn't count as work in and of itself, so we
+    // don't call work_started() here. This still allows the io_service to
+    // stop if the only remaining operations are descriptor operations.
+    int op_type = static_cast<int>(user_data & io_uring_ops::op_type_mask);
+    descriptor_state* descriptor_data = reinterpret_cast<descriptor_state*>(
+        static_cast<std::size_t>(user_data & ~boost::uint64_t(
+            io_uring_ops::user_data_mask)));
+
+    unsigned int events;
+    if (user_data & io_uring_ops::io_request_flag)
+    {
+      // Only one request per operation type is outstanding, so the result
+      // can be held until perform_io() runs.
+      --io_requests_outstanding_;
+      descriptor_data->io_result_[op_type] = cqe.res;
+      events = 1u << (io_uring_ops::io_completed_shift + op_type);
+    }
+    else
+    {
+      events = (cqe.res < 0)
+        ? static_cast<unsigned int>(POLLERR)
+        : (static_cast<unsigned int>(cqe.res) & io_uring_ops::events_mask);
+      events |= 1u << (io_uring_ops::completed_shift + op_type);
+    }
+
+    // Requests for different operation types may complete together, but the
+    // descriptor can be queued only once.
+    if (descriptor_data->run_count_ != run_count_)
+    {
+      descriptor_data->run_count_ = run_count_;
+      descriptor_data->task_result_ = events;
+      ops.push(descriptor_data);
+    }
+    else
+      descriptor_data->task_result_ |= events;
+  }
+}
+
+void io_uring_reactor::interrupt(std::size_t)
+{
+  interrupter_.interrupt();
+}
+
+void io_uring_reactor::open_ring()
+{
+  io_uring_params params;
+  std::memset(&params, 0, sizeof(params));
+  ring_fd_ = io_uring_ops::setup(ring_size, &params);
+  if (ring_fd_ == -1)
+  {
+    boost::system::error_code ec(errno,
+        boost::asio::error::get_system_category());
+    boost::asio::detail::throw_error(ec, "io_uring");
+  }
+
+  // Completions must not be dropped, as each one is the only notification
+  // for an outstanding poll.
+  if ((params.features & IORING_FEAT_NODROP) == 0)
+  {
+    close_ring();
+    boost::system::error_code ec(ENOSYS,
+        boost::asio::error::get_system_category());
+    boost::asio::detail::throw_error(ec, "io_uring");
+  }
+
+  sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  cq_ring_size_ = params.cq_off.cqes
+    + params.cq_entries * sizeof(io_uring_cqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP)
+  {
+    if (cq_ring_size_ > sq_ring_size_)
+      sq_ring_size_ = cq_ring_size_;
+    cq_ring_size_ = 0;
+  }
+
+  sq_ring_ = ::mmap(0, sq_ring_size_, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+  if (sq_ring_ == MAP_FAILED)
+    sq_ring_ = 0;
+
+  if (sq_ring_ && cq_ring_size_ > 0)
+  {
+    cq_ring_ = ::mmap(0, cq_ring_size_, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+    if (cq_ring_ == MAP_FAILED)
+      cq_ring_ = 0;
+  }
+  else
+    cq_ring_ = sq_ring_;
+
+  sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+  if (cq_ring_)
+  {
+    sqes_ = static_cast<io_uring_sqe*>(::mmap(0, sqes_size_,
+          PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+          ring_fd_, IORING_OFF_SQES));
+    if (sqes_ == MAP_FAILED)
+      sqes_ = 0;
+  }
+
+  if (!sqes_)
+  {
+    boost::system::error_code ec(errno,
+        boost::asio::error::get_system_category());
+    close_ring();
+    boost::asio::detail::throw_error(ec, "io_uring");
+  }
+
+  char* sq = static_cast<char*>(sq_ring_);
+  sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  sq_entries_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_entries);
+  sq_local_tail_ = *sq_tail_;
+
+  // Submission queue entries are always used in order, so the indirection
+  // array is set up once.
+  unsigned* sq_array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  for (unsigned i = 0; i < sq_entries_; ++i)
+    sq_array[i] = i;
+
+  char* cq = static_cast<char*>(cq_ring_);
+  cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+}
+
+void io_uring_reactor::close_ring()
+{
+  if (sqes_)
+    ::munmap(sqes_, sqes_size_);
+  sqes_ = 0;
+  if (cq_ring_ && cq_ring_ != sq_ring_)
+    ::munmap(cq_ring_, cq_ring_size_);
+  cq_ring_ = 0;
+  if (sq_ring_)
+    ::munmap(sq_ring_, sq_ring_size_);
+  sq_ring_ = 0;
+  if (ring_fd_ != -1)
+    ::close(ring_fd_);
+  ring_fd_ = -1;
+}
+
+void io_uring_reactor::reserve_sqes(mutex::scoped_lock& lock, unsigned n)
+{
+  while (sq_local_tail_ - io_uring_ops::load_acquire(sq_head_)
+      > sq_entries_ - n)
+  {
+    commit_sqes(true);
+    if (sq_local_tail_ - io_uring_ops::load_acquire(sq_head_)
+        > sq_entries_ - n)
+      wait_for_sqes(lock);
+  }
+}
+
+io_uring_sqe* io_uring_reactor::get_sqe()
+{
+  BOOST_ASSERT(sq_local_tail_ - io_uring_ops::load_acquire(sq_head_)
+      < sq_entries_);
+
+  io_uring_sqe* sqe = &sqes_[sq_local_tail_ & sq_mask_];
+  std::memset(sqe, 0, sizeof(*sqe));
+  ++sq_local_tail_;
+  return sqe;
+}
+
+void io_uring_reactor::wait_for_sqes(mutex::scoped_lock& lock)
+{
+  // The kernel is unable to accept more requests until completions have been
+  // reaped. Move them out of the completion queue for the next call to run().
+  unsigned head = *cq_head_;
+  unsigned tail = io_uring_ops::load_acquire(cq_tail_);
+  if (head != tail)
+  {
+    for (; head != tail; ++head)
+      reaped_cqes_.push_back(cqes_[head & cq_mask_]);
+    io_uring_ops::store_release(cq_head_, head);
+
+    // A thread blocked in run() waits for the completion queue, which is now
+    // empty, so wake it to dispatch the reaped completions.
+    if (waiting_)
+      interrupter_.interrupt();
+
+    submit_sqes();
+  }
+  else
+  {
+    // Nothing to reap, so wait for a completion. This blocks rather than
+    // returning immediately, as the completion queue is empty. Other threads
+    // may queue requests and dispatch completions in the meantime.
+    lock.unlock();
+    io_uring_ops::enter(ring_fd_, 0, 1, IORING_ENTER_GETEVENTS);
+    lock.lock();
+  }
+}
+
+void io_uring_reactor::commit_sqes(bool force)
+{
+  io_uring_ops::store_release(sq_tail_, sq_local_tail_);
+  if (force || waiting_)
+    submit_sqes();
+}
+
+void io_uring_reactor::submit_sqes()
+{
+  unsigned to_submit = sq_local_tail_ - io_uring_ops::load_acquire(sq_head_);
+  if (to_submit > 0)
+    if (!io_uring_ops::enter(ring_fd_, to_submit, 0, 0) && waiting_)
+      interrupter_.interrupt();
+}
+
+bool io_uring_reactor::is_io_completion(const io_uring_cqe& cqe)
+{
+  void* ptr = reinterpret_cast<void*>(static_cast<std::size_t>(cqe.user_data));
+  return cqe.user_data != io_uring_ops::ignored_user_data
+    && ptr != &interrupter_ && ptr != &timeout_
+    && (cqe.user_data & io_uring_ops::io_request_flag) != 0;
+}
+
+void io_uring_reactor::start_poll(descriptor_state* s, int op_type)
+{
+  static const unsigned flag[max_ops] = { POLLIN, POLLOUT, POLLPRI };
+
+  BOOST_ASSERT((reinterpret_cast<std::size_t>(s)
+        & io_uring_ops::user_data_mask) == 0);
+
+  mutex::scoped_lock lock(mutex_);
+  reserve_sqes(lock, 1);
+  io_uring_sqe* sqe = get_sqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = s->descriptor_;
+  sqe->poll32_events = io_uring_ops::poll_events(
+      flag[op_type] | POLLERR | POLLHUP);
+  sqe->user_data = reinterpret_cast<std::size_t>(s) | op_type;
+  commit_sqes(false);
+
+  s->poll_pending_[op_type] = true;
+}
+
+void io_uring_reactor::cancel_polls(descriptor_state* s)
+{
+  unsigned n = 0;
+  for (int i = 0; i < max_ops; ++i)
+    if (s->poll_pending_[i])
+      ++n;
+  if (n == 0)
+    return;
+
+  mutex::scoped_lock lock(mutex_);
+  reserve_sqes(lock, n);
+  for (int i = 0; i < max_ops; ++i)
+  {
+    if (s->poll_pending_[i])
+    {
+      io_uring_sqe* sqe = get_sqe();
+      sqe->opcode = IORING_OP_POLL_REMOVE;
+      sqe->fd = -1;
+      sqe->addr = reinterpret_cast<std::size_t>(s) | i;
+      sqe->user_data = io_uring_ops::ignored_user_data;
+    }
+  }
+
+  // The outstanding poll keeps the file open, so the cancellation must reach
+  // the kernel promptly for a close to take effect.
+  commit_sqes(true);
+}
+
+bool io_uring_reactor::start_io(descriptor_state* s, int op_type)
+{
+  // Exception operations are only ever waited for, and out-of-band data must
+  // be read before normal data.
+  if (op_type == except_op
+      || (op_type == read_op && !s->op_queue_[except_op].empty()))
+    return false;
+
+  // The entry is prepared before the mutex is acquired, to keep the time spent
+  // holding it short.
+  io_uring_sqe prepared;
+  std::memset(&prepared, 0, sizeof(prepared));
+  if (!s->op_queue_[op_type].front()->prepare(&prepared))
+    return false;
+
+  mutex::scoped_lock lock(mutex_);
+  reserve_sqes(lock, 1);
+  io_uring_sqe* sqe = get_sqe();
+  *sqe = prepared;
+  sqe->user_data = reinterpret_cast<std::size_t>(s)
+    | io_uring_ops::io_request_flag | op_type;
+  ++io_requests_outstanding_;
+  commit_sqes(false);
+
+  s->io_pending_[op_type] = true;
+  s->io_cancelled_[op_type] = false;
+  return true;
+}
+
+void io_uring_reactor::cancel_queued_ops(descriptor_state* s,
+    op_queue<operation>& ops)
+{
+  bool cancelled = false;
+  for (int i = 0; i < max_ops; ++i)
+  {
+    // The kernel still owns the buffers of a submitted operation, so it is
+    // kept at the front of the queue until its cancellation completes.
+    reactor_op* submitted_op = 0;
+    if (s->io_pending_[i])
+    {
+      submitted_op = s->op_queue_[i].front();
+      s->op_queue_[i].pop();
+    }
+
+    while (reactor_op* op = s->op_queue_[i].front())
+    {
+      op->ec_ = boost::asio::error::operation_aborted;
+      s->op_queue_[i].pop();
+      ops.push(op);
+    }
+
+    if (submitted_op)
+    {
+      s->op_queue_[i].push(submitted_op);
+      if (!s->io_cancelled_[i])
+      {
+        mutex::scoped_lock lock(mutex_);
+        reserve_sqes(lock, 1);
+        io_uring_sqe* sqe = get_sqe();
+        sqe->opcode = IORING_OP_ASYNC_CANCEL;
+        sqe->fd = -1;
+        sqe->addr = reinterpret_cast<std::size_t>(s)
+          | io_uring_ops::io_request_flag | i;
+        sqe->user_data = io_uring_ops::ignored_user_data;
+        s->io_cancelled_[i] = true;
+        cancelled = true;
+      }
+    }
+  }
+
+  // As with polls, the cancellation must reach the kernel promptly.
+  if (cancelled)
+  {
+    mutex::scoped_lock lock(mutex_);
+    commit_sqes(true);
+  }
+}
+
+void io_uring_reactor::start_interrupter_poll(mutex::scoped_lock& lock)
+{
+  reserve_sqes(lock, 1);
+  io_uring_sqe* sqe = get_sqe();
+  sqe->opcode = IORING_OP_POLL_ADD;
+  sqe->fd = interrupter_.read_descriptor();
+  sqe->poll32_events = io_uring_ops::poll_events(POLLIN | POLLERR);
+  sqe->user_data = reinterpret_cast<std::size_t>(&interrupter_);
+  commit_sqes(false);
+}
+
+io_uring_reactor::descriptor_state*
+io_uring_reactor::allocate_descriptor_state()
+{
+  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+  return registered_descriptors_.alloc();
+}
+
+void io_uring_reactor::free_descriptor_state(
+    io_uring_reactor::descriptor_state* s)
+{
+  mutex::scoped_lock descriptors_lock(registered_descriptors_mutex_);
+  registered_descriptors_.free(s);
+}
+
+void io_uring_reactor::do_add_timer_queue(timer_queue_base& queue)
+{
+  mutex::scoped_lock lock(mutex_);
+  timer_queues_.insert(&queue);
+}
+
+void io_uring_reactor::do_remove_timer_queue(timer_queue_base& queue)
+{
+  mutex::scoped_lock lock(mutex_);
+  timer_queues_.erase(&queue);
+}
+
+void io_uring_reactor::update_timeout(mutex::scoped_lock& lock)
+{
+  // By default we will wait no longer than 5 minutes. This will ensure that
+  // any changes to the system clock are detected after no longer than this.
+  long usec = timer_queues_.wait_duration_usec(5 * 60 * 1000 * 1000);
+
+  timespec now;
+  ::clock_gettime(CLOCK_MONOTONIC, &now);
+  long long nsec = now.tv_nsec + usec * 1000LL;
+  timeout_.tv_sec = now.tv_sec + nsec / 1000000000LL;
+  timeout_.tv_nsec = nsec % 1000000000LL;
+
+  // Replace the outstanding timeout, if any. The kernel processes the two
+  // requests in order. Room for both is reserved first, as the mutex may be
+  // released while waiting for it. A timeout that has expired, but whose
+  // completion has not yet been dispatched, is not found by the removal,
+  // which is harmless.
+  reserve_sqes(lock, 2);
+  if (timeouts_outstanding_ > 0)
+  {
+    io_uring_sqe* sqe = get_sqe();
+    sqe->opcode = IORING_OP_TIMEOUT_REMOVE;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<std::size_t>(&timeout_);
+    sqe->user_data = io_uring_ops::ignored_user_data;
+  }
+
+  io_uring_sqe* sqe = get_sqe();
+  sqe->opcode = IORING_OP_TIMEOUT;
+  sqe->fd = -1;
+  sqe->addr = reinterpret_cast<std::size_t>(&timeout_);
+  sqe->len = 1;
+  sqe->timeout_flags = IORING_TIMEOUT_ABS;
+  sqe->user_data = reinterpret_cast<std::size_t>(&timeout_);
+  ++timeouts_outstanding_;
+
+  commit_sqes(false);
+}
+
+struct io_uring_reactor::perform_io_cleanup_on_block_exit
+{
+  explicit perform_io_cleanup_on_block_exit(io_uring_reactor* r)
+    : reactor_(r), first_op_(0)
+  {
+  }
+
+  ~perform_io_cleanup_on_block_exit()
+  {
+    if (first_op_)
+    {
+      // Post the remaining completed operations for invocation.
+      if (!ops_.empty())
+        reactor_->io_service_.post_deferred_completions(ops_);
+
+      // A user-initiated operation has completed, but there's no need to
+      // explicitly call work_finished() here. Instead, we'll take advantage of
+      // the fact that the task_io_service will call work_finished() once we
+      // return.
+    }
+    else
+    {
+      // No user-initiated operations have completed, so we need to compensate
+      // for the work_finished() call that the task_io_service will make once
+      // this operation returns.
+      reactor_->io_service_.work_started();
+    }
+  }
+
+  io_uring_reactor* reactor_;
+  op_queue<operation> ops_;
+  operation* first_op_;
+};
+
+io_uring_reactor::descriptor_state::descriptor_state()
+  : operation(&io_uring_reactor::descriptor_state::do_complete),
+    run_count_(0)
+{
+}
+
+operation* io_uring_reactor::descriptor_state::perform_io(uint32_t events)
+{
+  perform_io_cleanup_on_block_exit io_cleanup(reactor_);
+  mutex::scoped_lock descriptor_lock(mutex_);
+
+  // Complete the operations whose ring requests have finished. Each request
+  // was made for the operation at the front of its queue.
+  bool must_poll[max_ops] = { false, false, false };
+  for (int j = 0; j < max_ops; ++j)
+  {
+    if (events & (1u << (io_uring_ops::completed_shift + j)))
+      poll_pending_[j] = false;
+
+    if (events & (1u << (io_uring_ops::io_completed_shift + j)))
+    {
+      bool cancelled = io_cancelled_[j];
+      io_pending_[j] = false;
+      io_cancelled_[j] = false;
+
+      if (reactor_op* op = op_queue_[j].front())
+      {
+        int result = io_result_[j];
+        if (result == -ECANCELED || (cancelled && result < 0))
+        {
+          op->ec_ = boost::asio::error::operation_aborted;
+          op_queue_[j].pop();
+          io_cleanup.ops_.push(op);
+        }
+        else if (op->finish(result))
+        {
+          op_queue_[j].pop();
+          io_cleanup.ops_.push(op);
+        }
+        else
+          must_poll[j] = true;
+      }
+    }
+  }
+
+  // A deregistered descriptor is freed once the last of its requests is done.
+  if (shutdown_)
+  {
+    bool requests_pending = false;
+    for (int j = 0; j < max_ops; ++j)
+    {
+      requests_pending = requests_pending || poll_pending_[j] || io_pending_[j];
+      if (!io_pending_[j])
+      {
+        while (reactor_op* op = op_queue_[j].front())
+        {
+          op->ec_ = boost::asio::error::operation_aborted;
+          op_queue_[j].pop();
+          io_cleanup.ops_.push(op);
+        }
+      }
+    }
+
+    descriptor_lock.unlock();
+    if (!requests_pending)
+      reactor_->free_descriptor_state(this);
+
+    io_cleanup.first_op_ = io_cleanup.ops_.front();
+    io_cleanup.ops_.pop();
+    return io_cleanup.first_op_;
+  }
+
+  // Exception operations must be processed first to ensure that any
+  // out-of-band data is read before normal data.
+  static const int flag[max_ops] = { POLLIN, POLLOUT, POLLPRI };
+  for (int j = max_ops - 1; j >= 0; --j)
+  {
+    if (!io_pending_[j] && (events & (flag[j] | POLLERR | POLLHUP)))
+    {
+      while (reactor_op* op = op_queue_[j].front())
+      {
+        if (op->perform())
+        {
+          op_queue_[j].pop();
+          io_cleanup.ops_.push(op);
+        }
+        else
+          break;
+      }
+    }
+  }
+
+  // Requests are one-shot, so start another for any operations that remain.
+  // An operation whose request could not complete it waits for readiness.
+  for (int j = 0; j < max_ops; ++j)
+  {
+    if (!op_queue_[j].empty() && !io_pending_[j] && !poll_pending_[j])
+      if (must_poll[j] || !reactor_->start_io(this, j))
+        reactor_->start_poll(this, j);
+  }
+
+  // The first operation will be returned for completion now. The others will
+  // be posted for later by the io_cleanup object's destructor.
+  io_cleanup.first_op_ = io_cleanup.ops_.front();
+  io_cleanup.ops_.pop();
+  return io_cleanup.first_op_;
+}
+
+void io_uring_reactor::descriptor_state::do_complete(
+    io_service_impl* owner, operation* base,
+    const boost::system::error_code& ec, std::size_t bytes_transferred)
+{
+  if (owner)
+  {
+    descriptor_state* descriptor_data = static_cast<descriptor_state*>(base);
+    uint32_t events = static_cast<uint32_t>(bytes_transferred);
+    if (operation* op = descriptor_data->perform_io(events))
+    {
+      op->complete(*owner, ec, 0);
+    }
+  }
+}
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
+#endif // BOOST_ASIO_DETAIL_IMPL_IO_URING_REACTOR_IPP
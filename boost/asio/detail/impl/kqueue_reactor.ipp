@@ -350,7 +350,8 @@ void kqueue_reactor::deregister_internal_descriptor(socket_type descriptor,
   }
 }
 
-void kqueue_reactor::run(bool block, op_queue<operation>& ops)
+void kqueue_reactor::run(bool block, op_queue<operation>& ops,
+    std::size_t)
 {
   mutex::scoped_lock lock(mutex_);
 
@@ -460,7 +461,7 @@ void kqueue_reactor::run(bool block, op_queue<operation>& ops)
   timer_queues_.get_ready_timers(ops);
 }
 
-void kqueue_reactor::interrupt()
+void kqueue_reactor::interrupt(std::size_t)
 {
   struct kevent event;
   BOOST_ASIO_KQUEUE_EV_SET(&event, interrupter_.read_descriptor(),
@@ -0,0 +1,121 @@
+//
+// detail/impl/pooled_strand_service.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_HPP
+#define BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/call_stack.hpp>
+#include <boost/asio/detail/completion_handler.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/handler_alloc_helpers.hpp>
+#include <boost/asio/detail/handler_invoke_helpers.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+inline pooled_strand_service::strand_impl::strand_impl()
+  : operation(&pooled_strand_service::do_complete),
+    next_(0),
+    prev_(0),
+    service_(0),
+    ref_count_(0),
+#if defined(BOOST_ASIO_HAS_STD_ATOMIC)
+    incoming_(0)
+#else // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+    locked_(false)
+#endif // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+{
+}
+
+struct pooled_strand_service::on_dispatch_exit
+{
+  io_service_impl* io_service_;
+  strand_impl* impl_;
+
+  ~on_dispatch_exit()
+  {
+    if (impl_->release())
+      io_service_->post_immediate_completion(impl_);
+    else
+      pooled_strand_service::release(impl_);
+  }
+};
+
+template <typename Handler>
+void pooled_strand_service::dispatch(
+    pooled_strand_service::implementation_type& impl, Handler handler)
+{
+  // If we are already in the strand then the handler can run immediately.
+  if (call_stack<strand_impl>::contains(impl.get()))
+  {
+    fenced_block b(fenced_block::full);
+    boost_asio_handler_invoke_helpers::invoke(handler, handler);
+    return;
+  }
+
+  // Allocate and construct an operation to wrap the handler.
+  typedef completion_handler<Handler> op;
+  typename op::ptr p = { boost::addressof(handler),
+    boost_asio_handler_alloc_helpers::allocate(
+      sizeof(op), handler), 0 };
+  p.p = new (p.v) op(handler);
+
+  BOOST_ASIO_HANDLER_CREATION((p.p, "strand", impl.get(), "dispatch"));
+
+  bool dispatch_immediately = do_dispatch(impl.get(), p.p);
+  operation* o = p.p;
+  p.v = p.p = 0;
+
+  if (dispatch_immediately)
+  {
+    // Indicate that this strand is executing on the current thread.
+    call_stack<strand_impl>::context ctx(impl.get());
+
+    // Ensure the next handler, if any, is scheduled on block exit.
+    on_dispatch_exit on_exit = { &io_service_, impl.get() };
+    (void)on_exit;
+
+    completion_handler<Handler>::do_complete(
+        &io_service_, o, boost::system::error_code(), 0);
+  }
+}
+
+// Request the io_service to invoke the given handler and return immediately.
+template <typename Handler>
+void pooled_strand_service::post(
+    pooled_strand_service::implementation_type& impl, Handler handler)
+{
+  // Allocate and construct an operation to wrap the handler.
+  typedef completion_handler<Handler> op;
+  typename op::ptr p = { boost::addressof(handler),
+    boost_asio_handler_alloc_helpers::allocate(
+      sizeof(op), handler), 0 };
+  p.p = new (p.v) op(handler);
+
+  BOOST_ASIO_HANDLER_CREATION((p.p, "strand", impl.get(), "post"));
+
+  do_post(impl.get(), p.p);
+  p.v = p.p = 0;
+}
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_HPP
@@ -0,0 +1,297 @@
+//
+// detail/impl/pooled_strand_service.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_IPP
+#define BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <boost/asio/detail/call_stack.hpp>
+#include <boost/asio/detail/pooled_strand_service.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+struct pooled_strand_service::on_do_complete_exit
+{
+  io_service_impl* owner_;
+  strand_impl* impl_;
+
+  ~on_do_complete_exit()
+  {
+    if (impl_->release())
+      owner_->post_private_immediate_completion(impl_);
+    else
+      pooled_strand_service::release(impl_);
+  }
+};
+
+pooled_strand_service::pooled_strand_service(
+    boost::asio::io_service& io_service)
+  : boost::asio::detail::service_base<pooled_strand_service>(io_service),
+    io_service_(boost::asio::use_service<io_service_impl>(io_service)),
+    mutex_(),
+    implementations_()
+{
+}
+
+pooled_strand_service::~pooled_strand_service()
+{
+  // Implementations that are still referenced by strand objects are handed
+  // over to those objects, and are deleted when the last reference goes.
+  strand_impl* impl = implementations_.first();
+  while (impl)
+  {
+    strand_impl* next_impl = impl->next_;
+    if (impl->ref_count_ != 0)
+    {
+      impl->service_ = 0;
+      implementations_.detach(impl);
+    }
+    impl = next_impl;
+  }
+}
+
+void pooled_strand_service::shutdown_service()
+{
+  op_queue<operation> ops;
+
+  boost::asio::detail::mutex::scoped_lock lock(mutex_);
+
+  strand_impl* impl = implementations_.first();
+  while (impl)
+  {
+    strand_impl* next_impl = impl->next_;
+    if (impl->abandon(ops))
+    {
+      // Drop the reference held on behalf of the strand lock.
+      if (--impl->ref_count_ == 0)
+        implementations_.free(impl);
+    }
+    impl = next_impl;
+  }
+}
+
+void pooled_strand_service::construct(
+    pooled_strand_service::implementation_type& impl)
+{
+  boost::asio::detail::mutex::scoped_lock lock(mutex_);
+  strand_impl* new_impl = implementations_.alloc();
+  lock.unlock();
+
+  new_impl->service_ = this;
+  ++new_impl->ref_count_;
+
+  pooled_strand_service::release(impl.impl_);
+  impl.impl_ = new_impl;
+}
+
+bool pooled_strand_service::do_dispatch(strand_impl* impl, operation* op)
+{
+  // If we are running inside the io_service, and no other handler already
+  // holds the strand lock, then the handler can run immediately.
+  bool can_dispatch = io_service_.can_dispatch();
+  if (!impl->enqueue(op))
+    return false;
+
+  // The handler has acquired the strand lock.
+  add_ref(impl);
+  if (can_dispatch)
+    return true;
+
+  impl->ready_queue_.push(op);
+  io_service_.post_immediate_completion(impl);
+  return false;
+}
+
+void pooled_strand_service::do_post(strand_impl* impl, operation* op)
+{
+  if (impl->enqueue(op))
+  {
+    // The handler is acquiring the strand lock and so is responsible for
+    // scheduling the strand.
+    add_ref(impl);
+    impl->ready_queue_.push(op);
+    io_service_.post_immediate_completion(impl);
+  }
+}
+
+void pooled_strand_service::do_complete(io_service_impl* owner,
+    operation* base, const boost::system::error_code& ec,
+    std::size_t /*bytes_transferred*/)
+{
+  if (owner)
+  {
+    strand_impl* impl = static_cast<strand_impl*>(base);
+
+    // Indicate that this strand is executing on the current thread.
+    call_stack<strand_impl>::context ctx(impl);
+
+    // Ensure the next handler, if any, is scheduled on block exit.
+    on_do_complete_exit on_exit = { owner, impl };
+
+    // Run all ready handlers. No lock is required since the ready queue is
+    // accessed only within the strand.
+    while (operation* o = impl->ready_queue_.front())
+    {
+      impl->ready_queue_.pop();
+      o->complete(*owner, ec, 0);
+    }
+  }
+}
+
+void pooled_strand_service::release(strand_impl* impl)
+{
+  if (impl && --impl->ref_count_ == 0)
+  {
+    if (pooled_strand_service* service = impl->service_)
+    {
+      boost::asio::detail::mutex::scoped_lock lock(service->mutex_);
+      service->implementations_.free(impl);
+    }
+    else
+    {
+      delete impl;
+    }
+  }
+}
+
+#if defined(BOOST_ASIO_HAS_STD_ATOMIC)
+
+bool pooled_strand_service::strand_impl::enqueue(operation* op)
+{
+  // The strand itself marks the incoming stack as locked and empty.
+  operation* const locked = this;
+  operation* head = incoming_.load(std::memory_order_relaxed);
+  for (;;)
+  {
+    // The first handler to arrive while the strand is unlocked acquires it.
+    if (head == 0)
+    {
+      if (incoming_.compare_exchange_weak(head, locked,
+            std::memory_order_acq_rel, std::memory_order_relaxed))
+        return true;
+    }
+
+    // Otherwise push the handler on to the incoming stack, from where it will
+    // be collected by the thread that holds the lock.
+    else
+    {
+      op_queue_access::next(op, head == locked ? 0 : head);
+      if (incoming_.compare_exchange_weak(head, op,
+            std::memory_order_release, std::memory_order_relaxed))
+        return false;
+    }
+  }
+}
+
+bool pooled_strand_service::strand_impl::release()
+{
+  operation* const locked = this;
+  operation* head = incoming_.load(std::memory_order_relaxed);
+  while (head == locked)
+  {
+    // A handler that threw leaves the rest of the ready queue to run.
+    if (!ready_queue_.empty())
+      return true;
+
+    // Nothing is waiting, so the lock is released. A handler pushed in the
+    // meantime makes the exchange fail, and is collected below.
+    if (incoming_.compare_exchange_weak(head, 0,
+          std::memory_order_release, std::memory_order_relaxed))
+      return false;
+  }
+
+  // More handlers have arrived. Move them on to the ready queue, restoring the
+  // order in which they were added, and keep the lock.
+  operation* stack = incoming_.exchange(locked, std::memory_order_acquire);
+  operation* reversed = 0;
+  while (stack)
+  {
+    operation* next = op_queue_access::next(stack);
+    op_queue_access::next(stack, reversed);
+    reversed = stack;
+    stack = next;
+  }
+  while (reversed)
+  {
+    operation* next = op_queue_access::next(reversed);
+    ready_queue_.push(reversed);
+    reversed = next;
+  }
+
+  return true;
+}
+
+bool pooled_strand_service::strand_impl::abandon(op_queue<operation>& ops)
+{
+  ops.push(ready_queue_);
+  operation* stack = incoming_.exchange(0, std::memory_order_acquire);
+  const bool was_locked = (stack != 0);
+  if (stack == this)
+    stack = 0;
+  while (stack)
+  {
+    operation* next = op_queue_access::next(stack);
+    ops.push(stack);
+    stack = next;
+  }
+  return was_locked;
+}
+
+#else // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+
+bool pooled_strand_service::strand_impl::enqueue(operation* op)
+{
+  boost::asio::detail::mutex::scoped_lock lock(mutex_);
+  if (locked_)
+  {
+    // Some other handler already holds the strand lock. Enqueue for later.
+    waiting_queue_.push(op);
+    return false;
+  }
+
+  locked_ = true;
+  return true;
+}
+
+bool pooled_strand_service::strand_impl::release()
+{
+  boost::asio::detail::mutex::scoped_lock lock(mutex_);
+  ready_queue_.push(waiting_queue_);
+  locked_ = !ready_queue_.empty();
+  return locked_;
+}
+
+bool pooled_strand_service::strand_impl::abandon(op_queue<operation>& ops)
+{
+  boost::asio::detail::mutex::scoped_lock lock(mutex_);
+  ops.push(waiting_queue_);
+  ops.push(ready_queue_);
+  bool was_locked = locked_;
+  locked_ = false;
+  return was_locked;
+}
+
+#endif // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_IMPL_POOLED_STRAND_SERVICE_IPP
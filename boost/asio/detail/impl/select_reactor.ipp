@@ -161,7 +161,8 @@ void select_reactor::deregister_internal_descriptor(
     op_queue_[i].cancel_operations(descriptor, ops);
 }
 
-void select_reactor::run(bool block, op_queue<operation>& ops)
+void select_reactor::run(bool block, op_queue<operation>& ops,
+    std::size_t)
 {
   boost::asio::detail::mutex::scoped_lock lock(mutex_);
 
@@ -240,7 +241,7 @@ void select_reactor::run(bool block, op_queue<operation>& ops)
   timer_queues_.get_ready_timers(ops);
 }
 
-void select_reactor::interrupt()
+void select_reactor::interrupt(std::size_t)
 {
   interrupter_.interrupt();
 }
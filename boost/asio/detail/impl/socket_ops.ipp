@@ -24,6 +24,9 @@
 #include <cstring>
 #include <cerrno>
 #include <new>
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+# include <sys/sendfile.h>
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
 #include <boost/asio/detail/socket_ops.hpp>
 #include <boost/asio/error.hpp>
 
@@ -247,6 +250,54 @@ bool non_blocking_accept(socket_type s,
   }
 }
 
+socket_type accept_pending(socket_type s,
+    state_type state, boost::system::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = boost::asio::error::bad_descriptor;
+    return invalid_socket;
+  }
+
+  for (;;)
+  {
+    // Accept the waiting connection. The new socket is created with its
+    // close-on-exec flag already set where accept4 is available.
+#if defined(BOOST_ASIO_HAS_ACCEPT4)
+    clear_last_error();
+    socket_type new_socket = error_wrapper(
+        ::accept4(s, 0, 0, SOCK_CLOEXEC), ec);
+    if (new_socket != invalid_socket)
+      ec = boost::system::error_code();
+#else // defined(BOOST_ASIO_HAS_ACCEPT4)
+    socket_type new_socket = socket_ops::accept(s, 0, 0, ec);
+#endif // defined(BOOST_ASIO_HAS_ACCEPT4)
+
+    // Check if operation succeeded.
+    if (new_socket != invalid_socket)
+      return new_socket;
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Skip connections that were aborted before they could be accepted.
+    if (ec == boost::asio::error::connection_aborted
+#if defined(EPROTO)
+        || ec.value() == EPROTO
+#endif // defined(EPROTO)
+        )
+    {
+      if (state & enable_connection_aborted)
+        return invalid_socket;
+      continue;
+    }
+
+    // Operation failed, or no connection is pending.
+    return invalid_socket;
+  }
+}
+
 #endif // defined(BOOST_ASIO_HAS_IOCP)
 
 template <typename SockLenType>
@@ -1285,6 +1336,279 @@ bool non_blocking_sendto(socket_type s,
 
 #endif // !defined(BOOST_ASIO_HAS_IOCP)
 
+#if defined(BOOST_ASIO_HAS_MMSG)
+
+int recvmmsg(socket_type s, mmsg* msgs, size_t count,
+    int flags, boost::system::error_code& ec)
+{
+  clear_last_error();
+
+  // Return as soon as one message has been received, even if the socket is
+  // in blocking mode, and collect any others that are already queued.
+  flags |= MSG_WAITFORONE;
+
+  int result = error_wrapper(::recvmmsg(s, msgs,
+        static_cast<unsigned int>(count), flags, 0), ec);
+  if (result >= 0)
+    ec = boost::system::error_code();
+  return result;
+}
+
+size_t sync_recvmmsg(socket_type s, state_type state, mmsg* msgs,
+    size_t count, int flags, boost::system::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = boost::asio::error::bad_descriptor;
+    return 0;
+  }
+
+  // Read some messages.
+  for (;;)
+  {
+    // Try to complete the operation without blocking.
+    int messages = socket_ops::recvmmsg(s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+      return messages;
+
+    // Operation failed.
+    if ((state & user_set_non_blocking)
+        || (ec != boost::asio::error::would_block
+          && ec != boost::asio::error::try_again))
+      return 0;
+
+    // Wait for socket to become ready.
+    if (socket_ops::poll_read(s, 0, ec) < 0)
+      return 0;
+  }
+}
+
+bool non_blocking_recvmmsg(socket_type s, mmsg* msgs, size_t count,
+    int flags, boost::system::error_code& ec, size_t& messages_transferred)
+{
+  for (;;)
+  {
+    // Read some messages.
+    int messages = socket_ops::recvmmsg(s, msgs, count, flags, ec);
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation is complete.
+    if (messages >= 0)
+    {
+      ec = boost::system::error_code();
+      messages_transferred = messages;
+    }
+    else
+      messages_transferred = 0;
+
+    return true;
+  }
+}
+
+int sendmmsg(socket_type s, mmsg* msgs, size_t count,
+    int flags, boost::system::error_code& ec)
+{
+  clear_last_error();
+  flags |= MSG_NOSIGNAL;
+  int result = error_wrapper(::sendmmsg(s, msgs,
+        static_cast<unsigned int>(count), flags), ec);
+  if (result >= 0)
+    ec = boost::system::error_code();
+  return result;
+}
+
+size_t sync_sendmmsg(socket_type s, state_type state, mmsg* msgs,
+    size_t count, int flags, boost::system::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = boost::asio::error::bad_descriptor;
+    return 0;
+  }
+
+  // Write some messages.
+  for (;;)
+  {
+    // Try to complete the operation without blocking.
+    int messages = socket_ops::sendmmsg(s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+      return messages;
+
+    // Operation failed.
+    if ((state & user_set_non_blocking)
+        || (ec != boost::asio::error::would_block
+          && ec != boost::asio::error::try_again))
+      return 0;
+
+    // Wait for socket to become ready.
+    if (socket_ops::poll_write(s, 0, ec) < 0)
+      return 0;
+  }
+}
+
+bool non_blocking_sendmmsg(socket_type s, mmsg* msgs, size_t count,
+    int flags, boost::system::error_code& ec, size_t& messages_transferred)
+{
+  for (;;)
+  {
+    // Write some messages.
+    int messages = socket_ops::sendmmsg(s, msgs, count, flags, ec);
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+      return false;
+
+    // Operation is complete.
+    if (messages >= 0)
+    {
+      ec = boost::system::error_code();
+      messages_transferred = messages;
+    }
+    else
+      messages_transferred = 0;
+
+    return true;
+  }
+}
+
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+
+signed_size_type sendfile(socket_type s, int fd, boost::uint64_t& offset,
+    size_t count, bool& use_splice, boost::system::error_code& ec)
+{
+  signed_size_type result = -1;
+  if (!use_splice)
+  {
+    clear_last_error();
+    loff_t off = static_cast<loff_t>(offset);
+    result = error_wrapper(::sendfile64(s, fd, &off, count), ec);
+    if (result >= 0)
+    {
+      offset = static_cast<boost::uint64_t>(off);
+      ec = boost::system::error_code();
+      return result;
+    }
+
+    // The descriptor cannot be mapped or seeked, as is the case for a pipe.
+    // Remember this, so that later calls go straight to splice.
+    use_splice = ec == boost::asio::error::invalid_argument
+      || ec == boost::system::error_code(ESPIPE,
+          boost::asio::error::get_system_category());
+  }
+
+  // Move the data straight from the pipe to the socket. Pipes have no offset.
+  if (use_splice)
+  {
+    clear_last_error();
+    result = error_wrapper(::splice(fd, 0, s, 0, count,
+          SPLICE_F_MOVE | SPLICE_F_NONBLOCK), ec);
+    if (result >= 0)
+      ec = boost::system::error_code();
+  }
+
+  return result;
+}
+
+size_t sync_sendfile(socket_type s, state_type state, int fd,
+    boost::uint64_t offset, size_t count, boost::system::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = boost::asio::error::bad_descriptor;
+    return 0;
+  }
+
+  size_t bytes_transferred = 0;
+  bool use_splice = false;
+  for (;;)
+  {
+    // Try to complete the operation without blocking.
+    if (socket_ops::non_blocking_sendfile(s, fd, offset,
+          count, use_splice, ec, bytes_transferred))
+      return bytes_transferred;
+
+    // Operation failed.
+    if (state & user_set_non_blocking)
+      return bytes_transferred;
+
+    // Wait for socket to become ready.
+    if (socket_ops::poll_write(s, 0, ec) < 0)
+      return bytes_transferred;
+  }
+}
+
+bool non_blocking_sendfile(socket_type s, int fd, boost::uint64_t& offset,
+    size_t count, bool& use_splice, boost::system::error_code& ec,
+    size_t& bytes_transferred)
+{
+  while (bytes_transferred < count)
+  {
+    // Write some data.
+    signed_size_type bytes = socket_ops::sendfile(
+        s, fd, offset, count - bytes_transferred, use_splice, ec);
+
+    // Retry operation if interrupted by signal.
+    if (ec == boost::asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again. A pipe that has no data
+    // available also reports would_block. The socket is checked, rather than
+    // the pipe, so that the operation only waits when the socket is full and
+    // a later change in its state is certain to be reported by the reactor.
+    if (ec == boost::asio::error::would_block
+        || ec == boost::asio::error::try_again)
+    {
+      boost::system::error_code poll_ec;
+      if (socket_ops::poll_write(s, user_set_non_blocking, poll_ec) == 0)
+        return false;
+
+      // The socket has room, so a file must be retried. An empty pipe
+      // completes the operation for now.
+      if (!use_splice)
+        continue;
+      ec = boost::system::error_code();
+      return true;
+    }
+
+    // Check for the end of the file.
+    if (bytes == 0)
+    {
+      ec = boost::asio::error::eof;
+      return true;
+    }
+
+    // Operation failed.
+    if (bytes < 0)
+      return true;
+
+    bytes_transferred += bytes;
+  }
+
+  ec = boost::system::error_code();
+  return true;
+}
+
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+
 socket_type socket(int af, int type, int protocol,
     boost::system::error_code& ec)
 {
@@ -19,12 +19,20 @@
 
 #if !defined(BOOST_ASIO_HAS_IOCP)
 
+#include <vector>
 #include <boost/limits.hpp>
 #include <boost/asio/detail/event.hpp>
 #include <boost/asio/detail/reactor.hpp>
 #include <boost/asio/detail/task_io_service.hpp>
 #include <boost/asio/detail/task_io_service_thread_info.hpp>
 
+#if defined(BOOST_WINDOWS) || defined(__CYGWIN__)
+# include <boost/asio/detail/socket_types.hpp>
+#else // defined(BOOST_WINDOWS) || defined(__CYGWIN__)
+# include <sys/time.h>
+# include <time.h>
+#endif // defined(BOOST_WINDOWS) || defined(__CYGWIN__)
+
 #include <boost/asio/detail/push_options.hpp>
 
 namespace boost {
@@ -43,17 +51,21 @@ struct task_io_service::task_cleanup
     }
     this_thread_->private_outstanding_work = 0;
 
-    // Enqueue the completed operations and reinsert the task at the end of
-    // the operation queue.
+    // Enqueue the completed operations and reinsert the task shards at the
+    // end of the operation queue.
     lock_->lock();
-    task_io_service_->task_interrupted_ = true;
+    operation* o = op_queue_access::front(*tasks_);
+    for (; o; o = op_queue_access::next(o))
+      task_io_service_->task_unblocked(o);
+    task_io_service_->stamp_ready_time(this_thread_->private_op_queue);
     task_io_service_->op_queue_.push(this_thread_->private_op_queue);
-    task_io_service_->op_queue_.push(&task_io_service_->task_operation_);
+    task_io_service_->op_queue_.push(*tasks_);
   }
 
   task_io_service* task_io_service_;
   mutex::scoped_lock* lock_;
   thread_info* this_thread_;
+  op_queue<operation>* tasks_;
 };
 
 struct task_io_service::work_cleanup
@@ -86,19 +98,145 @@ struct task_io_service::work_cleanup
   thread_info* this_thread_;
 };
 
+struct task_io_service::work_stealing_cleanup
+{
+  ~work_stealing_cleanup()
+  {
+    if (this_thread_->private_outstanding_work > 1)
+    {
+      boost::asio::detail::increment(
+          task_io_service_->outstanding_work_,
+          this_thread_->private_outstanding_work - 1);
+    }
+    else if (this_thread_->private_outstanding_work < 1)
+    {
+      task_io_service_->work_finished();
+    }
+    this_thread_->private_outstanding_work = 0;
+
+    if (!this_thread_->private_op_queue.empty())
+    {
+      task_io_service_->post_to_worker_queue(
+          *this_thread_->worker_queue, this_thread_->private_op_queue);
+    }
+  }
+
+  task_io_service* task_io_service_;
+  thread_info* this_thread_;
+};
+
+struct task_io_service::handler_metrics
+{
+  enum
+  {
+    // The number of handlers after which a thread flushes its counters.
+    flush_interval = 1024
+  };
+
+  handler_metrics(task_io_service* s, thread_info& t, boost::uint64_t ready)
+    : task_io_service_(s),
+      this_thread_(t),
+      start_time_(s->timed_ ? metrics_clock() : 0)
+  {
+    if (start_time_ && ready)
+    {
+      record(this_thread_.metrics.scheduling_delay,
+          start_time_ > ready ? start_time_ - ready : 0);
+    }
+  }
+
+  ~handler_metrics()
+  {
+    if (start_time_)
+    {
+      boost::uint64_t end_time = metrics_clock();
+      record(this_thread_.metrics.execution_time,
+          end_time > start_time_ ? end_time - start_time_ : 0);
+    }
+
+    ++this_thread_.metrics.handlers_run;
+    if (++this_thread_.unflushed_metrics >= flush_interval)
+      task_io_service_->flush_metrics(this_thread_);
+  }
+
+  // Count a duration in the histogram bucket for its base-2 logarithm.
+  static void record(boost::uint64_t* histogram, boost::uint64_t duration)
+  {
+    int bucket = 0;
+    while (duration > 1 && bucket < io_service_metrics::histogram_buckets - 1)
+    {
+      duration >>= 1;
+      ++bucket;
+    }
+    ++histogram[bucket];
+  }
+
+  task_io_service* task_io_service_;
+  thread_info& this_thread_;
+  boost::uint64_t start_time_;
+};
+
+struct task_io_service::metrics_cleanup
+{
+  ~metrics_cleanup()
+  {
+    task_io_service_->remove_running_thread(*this_thread_);
+  }
+
+  task_io_service* task_io_service_;
+  thread_info* this_thread_;
+};
+
 task_io_service::task_io_service(
     boost::asio::io_service& io_service, std::size_t concurrency_hint)
   : boost::asio::detail::service_base<task_io_service>(io_service),
-    one_thread_(concurrency_hint == 1),
+    concurrency_hint_(concurrency_hint),
+    one_thread_(BOOST_ASIO_CONCURRENCY_HINT_THREADS(concurrency_hint) == 1),
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    timed_(BOOST_ASIO_CONCURRENCY_HINT_HAS_FLAG(concurrency_hint,
+          BOOST_ASIO_CONCURRENCY_HINT_METRICS)),
+#else // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    timed_(false),
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
     mutex_(),
     task_(0),
-    task_interrupted_(true),
+    task_operations_(&task_operation_),
+    num_task_operations_(1),
+    first_blocked_task_(0),
     outstanding_work_(0),
     stopped_(false),
     shutdown_(false),
-    first_idle_thread_(0)
+    first_idle_thread_(0),
+    worker_queues_(0),
+    num_worker_queues_(0),
+    next_worker_queue_(0),
+    parked_threads_(0),
+    reactor_wakeups_(0),
+    metrics_mutex_(),
+    metrics_(),
+    first_running_thread_(0)
 {
   BOOST_ASIO_HANDLER_TRACKING_INIT;
+
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
+  if (!one_thread_ && BOOST_ASIO_CONCURRENCY_HINT_HAS_FLAG(concurrency_hint,
+        BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING))
+  {
+    // Without a thread count, assume a typical pool size. Threads beyond the
+    // number of queues share a queue with another thread.
+    num_worker_queues_ = BOOST_ASIO_CONCURRENCY_HINT_THREADS(concurrency_hint);
+    if (num_worker_queues_ == 0)
+      num_worker_queues_ = 16;
+    worker_queues_ = new worker_queue[num_worker_queues_];
+  }
+#endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
+}
+
+task_io_service::~task_io_service()
+{
+  delete[] worker_queues_;
+  if (task_operations_ != &task_operation_)
+    delete[] task_operations_;
 }
 
 void task_io_service::shutdown_service()
@@ -112,21 +250,40 @@ void task_io_service::shutdown_service()
   {
     operation* o = op_queue_.front();
     op_queue_.pop();
-    if (o != &task_operation_)
+    if (!is_task_operation(o))
+      o->destroy();
+  }
+
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    op_queue<operation>& q = worker_queues_[i].op_queue_;
+    while (operation* o = q.front())
+    {
+      q.pop();
       o->destroy();
+    }
   }
 
   // Reset to initial state.
   task_ = 0;
 }
 
-void task_io_service::init_task()
+void task_io_service::init_task(std::size_t num_shards)
 {
   mutex::scoped_lock lock(mutex_);
   if (!shutdown_ && !task_)
   {
+    if (num_shards > 1)
+    {
+      task_operations_ = new task_operation[num_shards];
+      num_task_operations_ = num_shards;
+      for (std::size_t i = 0; i < num_shards; ++i)
+        task_operations_[i].shard_ = i;
+    }
+
     task_ = &use_service<reactor>(this->get_io_service());
-    op_queue_.push(&task_operation_);
+    for (std::size_t i = 0; i < num_task_operations_; ++i)
+      op_queue_.push(&task_operations_[i]);
     wake_one_thread_and_unlock(lock);
   }
 }
@@ -145,7 +302,23 @@ std::size_t task_io_service::run(boost::system::error_code& ec)
   this_thread.wakeup_event = &wakeup_event;
   this_thread.private_outstanding_work = 0;
   this_thread.next = 0;
+  this_thread.worker_queue = 0;
+  this_thread.parked = false;
   thread_call_stack::context ctx(this, this_thread);
+  add_running_thread(this_thread);
+  metrics_cleanup on_exit = { this, &this_thread };
+  (void)on_exit;
+
+  if (worker_queues_)
+  {
+    attach_worker_queue(this_thread);
+
+    std::size_t n = 0;
+    while (do_work_stealing_run_one(this_thread, ec))
+      if (n != (std::numeric_limits<std::size_t>::max)())
+        ++n;
+    return n;
+  }
 
   mutex::scoped_lock lock(mutex_);
 
@@ -170,7 +343,18 @@ std::size_t task_io_service::run_one(boost::system::error_code& ec)
   this_thread.wakeup_event = &wakeup_event;
   this_thread.private_outstanding_work = 0;
   this_thread.next = 0;
+  this_thread.worker_queue = 0;
+  this_thread.parked = false;
   thread_call_stack::context ctx(this, this_thread);
+  add_running_thread(this_thread);
+  metrics_cleanup on_exit = { this, &this_thread };
+  (void)on_exit;
+
+  if (worker_queues_)
+  {
+    attach_worker_queue(this_thread);
+    return do_work_stealing_run_one(this_thread, ec);
+  }
 
   mutex::scoped_lock lock(mutex_);
 
@@ -190,7 +374,12 @@ std::size_t task_io_service::poll(boost::system::error_code& ec)
   this_thread.wakeup_event = 0;
   this_thread.private_outstanding_work = 0;
   this_thread.next = 0;
+  this_thread.worker_queue = 0;
+  this_thread.parked = false;
   thread_call_stack::context ctx(this, this_thread);
+  add_running_thread(this_thread);
+  metrics_cleanup on_exit = { this, &this_thread };
+  (void)on_exit;
 
   mutex::scoped_lock lock(mutex_);
 
@@ -201,6 +390,11 @@ std::size_t task_io_service::poll(boost::system::error_code& ec)
   if (one_thread_)
     if (thread_info* outer_thread_info = ctx.next_by_key())
       op_queue_.push(outer_thread_info->private_op_queue);
+
+  // Likewise, handlers on the per-thread run queues are not otherwise
+  // visible to poll() and poll_one().
+  if (worker_queues_)
+    flush_worker_queues();
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
 
   std::size_t n = 0;
@@ -223,7 +417,12 @@ std::size_t task_io_service::poll_one(boost::system::error_code& ec)
   this_thread.wakeup_event = 0;
   this_thread.private_outstanding_work = 0;
   this_thread.next = 0;
+  this_thread.worker_queue = 0;
+  this_thread.parked = false;
   thread_call_stack::context ctx(this, this_thread);
+  add_running_thread(this_thread);
+  metrics_cleanup on_exit = { this, &this_thread };
+  (void)on_exit;
 
   mutex::scoped_lock lock(mutex_);
 
@@ -234,6 +433,11 @@ std::size_t task_io_service::poll_one(boost::system::error_code& ec)
   if (one_thread_)
     if (thread_info* outer_thread_info = ctx.next_by_key())
       op_queue_.push(outer_thread_info->private_op_queue);
+
+  // Likewise, handlers on the per-thread run queues are not otherwise
+  // visible to poll() and poll_one().
+  if (worker_queues_)
+    flush_worker_queues();
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
 
   return do_poll_one(lock, this_thread, ec);
@@ -255,10 +459,56 @@ void task_io_service::reset()
 {
   mutex::scoped_lock lock(mutex_);
   stopped_ = false;
+
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    mutex::scoped_lock queue_lock(worker_queues_[i].mutex_);
+    worker_queues_[i].stopped_ = false;
+  }
+}
+
+io_service_metrics task_io_service::get_metrics()
+{
+  // The calling thread's counts are flushed first, so that a handler sees its
+  // own effects.
+  if (thread_info* this_thread = thread_call_stack::contains(this))
+    flush_metrics(*this_thread);
+
+  mutex::scoped_lock metrics_lock(metrics_mutex_);
+  io_service_metrics metrics = metrics_;
+  metrics_lock.unlock();
+
+  mutex::scoped_lock lock(mutex_);
+  metrics.reactor_wakeups = reactor_wakeups_;
+  metrics.queue_depth = count_handlers(op_queue_);
+  lock.unlock();
+
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    mutex::scoped_lock queue_lock(worker_queues_[i].mutex_);
+    metrics.queue_depth += count_handlers(worker_queues_[i].op_queue_);
+  }
+
+  metrics.outstanding_work = static_cast<long>(outstanding_work_);
+  return metrics;
+}
+
+std::vector<io_service_metrics> task_io_service::get_thread_metrics()
+{
+  if (thread_info* this_thread = thread_call_stack::contains(this))
+    flush_metrics(*this_thread);
+
+  std::vector<io_service_metrics> metrics;
+  mutex::scoped_lock lock(metrics_mutex_);
+  for (thread_info* t = first_running_thread_; t; t = t->next_running)
+    metrics.push_back(t->flushed_metrics);
+  return metrics;
 }
 
 void task_io_service::post_immediate_completion(task_io_service::operation* op)
 {
+  stamp_ready_time(op);
+
 #if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
   if (one_thread_)
   {
@@ -269,6 +519,12 @@ void task_io_service::post_immediate_completion(task_io_service::operation* op)
       return;
     }
   }
+  else if (worker_queue* q = this_worker_queue())
+  {
+    work_started();
+    post_to_worker_queue(*q, op);
+    return;
+  }
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
 
   work_started();
@@ -279,6 +535,8 @@ void task_io_service::post_immediate_completion(task_io_service::operation* op)
 
 void task_io_service::post_deferred_completion(task_io_service::operation* op)
 {
+  stamp_ready_time(op);
+
 #if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
   if (one_thread_)
   {
@@ -288,6 +546,11 @@ void task_io_service::post_deferred_completion(task_io_service::operation* op)
       return;
     }
   }
+  else if (worker_queue* q = this_worker_queue())
+  {
+    post_to_worker_queue(*q, op);
+    return;
+  }
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
 
   mutex::scoped_lock lock(mutex_);
@@ -300,6 +563,8 @@ void task_io_service::post_deferred_completions(
 {
   if (!ops.empty())
   {
+    stamp_ready_time(ops);
+
 #if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
     if (one_thread_)
     {
@@ -309,6 +574,11 @@ void task_io_service::post_deferred_completions(
         return;
       }
     }
+    else if (worker_queue* q = this_worker_queue())
+    {
+      post_to_worker_queue(*q, ops);
+      return;
+    }
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
 
     mutex::scoped_lock lock(mutex_);
@@ -327,10 +597,15 @@ void task_io_service::post_private_immediate_completion(
 void task_io_service::post_private_deferred_completion(
     task_io_service::operation* op)
 {
+  stamp_ready_time(op);
+
 #if defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
   if (thread_info* this_thread = thread_call_stack::contains(this))
   {
-    this_thread->private_op_queue.push(op);
+    if (this_thread->worker_queue)
+      post_to_worker_queue(*this_thread->worker_queue, op);
+    else
+      this_thread->private_op_queue.push(op);
     return;
   }
 #endif // defined(BOOST_HAS_THREADS) && !defined(BOOST_ASIO_DISABLE_THREADS)
@@ -350,6 +625,8 @@ void task_io_service::post_non_private_immediate_completion(
 void task_io_service::post_non_private_deferred_completion(
     task_io_service::operation* op)
 {
+  stamp_ready_time(op);
+
   mutex::scoped_lock lock(mutex_);
   op_queue_.push(op);
   wake_one_thread_and_unlock(lock);
@@ -373,34 +650,19 @@ std::size_t task_io_service::do_run_one(mutex::scoped_lock& lock,
       // Prepare to execute first handler from queue.
       operation* o = op_queue_.front();
       op_queue_.pop();
-      bool more_handlers = (!op_queue_.empty());
 
-      if (o == &task_operation_)
+      if (is_task_operation(o))
       {
-        task_interrupted_ = more_handlers;
-
-        if (more_handlers && !one_thread_)
-        {
-          if (!wake_one_idle_thread_and_unlock(lock))
-            lock.unlock();
-        }
-        else
-          lock.unlock();
-
-        task_cleanup on_exit = { this, &lock, &this_thread };
-        (void)on_exit;
-
-        // Run the task. May throw an exception. Only block if the operation
-        // queue is empty and we're not polling, otherwise we want to return
-        // as soon as possible.
-        task_->run(!more_handlers, this_thread.private_op_queue);
+        // Run the task. May throw an exception.
+        run_task(lock, this_thread, o);
       }
       else
       {
         std::size_t task_result = o->task_result_;
+        boost::uint64_t ready_time = take_ready_time(o);
 
-        if (more_handlers && !one_thread_)
-          wake_one_thread_and_unlock(lock);
+        if (!one_thread_)
+          wake_for_queued_work_and_unlock(lock);
         else
           lock.unlock();
 
@@ -408,6 +670,9 @@ std::size_t task_io_service::do_run_one(mutex::scoped_lock& lock,
         work_cleanup on_exit = { this, &lock, &this_thread };
         (void)on_exit;
 
+        // Count the handler and, if required, time it.
+        handler_metrics metrics(this, this_thread, ready_time);
+
         // Complete the operation. May throw an exception. Deletes the object.
         o->complete(*this, ec, task_result);
 
@@ -416,7 +681,11 @@ std::size_t task_io_service::do_run_one(mutex::scoped_lock& lock,
     }
     else
     {
-      // Nothing to run right now, so just wait for work to do.
+      // Nothing to run right now, so just wait for work to do. The thread's
+      // counters are flushed first, as it may not run again for some time.
+      ++this_thread.metrics.idle_waits;
+      ++this_thread.unflushed_metrics;
+      flush_metrics(this_thread);
       this_thread.next = first_idle_thread_;
       first_idle_thread_ = &this_thread;
       this_thread.wakeup_event->clear(lock);
@@ -434,37 +703,43 @@ std::size_t task_io_service::do_poll_one(mutex::scoped_lock& lock,
   if (stopped_)
     return 0;
 
+  // Give each task shard at the front of the queue a chance to run. Every
+  // shard is moved to the back of the queue after it has run, so this stops
+  // once the shards have all been run or a handler is found.
   operation* o = op_queue_.front();
-  if (o == &task_operation_)
+  for (std::size_t i = 0; i < num_task_operations_
+      && o != 0 && is_task_operation(o); ++i)
   {
     op_queue_.pop();
     lock.unlock();
 
     {
-      task_cleanup c = { this, &lock, &this_thread };
+      op_queue<operation> tasks;
+      tasks.push(o);
+      task_cleanup c = { this, &lock, &this_thread, &tasks };
       (void)c;
 
       // Run the task. May throw an exception. Only block if the operation
       // queue is empty and we're not polling, otherwise we want to return
       // as soon as possible.
-      task_->run(false, this_thread.private_op_queue);
+      count_task_run(this_thread, false);
+      task_->run(false, this_thread.private_op_queue,
+          static_cast<task_operation*>(o)->shard_);
     }
 
     o = op_queue_.front();
-    if (o == &task_operation_)
-      return 0;
   }
 
-  if (o == 0)
+  if (o == 0 || is_task_operation(o))
     return 0;
 
   op_queue_.pop();
-  bool more_handlers = (!op_queue_.empty());
 
   std::size_t task_result = o->task_result_;
+  boost::uint64_t ready_time = take_ready_time(o);
 
-  if (more_handlers && !one_thread_)
-    wake_one_thread_and_unlock(lock);
+  if (!one_thread_)
+    wake_for_queued_work_and_unlock(lock);
   else
     lock.unlock();
 
@@ -472,12 +747,339 @@ std::size_t task_io_service::do_poll_one(mutex::scoped_lock& lock,
   work_cleanup on_exit = { this, &lock, &this_thread };
   (void)on_exit;
 
+  // Count the handler and, if required, time it.
+  handler_metrics metrics(this, this_thread, ready_time);
+
   // Complete the operation. May throw an exception. Deletes the object.
   o->complete(*this, ec, task_result);
 
   return 1;
 }
 
+std::size_t task_io_service::do_work_stealing_run_one(
+    task_io_service::thread_info& this_thread,
+    const boost::system::error_code& ec)
+{
+  worker_queue& q = *this_thread.worker_queue;
+
+  for (;;)
+  {
+    // Prefer handlers that were posted by this thread. Only the queue's own
+    // mutex is needed for this, so threads do not contend with one another.
+    mutex::scoped_lock queue_lock(q.mutex_);
+    if (q.stopped_)
+      return 0;
+    operation* o = q.op_queue_.front();
+    q.op_queue_.pop();
+    std::size_t task_result = o ? o->task_result_ : 0;
+    boost::uint64_t ready_time = o ? take_ready_time(o) : 0;
+    queue_lock.unlock();
+
+    if (!o)
+    {
+      // Fall back to the shared queue, which also holds the task.
+      mutex::scoped_lock lock(mutex_);
+      if (stopped_)
+        return 0;
+
+      o = op_queue_.front();
+      op_queue_.pop();
+
+      if (o && is_task_operation(o))
+      {
+        // Run the task. May throw an exception.
+        run_task(lock, this_thread, o);
+        continue;
+      }
+
+      if (o)
+      {
+        // The task may reuse the operation as soon as the lock is released.
+        task_result = o->task_result_;
+        ready_time = take_ready_time(o);
+
+        wake_for_queued_work_and_unlock(lock);
+      }
+    }
+
+    if (!o)
+    {
+      // Announce that this thread is about to park before looking for work
+      // one last time. Anyone who queues work after that last look will see
+      // the thread as parked and wake it.
+      queue_lock.lock();
+      this_thread.next = q.first_idle_thread_;
+      q.first_idle_thread_ = &this_thread;
+      this_thread.parked = true;
+      ++parked_threads_;
+      queue_lock.unlock();
+
+      mutex::scoped_lock lock(mutex_);
+      bool retry = stopped_ || !op_queue_.empty();
+      lock.unlock();
+
+      if (!retry)
+        o = steal_operation(q, task_result, ready_time);
+
+      if (retry || o)
+      {
+        unpark(this_thread);
+      }
+      else
+      {
+        ++this_thread.metrics.idle_waits;
+        ++this_thread.unflushed_metrics;
+        flush_metrics(this_thread);
+        queue_lock.lock();
+        while (this_thread.parked)
+        {
+          this_thread.wakeup_event->clear(queue_lock);
+          this_thread.wakeup_event->wait(queue_lock);
+        }
+        queue_lock.unlock();
+      }
+
+      if (!o)
+        continue;
+    }
+
+    // Ensure the count of outstanding work is decremented on block exit.
+    work_stealing_cleanup on_exit = { this, &this_thread };
+    (void)on_exit;
+
+    // Count the handler and, if required, time it.
+    handler_metrics metrics(this, this_thread, ready_time);
+
+    // Complete the operation. May throw an exception. Deletes the object.
+    o->complete(*this, ec, task_result);
+
+    return 1;
+  }
+}
+
+void task_io_service::attach_worker_queue(
+    task_io_service::thread_info& this_thread)
+{
+  std::size_t index = static_cast<std::size_t>(++next_worker_queue_);
+  this_thread.worker_queue = &worker_queues_[index % num_worker_queues_];
+}
+
+task_io_service::worker_queue* task_io_service::this_worker_queue()
+{
+  if (worker_queues_)
+    if (thread_info* this_thread = thread_call_stack::contains(this))
+      return this_thread->worker_queue;
+  return 0;
+}
+
+void task_io_service::post_to_worker_queue(
+    task_io_service::worker_queue& q, task_io_service::operation* op)
+{
+  mutex::scoped_lock lock(q.mutex_);
+  q.op_queue_.push(op);
+  lock.unlock();
+  wake_one_parked_thread(&q);
+}
+
+void task_io_service::post_to_worker_queue(
+    task_io_service::worker_queue& q,
+    op_queue<task_io_service::operation>& ops)
+{
+  mutex::scoped_lock lock(q.mutex_);
+  q.op_queue_.push(ops);
+  lock.unlock();
+  wake_one_parked_thread(&q);
+}
+
+void task_io_service::flush_worker_queues()
+{
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    mutex::scoped_lock queue_lock(worker_queues_[i].mutex_);
+    op_queue_.push(worker_queues_[i].op_queue_);
+  }
+}
+
+task_io_service::operation* task_io_service::steal_operation(
+    task_io_service::worker_queue& thief, std::size_t& task_result,
+    boost::uint64_t& ready_time)
+{
+  // Start with the thief's own queue, as other threads may share it.
+  std::size_t start = static_cast<std::size_t>(&thief - worker_queues_);
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    worker_queue& q = worker_queues_[(start + i) % num_worker_queues_];
+    mutex::scoped_lock lock(q.mutex_);
+    if (operation* o = q.op_queue_.front())
+    {
+      q.op_queue_.pop();
+      task_result = o->task_result_;
+      ready_time = take_ready_time(o);
+      return o;
+    }
+  }
+  return 0;
+}
+
+bool task_io_service::wake_one_parked_thread(
+    task_io_service::worker_queue* after)
+{
+  if (parked_threads_ == 0)
+    return false;
+
+  std::size_t start = after
+    ? static_cast<std::size_t>(after - worker_queues_) + 1 : 0;
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    worker_queue& q = worker_queues_[(start + i) % num_worker_queues_];
+    mutex::scoped_lock lock(q.mutex_);
+    if (thread_info* idle_thread = q.first_idle_thread_)
+    {
+      q.first_idle_thread_ = idle_thread->next;
+      idle_thread->next = 0;
+      idle_thread->parked = false;
+      --parked_threads_;
+      idle_thread->wakeup_event->signal_and_unlock(lock);
+      return true;
+    }
+  }
+  return false;
+}
+
+void task_io_service::unpark(task_io_service::thread_info& this_thread)
+{
+  worker_queue& q = *this_thread.worker_queue;
+  mutex::scoped_lock lock(q.mutex_);
+  if (this_thread.parked)
+  {
+    thread_info** p = &q.first_idle_thread_;
+    while (*p != &this_thread)
+      p = &(*p)->next;
+    *p = this_thread.next;
+    this_thread.next = 0;
+    this_thread.parked = false;
+    --parked_threads_;
+  }
+}
+
+void task_io_service::task_blocked(task_io_service::operation* task)
+{
+  task_operation* t = static_cast<task_operation*>(task);
+  t->next_blocked_ = first_blocked_task_;
+  t->blocked_ = true;
+  first_blocked_task_ = t;
+}
+
+void task_io_service::task_unblocked(task_io_service::operation* task)
+{
+  task_operation* t = static_cast<task_operation*>(task);
+  if (t->blocked_)
+  {
+    task_operation** p = &first_blocked_task_;
+    while (*p != t)
+      p = &(*p)->next_blocked_;
+    *p = t->next_blocked_;
+    t->next_blocked_ = 0;
+    t->blocked_ = false;
+  }
+}
+
+void task_io_service::count_task_run(
+    task_io_service::thread_info& this_thread, bool block)
+{
+  if (block)
+    ++this_thread.metrics.reactor_waits;
+  else
+    ++this_thread.metrics.reactor_polls;
+  ++this_thread.unflushed_metrics;
+
+  if (block)
+    flush_metrics(this_thread);
+}
+
+bool task_io_service::interrupt_one_task()
+{
+  if (task_operation* t = first_blocked_task_)
+  {
+    first_blocked_task_ = t->next_blocked_;
+    t->next_blocked_ = 0;
+    t->blocked_ = false;
+    ++reactor_wakeups_;
+    task_->interrupt(t->shard_);
+    return true;
+  }
+  return false;
+}
+
+bool task_io_service::has_queued_handlers()
+{
+  // Only task shards can be queued ahead of the first handler, so this looks
+  // at no more than one operation more than there are shards.
+  operation* o = op_queue_access::front(op_queue_);
+  for (; o; o = op_queue_access::next(o))
+    if (!is_task_operation(o))
+      return true;
+  return false;
+}
+
+void task_io_service::run_task(mutex::scoped_lock& lock,
+    task_io_service::thread_info& this_thread, task_io_service::operation* task)
+{
+  op_queue<operation> tasks;
+  tasks.push(task);
+  std::size_t num_tasks = 1;
+
+  // Only block if no handlers are queued and we're not polling, otherwise we
+  // want to return as soon as possible.
+  bool block = !has_queued_handlers();
+  if (block)
+    task_blocked(task);
+
+  if (op_queue_.empty())
+    lock.unlock();
+  else if (one_thread_ || !wake_one_idle_thread_and_unlock(lock))
+  {
+    if (block)
+    {
+      // Only task shards are left in the queue and there is no thread free
+      // to wait on them, so wait on them all here.
+      while (operation* o = op_queue_.front())
+      {
+        op_queue_.pop();
+        task_blocked(o);
+        tasks.push(o);
+        ++num_tasks;
+      }
+    }
+    lock.unlock();
+  }
+
+  task_cleanup on_exit = { this, &lock, &this_thread, &tasks };
+  (void)on_exit;
+
+  count_task_run(this_thread, block);
+  if (num_tasks == 1)
+  {
+    task_->run(block, this_thread.private_op_queue,
+        static_cast<task_operation*>(task)->shard_);
+  }
+  else
+  {
+    std::vector<std::size_t> shards;
+    shards.reserve(num_tasks);
+    operation* o = op_queue_access::front(tasks);
+    for (; o; o = op_queue_access::next(o))
+      shards.push_back(static_cast<task_operation*>(o)->shard_);
+
+    // Wait until one of the shards is ready or interrupted, then collect the
+    // events from each of them without blocking.
+    if (block)
+      task_->wait_any(&shards[0], shards.size());
+    for (std::size_t i = 0; i < shards.size(); ++i)
+      task_->run(false, this_thread.private_op_queue, shards[i]);
+  }
+}
+
 void task_io_service::stop_all_threads(
     mutex::scoped_lock& lock)
 {
@@ -491,10 +1093,23 @@ void task_io_service::stop_all_threads(
     idle_thread->wakeup_event->signal(lock);
   }
 
-  if (!task_interrupted_ && task_)
+  for (std::size_t i = 0; i < num_worker_queues_; ++i)
+  {
+    worker_queue& q = worker_queues_[i];
+    mutex::scoped_lock queue_lock(q.mutex_);
+    q.stopped_ = true;
+    while (thread_info* idle_thread = q.first_idle_thread_)
+    {
+      q.first_idle_thread_ = idle_thread->next;
+      idle_thread->next = 0;
+      idle_thread->parked = false;
+      --parked_threads_;
+      idle_thread->wakeup_event->signal(queue_lock);
+    }
+  }
+
+  while (interrupt_one_task())
   {
-    task_interrupted_ = true;
-    task_->interrupt();
   }
 }
 
@@ -509,6 +1124,11 @@ bool task_io_service::wake_one_idle_thread_and_unlock(
     idle_thread->wakeup_event->signal_and_unlock(lock);
     return true;
   }
+  if (worker_queues_ && wake_one_parked_thread(0))
+  {
+    lock.unlock();
+    return true;
+  }
   return false;
 }
 
@@ -517,13 +1137,130 @@ void task_io_service::wake_one_thread_and_unlock(
 {
   if (!wake_one_idle_thread_and_unlock(lock))
   {
-    if (!task_interrupted_ && task_)
+    interrupt_one_task();
+    lock.unlock();
+  }
+}
+
+void task_io_service::wake_for_queued_work_and_unlock(
+    mutex::scoped_lock& lock)
+{
+  if (op_queue_.empty())
+    lock.unlock();
+  else if (has_queued_handlers())
+    wake_one_thread_and_unlock(lock);
+  else if (!wake_one_idle_thread_and_unlock(lock))
+    lock.unlock();
+}
+
+boost::uint64_t task_io_service::metrics_clock()
+{
+#if defined(BOOST_WINDOWS) || defined(__CYGWIN__)
+  LARGE_INTEGER frequency, counter;
+  ::QueryPerformanceFrequency(&frequency);
+  ::QueryPerformanceCounter(&counter);
+  boost::uint64_t f = frequency.QuadPart;
+  boost::uint64_t c = counter.QuadPart;
+  return (c / f) * 1000000000 + (c % f) * 1000000000 / f;
+#elif defined(CLOCK_MONOTONIC)
+  timespec ts;
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<boost::uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#else // defined(CLOCK_MONOTONIC)
+  timeval tv;
+  ::gettimeofday(&tv, 0);
+  return static_cast<boost::uint64_t>(tv.tv_sec) * 1000000000
+    + tv.tv_usec * 1000;
+#endif // defined(CLOCK_MONOTONIC)
+}
+
+void task_io_service::stamp_ready_time(
+    op_queue<task_io_service::operation>& ops)
+{
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  if (timed_)
+  {
+    boost::uint64_t now = 0;
+    operation* o = op_queue_access::front(ops);
+    for (; o; o = op_queue_access::next(o))
     {
-      task_interrupted_ = true;
-      task_->interrupt();
+      if (o->ready_time_ == 0)
+      {
+        if (now == 0)
+          now = metrics_clock();
+        o->ready_time_ = now;
+      }
     }
-    lock.unlock();
   }
+#else // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  (void)ops;
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+}
+
+boost::uint64_t task_io_service::count_handlers(
+    op_queue<task_io_service::operation>& ops)
+{
+  boost::uint64_t n = 0;
+  operation* o = op_queue_access::front(ops);
+  for (; o; o = op_queue_access::next(o))
+    if (!is_task_operation(o))
+      ++n;
+  return n;
+}
+
+void task_io_service::flush_metrics(task_io_service::thread_info& this_thread)
+{
+  if (this_thread.unflushed_metrics == 0)
+    return;
+
+  io_service_metrics& from = this_thread.metrics;
+  mutex::scoped_lock lock(metrics_mutex_);
+  add_metrics(metrics_, from);
+  add_metrics(this_thread.flushed_metrics, from);
+  lock.unlock();
+
+  from = io_service_metrics();
+  this_thread.unflushed_metrics = 0;
+}
+
+void task_io_service::add_metrics(
+    io_service_metrics& to, const io_service_metrics& from)
+{
+  to.handlers_run += from.handlers_run;
+  to.reactor_waits += from.reactor_waits;
+  to.reactor_polls += from.reactor_polls;
+  to.idle_waits += from.idle_waits;
+  for (int i = 0; i < io_service_metrics::histogram_buckets; ++i)
+  {
+    to.scheduling_delay[i] += from.scheduling_delay[i];
+    to.execution_time[i] += from.execution_time[i];
+  }
+}
+
+void task_io_service::add_running_thread(
+    task_io_service::thread_info& this_thread)
+{
+  this_thread.metrics = io_service_metrics();
+  this_thread.unflushed_metrics = 0;
+  this_thread.flushed_metrics = io_service_metrics();
+
+  mutex::scoped_lock lock(metrics_mutex_);
+  this_thread.next_running = first_running_thread_;
+  first_running_thread_ = &this_thread;
+}
+
+void task_io_service::remove_running_thread(
+    task_io_service::thread_info& this_thread)
+{
+  io_service_metrics& from = this_thread.metrics;
+  mutex::scoped_lock lock(metrics_mutex_);
+  if (this_thread.unflushed_metrics > 0)
+    add_metrics(metrics_, from);
+
+  thread_info** t = &first_running_thread_;
+  while (*t != &this_thread)
+    t = &(*t)->next_running;
+  *t = this_thread.next_running;
 }
 
 } // namespace detail
@@ -0,0 +1,76 @@
+//
+// detail/impl/thread_info_base.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
+#define BOOST_ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <boost/asio/detail/static_mutex.hpp>
+#include <boost/asio/detail/thread_info_base.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+struct thread_info_memory_totals
+{
+  // Mutex protecting access to the totals.
+  static_mutex mutex_;
+
+  // The counts flushed by all threads.
+  thread_info_base::memory_counters counters_;
+};
+
+inline thread_info_memory_totals* get_thread_info_memory_totals()
+{
+  static thread_info_memory_totals totals = {
+    BOOST_ASIO_STATIC_MUTEX_INIT, { 0, 0, 0 } };
+  return &totals;
+}
+
+thread_info_base::memory_counters thread_info_base::get_memory_counters(
+    thread_info_base* this_thread)
+{
+  if (this_thread && this_thread->unflushed_)
+    this_thread->flush_memory_counters();
+
+  thread_info_memory_totals* totals = get_thread_info_memory_totals();
+  totals->mutex_.init();
+  static_mutex::scoped_lock lock(totals->mutex_);
+  return totals->counters_;
+}
+
+void thread_info_base::flush_memory_counters()
+{
+  thread_info_memory_totals* totals = get_thread_info_memory_totals();
+  totals->mutex_.init();
+  static_mutex::scoped_lock lock(totals->mutex_);
+  totals->counters_.hits += counters_.hits;
+  totals->counters_.misses += counters_.misses;
+  totals->counters_.overflows += counters_.overflows;
+  counters_.hits = 0;
+  counters_.misses = 0;
+  counters_.overflows = 0;
+  unflushed_ = 0;
+}
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_IMPL_THREAD_INFO_BASE_IPP
@@ -75,7 +75,8 @@ win_iocp_io_service::win_iocp_io_service(
   BOOST_ASIO_HANDLER_TRACKING_INIT;
 
   iocp_.handle = ::CreateIoCompletionPort(INVALID_HANDLE_VALUE, 0, 0,
-      static_cast<DWORD>((std::min<size_t>)(concurrency_hint, DWORD(~0))));
+      static_cast<DWORD>((std::min<size_t>)(
+          BOOST_ASIO_CONCURRENCY_HINT_THREADS(concurrency_hint), DWORD(~0))));
   if (!iocp_.handle)
   {
     DWORD last_error = ::GetLastError();
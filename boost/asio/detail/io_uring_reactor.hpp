@@ -0,0 +1,356 @@
+//
+// detail/io_uring_reactor.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_IO_URING_REACTOR_HPP
+#define BOOST_ASIO_DETAIL_IO_URING_REACTOR_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+
+#include <time.h>
+#include <vector>
+#include <linux/io_uring.h>
+#include <boost/cstdint.hpp>
+#include <boost/limits.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/detail/io_uring_reactor_fwd.hpp>
+#include <boost/asio/detail/mutex.hpp>
+#include <boost/asio/detail/object_pool.hpp>
+#include <boost/asio/detail/op_queue.hpp>
+#include <boost/asio/detail/reactor_op.hpp>
+#include <boost/asio/detail/select_interrupter.hpp>
+#include <boost/asio/detail/socket_types.hpp>
+#include <boost/asio/detail/timer_queue_base.hpp>
+#include <boost/asio/detail/timer_queue_fwd.hpp>
+#include <boost/asio/detail/timer_queue_set.hpp>
+#include <boost/asio/detail/wait_op.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A reactor that uses Linux io_uring. Socket receive, send and accept
+// operations on a single buffer are performed by the kernel as ring requests.
+// Other operations wait for readiness using one-shot poll requests. Requests,
+// timeouts and cancellations are written to the submission queue and handed
+// to the kernel in batches, normally as part of the same io_uring_enter call
+// that waits for completions.
+class io_uring_reactor
+  : public boost::asio::detail::service_base<io_uring_reactor>
+{
+public:
+  enum op_types { read_op = 0, write_op = 1,
+    connect_op = 1, except_op = 2, max_ops = 3 };
+
+  // Per-descriptor queues.
+  class descriptor_state : operation
+  {
+    friend class io_uring_reactor;
+    friend class object_pool_access;
+
+    descriptor_state* next_;
+    descriptor_state* prev_;
+
+    mutex mutex_;
+    io_uring_reactor* reactor_;
+    int descriptor_;
+    op_queue<reactor_op> op_queue_[max_ops];
+    bool poll_pending_[max_ops];
+    bool io_pending_[max_ops];
+    bool io_cancelled_[max_ops];
+    int io_result_[max_ops];
+    bool shutdown_;
+    unsigned long run_count_;
+
+    BOOST_ASIO_DECL descriptor_state();
+    BOOST_ASIO_DECL operation* perform_io(uint32_t events);
+    BOOST_ASIO_DECL static void do_complete(
+        io_service_impl* owner, operation* base,
+        const boost::system::error_code& ec, std::size_t bytes_transferred);
+  };
+
+  // Per-descriptor data.
+  typedef descriptor_state* per_descriptor_data;
+
+  // Constructor.
+  BOOST_ASIO_DECL io_uring_reactor(boost::asio::io_service& io_service);
+
+  // Destructor.
+  BOOST_ASIO_DECL ~io_uring_reactor();
+
+  // Destroy all user-defined handler objects owned by the service.
+  BOOST_ASIO_DECL void shutdown_service();
+
+  // Recreate internal descriptors following a fork.
+  BOOST_ASIO_DECL void fork_service(
+      boost::asio::io_service::fork_event fork_ev);
+
+  // Initialise the task.
+  BOOST_ASIO_DECL void init_task();
+
+  // Register a socket with the reactor. Returns 0 on success, system error
+  // code on failure.
+  BOOST_ASIO_DECL int register_descriptor(socket_type descriptor,
+      per_descriptor_data& descriptor_data);
+
+  // Register a descriptor with an associated single operation. Returns 0 on
+  // success, system error code on failure.
+  BOOST_ASIO_DECL int register_internal_descriptor(
+      int op_type, socket_type descriptor,
+      per_descriptor_data& descriptor_data, reactor_op* op);
+
+  // Move descriptor registration from one descriptor_data object to another.
+  BOOST_ASIO_DECL void move_descriptor(socket_type descriptor,
+      per_descriptor_data& target_descriptor_data,
+      per_descriptor_data& source_descriptor_data);
+
+  // Post a reactor operation for immediate completion.
+  void post_immediate_completion(reactor_op* op)
+  {
+    io_service_.post_immediate_completion(op);
+  }
+
+  // Start a new operation. The reactor operation will be performed when the
+  // given descriptor is flagged as ready, or an error has occurred.
+  BOOST_ASIO_DECL void start_op(int op_type, socket_type descriptor,
+      per_descriptor_data& descriptor_data, reactor_op* op,
+      bool allow_speculative);
+
+  // Cancel all operations associated with the given descriptor. The
+  // handlers associated with the descriptor will be invoked with the
+  // operation_aborted error.
+  BOOST_ASIO_DECL void cancel_ops(socket_type descriptor,
+      per_descriptor_data& descriptor_data);
+
+  // Cancel any operations that are running against the descriptor and remove
+  // its registration from the reactor.
+  BOOST_ASIO_DECL void deregister_descriptor(socket_type descriptor,
+      per_descriptor_data& descriptor_data, bool closing);
+
+  // Remote the descriptor's registration from the reactor.
+  BOOST_ASIO_DECL void deregister_internal_descriptor(
+      socket_type descriptor, per_descriptor_data& descriptor_data);
+
+  // Add a new timer queue to the reactor.
+  template <typename Time_Traits>
+  void add_timer_queue(timer_queue<Time_Traits>& timer_queue);
+
+  // Remove a timer queue from the reactor.
+  template <typename Time_Traits>
+  void remove_timer_queue(timer_queue<Time_Traits>& timer_queue);
+
+  // Schedule a new operation in the given timer queue to expire at the
+  // specified absolute time.
+  template <typename Time_Traits>
+  void schedule_timer(timer_queue<Time_Traits>& queue,
+      const typename Time_Traits::time_type& time,
+      typename timer_queue<Time_Traits>::per_timer_data& timer, wait_op* op);
+
+  // Cancel the timer operations associated with the given token. Returns the
+  // number of operations that have been posted or dispatched.
+  template <typename Time_Traits>
+  std::size_t cancel_timer(timer_queue<Time_Traits>& queue,
+      typename timer_queue<Time_Traits>::per_timer_data& timer,
+      std::size_t max_cancelled = (std::numeric_limits<std::size_t>::max)());
+
+  // Submit queued requests and wait until interrupted or events are ready to
+  // be dispatched.
+  // The reactor has a single shard, so the shard argument is ignored.
+  BOOST_ASIO_DECL void run(bool block, op_queue<operation>& ops,
+      std::size_t shard = 0);
+
+  // Wait on several shards. The reactor has a single shard, so this is never
+  // called.
+  void wait_any(const std::size_t*, std::size_t)
+  {
+  }
+
+  // Interrupt the wait.
+  BOOST_ASIO_DECL void interrupt(std::size_t shard = 0);
+
+private:
+  // The number of entries in the submission queue.
+  enum { ring_size = 1024 };
+
+  // Create the io_uring instance and map its rings. Throws an exception if
+  // the instance cannot be created.
+  BOOST_ASIO_DECL void open_ring();
+
+  // Unmap the rings and close the io_uring descriptor.
+  BOOST_ASIO_DECL void close_ring();
+
+  // Ensure that the submission queue has room for the specified number of
+  // entries. Submits queued entries if the queue is full, and waits for
+  // completions if that is not enough. The mutex may be released while
+  // waiting. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void reserve_sqes(mutex::scoped_lock& lock, unsigned n);
+
+  // Get a free submission queue entry. Assumes that the mutex is held and
+  // that room for the entry has been reserved.
+  BOOST_ASIO_DECL io_uring_sqe* get_sqe();
+
+  // Make queued submission queue entries visible to the kernel. If a thread
+  // is blocked waiting for completions, or if forced, submit them now rather
+  // than with the next wait. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void commit_sqes(bool force);
+
+  // Hand all queued submission queue entries to the kernel. If the kernel
+  // cannot take them until completions are reaped, a thread blocked waiting
+  // for completions is woken to reap them and submit the entries again.
+  BOOST_ASIO_DECL void submit_sqes();
+
+  // Wait for completions while the submission queue is full. The mutex is
+  // released while blocked. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void wait_for_sqes(mutex::scoped_lock& lock);
+
+  // Determine whether a completion is for a descriptor operation that was
+  // submitted as a ring request.
+  BOOST_ASIO_DECL bool is_io_completion(const io_uring_cqe& cqe);
+
+  // Queue a completion for dispatch by the next call to run().
+  BOOST_ASIO_DECL void dispatch_cqe(const io_uring_cqe& cqe,
+      op_queue<operation>& ops, bool& check_timers, bool& check_interrupter);
+
+  // Start a one-shot poll for the descriptor. Assumes that the descriptor's
+  // mutex is held.
+  BOOST_ASIO_DECL void start_poll(descriptor_state* s, int op_type);
+
+  // Submit the operation at the front of the queue as a ring request. Returns
+  // false if the operation must wait for readiness instead. Assumes that the
+  // descriptor's mutex is held.
+  BOOST_ASIO_DECL bool start_io(descriptor_state* s, int op_type);
+
+  // Abort the queued operations for the descriptor. Operations that have been
+  // submitted as ring requests stay queued until the kernel reports that they
+  // have been cancelled. Assumes that the descriptor's mutex is held.
+  BOOST_ASIO_DECL void cancel_queued_ops(descriptor_state* s,
+      op_queue<operation>& ops);
+
+  // Cancel any outstanding polls for the descriptor. Assumes that the
+  // descriptor's mutex is held.
+  BOOST_ASIO_DECL void cancel_polls(descriptor_state* s);
+
+  // Start a poll on the interrupter. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void start_interrupter_poll(mutex::scoped_lock& lock);
+
+  // Allocate a new descriptor state object.
+  BOOST_ASIO_DECL descriptor_state* allocate_descriptor_state();
+
+  // Free an existing descriptor state object.
+  BOOST_ASIO_DECL void free_descriptor_state(descriptor_state* s);
+
+  // Helper function to add a new timer queue.
+  BOOST_ASIO_DECL void do_add_timer_queue(timer_queue_base& queue);
+
+  // Helper function to remove a timer queue.
+  BOOST_ASIO_DECL void do_remove_timer_queue(timer_queue_base& queue);
+
+  // Called to recalculate and update the timeout. Replaces any outstanding
+  // timeout request with one for the earliest timer. Assumes that the mutex
+  // is held.
+  BOOST_ASIO_DECL void update_timeout(mutex::scoped_lock& lock);
+
+  // The io_service implementation used to post completions.
+  io_service_impl& io_service_;
+
+  // Mutex to protect access to internal data.
+  mutex mutex_;
+
+  // The interrupter is used to break a blocking wait.
+  select_interrupter interrupter_;
+
+  // The io_uring file descriptor.
+  int ring_fd_;
+
+  // The mapped submission queue ring.
+  void* sq_ring_;
+  std::size_t sq_ring_size_;
+  unsigned* sq_head_;
+  unsigned* sq_tail_;
+  unsigned sq_mask_;
+  unsigned sq_entries_;
+
+  // The mapped completion queue ring.
+  void* cq_ring_;
+  std::size_t cq_ring_size_;
+  unsigned* cq_head_;
+  unsigned* cq_tail_;
+  unsigned cq_mask_;
+  io_uring_cqe* cqes_;
+
+  // The mapped submission queue entries.
+  io_uring_sqe* sqes_;
+  std::size_t sqes_size_;
+
+  // Completions taken from the completion queue while waiting for space in
+  // the submission queue, to be dispatched by the next call to run().
+  std::vector<io_uring_cqe> reaped_cqes_;
+
+  // The tail of the submission queue as seen by this process. Entries up to
+  // this point have been filled in but may not yet be visible to the kernel.
+  unsigned sq_local_tail_;
+
+  // Whether a thread is blocked waiting for completions.
+  bool waiting_;
+
+  // The absolute expiry time for the timeout request.
+  struct __kernel_timespec timeout_;
+
+  // The number of timeout requests whose completions have not yet been
+  // dispatched. Any that are still waiting are removed before a new timeout
+  // request is submitted, so that at most one is ever waiting.
+  std::size_t timeouts_outstanding_;
+
+  // The number of descriptor operations submitted as ring requests whose
+  // completions have not yet been dispatched.
+  std::size_t io_requests_outstanding_;
+
+  // The number of calls to run(). Used to ensure that each descriptor is
+  // queued at most once per call.
+  unsigned long run_count_;
+
+  // The timer queues.
+  timer_queue_set timer_queues_;
+
+  // Whether the service has been shut down.
+  bool shutdown_;
+
+  // Mutex to protect access to the registered descriptors.
+  mutex registered_descriptors_mutex_;
+
+  // Keep track of all registered descriptors.
+  object_pool<descriptor_state> registered_descriptors_;
+
+  // Helper class to do post-perform_io cleanup.
+  struct perform_io_cleanup_on_block_exit;
+  friend struct perform_io_cleanup_on_block_exit;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#include <boost/asio/detail/impl/io_uring_reactor.hpp>
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/detail/impl/io_uring_reactor.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
+#endif // BOOST_ASIO_DETAIL_IO_URING_REACTOR_HPP
@@ -99,6 +99,17 @@ public:
 
   // Free an object. Moves it to the free list. No destructors are run.
   void free(Object* o)
+  {
+    detach(o);
+
+    object_pool_access::next(o) = free_list_;
+    object_pool_access::prev(o) = 0;
+    free_list_ = o;
+  }
+
+  // Remove an object from the live list without freeing it. Ownership of the
+  // object passes to the caller.
+  void detach(Object* o)
   {
     if (live_list_ == o)
       live_list_ = object_pool_access::next(o);
@@ -115,9 +126,8 @@ public:
         = object_pool_access::prev(o);
     }
 
-    object_pool_access::next(o) = free_list_;
+    object_pool_access::next(o) = 0;
     object_pool_access::prev(o) = 0;
-    free_list_ = o;
   }
 
 private:
@@ -0,0 +1,221 @@
+//
+// detail/pooled_strand_service.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_POOLED_STRAND_SERVICE_HPP
+#define BOOST_ASIO_DETAIL_POOLED_STRAND_SERVICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_STD_ATOMIC)
+# include <atomic>
+#endif // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/detail/atomic_count.hpp>
+#include <boost/asio/detail/mutex.hpp>
+#include <boost/asio/detail/object_pool.hpp>
+#include <boost/asio/detail/op_queue.hpp>
+#include <boost/asio/detail/operation.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// Strand service that gives every strand its own implementation, so that
+// unrelated strands never contend with one another. Implementations are
+// reference counted by the strand objects that use them, and are recycled
+// through a pool once the last reference has gone.
+class pooled_strand_service
+  : public boost::asio::detail::service_base<pooled_strand_service>
+{
+private:
+  // Helper class to re-post the strand on exit.
+  struct on_do_complete_exit;
+
+  // Helper class to re-post the strand on exit.
+  struct on_dispatch_exit;
+
+public:
+
+  // The underlying implementation of a strand.
+  class strand_impl
+    : public operation
+  {
+  public:
+    strand_impl();
+
+  private:
+    // Only this service will have access to the internal values.
+    friend class pooled_strand_service;
+    friend class object_pool_access;
+    friend struct on_do_complete_exit;
+    friend struct on_dispatch_exit;
+
+    // Add a handler to the strand. Returns true if the caller has acquired
+    // the strand lock, in which case the handler has not been queued and the
+    // caller is responsible for running or scheduling it.
+    BOOST_ASIO_DECL bool enqueue(operation* op);
+
+    // Release the strand lock after the ready handlers have run. Returns false
+    // if the lock was released, or true if handlers are still ready or more
+    // are waiting and have been moved to the ready queue.
+    BOOST_ASIO_DECL bool release();
+
+    // Return all queued handlers and reset the lock. Used on shutdown.
+    // Returns true if the strand was locked.
+    BOOST_ASIO_DECL bool abandon(op_queue<operation>& ops);
+
+    // Pointers used by the object pool.
+    strand_impl* next_;
+    strand_impl* prev_;
+
+    // The service that owns the implementation. Null once the service has
+    // been destroyed.
+    pooled_strand_service* service_;
+
+    // The number of strand objects using the implementation, plus one while
+    // the strand is locked.
+    atomic_count ref_count_;
+
+#if defined(BOOST_ASIO_HAS_STD_ATOMIC)
+    // Handlers that are waiting on the strand, pushed as a stack by any
+    // thread and taken as a whole by the thread that holds the lock. Null
+    // while the strand is unlocked, and the strand itself while it is locked
+    // with no handlers waiting.
+    std::atomic<operation*> incoming_;
+#else // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+    // Mutex to protect access to internal data.
+    boost::asio::detail::mutex mutex_;
+
+    // Indicates whether the strand is currently "locked" by a handler.
+    bool locked_;
+
+    // The handlers that are waiting on the strand but should not be run until
+    // after the next time the strand is scheduled. This queue must only be
+    // modified while the mutex is locked.
+    op_queue<operation> waiting_queue_;
+#endif // defined(BOOST_ASIO_HAS_STD_ATOMIC)
+
+    // The handlers that are ready to be run. Logically speaking, these are the
+    // handlers that hold the strand's lock. The ready queue is only modified
+    // from within the strand and so may be accessed without synchronisation.
+    op_queue<operation> ready_queue_;
+  };
+
+  // Handle that keeps a strand implementation alive.
+  class implementation_type
+  {
+  public:
+    implementation_type()
+      : impl_(0)
+    {
+    }
+
+    implementation_type(const implementation_type& other)
+      : impl_(other.impl_)
+    {
+      pooled_strand_service::add_ref(impl_);
+    }
+
+    ~implementation_type()
+    {
+      pooled_strand_service::release(impl_);
+    }
+
+    implementation_type& operator=(const implementation_type& other)
+    {
+      pooled_strand_service::add_ref(other.impl_);
+      pooled_strand_service::release(impl_);
+      impl_ = other.impl_;
+      return *this;
+    }
+
+    strand_impl* get() const
+    {
+      return impl_;
+    }
+
+  private:
+    friend class pooled_strand_service;
+    strand_impl* impl_;
+  };
+
+  // Construct a new strand service for the specified io_service.
+  BOOST_ASIO_DECL explicit pooled_strand_service(
+      boost::asio::io_service& io_service);
+
+  // Destructor.
+  BOOST_ASIO_DECL ~pooled_strand_service();
+
+  // Destroy all user-defined handler objects owned by the service.
+  BOOST_ASIO_DECL void shutdown_service();
+
+  // Construct a new strand implementation.
+  BOOST_ASIO_DECL void construct(implementation_type& impl);
+
+  // Request the io_service to invoke the given handler.
+  template <typename Handler>
+  void dispatch(implementation_type& impl, Handler handler);
+
+  // Request the io_service to invoke the given handler and return immediately.
+  template <typename Handler>
+  void post(implementation_type& impl, Handler handler);
+
+private:
+  // Helper function to dispatch a handler. Returns true if the handler should
+  // be dispatched immediately.
+  BOOST_ASIO_DECL bool do_dispatch(strand_impl* impl, operation* op);
+
+  // Helper function to post a handler.
+  BOOST_ASIO_DECL void do_post(strand_impl* impl, operation* op);
+
+  BOOST_ASIO_DECL static void do_complete(io_service_impl* owner,
+      operation* base, const boost::system::error_code& ec,
+      std::size_t bytes_transferred);
+
+  // Add a reference to an implementation.
+  static void add_ref(strand_impl* impl)
+  {
+    if (impl)
+      ++impl->ref_count_;
+  }
+
+  // Drop a reference to an implementation, returning it to the pool if it
+  // was the last one.
+  BOOST_ASIO_DECL static void release(strand_impl* impl);
+
+  // The io_service implementation used to post completions.
+  io_service_impl& io_service_;
+
+  // Mutex to protect access to the pool of implementations.
+  boost::asio::detail::mutex mutex_;
+
+  // Pool of implementations.
+  object_pool<strand_impl> implementations_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#include <boost/asio/detail/impl/pooled_strand_service.hpp>
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/detail/impl/pooled_strand_service.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
+#endif // BOOST_ASIO_DETAIL_POOLED_STRAND_SERVICE_HPP
@@ -0,0 +1,163 @@
+//
+// detail/reactive_socket_accept_batch_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
+#define BOOST_ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if !defined(BOOST_ASIO_HAS_IOCP)
+
+#include <boost/utility/addressof.hpp>
+#include <boost/asio/detail/bind_handler.hpp>
+#include <boost/asio/detail/fenced_block.hpp>
+#include <boost/asio/detail/reactor_op.hpp>
+#include <boost/asio/detail/socket_holder.hpp>
+#include <boost/asio/detail/socket_ops.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+template <typename Socket, typename Protocol>
+class reactive_socket_accept_batch_op_base : public reactor_op
+{
+public:
+  reactive_socket_accept_batch_op_base(socket_type socket,
+      socket_ops::state_type state, Socket* const* peers, std::size_t count,
+      const Protocol& protocol, func_type complete_func)
+    : reactor_op(&reactive_socket_accept_batch_op_base::do_perform,
+        complete_func),
+      socket_(socket),
+      state_(state),
+      peers_(peers),
+      count_(count),
+      protocol_(protocol)
+  {
+  }
+
+  static bool do_perform(reactor_op* base)
+  {
+    reactive_socket_accept_batch_op_base* o(
+        static_cast<reactive_socket_accept_batch_op_base*>(base));
+
+    // Accept connections until none are pending or every peer has been used.
+    // The number accepted is passed to the handler as the bytes transferred.
+    std::size_t& n = o->bytes_transferred_;
+    while (n < o->count_)
+    {
+      // Aborted connections are skipped once a connection has been accepted,
+      // even if enable_connection_aborted is set.
+      socket_ops::state_type state = o->state_;
+      if (n > 0)
+        state &= ~socket_ops::enable_connection_aborted;
+
+      socket_holder new_socket(
+          socket_ops::accept_pending(o->socket_, state, o->ec_));
+      if (new_socket.get() == invalid_socket)
+      {
+        // Wait for a connection unless the acceptor is in non-blocking mode.
+        if (n == 0)
+          return !((o->ec_ == boost::asio::error::would_block
+                || o->ec_ == boost::asio::error::try_again)
+              && !(o->state_ & socket_ops::user_set_non_blocking));
+
+        // Any error after the first connection will be seen again by the
+        // next accept.
+        o->ec_ = boost::system::error_code();
+        return true;
+      }
+
+      // A connection that cannot be assigned to its peer is closed, and the
+      // error is reported along with the connections already accepted.
+      if (o->peers_[n]->assign(o->protocol_, new_socket.get(), o->ec_))
+        return true;
+      new_socket.release();
+      ++n;
+    }
+
+    return true;
+  }
+
+private:
+  socket_type socket_;
+  socket_ops::state_type state_;
+  Socket* const* peers_;
+  std::size_t count_;
+  Protocol protocol_;
+};
+
+template <typename Socket, typename Protocol, typename Handler>
+class reactive_socket_accept_batch_op :
+  public reactive_socket_accept_batch_op_base<Socket, Protocol>
+{
+public:
+  BOOST_ASIO_DEFINE_HANDLER_PTR(reactive_socket_accept_batch_op);
+
+  reactive_socket_accept_batch_op(socket_type socket,
+      socket_ops::state_type state, Socket* const* peers, std::size_t count,
+      const Protocol& protocol, Handler& handler)
+    : reactive_socket_accept_batch_op_base<Socket, Protocol>(socket, state,
+        peers, count, protocol, &reactive_socket_accept_batch_op::do_complete),
+      handler_(BOOST_ASIO_MOVE_CAST(Handler)(handler))
+  {
+  }
+
+  static void do_complete(io_service_impl* owner, operation* base,
+      const boost::system::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    reactive_socket_accept_batch_op* o(
+        static_cast<reactive_socket_accept_batch_op*>(base));
+    ptr p = { boost::addressof(o->handler_), o, o };
+
+    BOOST_ASIO_HANDLER_COMPLETION((o));
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, boost::system::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = boost::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      BOOST_ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      boost_asio_handler_invoke_helpers::invoke(handler, handler.handler_);
+      BOOST_ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+private:
+  Handler handler_;
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // !defined(BOOST_ASIO_HAS_IOCP)
+
+#endif // BOOST_ASIO_DETAIL_REACTIVE_SOCKET_ACCEPT_BATCH_OP_HPP
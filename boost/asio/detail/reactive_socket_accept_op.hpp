@@ -24,6 +24,11 @@
 #include <boost/asio/detail/socket_holder.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+# include <cerrno>
+# include <linux/io_uring.h>
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 #include <boost/asio/detail/push_options.hpp>
 
 namespace boost {
@@ -44,6 +49,10 @@ public:
       protocol_(protocol),
       peer_endpoint_(peer_endpoint)
   {
+#if defined(BOOST_ASIO_HAS_IO_URING)
+    this->set_io_uring_funcs(&reactive_socket_accept_op_base::do_prepare,
+        &reactive_socket_accept_op_base::do_finish);
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
   }
 
   static bool do_perform(reactor_op* base)
@@ -70,12 +79,69 @@ public:
     return result;
   }
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  static bool do_prepare(reactor_op* base, io_uring_sqe* sqe)
+  {
+    reactive_socket_accept_op_base* o(
+        static_cast<reactive_socket_accept_op_base*>(base));
+
+    // A socket in user-set non-blocking mode must fail with would_block
+    // rather than wait for a connection.
+    if (o->state_ & socket_ops::user_set_non_blocking)
+      return false;
+
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = o->socket_;
+    if (o->peer_endpoint_)
+    {
+      o->addrlen_ = static_cast<socklen_t>(o->peer_endpoint_->capacity());
+      sqe->addr = reinterpret_cast<std::size_t>(o->peer_endpoint_->data());
+      sqe->addr2 = reinterpret_cast<std::size_t>(&o->addrlen_);
+    }
+    return true;
+  }
+
+  static bool do_finish(reactor_op* base, int result)
+  {
+    reactive_socket_accept_op_base* o(
+        static_cast<reactive_socket_accept_op_base*>(base));
+
+    // Check if we need to run the operation again.
+    if (result == -EAGAIN || result == -EWOULDBLOCK || result == -EINTR)
+      return false;
+    if (result == -ECONNABORTED || result == -EPROTO)
+      if ((o->state_ & socket_ops::enable_connection_aborted) == 0)
+        return false;
+
+    if (result < 0)
+    {
+      o->ec_ = boost::system::error_code(-result,
+          boost::asio::error::get_system_category());
+      return true;
+    }
+
+    // Assign new connection to peer socket object.
+    socket_holder new_socket_holder(result);
+    o->ec_ = boost::system::error_code();
+    if (o->peer_endpoint_)
+      o->peer_endpoint_->resize(o->addrlen_);
+    if (!o->peer_.assign(o->protocol_, result, o->ec_))
+      new_socket_holder.release();
+    return true;
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 private:
   socket_type socket_;
   socket_ops::state_type state_;
   Socket& peer_;
   Protocol protocol_;
   typename Protocol::endpoint* peer_endpoint_;
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  // The length of the peer address, written by the kernel.
+  socklen_t addrlen_;
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
 };
 
 template <typename Socket, typename Protocol, typename Handler>
@@ -23,6 +23,11 @@
 #include <boost/asio/detail/reactor_op.hpp>
 #include <boost/asio/detail/socket_ops.hpp>
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+# include <cerrno>
+# include <linux/io_uring.h>
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 #include <boost/asio/detail/push_options.hpp>
 
 namespace boost {
@@ -42,6 +47,10 @@ public:
       buffers_(buffers),
       flags_(flags)
   {
+#if defined(BOOST_ASIO_HAS_IO_URING)
+    this->set_io_uring_funcs(&reactive_socket_recv_op_base::do_prepare,
+        &reactive_socket_recv_op_base::do_finish);
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
   }
 
   static bool do_perform(reactor_op* base)
@@ -58,6 +67,58 @@ public:
         o->ec_, o->bytes_transferred_);
   }
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  static bool do_prepare(reactor_op* base, io_uring_sqe* sqe)
+  {
+    reactive_socket_recv_op_base* o(
+        static_cast<reactive_socket_recv_op_base*>(base));
+
+    // The buffer sequence is not kept beyond this call, so only a single
+    // buffer can be described to the kernel.
+    buffer_sequence_adapter<boost::asio::mutable_buffer,
+        MutableBufferSequence> bufs(o->buffers_);
+    if (bufs.count() != 1 || (o->flags_ & MSG_OOB) != 0)
+      return false;
+
+    std::size_t size = bufs.buffers()[0].iov_len;
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = o->socket_;
+    sqe->addr = reinterpret_cast<std::size_t>(bufs.buffers()[0].iov_base);
+    sqe->len = static_cast<unsigned int>(
+        size < 0x7FFFF000 ? size : 0x7FFFF000);
+    sqe->msg_flags = o->flags_;
+    return true;
+  }
+
+  static bool do_finish(reactor_op* base, int result)
+  {
+    reactive_socket_recv_op_base* o(
+        static_cast<reactive_socket_recv_op_base*>(base));
+
+    // Check if we need to run the operation again.
+    if (result == -EAGAIN || result == -EWOULDBLOCK || result == -EINTR)
+      return false;
+
+    if (result >= 0)
+    {
+      // Check for end of stream.
+      if (result == 0 && (o->state_ & socket_ops::stream_oriented) != 0)
+        o->ec_ = boost::asio::error::eof;
+      else
+        o->ec_ = boost::system::error_code();
+      o->bytes_transferred_ = result;
+    }
+    else
+    {
+      o->ec_ = boost::system::error_code(-result,
+          boost::asio::error::get_system_category());
+      o->bytes_transferred_ = 0;
+    }
+
+    return true;
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 private:
   socket_type socket_;
   socket_ops::state_type state_;
@@ -21,15 +21,20 @@
 
 #include <boost/utility/addressof.hpp>
 #include <boost/asio/buffer.hpp>
+#include <boost/asio/datagram_message.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/socket_base.hpp>
 #include <boost/asio/detail/buffer_sequence_adapter.hpp>
+#include <boost/asio/detail/datagram_message_adapter.hpp>
 #include <boost/asio/detail/noncopyable.hpp>
 #include <boost/asio/detail/reactive_null_buffers_op.hpp>
+#include <boost/asio/detail/reactive_socket_accept_batch_op.hpp>
 #include <boost/asio/detail/reactive_socket_accept_op.hpp>
 #include <boost/asio/detail/reactive_socket_connect_op.hpp>
 #include <boost/asio/detail/reactive_socket_recvfrom_op.hpp>
+#include <boost/asio/detail/reactive_socket_recvmmsg_op.hpp>
+#include <boost/asio/detail/reactive_socket_sendmmsg_op.hpp>
 #include <boost/asio/detail/reactive_socket_sendto_op.hpp>
 #include <boost/asio/detail/reactive_socket_service_base.hpp>
 #include <boost/asio/detail/reactor.hpp>
@@ -340,6 +345,92 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(BOOST_ASIO_HAS_MMSG)
+  // Send a batch of datagrams. Returns the number of messages sent.
+  size_t send_to_batch(implementation_type& impl,
+      datagram_message<boost::asio::const_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    datagram_message_adapter<boost::asio::const_buffer,
+        endpoint_type> msgs(messages, count);
+
+    std::size_t n = socket_ops::sync_sendmmsg(impl.socket_, impl.state_,
+        msgs.msgs(), msgs.count(), flags, ec);
+
+    if (!ec)
+      msgs.complete(n);
+
+    return n;
+  }
+
+  // Start an asynchronous send of a batch of datagrams. The messages and the
+  // data they refer to must be valid for the lifetime of the asynchronous
+  // operation.
+  template <typename Handler>
+  void async_send_to_batch(implementation_type& impl,
+      datagram_message<boost::asio::const_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags, Handler handler)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendmmsg_op<endpoint_type, Handler> op;
+    typename op::ptr p = { boost::addressof(handler),
+      boost_asio_handler_alloc_helpers::allocate(
+        sizeof(op), handler), 0 };
+    p.p = new (p.v) op(impl.socket_, messages, count, flags, handler);
+
+    BOOST_ASIO_HANDLER_CREATION((p.p, "socket",
+          &impl, "async_send_to_batch"));
+
+    start_op(impl, reactor::write_op, p.p, true, false);
+    p.v = p.p = 0;
+  }
+
+  // Receive a batch of datagrams with the endpoints of their senders. Returns
+  // the number of messages received.
+  size_t receive_from_batch(implementation_type& impl,
+      datagram_message<boost::asio::mutable_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags,
+      boost::system::error_code& ec)
+  {
+    datagram_message_adapter<boost::asio::mutable_buffer,
+        endpoint_type> msgs(messages, count);
+
+    std::size_t n = socket_ops::sync_recvmmsg(impl.socket_, impl.state_,
+        msgs.msgs(), msgs.count(), flags, ec);
+
+    if (!ec)
+      msgs.complete(n);
+
+    return n;
+  }
+
+  // Start an asynchronous receive of a batch of datagrams. The messages and
+  // the buffers they refer to must be valid for the lifetime of the
+  // asynchronous operation.
+  template <typename Handler>
+  void async_receive_from_batch(implementation_type& impl,
+      datagram_message<boost::asio::mutable_buffer, endpoint_type>* messages,
+      std::size_t count, socket_base::message_flags flags, Handler handler)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_recvmmsg_op<endpoint_type, Handler> op;
+    typename op::ptr p = { boost::addressof(handler),
+      boost_asio_handler_alloc_helpers::allocate(
+        sizeof(op), handler), 0 };
+    p.p = new (p.v) op(impl.socket_, messages, count, flags, handler);
+
+    BOOST_ASIO_HANDLER_CREATION((p.p, "socket",
+          &impl, "async_receive_from_batch"));
+
+    start_op(impl,
+        (flags & socket_base::message_out_of_band)
+          ? reactor::except_op : reactor::read_op,
+        p.p, true, false);
+    p.v = p.p = 0;
+  }
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
   // Accept a new connection.
   template <typename Socket>
   boost::system::error_code accept(implementation_type& impl,
@@ -389,6 +480,90 @@ public:
     p.v = p.p = 0;
   }
 
+  // Accept one or more new connections. Blocks until at least one connection
+  // has been accepted, and then accepts any others that are already pending.
+  template <typename Socket>
+  std::size_t accept_batch(implementation_type& impl, Socket* const* peers,
+      std::size_t count, boost::system::error_code& ec)
+  {
+    // We cannot accept into a socket that is already open.
+    if (any_open(peers, count))
+    {
+      ec = boost::asio::error::already_open;
+      return 0;
+    }
+
+    // Further connections are only accepted if they are pending, so the
+    // acceptor must not block. Synchronous operations on a socket in internal
+    // non-blocking mode wait using poll.
+    if ((impl.state_ & socket_ops::non_blocking) == 0
+        && !socket_ops::set_internal_non_blocking(
+          impl.socket_, impl.state_, true, ec))
+      return 0;
+
+    std::size_t n = 0;
+    while (n < count)
+    {
+      // Aborted connections are skipped once a connection has been accepted,
+      // even if enable_connection_aborted is set.
+      socket_ops::state_type state = impl.state_;
+      if (n > 0)
+        state &= ~socket_ops::enable_connection_aborted;
+
+      socket_holder new_socket(
+          socket_ops::accept_pending(impl.socket_, state, ec));
+
+      if (new_socket.get() == invalid_socket)
+      {
+        // Wait for the first connection unless the acceptor is in
+        // non-blocking mode.
+        if (n == 0 && (ec == boost::asio::error::would_block
+              || ec == boost::asio::error::try_again)
+            && !(impl.state_ & socket_ops::user_set_non_blocking))
+        {
+          if (socket_ops::poll_read(impl.socket_, impl.state_, ec) < 0)
+            return 0;
+          continue;
+        }
+
+        // Any error after the first connection will be seen again by the
+        // next accept.
+        if (n > 0)
+          ec = boost::system::error_code();
+        return n;
+      }
+
+      // A connection that cannot be assigned to its peer is closed, and the
+      // error is reported along with the connections already accepted.
+      if (peers[n]->assign(impl.protocol_, new_socket.get(), ec))
+        return n;
+      new_socket.release();
+      ++n;
+    }
+
+    return n;
+  }
+
+  // Start an asynchronous accept of one or more connections. The peers must
+  // be valid until the handler is invoked.
+  template <typename Socket, typename Handler>
+  void async_accept_batch(implementation_type& impl, Socket* const* peers,
+      std::size_t count, Handler handler)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_accept_batch_op<Socket, Protocol, Handler> op;
+    typename op::ptr p = { boost::addressof(handler),
+      boost_asio_handler_alloc_helpers::allocate(
+        sizeof(op), handler), 0 };
+    p.p = new (p.v) op(impl.socket_, impl.state_,
+        peers, count, impl.protocol_, handler);
+
+    BOOST_ASIO_HANDLER_CREATION((p.p, "socket", &impl, "async_accept_batch"));
+
+    start_accept_op(impl, p.p, any_open(peers, count));
+    p.v = p.p = 0;
+  }
+
   // Connect the socket to the specified endpoint.
   boost::system::error_code connect(implementation_type& impl,
       const endpoint_type& peer_endpoint, boost::system::error_code& ec)
@@ -415,6 +590,17 @@ public:
     start_connect_op(impl, p.p, peer_endpoint.data(), peer_endpoint.size());
     p.v = p.p = 0;
   }
+
+private:
+  // Determine whether any of the given sockets is open.
+  template <typename Socket>
+  static bool any_open(Socket* const* peers, std::size_t count)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+      if (peers[i]->is_open())
+        return true;
+    return false;
+  }
 };
 
 } // namespace detail
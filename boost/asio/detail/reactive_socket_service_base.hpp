@@ -29,6 +29,7 @@
 #include <boost/asio/detail/reactive_socket_recv_op.hpp>
 #include <boost/asio/detail/reactive_socket_recvmsg_op.hpp>
 #include <boost/asio/detail/reactive_socket_send_op.hpp>
+#include <boost/asio/detail/reactive_socket_sendfile_op.hpp>
 #include <boost/asio/detail/reactor.hpp>
 #include <boost/asio/detail/reactor_op.hpp>
 #include <boost/asio/detail/socket_holder.hpp>
@@ -235,6 +236,36 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+  // Send data from a file descriptor. Returns the number of bytes sent.
+  size_t send_file(base_implementation_type& impl, int fd,
+      boost::uint64_t offset, std::size_t length,
+      boost::system::error_code& ec)
+  {
+    return socket_ops::sync_sendfile(impl.socket_,
+        impl.state_, fd, offset, length, ec);
+  }
+
+  // Start an asynchronous send of data from a file descriptor. The descriptor
+  // must remain open for the lifetime of the asynchronous operation.
+  template <typename Handler>
+  void async_send_file(base_implementation_type& impl, int fd,
+      boost::uint64_t offset, std::size_t length, Handler handler)
+  {
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendfile_op<Handler> op;
+    typename op::ptr p = { boost::addressof(handler),
+      boost_asio_handler_alloc_helpers::allocate(
+        sizeof(op), handler), 0 };
+    p.p = new (p.v) op(impl.socket_, fd, offset, length, handler);
+
+    BOOST_ASIO_HANDLER_CREATION((p.p, "socket", &impl, "async_send_file"));
+
+    start_op(impl, reactor::write_op, p.p, true, length == 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+
   // Receive some data from the peer. Returns the number of bytes received.
   template <typename MutableBufferSequence>
   size_t receive(base_implementation_type& impl,
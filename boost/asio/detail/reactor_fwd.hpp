@@ -19,6 +19,8 @@
 
 #if defined(BOOST_ASIO_HAS_IOCP)
 # include <boost/asio/detail/select_reactor_fwd.hpp>
+#elif defined(BOOST_ASIO_HAS_IO_URING)
+# include <boost/asio/detail/io_uring_reactor_fwd.hpp>
 #elif defined(BOOST_ASIO_HAS_EPOLL)
 # include <boost/asio/detail/epoll_reactor_fwd.hpp>
 #elif defined(BOOST_ASIO_HAS_KQUEUE)
@@ -35,6 +37,8 @@ namespace detail {
 
 #if defined(BOOST_ASIO_HAS_IOCP)
 typedef select_reactor reactor;
+#elif defined(BOOST_ASIO_HAS_IO_URING)
+typedef io_uring_reactor reactor;
 #elif defined(BOOST_ASIO_HAS_EPOLL)
 typedef epoll_reactor reactor;
 #elif defined(BOOST_ASIO_HAS_KQUEUE)
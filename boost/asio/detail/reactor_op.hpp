@@ -20,6 +20,10 @@
 
 #include <boost/asio/detail/push_options.hpp>
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+struct io_uring_sqe;
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 namespace boost {
 namespace asio {
 namespace detail {
@@ -40,6 +44,24 @@ public:
     return perform_func_(this);
   }
 
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  // Fill in a submission queue entry that performs the operation once the
+  // descriptor is ready. Returns false if the operation cannot be submitted,
+  // in which case it must wait for readiness and be performed instead.
+  bool prepare(io_uring_sqe* sqe)
+  {
+    return prepare_func_ != 0 && prepare_func_(this, sqe);
+  }
+
+  // Record the result of the submission queue entry. Returns true if the
+  // operation is finished, or false if it must wait for readiness and be
+  // performed instead.
+  bool finish(int result)
+  {
+    return finish_func_(this, result);
+  }
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+
 protected:
   typedef bool (*perform_func_type)(reactor_op*);
 
@@ -47,11 +69,33 @@ protected:
     : operation(complete_func),
       bytes_transferred_(0),
       perform_func_(perform_func)
+#if defined(BOOST_ASIO_HAS_IO_URING)
+      , prepare_func_(0)
+      , finish_func_(0)
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
+  {
+  }
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  typedef bool (*prepare_func_type)(reactor_op*, io_uring_sqe*);
+  typedef bool (*finish_func_type)(reactor_op*, int);
+
+  // Allow the operation to be submitted to io_uring.
+  void set_io_uring_funcs(prepare_func_type prepare_func,
+      finish_func_type finish_func)
   {
+    prepare_func_ = prepare_func;
+    finish_func_ = finish_func;
   }
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
 
 private:
   perform_func_type perform_func_;
+
+#if defined(BOOST_ASIO_HAS_IO_URING)
+  prepare_func_type prepare_func_;
+  finish_func_type finish_func_;
+#endif // defined(BOOST_ASIO_HAS_IO_URING)
 };
 
 } // namespace detail
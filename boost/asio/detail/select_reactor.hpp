@@ -144,10 +144,18 @@ public:
       std::size_t max_cancelled = (std::numeric_limits<std::size_t>::max)());
 
   // Run select once until interrupted or events are ready to be dispatched.
-  BOOST_ASIO_DECL void run(bool block, op_queue<operation>& ops);
+  // The reactor has a single shard, so the shard argument is ignored.
+  BOOST_ASIO_DECL void run(bool block, op_queue<operation>& ops,
+      std::size_t shard = 0);
+
+  // Wait on several shards. The reactor has a single shard, so this is never
+  // called.
+  void wait_any(const std::size_t*, std::size_t)
+  {
+  }
 
   // Interrupt the select loop.
-  BOOST_ASIO_DECL void interrupt();
+  BOOST_ASIO_DECL void interrupt(std::size_t shard = 0);
 
 private:
 #if defined(BOOST_ASIO_HAS_IOCP)
@@ -17,6 +17,7 @@
 
 #include <boost/asio/detail/config.hpp>
 
+#include <boost/cstdint.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/asio/detail/shared_ptr.hpp>
 #include <boost/asio/detail/socket_types.hpp>
@@ -83,6 +84,9 @@ BOOST_ASIO_DECL bool non_blocking_accept(socket_type s,
     state_type state, socket_addr_type* addr, std::size_t* addrlen,
     boost::system::error_code& ec, socket_type& new_socket);
 
+BOOST_ASIO_DECL socket_type accept_pending(socket_type s,
+    state_type state, boost::system::error_code& ec);
+
 #endif // defined(BOOST_ASIO_HAS_IOCP)
 
 BOOST_ASIO_DECL int bind(socket_type s, const socket_addr_type* addr,
@@ -125,6 +129,10 @@ typedef WSABUF buf;
 typedef iovec buf;
 #endif // defined(BOOST_WINDOWS) || defined(__CYGWIN__)
 
+#if defined(BOOST_ASIO_HAS_MMSG)
+typedef mmsghdr mmsg;
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
 BOOST_ASIO_DECL void init_buf(buf& b, void* data, size_t size);
 
 BOOST_ASIO_DECL void init_buf(buf& b, const void* data, size_t size);
@@ -232,6 +240,46 @@ BOOST_ASIO_DECL bool non_blocking_sendto(socket_type s,
 
 #endif // !defined(BOOST_ASIO_HAS_IOCP)
 
+#if defined(BOOST_ASIO_HAS_MMSG)
+
+BOOST_ASIO_DECL int recvmmsg(socket_type s, mmsg* msgs,
+    size_t count, int flags, boost::system::error_code& ec);
+
+BOOST_ASIO_DECL size_t sync_recvmmsg(socket_type s, state_type state,
+    mmsg* msgs, size_t count, int flags, boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_recvmmsg(socket_type s,
+    mmsg* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& messages_transferred);
+
+BOOST_ASIO_DECL int sendmmsg(socket_type s, mmsg* msgs,
+    size_t count, int flags, boost::system::error_code& ec);
+
+BOOST_ASIO_DECL size_t sync_sendmmsg(socket_type s, state_type state,
+    mmsg* msgs, size_t count, int flags, boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_sendmmsg(socket_type s,
+    mmsg* msgs, size_t count, int flags,
+    boost::system::error_code& ec, size_t& messages_transferred);
+
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+
+BOOST_ASIO_DECL signed_size_type sendfile(socket_type s, int fd,
+    boost::uint64_t& offset, size_t count, bool& use_splice,
+    boost::system::error_code& ec);
+
+BOOST_ASIO_DECL size_t sync_sendfile(socket_type s, state_type state,
+    int fd, boost::uint64_t offset, size_t count,
+    boost::system::error_code& ec);
+
+BOOST_ASIO_DECL bool non_blocking_sendfile(socket_type s,
+    int fd, boost::uint64_t& offset, size_t count, bool& use_splice,
+    boost::system::error_code& ec, size_t& bytes_transferred);
+
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+
 BOOST_ASIO_DECL socket_type socket(int af, int type, int protocol,
     boost::system::error_code& ec);
 
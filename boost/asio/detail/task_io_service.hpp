@@ -19,10 +19,14 @@
 
 #if !defined(BOOST_ASIO_HAS_IOCP)
 
+#include <vector>
+#include <boost/cstdint.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/asio/io_service.hpp>
+#include <boost/asio/io_service_metrics.hpp>
 #include <boost/asio/detail/atomic_count.hpp>
 #include <boost/asio/detail/call_stack.hpp>
+#include <boost/asio/detail/concurrency_hint.hpp>
 #include <boost/asio/detail/mutex.hpp>
 #include <boost/asio/detail/op_queue.hpp>
 #include <boost/asio/detail/reactor_fwd.hpp>
@@ -42,15 +46,27 @@ public:
   typedef task_io_service_operation operation;
 
   // Constructor. Specifies the number of concurrent threads that are likely to
-  // run the io_service. If set to 1 certain optimisation are performed.
+  // run the io_service. If set to 1 certain optimisation are performed. A
+  // hint created with BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING selects
+  // per-thread run queues.
   BOOST_ASIO_DECL task_io_service(boost::asio::io_service& io_service,
       std::size_t concurrency_hint = 0);
 
+  // Destructor.
+  BOOST_ASIO_DECL ~task_io_service();
+
   // Destroy all user-defined handler objects owned by the service.
   BOOST_ASIO_DECL void shutdown_service();
 
-  // Initialise the task, if required.
-  BOOST_ASIO_DECL void init_task();
+  // Initialise the task, if required. A reactor that is able to wait on
+  // several shards at once may ask for the task to be run once per shard.
+  BOOST_ASIO_DECL void init_task(std::size_t num_shards = 1);
+
+  // Get the concurrency hint passed to the constructor.
+  std::size_t concurrency_hint() const
+  {
+    return concurrency_hint_;
+  }
 
   // Run the event loop until interrupted or no more work.
   BOOST_ASIO_DECL std::size_t run(boost::system::error_code& ec);
@@ -73,6 +89,12 @@ public:
   // Reset in preparation for a subsequent run invocation.
   BOOST_ASIO_DECL void reset();
 
+  // Get a snapshot of the io_service's activity.
+  BOOST_ASIO_DECL io_service_metrics get_metrics();
+
+  // Get a snapshot of the activity of each thread running the io_service.
+  BOOST_ASIO_DECL std::vector<io_service_metrics> get_thread_metrics();
+
   // Notify that some work has started.
   void work_started()
   {
@@ -130,6 +152,9 @@ private:
   // Structure containing information about an idle thread.
   typedef task_io_service_thread_info thread_info;
 
+  // Per-thread run queue used by the work-stealing scheduler.
+  typedef task_io_service_worker_queue worker_queue;
+
   // Request invocation of the given operation, avoiding the thread-private
   // queue, and return immediately. Assumes that work_started() has not yet
   // been called for the operation.
@@ -148,6 +173,61 @@ private:
   BOOST_ASIO_DECL std::size_t do_poll_one(mutex::scoped_lock& lock,
       thread_info& this_thread, const boost::system::error_code& ec);
 
+  // Run at most one operation using the per-thread run queues. May block.
+  BOOST_ASIO_DECL std::size_t do_work_stealing_run_one(
+      thread_info& this_thread, const boost::system::error_code& ec);
+
+  // Attach the calling thread to one of the per-thread run queues.
+  BOOST_ASIO_DECL void attach_worker_queue(thread_info& this_thread);
+
+  // Return the per-thread run queue of the calling thread, if any.
+  BOOST_ASIO_DECL worker_queue* this_worker_queue();
+
+  // Add operations to a per-thread run queue and wake a parked thread, if
+  // there is one, so that it may steal them.
+  BOOST_ASIO_DECL void post_to_worker_queue(worker_queue& q, operation* op);
+  BOOST_ASIO_DECL void post_to_worker_queue(worker_queue& q,
+      op_queue<operation>& ops);
+
+  // Move all handlers on the per-thread run queues to the shared queue.
+  // Assumes that the mutex is held.
+  BOOST_ASIO_DECL void flush_worker_queues();
+
+  // Take an operation from the front of another thread's run queue.
+  BOOST_ASIO_DECL operation* steal_operation(worker_queue& thief,
+      std::size_t& task_result, boost::uint64_t& ready_time);
+
+  // Wake a single thread parked on any of the per-thread run queues, starting
+  // the search after the specified queue. Returns true if a thread was woken.
+  BOOST_ASIO_DECL bool wake_one_parked_thread(worker_queue* after);
+
+  // Remove the calling thread from its queue's list of parked threads, if it
+  // is still on it.
+  BOOST_ASIO_DECL void unpark(thread_info& this_thread);
+
+  // Mark a task shard as blocked, so that it will be interrupted when a
+  // thread is needed. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void task_blocked(operation* task);
+
+  // Remove a task shard from the list of blocked shards, if it is still on
+  // it. Assumes that the mutex is held.
+  BOOST_ASIO_DECL void task_unblocked(operation* task);
+
+  // Interrupt a single blocked task shard. Returns true if one was found.
+  // Assumes that the mutex is held.
+  BOOST_ASIO_DECL bool interrupt_one_task();
+
+  // Determine whether any handlers, as opposed to task shards, are queued.
+  // Assumes that the mutex is held.
+  BOOST_ASIO_DECL bool has_queued_handlers();
+
+  // Run a task shard that has just been taken from the queue, blocking only
+  // if no handlers are queued. Task shards that are left in the queue are
+  // handed to an idle thread or, if there is none, run by the calling thread
+  // as well. Assumes that the mutex is held, and unlocks it.
+  BOOST_ASIO_DECL void run_task(mutex::scoped_lock& lock,
+      thread_info& this_thread, operation* task);
+
   // Stop the task and all idle threads.
   BOOST_ASIO_DECL void stop_all_threads(mutex::scoped_lock& lock);
 
@@ -161,6 +241,67 @@ private:
   BOOST_ASIO_DECL void wake_one_thread_and_unlock(
       mutex::scoped_lock& lock);
 
+  // Wake a single thread to run whatever is left in the queue after a
+  // handler has been taken from it, and always unlock the mutex. A blocked
+  // task shard is only interrupted if handlers are queued, as queued task
+  // shards are not worth waking it for.
+  BOOST_ASIO_DECL void wake_for_queued_work_and_unlock(
+      mutex::scoped_lock& lock);
+
+  // Get the current time in nanoseconds, for timing handlers.
+  BOOST_ASIO_DECL static boost::uint64_t metrics_clock();
+
+  // Record the time at which an operation became ready to run, unless it has
+  // already been recorded. Does nothing if handlers are not being timed.
+  void stamp_ready_time(operation* op)
+  {
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    if (timed_ && op->ready_time_ == 0)
+      op->ready_time_ = metrics_clock();
+#else // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    (void)op;
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  }
+
+  // Record the time at which each operation in a queue became ready to run.
+  BOOST_ASIO_DECL void stamp_ready_time(op_queue<operation>& ops);
+
+  // Take the time at which an operation became ready to run, leaving it clear
+  // so that the operation may be queued again.
+  static boost::uint64_t take_ready_time(operation* op)
+  {
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    boost::uint64_t ready_time = op->ready_time_;
+    op->ready_time_ = 0;
+    return ready_time;
+#else // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    (void)op;
+    return 0;
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  }
+
+  // Count a run of the task by the calling thread, flushing the thread's
+  // counters first if the task is about to block.
+  BOOST_ASIO_DECL void count_task_run(thread_info& this_thread, bool block);
+
+  // Count the handlers in a queue, ignoring task shards.
+  BOOST_ASIO_DECL static boost::uint64_t count_handlers(
+      op_queue<operation>& ops);
+
+  // Add the calling thread's counters to the totals for the io_service.
+  BOOST_ASIO_DECL void flush_metrics(thread_info& this_thread);
+
+  // Add one set of counters to another.
+  BOOST_ASIO_DECL static void add_metrics(
+      io_service_metrics& to, const io_service_metrics& from);
+
+  // Add the calling thread to the list of threads running the io_service.
+  BOOST_ASIO_DECL void add_running_thread(thread_info& this_thread);
+
+  // Flush the calling thread's counters and remove it from the list of
+  // threads running the io_service.
+  BOOST_ASIO_DECL void remove_running_thread(thread_info& this_thread);
+
   // Helper class to perform task-related operations on block exit.
   struct task_cleanup;
   friend struct task_cleanup;
@@ -169,23 +310,64 @@ private:
   struct work_cleanup;
   friend struct work_cleanup;
 
+  // Helper class to call work-related operations on block exit when the
+  // handler was taken from a per-thread run queue.
+  struct work_stealing_cleanup;
+  friend struct work_stealing_cleanup;
+
+  // Helper class to count and time a handler.
+  struct handler_metrics;
+  friend struct handler_metrics;
+
+  // Helper class to remove a thread from the list of running threads on block
+  // exit.
+  struct metrics_cleanup;
+  friend struct metrics_cleanup;
+
+  // The concurrency hint passed to the constructor.
+  const std::size_t concurrency_hint_;
+
   // Whether to optimise for single-threaded use cases.
   const bool one_thread_;
 
+  // Whether to time every handler. Always false unless handler timing is
+  // enabled at compile time.
+  const bool timed_;
+
   // Mutex to protect access to internal data.
   mutable mutex mutex_;
 
   // The task to be run by this service.
   reactor* task_;
 
-  // Operation object to represent the position of the task in the queue.
+  // Operation object to represent the position of a task shard in the queue.
   struct task_operation : operation
   {
-    task_operation() : operation(0) {}
-  } task_operation_;
+    task_operation()
+      : operation(0), shard_(0), next_blocked_(0), blocked_(false) {}
+    std::size_t shard_;
+    task_operation* next_blocked_;
+    bool blocked_;
+  };
+
+  // Determine whether an operation represents a task shard.
+  static bool is_task_operation(operation* o)
+  {
+    return o->func_ == 0;
+  }
+
+  // The operation for the first task shard.
+  task_operation task_operation_;
+
+  // The operations for all task shards. Points to task_operation_ unless the
+  // task has more than one shard.
+  task_operation* task_operations_;
 
-  // Whether the task has been interrupted.
-  bool task_interrupted_;
+  // The number of task shards.
+  std::size_t num_task_operations_;
+
+  // The task shards that are blocked and have not yet been interrupted.
+  task_operation* first_blocked_task_;
 
   // The count of unfinished work.
   atomic_count outstanding_work_;
@@ -204,6 +386,32 @@ private:
 
   // The threads that are currently idle.
   thread_info* first_idle_thread_;
+
+  // The per-thread run queues. Null unless work stealing is enabled.
+  worker_queue* worker_queues_;
+
+  // The number of per-thread run queues.
+  std::size_t num_worker_queues_;
+
+  // Used to distribute threads across the per-thread run queues.
+  atomic_count next_worker_queue_;
+
+  // The number of threads parked on the per-thread run queues.
+  atomic_count parked_threads_;
+
+  // The number of times a blocked task shard has been interrupted. Protected
+  // by the mutex.
+  boost::uint64_t reactor_wakeups_;
+
+  // Mutex to protect access to the totals of the threads' counters.
+  mutex metrics_mutex_;
+
+  // The counters flushed by all threads.
+  io_service_metrics metrics_;
+
+  // The threads that are running the io_service. Protected by the metrics
+  // mutex.
+  thread_info* first_running_thread_;
 };
 
 } // namespace detail
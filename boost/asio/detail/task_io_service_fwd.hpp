@@ -22,6 +22,7 @@ namespace detail {
 class task_io_service;
 class task_io_service_operation;
 struct task_io_service_thread_info;
+struct task_io_service_worker_queue;
 
 } // namespace detail
 } // namespace asio
@@ -15,6 +15,7 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include <boost/cstdint.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/asio/detail/handler_tracking.hpp>
 #include <boost/asio/detail/op_queue.hpp>
@@ -51,6 +52,9 @@ protected:
     : next_(0),
       func_(func),
       task_result_(0)
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+    , ready_time_(0)
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
   {
   }
 
@@ -66,6 +70,9 @@ private:
 protected:
   friend class task_io_service;
   unsigned int task_result_; // Passed into bytes transferred.
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  boost::uint64_t ready_time_; // When queued, if the io_service is timed.
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
 };
 
 } // namespace detail
@@ -15,7 +15,9 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include <boost/asio/io_service_metrics.hpp>
 #include <boost/asio/detail/event.hpp>
+#include <boost/asio/detail/mutex.hpp>
 #include <boost/asio/detail/op_queue.hpp>
 #include <boost/asio/detail/task_io_service_fwd.hpp>
 #include <boost/asio/detail/thread_info_base.hpp>
@@ -26,12 +28,48 @@ namespace boost {
 namespace asio {
 namespace detail {
 
+struct task_io_service_worker_queue;
+
 struct task_io_service_thread_info : public thread_info_base
 {
   event* wakeup_event;
   op_queue<task_io_service_operation> private_op_queue;
   long private_outstanding_work;
   task_io_service_thread_info* next;
+  task_io_service_worker_queue* worker_queue;
+  bool parked;
+  io_service_metrics metrics;
+  long unflushed_metrics;
+  io_service_metrics flushed_metrics;
+  task_io_service_thread_info* next_running;
+};
+
+// Per-thread run queue used when the io_service is created with a
+// work-stealing concurrency hint. Each queue is shared by the threads mapped
+// on to it, and is also the place where those threads park when idle.
+struct task_io_service_worker_queue
+{
+  task_io_service_worker_queue()
+    : stopped_(false),
+      first_idle_thread_(0)
+  {
+  }
+
+  // Mutex to protect access to the queue's data.
+  mutex mutex_;
+
+  // The handlers that are ready to be delivered.
+  op_queue<task_io_service_operation> op_queue_;
+
+  // Mirrors the io_service's stopped flag so that it can be checked without
+  // taking the io_service's mutex.
+  bool stopped_;
+
+  // The threads that are parked on this queue.
+  task_io_service_thread_info* first_idle_thread_;
+
+  // Keep neighbouring queues on separate cache lines.
+  char padding_[64];
 };
 
 } // namespace detail
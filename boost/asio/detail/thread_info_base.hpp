@@ -15,8 +15,10 @@
 # pragma once
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
+#include <boost/asio/detail/config.hpp>
 #include <climits>
 #include <cstddef>
+#include <boost/cstdint.hpp>
 #include <boost/asio/detail/noncopyable.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
@@ -25,63 +27,178 @@ namespace boost {
 namespace asio {
 namespace detail {
 
+// Per-thread cache of memory blocks for handler allocation. Blocks are
+// grouped into size classes, and each class keeps a bounded list of freed
+// blocks for reuse. A block may be freed on a different thread from the one
+// that allocated it, in which case it goes to the freeing thread's cache. The
+// bound on each list stops memory from piling up in a thread that frees more
+// blocks than it allocates.
 class thread_info_base
   : private noncopyable
 {
 public:
+  // Counters describing the use of the caches.
+  struct memory_counters
+  {
+    // Allocations satisfied from a cache.
+    boost::uint64_t hits;
+
+    // Allocations that had to call ::operator new.
+    boost::uint64_t misses;
+
+    // Deallocations that had to call ::operator delete because the block was
+    // too large or the cache for its size class was full.
+    boost::uint64_t overflows;
+  };
+
   thread_info_base()
-    : reusable_memory_(0)
+    : unflushed_(0)
   {
+    for (int i = 0; i < num_size_classes; ++i)
+    {
+      free_list_[i] = 0;
+      free_count_[i] = 0;
+    }
+    counters_.hits = 0;
+    counters_.misses = 0;
+    counters_.overflows = 0;
   }
 
   ~thread_info_base()
   {
-    if (reusable_memory_)
-      ::operator delete(reusable_memory_);
+    for (int i = 0; i < num_size_classes; ++i)
+    {
+      while (void* pointer = free_list_[i])
+      {
+        free_list_[i] = *static_cast<void**>(pointer);
+        ::operator delete(pointer);
+      }
+    }
+
+    if (unflushed_)
+      flush_memory_counters();
   }
 
   static void* allocate(thread_info_base* this_thread, std::size_t size)
   {
-    if (this_thread && this_thread->reusable_memory_)
+    int size_class = size_class_for(size);
+    if (this_thread)
     {
-      void* const pointer = this_thread->reusable_memory_;
-      this_thread->reusable_memory_ = 0;
-
-      unsigned char* const mem = static_cast<unsigned char*>(pointer);
-      if (static_cast<std::size_t>(mem[0]) >= size)
+      if (size_class != no_size_class)
       {
-        mem[size] = mem[0];
-        return pointer;
+        if (void* const pointer = this_thread->free_list_[size_class])
+        {
+          this_thread->free_list_[size_class] = *static_cast<void**>(pointer);
+          --this_thread->free_count_[size_class];
+          ++this_thread->counters_.hits;
+          this_thread->count_memory_event();
+
+          unsigned char* const mem = static_cast<unsigned char*>(pointer);
+          mem[size] = static_cast<unsigned char>(size_class + 1);
+          return pointer;
+        }
       }
 
-      ::operator delete(pointer);
+      ++this_thread->counters_.misses;
+      this_thread->count_memory_event();
     }
 
-    void* const pointer = ::operator new(size + 1);
+    std::size_t block_size = (size_class == no_size_class)
+      ? size + 1 : size_class_chunks(size_class) * chunk_size;
+    void* const pointer = ::operator new(block_size);
     unsigned char* const mem = static_cast<unsigned char*>(pointer);
-    mem[size] = (size <= UCHAR_MAX) ? static_cast<unsigned char>(size) : 0;
+    mem[size] = static_cast<unsigned char>(size_class + 1);
     return pointer;
   }
 
   static void deallocate(thread_info_base* this_thread,
       void* pointer, std::size_t size)
   {
-    if (size <= UCHAR_MAX)
+    if (this_thread)
     {
-      if (this_thread && this_thread->reusable_memory_ == 0)
+      unsigned char* const mem = static_cast<unsigned char*>(pointer);
+      int size_class = static_cast<int>(mem[size]) - 1;
+      if (size_class != no_size_class
+          && this_thread->free_count_[size_class] < max_free_blocks)
       {
-        unsigned char* const mem = static_cast<unsigned char*>(pointer);
-        mem[0] = mem[size];
-        this_thread->reusable_memory_ = pointer;
+        *static_cast<void**>(pointer) = this_thread->free_list_[size_class];
+        this_thread->free_list_[size_class] = pointer;
+        ++this_thread->free_count_[size_class];
         return;
       }
+
+      ++this_thread->counters_.overflows;
+      this_thread->count_memory_event();
     }
 
     ::operator delete(pointer);
   }
 
+  // Get the counters for all threads. Each thread adds its own counts to the
+  // totals periodically and when it exits, so the calling thread's counts are
+  // flushed first.
+  BOOST_ASIO_DECL static memory_counters get_memory_counters(
+      thread_info_base* this_thread);
+
 private:
-  void* reusable_memory_;
+  enum
+  {
+    // The unit in which block sizes are measured.
+    chunk_size = 16,
+
+    // The number of size classes.
+    num_size_classes = 12,
+
+    // The size class value for blocks that are too large to be cached.
+    no_size_class = -1,
+
+    // The maximum number of freed blocks kept in each size class.
+    max_free_blocks = 16,
+
+    // The number of events after which a thread flushes its counters.
+    flush_interval = 1024
+  };
+
+  // Get the number of chunks in the blocks of a size class.
+  static std::size_t size_class_chunks(int size_class)
+  {
+    static const unsigned char chunks[num_size_classes] =
+      { 1, 2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64 };
+    return chunks[size_class];
+  }
+
+  // Get the size class whose blocks can hold the given size, plus the byte
+  // used to record the size class.
+  static int size_class_for(std::size_t size)
+  {
+    std::size_t chunks = (size + chunk_size) / chunk_size;
+    for (int i = 0; i < num_size_classes; ++i)
+      if (size_class_chunks(i) >= chunks)
+        return i;
+    return no_size_class;
+  }
+
+  // Note that the counters have changed, flushing them if required.
+  void count_memory_event()
+  {
+    if (++unflushed_ == flush_interval)
+      flush_memory_counters();
+  }
+
+  // Add the thread's counts to the totals for all threads.
+  BOOST_ASIO_DECL void flush_memory_counters();
+
+  // The freed blocks of each size class, linked through their first bytes.
+  void* free_list_[num_size_classes];
+
+  // The number of blocks in each free list.
+  int free_count_[num_size_classes];
+
+  // The counts for this thread that have not yet been added to the totals.
+  memory_counters counters_;
+
+  // The number of events since the counters were last flushed.
+  int unflushed_;
 };
 
 } // namespace detail
@@ -90,4 +207,8 @@ private:
 
 #include <boost/asio/detail/pop_options.hpp>
 
+#if defined(BOOST_ASIO_HEADER_ONLY)
+# include <boost/asio/detail/impl/thread_info_base.ipp>
+#endif // defined(BOOST_ASIO_HEADER_ONLY)
+
 #endif // BOOST_ASIO_DETAIL_THREAD_INFO_BASE_HPP
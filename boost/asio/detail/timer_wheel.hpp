@@ -0,0 +1,523 @@
+//
+// detail/timer_wheel.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_DETAIL_TIMER_WHEEL_HPP
+#define BOOST_ASIO_DETAIL_TIMER_WHEEL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <cstddef>
+#include <boost/config.hpp>
+#include <boost/limits.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/asio/detail/chrono_time_traits.hpp>
+#include <boost/asio/detail/date_time_fwd.hpp>
+#include <boost/asio/detail/op_queue.hpp>
+#include <boost/asio/detail/timer_queue_base.hpp>
+#include <boost/asio/detail/timer_queue_fwd.hpp>
+#include <boost/asio/detail/wait_op.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/timer_wheel_traits.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+namespace detail {
+
+// A hierarchical timing wheel. Time is divided into ticks of one millisecond,
+// measured from the time the wheel was created. The first level of the wheel
+// holds the timers that expire within the current block of 256 ticks, with
+// one slot per tick. Each further level holds a block 256 times as long as
+// the level below it, and its timers are cascaded into the lower levels as
+// the wheel reaches them. Timers that lie beyond the last level are kept in
+// an overflow list. Scheduling and cancelling a timer take constant time.
+template <typename Time_Traits>
+class timer_wheel
+  : public timer_queue_base
+{
+public:
+  // The time type.
+  typedef typename Time_Traits::time_type time_type;
+
+  // The duration type.
+  typedef typename Time_Traits::duration_type duration_type;
+
+  // Per-timer data.
+  class per_timer_data
+  {
+  public:
+    per_timer_data()
+      : tick_(0), slot_(0), slot_next_(0), slot_prev_(0), next_(0), prev_(0)
+    {
+    }
+
+  private:
+    friend class timer_wheel;
+
+    // The operations waiting on the timer.
+    op_queue<wait_op> op_queue_;
+
+    // The time when the timer should fire.
+    time_type time_;
+
+    // The tick in which the timer expires.
+    boost::int64_t tick_;
+
+    // The slot that holds the timer.
+    std::size_t slot_;
+
+    // Pointers to adjacent timers in the same slot.
+    per_timer_data* slot_next_;
+    per_timer_data* slot_prev_;
+
+    // Pointers to adjacent timers in a linked list.
+    per_timer_data* next_;
+    per_timer_data* prev_;
+  };
+
+  // Constructor.
+  timer_wheel()
+    : timers_(0),
+      origin_(Time_Traits::now()),
+      current_tick_(0)
+  {
+    for (std::size_t i = 0; i < overflow_slot + 1; ++i)
+      slots_[i] = 0;
+    for (std::size_t i = 0; i < occupied_words; ++i)
+      occupied_[i] = 0;
+  }
+
+  // Add a new timer to the queue. Returns true if the timer may be the one
+  // that expires earliest, in which case the reactor's event demultiplexing
+  // function call may need to be interrupted and restarted.
+  bool enqueue_timer(const time_type& time, per_timer_data& timer, wait_op* op)
+  {
+    bool earliest = false;
+
+    // Enqueue the timer object.
+    if (timer.prev_ == 0 && &timer != timers_)
+    {
+      if (this->is_positive_infinity(time))
+      {
+        // No slot is required for timers that never expire.
+        timer.slot_ = no_slot;
+      }
+      else
+      {
+        timer.time_ = time;
+        timer.tick_ = to_tick(time);
+        earliest = timer.tick_ <= next_tick();
+        link_timer(timer);
+      }
+
+      // Insert the new timer into the linked list of active timers.
+      timer.next_ = timers_;
+      timer.prev_ = 0;
+      if (timers_)
+        timers_->prev_ = &timer;
+      timers_ = &timer;
+    }
+
+    // Enqueue the individual timer operation.
+    timer.op_queue_.push(op);
+
+    return earliest;
+  }
+
+  // Whether there are no timers in the queue.
+  virtual bool empty() const
+  {
+    return timers_ == 0;
+  }
+
+  // Get the time for the timer that is earliest in the queue.
+  virtual long wait_duration_msec(long max_duration) const
+  {
+    boost::int64_t usec = 0;
+    if (!next_expiry_usec(usec))
+      return max_duration;
+
+    if (usec <= 0)
+      return 0;
+    boost::int64_t msec = usec / 1000;
+    if (msec == 0)
+      return 1;
+    if (msec > max_duration)
+      return max_duration;
+    return static_cast<long>(msec);
+  }
+
+  // Get the time for the timer that is earliest in the queue.
+  virtual long wait_duration_usec(long max_duration) const
+  {
+    boost::int64_t usec = 0;
+    if (!next_expiry_usec(usec))
+      return max_duration;
+
+    if (usec <= 0)
+      return 0;
+    if (usec > max_duration)
+      return max_duration;
+    return static_cast<long>(usec);
+  }
+
+  // Dequeue all timers not later than the current time.
+  virtual void get_ready_timers(op_queue<operation>& ops)
+  {
+    if (!timers_)
+      return;
+
+    const time_type now = Time_Traits::now();
+    const boost::int64_t now_tick = to_tick(now);
+    for (;;)
+    {
+      // Move directly to the next tick that holds timers. Nothing needs to be
+      // done for the ticks in between.
+      boost::int64_t tick = next_tick();
+      if (tick > now_tick)
+      {
+        if (now_tick > current_tick_)
+          advance_to(now_tick);
+        break;
+      }
+      advance_to(tick);
+
+      // The timers in an earlier tick have all expired. The timers in the
+      // current tick are checked against their exact expiry times.
+      per_timer_data* timer = slots_[tick & slot_mask];
+      while (timer)
+      {
+        per_timer_data* next = timer->slot_next_;
+        if (!Time_Traits::less_than(now, timer->time_))
+        {
+          ops.push(timer->op_queue_);
+          remove_timer(*timer);
+        }
+        timer = next;
+      }
+
+      if (tick == now_tick)
+        break;
+    }
+  }
+
+  // Dequeue all timers.
+  virtual void get_all_timers(op_queue<operation>& ops)
+  {
+    while (timers_)
+    {
+      per_timer_data* timer = timers_;
+      timers_ = timers_->next_;
+      ops.push(timer->op_queue_);
+      timer->slot_ = no_slot;
+      timer->slot_next_ = 0;
+      timer->slot_prev_ = 0;
+      timer->next_ = 0;
+      timer->prev_ = 0;
+    }
+
+    for (std::size_t i = 0; i < overflow_slot + 1; ++i)
+      slots_[i] = 0;
+    for (std::size_t i = 0; i < occupied_words; ++i)
+      occupied_[i] = 0;
+  }
+
+  // Cancel and dequeue operations for the given timer.
+  std::size_t cancel_timer(per_timer_data& timer, op_queue<operation>& ops,
+      std::size_t max_cancelled = (std::numeric_limits<std::size_t>::max)())
+  {
+    std::size_t num_cancelled = 0;
+    if (timer.prev_ != 0 || &timer == timers_)
+    {
+      while (wait_op* op = (num_cancelled != max_cancelled)
+          ? timer.op_queue_.front() : 0)
+      {
+        op->ec_ = boost::asio::error::operation_aborted;
+        timer.op_queue_.pop();
+        ops.push(op);
+        ++num_cancelled;
+      }
+      if (timer.op_queue_.empty())
+        remove_timer(timer);
+    }
+    return num_cancelled;
+  }
+
+private:
+  // The layout of the wheel.
+  enum
+  {
+    slot_bits = 8,
+    slots_per_level = 1 << slot_bits,
+    slot_mask = slots_per_level - 1,
+    num_levels = 4,
+    overflow_slot = num_levels * slots_per_level,
+    no_slot = overflow_slot + 1,
+    occupied_words = overflow_slot / 64
+  };
+
+  // Convert an absolute time into a tick.
+  boost::int64_t to_tick(const time_type& time) const
+  {
+    return Time_Traits::to_posix_duration(
+        Time_Traits::subtract(time, origin_)).total_milliseconds();
+  }
+
+  // Put a timer into the slot that corresponds to its tick. A timer whose
+  // tick has already passed is put into the current tick.
+  void link_timer(per_timer_data& timer)
+  {
+    if (timer.tick_ < current_tick_)
+      timer.tick_ = current_tick_;
+
+    std::size_t slot = overflow_slot;
+    for (std::size_t level = 0; level < num_levels; ++level)
+    {
+      std::size_t shift = level * slot_bits;
+      if ((timer.tick_ >> (shift + slot_bits))
+          == (current_tick_ >> (shift + slot_bits)))
+      {
+        slot = level * slots_per_level
+          + static_cast<std::size_t>((timer.tick_ >> shift) & slot_mask);
+        break;
+      }
+    }
+
+    timer.slot_ = slot;
+    timer.slot_prev_ = 0;
+    timer.slot_next_ = slots_[slot];
+    if (slots_[slot])
+      slots_[slot]->slot_prev_ = &timer;
+    else if (slot != overflow_slot)
+      occupied_[slot / 64] |= boost::uint64_t(1) << (slot % 64);
+    slots_[slot] = &timer;
+  }
+
+  // Take a timer out of its slot.
+  void unlink_timer(per_timer_data& timer)
+  {
+    if (timer.slot_ == no_slot)
+      return;
+
+    if (timer.slot_prev_)
+      timer.slot_prev_->slot_next_ = timer.slot_next_;
+    else if ((slots_[timer.slot_] = timer.slot_next_) == 0
+        && timer.slot_ != overflow_slot)
+      occupied_[timer.slot_ / 64] &=
+        ~(boost::uint64_t(1) << (timer.slot_ % 64));
+    if (timer.slot_next_)
+      timer.slot_next_->slot_prev_ = timer.slot_prev_;
+    timer.slot_ = no_slot;
+    timer.slot_next_ = 0;
+    timer.slot_prev_ = 0;
+  }
+
+  // Find the first occupied slot in a level, starting from the given index.
+  // Returns slots_per_level if there is none.
+  std::size_t find_slot(std::size_t level, std::size_t index) const
+  {
+    while (index < slots_per_level)
+    {
+      std::size_t slot = level * slots_per_level + index;
+      boost::uint64_t word = occupied_[slot / 64] >> (slot % 64);
+      if (word)
+        return index + lowest_bit(word);
+      index = (index / 64 + 1) * 64;
+    }
+    return slots_per_level;
+  }
+
+  // Get the index of the lowest set bit in a non-zero word.
+  static std::size_t lowest_bit(boost::uint64_t word)
+  {
+#if defined(__GNUC__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else // defined(__GNUC__)
+    std::size_t index = 0;
+    while ((word & 1) == 0)
+    {
+      word >>= 1;
+      ++index;
+    }
+    return index;
+#endif // defined(__GNUC__)
+  }
+
+  // Get the first tick at which the wheel has work to do, either because a
+  // slot in the first level holds timers or because a slot in a higher level
+  // must be cascaded. Returns the largest tick value if the wheel is empty.
+  boost::int64_t next_tick() const
+  {
+    for (std::size_t level = 0; level < num_levels; ++level)
+    {
+      // The slot for the current block of a higher level has already been
+      // cascaded, so the search starts at the slot after it.
+      std::size_t shift = level * slot_bits;
+      std::size_t index = find_slot(level, static_cast<std::size_t>(
+            (current_tick_ >> shift) & slot_mask) + (level == 0 ? 0 : 1));
+      if (index != slots_per_level)
+      {
+        return ((current_tick_ >> (shift + slot_bits)) << (shift + slot_bits))
+          | (static_cast<boost::int64_t>(index) << shift);
+      }
+    }
+
+    if (slots_[overflow_slot])
+    {
+      std::size_t shift = num_levels * slot_bits;
+      return ((current_tick_ >> shift) + 1) << shift;
+    }
+
+    return (std::numeric_limits<boost::int64_t>::max)();
+  }
+
+  // Get the number of microseconds until the wheel has work to do. Returns
+  // false if there are no timers in the wheel.
+  bool next_expiry_usec(boost::int64_t& usec) const
+  {
+    boost::int64_t tick = next_tick();
+    if (tick == (std::numeric_limits<boost::int64_t>::max)())
+      return false;
+
+    const time_type now = Time_Traits::now();
+    if ((tick >> slot_bits) == (current_tick_ >> slot_bits))
+    {
+      // The timers in the first level are due at their exact expiry times.
+      per_timer_data* timer = slots_[tick & slot_mask];
+      const time_type* earliest = &timer->time_;
+      for (timer = timer->slot_next_; timer; timer = timer->slot_next_)
+        if (Time_Traits::less_than(timer->time_, *earliest))
+          earliest = &timer->time_;
+      usec = Time_Traits::to_posix_duration(
+          Time_Traits::subtract(*earliest, now)).total_microseconds();
+    }
+    else
+    {
+      // The timers in a higher level must be cascaded when their tick begins.
+      usec = tick * 1000 - Time_Traits::to_posix_duration(
+          Time_Traits::subtract(now, origin_)).total_microseconds();
+    }
+
+    return true;
+  }
+
+  // Move the wheel to the given tick, cascading the slots of the higher levels
+  // whose blocks begin between the current tick and the new one.
+  void advance_to(boost::int64_t tick)
+  {
+    boost::int64_t previous = current_tick_;
+    current_tick_ = tick;
+
+    if ((previous >> (num_levels * slot_bits))
+        != (tick >> (num_levels * slot_bits)))
+      cascade(overflow_slot);
+
+    for (std::size_t level = num_levels - 1; level > 0; --level)
+    {
+      std::size_t shift = level * slot_bits;
+      if ((previous >> shift) != (tick >> shift))
+      {
+        cascade(level * slots_per_level
+            + static_cast<std::size_t>((tick >> shift) & slot_mask));
+      }
+    }
+  }
+
+  // Redistribute the timers in a slot according to the current tick.
+  void cascade(std::size_t slot)
+  {
+    per_timer_data* timer = slots_[slot];
+    slots_[slot] = 0;
+    if (slot != overflow_slot)
+      occupied_[slot / 64] &= ~(boost::uint64_t(1) << (slot % 64));
+
+    while (timer)
+    {
+      per_timer_data* next = timer->slot_next_;
+      link_timer(*timer);
+      timer = next;
+    }
+  }
+
+  // Remove a timer from the wheel and list of timers.
+  void remove_timer(per_timer_data& timer)
+  {
+    // Remove the timer from the wheel.
+    unlink_timer(timer);
+
+    // Remove the timer from the linked list of active timers.
+    if (timers_ == &timer)
+      timers_ = timer.next_;
+    if (timer.prev_)
+      timer.prev_->next_ = timer.next_;
+    if (timer.next_)
+      timer.next_->prev_= timer.prev_;
+    timer.next_ = 0;
+    timer.prev_ = 0;
+  }
+
+  // Determine if the specified absolute time is positive infinity.
+  template <typename Time_Type>
+  static bool is_positive_infinity(const Time_Type&)
+  {
+    return false;
+  }
+
+  // Determine if the specified absolute time is positive infinity.
+  template <typename T, typename TimeSystem>
+  static bool is_positive_infinity(
+      const boost::date_time::base_time<T, TimeSystem>& time)
+  {
+    return time.is_pos_infinity();
+  }
+
+  // The head of a linked list of all active timers.
+  per_timer_data* timers_;
+
+  // The time from which ticks are counted.
+  time_type origin_;
+
+  // The tick that the wheel has reached.
+  boost::int64_t current_tick_;
+
+  // The slots of each level, followed by the overflow list.
+  per_timer_data* slots_[overflow_slot + 1];
+
+  // One bit for each slot, set when the slot holds any timers.
+  boost::uint64_t occupied_[occupied_words];
+};
+
+// Timer queue for timers whose traits select the timer wheel.
+template <typename Time_Traits>
+class timer_queue<boost::asio::timer_wheel_traits<Time_Traits> >
+  : public timer_wheel<boost::asio::timer_wheel_traits<Time_Traits> >
+{
+};
+
+// Timer queue for waitable timers whose wait traits select the timer wheel.
+template <typename Clock, typename WaitTraits>
+class timer_queue<chrono_time_traits<Clock,
+    boost::asio::timer_wheel_traits<WaitTraits> > >
+  : public timer_wheel<chrono_time_traits<Clock,
+      boost::asio::timer_wheel_traits<WaitTraits> > >
+{
+};
+
+} // namespace detail
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_DETAIL_TIMER_WHEEL_HPP
@@ -19,6 +19,7 @@
 
 #if defined(BOOST_ASIO_HAS_IOCP)
 
+#include <vector>
 #include <boost/limits.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/detail/call_stack.hpp>
@@ -92,6 +93,22 @@ public:
     ::InterlockedExchange(&stopped_, 0);
   }
 
+  // Get a snapshot of the io_service's activity. Only the outstanding work is
+  // tracked by this implementation.
+  io_service_metrics get_metrics()
+  {
+    io_service_metrics metrics = io_service_metrics();
+    metrics.outstanding_work = ::InterlockedExchangeAdd(&outstanding_work_, 0);
+    return metrics;
+  }
+
+  // Get a snapshot of the activity of each thread running the io_service.
+  // Threads are not tracked by this implementation.
+  std::vector<io_service_metrics> get_thread_metrics()
+  {
+    return std::vector<io_service_metrics>();
+  }
+
   // Notify that some work has started.
   void work_started()
   {
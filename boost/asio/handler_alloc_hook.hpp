@@ -17,6 +17,7 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
+#include <boost/cstdint.hpp>
 
 #include <boost/asio/detail/push_options.hpp>
 
@@ -71,6 +72,43 @@ BOOST_ASIO_DECL void* asio_handler_allocate(
 BOOST_ASIO_DECL void asio_handler_deallocate(
     void* pointer, std::size_t size, ...);
 
+/// Counters that describe the behaviour of the default handler allocator.
+/**
+ * The default implementation of asio_handler_allocate keeps a cache of freed
+ * memory blocks in each thread that is running an io_service. The cache is
+ * divided into size classes, and a bounded number of blocks is kept for each
+ * class.
+ *
+ * The counters cover all threads for the lifetime of the program. Each thread
+ * adds its counts to the totals periodically and when it stops running the
+ * io_service, so the totals may lag behind the most recent allocations.
+ * Allocations made from threads that are not running an io_service bypass the
+ * cache and are not counted.
+ *
+ * @sa get_handler_allocation_counters.
+ */
+struct handler_allocation_counters
+{
+  /// The number of allocations satisfied from a thread's cache.
+  boost::uint64_t hits;
+
+  /// The number of allocations that called <tt>::operator new</tt>.
+  boost::uint64_t misses;
+
+  /// The number of deallocations that called <tt>::operator delete</tt>
+  /// because the block was too large to cache, or because the cache for its
+  /// size class was full.
+  boost::uint64_t overflows;
+};
+
+/// Get the counters for the default handler allocator.
+/**
+ * @returns The counters for all threads. All counters are zero when the
+ * cache has been disabled by defining
+ * @c BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING.
+ */
+BOOST_ASIO_DECL handler_allocation_counters get_handler_allocation_counters();
+
 } // namespace asio
 } // namespace boost
 
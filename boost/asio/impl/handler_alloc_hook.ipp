@@ -68,6 +68,27 @@ void asio_handler_deallocate(void* pointer, std::size_t size, ...)
 #endif // !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
 }
 
+handler_allocation_counters get_handler_allocation_counters()
+{
+  handler_allocation_counters counters = { 0, 0, 0 };
+#if !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
+# if defined(BOOST_ASIO_HAS_IOCP)
+  typedef detail::win_iocp_io_service io_service_impl;
+  typedef detail::win_iocp_thread_info thread_info;
+# else // defined(BOOST_ASIO_HAS_IOCP)
+  typedef detail::task_io_service io_service_impl;
+  typedef detail::task_io_service_thread_info thread_info;
+# endif // defined(BOOST_ASIO_HAS_IOCP)
+  typedef detail::call_stack<io_service_impl, thread_info> call_stack;
+  detail::thread_info_base::memory_counters totals =
+    thread_info::get_memory_counters(call_stack::top());
+  counters.hits = totals.hits;
+  counters.misses = totals.misses;
+  counters.overflows = totals.overflows;
+#endif // !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
+  return counters;
+}
+
 } // namespace asio
 } // namespace boost
 
@@ -120,6 +120,16 @@ void io_service::reset()
   impl_.reset();
 }
 
+io_service_metrics io_service::get_metrics() const
+{
+  return impl_.get_metrics();
+}
+
+std::vector<io_service_metrics> io_service::get_thread_metrics() const
+{
+  return impl_.get_thread_metrics();
+}
+
 void io_service::notify_fork(boost::asio::io_service::fork_event event)
 {
   service_registry_->notify_fork(event);
@@ -0,0 +1,219 @@
+//
+// impl/send_file.hpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_IMPL_SEND_FILE_HPP
+#define BOOST_ASIO_IMPL_SEND_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/detail/handler_alloc_helpers.hpp>
+#include <boost/asio/detail/handler_invoke_helpers.hpp>
+#include <boost/asio/detail/handler_type_requirements.hpp>
+#include <boost/asio/detail/throw_error.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+template <typename SyncFileSendStream, typename DescriptorService>
+std::size_t send_file(SyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length, boost::system::error_code& ec)
+{
+  ec = boost::system::error_code();
+  std::size_t total_transferred = 0;
+  while (total_transferred < length)
+  {
+    // A send stops early once the pipe has been drained.
+    total_transferred += s.send_file(d.native_handle(),
+        0, length - total_transferred, ec);
+    if (ec || total_transferred == length)
+      break;
+
+    // Wait for more data to arrive in the pipe.
+    d.read_some(null_buffers(), ec);
+    if (ec)
+      break;
+  }
+  return total_transferred;
+}
+
+template <typename SyncFileSendStream, typename DescriptorService>
+inline std::size_t send_file(SyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length)
+{
+  boost::system::error_code ec;
+  std::size_t bytes_transferred = send_file(s, d, length, ec);
+  boost::asio::detail::throw_error(ec, "send_file");
+  return bytes_transferred;
+}
+
+namespace detail
+{
+  template <typename AsyncFileSendStream, typename Descriptor,
+      typename WriteHandler>
+  class send_file_op
+  {
+  public:
+    send_file_op(AsyncFileSendStream& stream, Descriptor& descriptor,
+        std::size_t length, WriteHandler& handler)
+      : stream_(stream),
+        descriptor_(descriptor),
+        length_(length),
+        total_transferred_(0),
+        waiting_(false),
+        handler_(BOOST_ASIO_MOVE_CAST(WriteHandler)(handler))
+    {
+    }
+
+#if defined(BOOST_ASIO_HAS_MOVE)
+    send_file_op(const send_file_op& other)
+      : stream_(other.stream_),
+        descriptor_(other.descriptor_),
+        length_(other.length_),
+        total_transferred_(other.total_transferred_),
+        waiting_(other.waiting_),
+        handler_(other.handler_)
+    {
+    }
+
+    send_file_op(send_file_op&& other)
+      : stream_(other.stream_),
+        descriptor_(other.descriptor_),
+        length_(other.length_),
+        total_transferred_(other.total_transferred_),
+        waiting_(other.waiting_),
+        handler_(BOOST_ASIO_MOVE_CAST(WriteHandler)(other.handler_))
+    {
+    }
+#endif // defined(BOOST_ASIO_HAS_MOVE)
+
+    void operator()(const boost::system::error_code& ec,
+        std::size_t bytes_transferred, int start = 0)
+    {
+      if (start)
+      {
+        // The pipe may already hold data, so try sending straight away.
+        stream_.async_send_file(descriptor_.native_handle(), 0,
+            length_, BOOST_ASIO_MOVE_CAST(send_file_op)(*this));
+        return;
+      }
+
+      if (waiting_)
+      {
+        // The pipe has become readable.
+        waiting_ = false;
+        if (!ec)
+        {
+          stream_.async_send_file(descriptor_.native_handle(), 0,
+              length_ - total_transferred_,
+              BOOST_ASIO_MOVE_CAST(send_file_op)(*this));
+          return;
+        }
+      }
+      else
+      {
+        // A send that stops short without an error has drained the pipe, so
+        // wait for more data to arrive before trying again.
+        total_transferred_ += bytes_transferred;
+        if (!ec && total_transferred_ < length_)
+        {
+          waiting_ = true;
+          descriptor_.async_read_some(null_buffers(),
+              BOOST_ASIO_MOVE_CAST(send_file_op)(*this));
+          return;
+        }
+      }
+
+      handler_(ec, static_cast<const std::size_t&>(total_transferred_));
+    }
+
+  //private:
+    AsyncFileSendStream& stream_;
+    Descriptor& descriptor_;
+    std::size_t length_;
+    std::size_t total_transferred_;
+    bool waiting_;
+    WriteHandler handler_;
+  };
+
+  template <typename AsyncFileSendStream, typename Descriptor,
+      typename WriteHandler>
+  inline void* asio_handler_allocate(std::size_t size,
+      send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>* this_handler)
+  {
+    return boost_asio_handler_alloc_helpers::allocate(
+        size, this_handler->handler_);
+  }
+
+  template <typename AsyncFileSendStream, typename Descriptor,
+      typename WriteHandler>
+  inline void asio_handler_deallocate(void* pointer, std::size_t size,
+      send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>* this_handler)
+  {
+    boost_asio_handler_alloc_helpers::deallocate(
+        pointer, size, this_handler->handler_);
+  }
+
+  template <typename Function, typename AsyncFileSendStream,
+      typename Descriptor, typename WriteHandler>
+  inline void asio_handler_invoke(Function& function,
+      send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>* this_handler)
+  {
+    boost_asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+  }
+
+  template <typename Function, typename AsyncFileSendStream,
+      typename Descriptor, typename WriteHandler>
+  inline void asio_handler_invoke(const Function& function,
+      send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>* this_handler)
+  {
+    boost_asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+  }
+
+  template <typename AsyncFileSendStream, typename Descriptor,
+      typename WriteHandler>
+  inline send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>
+  make_send_file_op(AsyncFileSendStream& s, Descriptor& d,
+      std::size_t length, WriteHandler handler)
+  {
+    return send_file_op<AsyncFileSendStream, Descriptor, WriteHandler>(
+        s, d, length, handler);
+  }
+} // namespace detail
+
+template <typename AsyncFileSendStream, typename DescriptorService,
+    typename WriteHandler>
+inline void async_send_file(AsyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length, BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+{
+  // If you get an error on the following line it means that your handler does
+  // not meet the documented type requirements for a WriteHandler.
+  BOOST_ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+  detail::make_send_file_op(s, d, length,
+      BOOST_ASIO_MOVE_CAST(WriteHandler)(handler))(
+        boost::system::error_code(), 0, 1);
+}
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_IMPL_SEND_FILE_HPP
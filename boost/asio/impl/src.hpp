@@ -26,10 +26,12 @@
 #include <boost/asio/detail/impl/descriptor_ops.ipp>
 #include <boost/asio/detail/impl/dev_poll_reactor.ipp>
 #include <boost/asio/detail/impl/epoll_reactor.ipp>
+#include <boost/asio/detail/impl/io_uring_reactor.ipp>
 #include <boost/asio/detail/impl/eventfd_select_interrupter.ipp>
 #include <boost/asio/detail/impl/handler_tracking.ipp>
 #include <boost/asio/detail/impl/kqueue_reactor.ipp>
 #include <boost/asio/detail/impl/pipe_select_interrupter.ipp>
+#include <boost/asio/detail/impl/pooled_strand_service.ipp>
 #include <boost/asio/detail/impl/posix_event.ipp>
 #include <boost/asio/detail/impl/posix_mutex.ipp>
 #include <boost/asio/detail/impl/posix_thread.ipp>
@@ -45,6 +47,7 @@
 #include <boost/asio/detail/impl/socket_select_interrupter.ipp>
 #include <boost/asio/detail/impl/strand_service.ipp>
 #include <boost/asio/detail/impl/task_io_service.ipp>
+#include <boost/asio/detail/impl/thread_info_base.ipp>
 #include <boost/asio/detail/impl/throw_error.ipp>
 #include <boost/asio/detail/impl/timer_queue_ptime.ipp>
 #include <boost/asio/detail/impl/timer_queue_set.ipp>
@@ -19,9 +19,12 @@
 #include <cstddef>
 #include <stdexcept>
 #include <typeinfo>
+#include <vector>
+#include <boost/asio/detail/concurrency_hint.hpp>
 #include <boost/asio/detail/noncopyable.hpp>
 #include <boost/asio/detail/service_registry_fwd.hpp>
 #include <boost/asio/detail/wrapped_handler.hpp>
+#include <boost/asio/io_service_metrics.hpp>
 #include <boost/system/error_code.hpp>
 
 #if defined(BOOST_ASIO_HAS_IOCP)
@@ -212,6 +215,36 @@ public:
    *
    * @param concurrency_hint A suggestion to the implementation on how many
    * threads it should allow to run simultaneously.
+   *
+   * @par Work stealing
+   * On platforms that do not use I/O completion ports, a hint constructed
+   * using @c BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING_THREADS(n) gives each
+   * thread that calls run() its own queue of ready handlers. Handlers posted
+   * from within a handler are added to the calling thread's queue rather than
+   * a queue shared by all threads, and idle threads steal handlers from the
+   * queues of other threads. This reduces contention when many threads run
+   * the io_service. The argument @c n is the number of threads expected to
+   * call run(), or 0 if unknown.
+   *
+   * @par Reactor shards
+   * When the @c epoll reactor is used, a hint constructed using
+   * @c BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS_THREADS(n) divides the
+   * reactor into @c n shards, each with its own @c epoll instance. Sockets
+   * and descriptors are assigned to a shard when they are opened, and up to
+   * @c n threads may wait for readiness at the same time. If fewer than @c n
+   * threads call run(), an idle thread waits on several shards at once.
+   * Expired timers are handled by whichever waiting thread the kernel wakes,
+   * provided that @c timerfd and @c EPOLLEXCLUSIVE (Linux 4.5 or later) are
+   * available. Otherwise timers are handled only by the first shard. The
+   * flags of the two hints may be combined using
+   * @c BOOST_ASIO_CONCURRENCY_HINT(flags, n).
+   *
+   * @par Metrics
+   * Adding the flag @c BOOST_ASIO_CONCURRENCY_HINT_METRICS times every
+   * handler, so that the histograms returned by get_metrics() are filled in.
+   * The flag has no effect unless @c BOOST_ASIO_ENABLE_HANDLER_TIMING is
+   * defined, as the time at which each handler became ready is stored in the
+   * handler's operation.
    */
   BOOST_ASIO_DECL explicit io_service(std::size_t concurrency_hint);
 
@@ -419,6 +452,38 @@ public:
    */
   BOOST_ASIO_DECL void reset();
 
+  /// Get a snapshot of the io_service object's activity.
+  /**
+   * This function may be called from any thread, including threads that are
+   * running the io_service. The threads running the io_service count handlers
+   * in per-thread storage, and take a lock to add them to the totals every 1024
+   * handlers, before they block, and when they return from run(), run_one(),
+   * poll() or poll_one(). Reactor wakeups are counted under the lock that
+   * protects the handler queue. This function takes the same locks to read
+   * the counters.
+   *
+   * @return The counters, queue depth and histograms described by
+   * io_service_metrics.
+   */
+  BOOST_ASIO_DECL io_service_metrics get_metrics() const;
+
+  /// Get a snapshot of the activity of each thread running the io_service.
+  /**
+   * This function may be called from any thread. It returns one entry for each
+   * call to run(), run_one(), poll() or poll_one() that is in progress, in no
+   * particular order. Each entry holds the counters and histograms for the
+   * handlers run by that call, as of the last time the thread added them to
+   * the totals. As a thread does so before it blocks, the entries for idle
+   * threads are up to date.
+   *
+   * The queue depth, outstanding work and reactor wakeups are not counted per
+   * thread, and are zero. On Windows, when I/O completion ports are used, the
+   * returned vector is empty.
+   *
+   * @return The counters and histograms of each running thread.
+   */
+  BOOST_ASIO_DECL std::vector<io_service_metrics> get_thread_metrics() const;
+
   /// Request the io_service to invoke the given handler.
   /**
    * This function is used to ask the io_service to execute the given handler.
@@ -0,0 +1,92 @@
+//
+// io_service_metrics.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_IO_SERVICE_METRICS_HPP
+#define BOOST_ASIO_IO_SERVICE_METRICS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+#include <boost/cstdint.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// A snapshot of the activity of an io_service.
+/**
+ * Obtained by calling io_service::get_metrics() or
+ * io_service::get_thread_metrics().
+ *
+ * Each thread running the io_service counts events in its own storage, and
+ * adds them to the io_service's totals every 1024 handlers, before it blocks,
+ * and when it returns from run(), run_one(), poll() or poll_one(). The
+ * counters may therefore lag behind the handlers that are running at the time
+ * of the snapshot. The queue depth and outstanding work are sampled when the
+ * snapshot is taken.
+ *
+ * The histograms are only filled in when the program is compiled with
+ * @c BOOST_ASIO_ENABLE_HANDLER_TIMING defined and the io_service is
+ * constructed using the concurrency hint flag
+ * @c BOOST_ASIO_CONCURRENCY_HINT_METRICS, as timing every handler requires
+ * reading a clock several times and storing a time in every operation. A duration of @c d
+ * nanoseconds is counted in bucket @c floor(log2(d)), or bucket 0 when @c d
+ * is zero. The last bucket also counts all longer durations.
+ *
+ * On Windows, when I/O completion ports are used, only the outstanding work
+ * is filled in.
+ */
+struct io_service_metrics
+{
+  /// The number of buckets in each histogram.
+  enum { histogram_buckets = 32 };
+
+  /// The number of handlers that have been run.
+  boost::uint64_t handlers_run;
+
+  /// The number of handlers that were ready to run but had not yet been
+  /// started when the snapshot was taken. Handlers queued privately by a
+  /// thread that is running a handler are not included.
+  boost::uint64_t queue_depth;
+
+  /// The amount of unfinished work when the snapshot was taken, including
+  /// asynchronous operations that have not yet completed.
+  boost::uint64_t outstanding_work;
+
+  /// The number of times a thread waited for the reactor to report events.
+  boost::uint64_t reactor_waits;
+
+  /// The number of times a thread polled the reactor without waiting.
+  boost::uint64_t reactor_polls;
+
+  /// The number of times a waiting reactor was interrupted so that a thread
+  /// could run newly queued handlers.
+  boost::uint64_t reactor_wakeups;
+
+  /// The number of times a thread went idle because there was nothing to run.
+  boost::uint64_t idle_waits;
+
+  /// Histogram of the time between a handler becoming ready to run and the
+  /// handler starting.
+  boost::uint64_t scheduling_delay[histogram_buckets];
+
+  /// Histogram of the time taken to run each handler.
+  boost::uint64_t execution_time[histogram_buckets];
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_IO_SERVICE_METRICS_HPP
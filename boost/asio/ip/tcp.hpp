@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include <boost/asio/detail/config.hpp>
+#include <boost/asio/basic_reuse_port_acceptor.hpp>
 #include <boost/asio/basic_socket_acceptor.hpp>
 #include <boost/asio/basic_socket_iostream.hpp>
 #include <boost/asio/basic_stream_socket.hpp>
@@ -85,6 +86,12 @@ public:
   /// The TCP acceptor type.
   typedef basic_socket_acceptor<tcp> acceptor;
 
+#if defined(BOOST_ASIO_HAS_REUSE_PORT) || defined(GENERATING_DOCUMENTATION)
+  /// The type of a group of TCP acceptors sharing an endpoint.
+  typedef basic_reuse_port_acceptor<tcp> reuse_port_acceptor;
+#endif // defined(BOOST_ASIO_HAS_REUSE_PORT)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// The TCP resolver type.
   typedef basic_resolver<tcp> resolver;
 
@@ -0,0 +1,189 @@
+//
+// send_file.hpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_SEND_FILE_HPP
+#define BOOST_ASIO_SEND_FILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/config.hpp>
+
+#if defined(BOOST_ASIO_HAS_SENDFILE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <boost/asio/error.hpp>
+#include <boost/asio/posix/basic_stream_descriptor.hpp>
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/**
+ * @defgroup send_file boost::asio::send_file
+ *
+ * @brief Send data from a pipe to a stream socket without copying it through
+ * user space.
+ */
+/*@{*/
+
+/// Send a certain amount of data from a pipe to a stream socket before
+/// returning.
+/**
+ * This function is used to move data from a pipe to a stream socket using
+ * @c splice. The call will block until one of the following conditions is
+ * true:
+ *
+ * @li @c length bytes have been sent.
+ *
+ * @li The write end of the pipe has been closed and all data has been sent.
+ *
+ * @li An error occurred.
+ *
+ * This operation is implemented in terms of zero or more calls to the
+ * descriptor's read_some function with null_buffers, and to the socket's
+ * send_file function.
+ *
+ * @param s The socket to which the data is to be sent. The type must provide
+ * a @c send_file member function with the same signature as that of
+ * basic_stream_socket.
+ *
+ * @param d The descriptor of the pipe from which the data is read.
+ *
+ * @param length The number of bytes to send.
+ *
+ * @returns The number of bytes sent.
+ *
+ * @throws boost::system::system_error Thrown on failure. An error code of
+ * boost::asio::error::eof indicates that the pipe was closed before @c length
+ * bytes were sent.
+ *
+ * @note This function is available only on Linux.
+ */
+template <typename SyncFileSendStream, typename DescriptorService>
+std::size_t send_file(SyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length);
+
+/// Send a certain amount of data from a pipe to a stream socket before
+/// returning.
+/**
+ * This function is used to move data from a pipe to a stream socket using
+ * @c splice. The call will block until one of the following conditions is
+ * true:
+ *
+ * @li @c length bytes have been sent.
+ *
+ * @li The write end of the pipe has been closed and all data has been sent.
+ *
+ * @li An error occurred.
+ *
+ * This operation is implemented in terms of zero or more calls to the
+ * descriptor's read_some function with null_buffers, and to the socket's
+ * send_file function.
+ *
+ * @param s The socket to which the data is to be sent. The type must provide
+ * a @c send_file member function with the same signature as that of
+ * basic_stream_socket.
+ *
+ * @param d The descriptor of the pipe from which the data is read.
+ *
+ * @param length The number of bytes to send.
+ *
+ * @param ec Set to indicate what error occurred, if any. An error code of
+ * boost::asio::error::eof indicates that the pipe was closed before @c length
+ * bytes were sent.
+ *
+ * @returns The number of bytes sent.
+ *
+ * @note This function is available only on Linux.
+ */
+template <typename SyncFileSendStream, typename DescriptorService>
+std::size_t send_file(SyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length, boost::system::error_code& ec);
+
+/*@}*/
+
+/**
+ * @defgroup async_send_file boost::asio::async_send_file
+ *
+ * @brief Start an asynchronous operation to send data from a pipe to a
+ * stream socket without copying it through user space.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to send a certain amount of data from a
+/// pipe to a stream socket.
+/**
+ * This function is used to asynchronously move data from a pipe to a stream
+ * socket using @c splice. The function call always returns immediately. The
+ * asynchronous operation will continue until one of the following conditions
+ * is true:
+ *
+ * @li @c length bytes have been sent.
+ *
+ * @li The write end of the pipe has been closed and all data has been sent.
+ *
+ * @li An error occurred.
+ *
+ * This operation is implemented in terms of zero or more calls to the
+ * descriptor's async_read_some function with null_buffers, which waits for
+ * data to arrive in the pipe, and to the socket's async_send_file function,
+ * which waits for the socket to become ready for writing. The program must
+ * ensure that no other operations are performed on the pipe until this
+ * operation completes.
+ *
+ * @param s The socket to which the data is to be sent. The type must provide
+ * an @c async_send_file member function with the same signature as that of
+ * basic_stream_socket.
+ *
+ * @param d The descriptor of the pipe from which the data is read. Ownership
+ * of the descriptor is retained by the caller, which must guarantee that it
+ * remains valid until the handler is called.
+ *
+ * @param length The number of bytes to send.
+ *
+ * @param handler The handler to be called when the send operation completes.
+ * Copies will be made of the handler as required. The function signature of
+ * the handler must be:
+ * @code void handler(
+ *   const boost::system::error_code& error, // Result of operation.
+ *   std::size_t bytes_transferred           // Number of bytes sent.
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the handler will not be invoked from within this function. Invocation
+ * of the handler will be performed in a manner equivalent to using
+ * boost::asio::io_service::post().
+ *
+ * @note This function is available only on Linux.
+ */
+template <typename AsyncFileSendStream, typename DescriptorService,
+    typename WriteHandler>
+void async_send_file(AsyncFileSendStream& s,
+    posix::basic_stream_descriptor<DescriptorService>& d,
+    std::size_t length, BOOST_ASIO_MOVE_ARG(WriteHandler) handler);
+
+/*@}*/
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#include <boost/asio/impl/send_file.hpp>
+
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // BOOST_ASIO_SEND_FILE_HPP
@@ -258,6 +258,25 @@ public:
         BOOST_ASIO_MOVE_CAST(AcceptHandler)(handler));
   }
 
+#if !defined(BOOST_ASIO_HAS_IOCP) || defined(GENERATING_DOCUMENTATION)
+  /// Accept one or more new connections.
+  template <typename Socket>
+  std::size_t accept_batch(implementation_type& impl, Socket* const* peers,
+      std::size_t count, boost::system::error_code& ec)
+  {
+    return service_impl_.accept_batch(impl, peers, count, ec);
+  }
+
+  /// Start an asynchronous accept of one or more new connections.
+  template <typename Socket, typename AcceptHandler>
+  void async_accept_batch(implementation_type& impl, Socket* const* peers,
+      std::size_t count, BOOST_ASIO_MOVE_ARG(AcceptHandler) handler)
+  {
+    service_impl_.async_accept_batch(impl, peers, count,
+        BOOST_ASIO_MOVE_CAST(AcceptHandler)(handler));
+  }
+#endif // !defined(BOOST_ASIO_HAS_IOCP) || defined(GENERATING_DOCUMENTATION)
+
 private:
   // Destroy all user-defined handler objects owned by the service.
   void shutdown_service()
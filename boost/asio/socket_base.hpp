@@ -375,6 +375,37 @@ public:
     SOL_SOCKET, SO_REUSEADDR> reuse_address;
 #endif
 
+#if defined(BOOST_ASIO_HAS_REUSE_PORT) || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to allow several sockets to be bound to the same address
+  /// and port.
+  /**
+   * Implements the SOL_SOCKET/SO_REUSEPORT socket option. Incoming
+   * connections and datagrams are distributed among the sockets by the
+   * kernel. Each socket must set the option before it is bound.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * boost::asio::ip::tcp::acceptor acceptor(io_service); 
+   * ...
+   * boost::asio::socket_base::reuse_port option(true);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   *
+   * @note This option is available only on Linux 3.9 and later.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined reuse_port;
+#else
+  typedef boost::asio::detail::socket_option::boolean<
+    SOL_SOCKET, SO_REUSEPORT> reuse_port;
+#endif
+#endif // defined(BOOST_ASIO_HAS_REUSE_PORT)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Socket option to specify whether the socket lingers on close if unsent
   /// data is present.
   /**
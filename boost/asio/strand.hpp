@@ -17,7 +17,11 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <boost/asio/detail/handler_type_requirements.hpp>
-#include <boost/asio/detail/strand_service.hpp>
+#if defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
+# include <boost/asio/detail/strand_service.hpp>
+#else // defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
+# include <boost/asio/detail/pooled_strand_service.hpp>
+#endif // defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
 #include <boost/asio/detail/wrapped_handler.hpp>
 #include <boost/asio/io_service.hpp>
 
@@ -90,8 +94,7 @@ public:
    * dispatch handlers that are ready to be run.
    */
   explicit strand(boost::asio::io_service& io_service)
-    : service_(boost::asio::use_service<
-        boost::asio::detail::strand_service>(io_service))
+    : service_(boost::asio::use_service<service_type>(io_service))
   {
     service_.construct(impl_);
   }
@@ -208,8 +211,14 @@ public:
   }
 
 private:
-  boost::asio::detail::strand_service& service_;
-  boost::asio::detail::strand_service::implementation_type impl_;
+#if defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
+  typedef boost::asio::detail::strand_service service_type;
+#else // defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
+  typedef boost::asio::detail::pooled_strand_service service_type;
+#endif // defined(BOOST_ASIO_ENABLE_HASHED_STRANDS)
+
+  service_type& service_;
+  service_type::implementation_type impl_;
 };
 
 /// Typedef for backwards compatibility.
@@ -17,6 +17,7 @@
 
 #include <boost/asio/detail/config.hpp>
 #include <cstddef>
+#include <boost/cstdint.hpp>
 #include <boost/asio/error.hpp>
 #include <boost/asio/io_service.hpp>
 
@@ -299,6 +300,26 @@ public:
         BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
   }
 
+#if defined(BOOST_ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+  /// Send data from a file descriptor.
+  std::size_t send_file(implementation_type& impl, int fd,
+      boost::uint64_t offset, std::size_t length,
+      boost::system::error_code& ec)
+  {
+    return service_impl_.send_file(impl, fd, offset, length, ec);
+  }
+
+  /// Start an asynchronous send of data from a file descriptor.
+  template <typename WriteHandler>
+  void async_send_file(implementation_type& impl, int fd,
+      boost::uint64_t offset, std::size_t length,
+      BOOST_ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    service_impl_.async_send_file(impl, fd, offset, length,
+        BOOST_ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+#endif // defined(BOOST_ASIO_HAS_SENDFILE) || defined(GENERATING_DOCUMENTATION)
+
   /// Receive some data from the peer.
   template <typename MutableBufferSequence>
   std::size_t receive(implementation_type& impl,
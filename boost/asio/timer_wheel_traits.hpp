@@ -0,0 +1,65 @@
+//
+// timer_wheel_traits.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_ASIO_TIMER_WHEEL_TRAITS_HPP
+#define BOOST_ASIO_TIMER_WHEEL_TRAITS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include <boost/asio/detail/push_options.hpp>
+
+namespace boost {
+namespace asio {
+
+/// Traits adapter that selects a timer wheel for a timer service.
+/**
+ * By default, the timers belonging to a timer service are kept in a binary
+ * heap, so that scheduling and cancelling a timer take logarithmic time. When
+ * a program has a very large number of timers that are frequently re-armed,
+ * such as idle timeouts on many connections, the heap maintenance can become
+ * significant.
+ *
+ * Wrapping a timer's traits type in @c timer_wheel_traits causes the timer
+ * service to keep its timers in a hierarchical timing wheel instead. A timer
+ * wheel schedules and cancels a timer in constant time, at the cost of
+ * dividing time into ticks of one millisecond.
+ *
+ * The adapter may be used with either the @c TimeTraits parameter of
+ * basic_deadline_timer or the @c WaitTraits parameter of basic_waitable_timer.
+ * Each distinct traits type has its own timer service, so timers that use
+ * the adapter do not share a queue with those that do not.
+ *
+ * @par Example
+ * @code
+ * typedef boost::asio::basic_deadline_timer<boost::posix_time::ptime,
+ *     boost::asio::timer_wheel_traits<
+ *       boost::asio::time_traits<boost::posix_time::ptime> > >
+ *   wheel_deadline_timer;
+ *
+ * typedef boost::asio::basic_waitable_timer<boost::chrono::steady_clock,
+ *     boost::asio::timer_wheel_traits<
+ *       boost::asio::wait_traits<boost::chrono::steady_clock> > >
+ *   wheel_steady_timer;
+ * @endcode
+ */
+template <typename Traits>
+struct timer_wheel_traits
+  : Traits
+{
+};
+
+} // namespace asio
+} // namespace boost
+
+#include <boost/asio/detail/pop_options.hpp>
+
+#endif // BOOST_ASIO_TIMER_WHEEL_TRAITS_HPP
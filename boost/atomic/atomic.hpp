@@ -8,6 +8,7 @@
 //  http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cstddef>
+#include <cstring>
 #include <boost/cstdint.hpp>
 
 #include <boost/memory_order.hpp>
@@ -15,6 +16,7 @@
 #include <boost/atomic/detail/config.hpp>
 #include <boost/atomic/detail/platform.hpp>
 #include <boost/atomic/detail/type-classification.hpp>
+#include <boost/atomic/detail/wait_ops.hpp>
 #include <boost/type_traits/is_signed.hpp>
 
 #ifdef BOOST_ATOMIC_HAS_PRAGMA_ONCE
@@ -96,7 +98,51 @@ public:
         super::operator=(v);
         return *const_cast<atomic *>(this);
     }
+
+    // Blocks as long as the value of the object is equal to old (compared
+    // bitwise), until notify_one or notify_all is called. Spurious wakeups
+    // are possible, but wait only returns once the value has changed.
+    void
+    wait(value_type old, memory_order order = memory_order_seq_cst) const volatile
+    {
+        while (equal(this->load(order), old)) {
+            unsigned int epoch = atomics::detail::wait_ops::prepare_wait(this);
+            if (!equal(this->load(order), old)) {
+                atomics::detail::wait_ops::cancel_wait(this);
+                return;
+            }
+            atomics::detail::wait_ops::block(this, wait_size(), &old, epoch);
+        }
+    }
+
+    // Wakes up at least one thread, or all threads, that are blocked in wait
+    // on this object.
+    void
+    notify_one(void) volatile
+    {
+        atomics::detail::wait_ops::notify(this, wait_size(), false);
+    }
+
+    void
+    notify_all(void) volatile
+    {
+        atomics::detail::wait_ops::notify(this, wait_size(), true);
+    }
 private:
+    // size of the object, as far as the platform may compare it with old
+    // in wait_ops::block; 0 if the object has padding
+    static std::size_t
+    wait_size(void)
+    {
+        return sizeof(value_type) == sizeof(atomic) ? sizeof(value_type) : 0;
+    }
+
+    static bool
+    equal(value_type const& a, value_type const& b)
+    {
+        return std::memcmp(&a, &b, sizeof(value_type)) == 0;
+    }
+
     atomic(const atomic &) /* =delete */ ;
     atomic & operator=(const atomic &) /* =delete */ ;
 };
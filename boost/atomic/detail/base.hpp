@@ -142,6 +142,7 @@ private:
     typedef base_atomic this_type;
     typedef T value_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_shared_lock shared_guard_type;
 public:
     base_atomic(void) {}
 
@@ -161,7 +162,7 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) volatile const
     {
-        guard_type guard(const_cast<const char *>(v_));
+        shared_guard_type guard(const_cast<const char *>(v_));
 
         value_type v;
         memcpy(&v, const_cast<const char *>(v_), sizeof(value_type));
@@ -229,6 +230,7 @@ private:
     typedef T value_type;
     typedef T difference_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_shared_lock shared_guard_type;
 public:
     explicit base_atomic(value_type v) : v_(v) {}
     base_atomic(void) {}
@@ -244,7 +246,7 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        shared_guard_type guard(const_cast<value_type *>(&v_));
 
         value_type v = const_cast<const volatile value_type &>(v_);
         return v;
@@ -354,6 +356,7 @@ private:
     typedef T * value_type;
     typedef ptrdiff_t difference_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_shared_lock shared_guard_type;
 public:
     explicit base_atomic(value_type v) : v_(v) {}
     base_atomic(void) {}
@@ -368,7 +371,7 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        shared_guard_type guard(const_cast<value_type *>(&v_));
 
         value_type v = const_cast<const volatile value_type &>(v_);
         return v;
@@ -445,6 +448,7 @@ private:
     typedef base_atomic this_type;
     typedef void * value_type;
     typedef lockpool::scoped_lock guard_type;
+    typedef lockpool::scoped_shared_lock shared_guard_type;
 public:
     explicit base_atomic(value_type v) : v_(v) {}
     base_atomic(void) {}
@@ -459,7 +463,7 @@ public:
     value_type
     load(memory_order /*order*/ = memory_order_seq_cst) const volatile
     {
-        guard_type guard(const_cast<value_type *>(&v_));
+        shared_guard_type guard(const_cast<value_type *>(&v_));
 
         value_type v = const_cast<const volatile value_type &>(v_);
         return v;
@@ -7,10 +7,8 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <cstddef>
 #include <boost/atomic/detail/config.hpp>
-#ifndef BOOST_ATOMIC_FLAG_LOCK_FREE
-#include <boost/thread/mutex.hpp>
-#endif
 
 #ifdef BOOST_ATOMIC_HAS_PRAGMA_ONCE
 #pragma once
@@ -20,75 +18,76 @@ namespace boost {
 namespace atomics {
 namespace detail {
 
-#ifndef BOOST_ATOMIC_FLAG_LOCK_FREE
-
+// Locks for atomic objects that are not lock-free. The address of the
+// object is hashed to one of BOOST_ATOMIC_LOCK_POOL_SIZE locks, each of
+// which has a cache line of its own. Where atomic<unsigned int> is
+// lock-free, the locks are reader-writer spinlocks, so that concurrent
+// loads of the same object don't serialize; otherwise loads take the lock
+// exclusively.
+//
+// The pool counts how often a thread had to wait for each lock, which can
+// be used to find out whether the pool is too small, or whether a few hot
+// objects share a lock.
 class lockpool
 {
 public:
-    typedef mutex lock_type;
     class scoped_lock
     {
     private:
-        lock_type& mtx_;
+        void * lock_;
 
         scoped_lock(scoped_lock const&) /* = delete */;
         scoped_lock& operator=(scoped_lock const&) /* = delete */;
 
     public:
         explicit
-        scoped_lock(const volatile void * addr) : mtx_(get_lock_for(addr))
+        scoped_lock(const volatile void * addr) : lock_(lock(addr))
         {
-            mtx_.lock();
         }
         ~scoped_lock()
         {
-            mtx_.unlock();
+            unlock(lock_);
         }
     };
 
-private:
-    static BOOST_ATOMIC_DECL lock_type& get_lock_for(const volatile void * addr);
-};
-
-#else
-
-class lockpool
-{
-public:
-    typedef atomic_flag lock_type;
-
-    class scoped_lock
+    class scoped_shared_lock
     {
     private:
-        atomic_flag& flag_;
+        void * lock_;
 
-        scoped_lock(const scoped_lock &) /* = delete */;
-        scoped_lock& operator=(const scoped_lock &) /* = delete */;
+        scoped_shared_lock(scoped_shared_lock const&) /* = delete */;
+        scoped_shared_lock& operator=(scoped_shared_lock const&) /* = delete */;
 
     public:
         explicit
-        scoped_lock(const volatile void * addr) : flag_(get_lock_for(addr))
+        scoped_shared_lock(const volatile void * addr) : lock_(lock_shared(addr))
         {
-            for (; flag_.test_and_set(memory_order_acquire);)
-            {
-#if defined(BOOST_ATOMIC_X86_PAUSE)
-                BOOST_ATOMIC_X86_PAUSE();
-#endif
-            }
         }
-
-        ~scoped_lock(void)
+        ~scoped_shared_lock()
         {
-            flag_.clear(memory_order_release);
+            unlock_shared(lock_);
         }
     };
 
+    // number of locks in the pool
+    static BOOST_ATOMIC_DECL std::size_t size(void);
+
+    // index of the lock that protects the object at addr
+    static BOOST_ATOMIC_DECL std::size_t index_of(const volatile void * addr);
+
+    // number of times that a thread had to wait for the lock with the given
+    // index, since the program started or reset_contention_counts was called
+    static BOOST_ATOMIC_DECL std::size_t contention_count(std::size_t index);
+
+    static BOOST_ATOMIC_DECL void reset_contention_counts(void);
+
 private:
-    static BOOST_ATOMIC_DECL lock_type& get_lock_for(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void * lock(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void unlock(void * lock);
+    static BOOST_ATOMIC_DECL void * lock_shared(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void unlock_shared(void * lock);
 };
 
-#endif
-
 }
 }
 }
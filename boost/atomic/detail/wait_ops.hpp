@@ -0,0 +1,47 @@
+#ifndef BOOST_ATOMIC_DETAIL_WAIT_OPS_HPP
+#define BOOST_ATOMIC_DETAIL_WAIT_OPS_HPP
+
+//  Copyright (c) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstddef>
+#include <boost/atomic/detail/config.hpp>
+
+#ifdef BOOST_ATOMIC_HAS_PRAGMA_ONCE
+#pragma once
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+// Blocking for atomic<T>::wait and notify_one/notify_all.
+//
+// On Linux, objects of 4 bytes are waited for with a futex on the object
+// itself. Other objects, and other platforms, use a table of condition
+// variables, selected by hashing the address. Every entry of the table
+// counts its waiters, so that notify doesn't enter the kernel if nobody
+// waits for an object that hashes to the same entry.
+//
+// A waiter calls prepare_wait, checks the value of the object once more,
+// and then calls block, or cancel_wait if the value has already changed.
+// block returns after notify has been called for the object, or when the
+// 4 bytes at addr differ from old; spurious wakeups are possible.
+class wait_ops
+{
+public:
+    static BOOST_ATOMIC_DECL unsigned int prepare_wait(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void cancel_wait(const volatile void * addr);
+    static BOOST_ATOMIC_DECL void block(const volatile void * addr, std::size_t size, const void * old, unsigned int epoch);
+
+    static BOOST_ATOMIC_DECL void notify(const volatile void * addr, std::size_t size, bool all);
+};
+
+}
+}
+}
+
+#endif
@@ -37,6 +37,7 @@ namespace bi = boost::intrusive;
 #include <functional>
 #include <iosfwd>
 #include <string>
+#include <cstddef>
 
 /// @endcond
 
@@ -57,6 +58,18 @@ template <class T
          ,class Allocator = std::allocator<T> >
 class stable_vector;
 
+//small_vector_allocator class
+template <class T
+         ,std::size_t N
+         ,class Allocator = std::allocator<T> >
+class small_vector_allocator;
+
+//small_vector class
+template <class T
+         ,std::size_t N
+         ,class Allocator = std::allocator<T> >
+class small_vector;
+
 //vector class
 template <class T
          ,class Allocator = std::allocator<T> >
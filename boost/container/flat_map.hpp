@@ -24,6 +24,7 @@
 #include <memory>
 #include <stdexcept>
 #include <boost/container/detail/flat_tree.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/type_traits/has_trivial_destructor.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/allocator_traits.hpp>
@@ -1650,6 +1651,20 @@ template <class Key, class T, class Compare, class Allocator>
 inline void swap(flat_multimap<Key,T,Compare,Allocator>& x, flat_multimap<Key,T,Compare,Allocator>& y)
    {  x.swap(y);  }
 
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+//! A flat_map that stores up to N elements inside the object, in the
+//! internal buffer of a small_vector_allocator. In C++03 compilers use
+//! flat_map<Key, T, Compare, small_vector_allocator<std::pair<Key, T>, N, Allocator> >.
+template <class Key, class T, std::size_t N, class Compare = std::less<Key>, class Allocator = std::allocator< std::pair< Key, T> > >
+using small_flat_map = flat_map<Key, T, Compare, small_vector_allocator<std::pair<Key, T>, N, Allocator> >;
+
+//! A flat_multimap that stores up to N elements inside the object, see small_flat_map.
+template <class Key, class T, std::size_t N, class Compare = std::less<Key>, class Allocator = std::allocator< std::pair< Key, T> > >
+using small_flat_multimap = flat_multimap<Key, T, Compare, small_vector_allocator<std::pair<Key, T>, N, Allocator> >;
+
+#endif
+
 }}
 
 /// @cond
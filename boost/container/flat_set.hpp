@@ -23,6 +23,7 @@
 #include <functional>
 #include <memory>
 #include <boost/container/detail/flat_tree.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/container/detail/mpl.hpp>
 #include <boost/container/allocator_traits.hpp>
 #include <boost/move/utility.hpp>
@@ -1401,6 +1402,20 @@ namespace container {
 
 /// @endcond
 
+#if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+
+//! A flat_set that stores up to N elements inside the object, in the
+//! internal buffer of a small_vector_allocator. In C++03 compilers use
+//! flat_set<T, Compare, small_vector_allocator<T, N, Allocator> >.
+template <class T, std::size_t N, class Compare = std::less<T>, class Allocator = std::allocator<T> >
+using small_flat_set = flat_set<T, Compare, small_vector_allocator<T, N, Allocator> >;
+
+//! A flat_multiset that stores up to N elements inside the object, see small_flat_set.
+template <class T, std::size_t N, class Compare = std::less<T>, class Allocator = std::allocator<T> >
+using small_flat_multiset = flat_multiset<T, Compare, small_vector_allocator<T, N, Allocator> >;
+
+#endif
+
 }}
 
 #include <boost/container/detail/config_end.hpp>
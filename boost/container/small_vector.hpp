@@ -0,0 +1,433 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
+#define BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
+
+#if (defined _MSC_VER) && (_MSC_VER >= 1200)
+#  pragma once
+#endif
+
+#include <boost/container/detail/config_begin.hpp>
+#include <boost/container/detail/workaround.hpp>
+#include <boost/container/container_fwd.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <boost/container/vector.hpp>
+#include <boost/container/allocator_traits.hpp>
+#include <boost/container/detail/version_type.hpp>
+#include <boost/container/detail/allocation_type.hpp>
+#include <boost/container/detail/allocator_version_traits.hpp>
+#include <boost/container/detail/mpl.hpp>
+#include <boost/container/detail/type_traits.hpp>
+#include <boost/container/detail/preprocessor.hpp>
+#include <boost/move/utility.hpp>
+#include <boost/move/iterator.hpp>
+#include <boost/aligned_storage.hpp>
+
+namespace boost {
+namespace container {
+
+//! \class small_vector_allocator
+//! An allocator that keeps a buffer for N objects of type T inside the
+//! allocator object, and obtains larger buffers from Allocator.
+//!
+//! The buffer is handed out for the first allocation of up to N objects, and
+//! reported as a buffer of N objects, so a vector that uses this allocator
+//! doesn't allocate memory until it holds more than N elements. As the buffer
+//! can't be handed over to another container, copies of the allocator come
+//! with a buffer of their own, the allocator is never propagated, and vector
+//! moves the elements one by one if they are stored in the buffer.
+//!
+//! Construction and destruction of elements, max_size and
+//! select_on_container_copy_construction are those of Allocator (through
+//! allocator_traits), so scoped_allocator_adaptor and allocators with smart
+//! pointers (e.g. Boost.Interprocess allocators) can be used as Allocator.
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template <class T, std::size_t N, class Allocator = std::allocator<T> >
+#else
+template <class T, std::size_t N, class Allocator>
+#endif
+class small_vector_allocator
+   : public Allocator
+{
+   /// @cond
+   typedef allocator_traits<Allocator>                               base_traits;
+   typedef container_detail::allocator_version_traits<Allocator>     base_version_traits;
+   typedef typename boost::aligned_storage
+      < sizeof(T)*N, container_detail::alignment_of<T>::value>::type storage_t;
+   /// @endcond
+
+   public:
+   typedef T                                                   value_type;
+   typedef typename base_traits::pointer                       pointer;
+   typedef typename base_traits::const_pointer                 const_pointer;
+   typedef typename base_traits::void_pointer                  void_pointer;
+   typedef typename base_traits::const_void_pointer            const_void_pointer;
+   typedef typename base_traits::size_type                     size_type;
+   typedef typename base_traits::difference_type               difference_type;
+   typedef Allocator                                           base_allocator_type;
+
+   //!The buffer can't be handed over to another container
+   typedef container_detail::false_type                        propagate_on_container_copy_assignment;
+   typedef container_detail::false_type                        propagate_on_container_move_assignment;
+   typedef container_detail::false_type                        propagate_on_container_swap;
+
+   //!Version 2 allocator: allocation_command reports the size of the buffer
+   typedef boost::container::container_detail::
+      version_type<small_vector_allocator, 2>                  version;
+   typedef typename base_version_traits::multiallocation_chain multiallocation_chain;
+
+   //!Obtains a small_vector_allocator that allocates objects of type U
+   template<class U>
+   struct rebind
+   {
+      typedef small_vector_allocator
+         < U, N, typename base_traits::template portable_rebind_alloc<U>::type> other;
+   };
+
+   //!Number of objects in the internal buffer
+   static const std::size_t static_capacity = N;
+
+   //!Default constructs Allocator
+   small_vector_allocator()
+      : Allocator(), m_in_use(false)
+   {}
+
+   //!Constructs from a copy of a, so that a small_vector can be constructed
+   //!from an Allocator (this is also what uses-allocator construction relies on)
+   small_vector_allocator(const Allocator &a)
+      : Allocator(a), m_in_use(false)
+   {}
+
+   //!Copies Allocator. The copy has an unused buffer of its own.
+   small_vector_allocator(const small_vector_allocator &other)
+      : Allocator(other.get_base_allocator()), m_in_use(false)
+   {}
+
+   //!Copies the Allocator of other, rebound to T.
+   template<class U, class OtherAllocator>
+   small_vector_allocator(const small_vector_allocator<U, N, OtherAllocator> &other)
+      : Allocator(other.get_base_allocator()), m_in_use(false)
+   {}
+
+   //!Assigns Allocator. The buffer and its state are not changed.
+   small_vector_allocator & operator=(const small_vector_allocator &other)
+   {
+      this->Allocator::operator=(other.get_base_allocator());
+      return *this;
+   }
+
+   const Allocator &get_base_allocator() const
+   {  return *this;  }
+
+   Allocator &get_base_allocator()
+   {  return *this;  }
+
+   //!Returns a copy of the Allocator selected by
+   //!allocator_traits<Allocator>::select_on_container_copy_construction
+   small_vector_allocator select_on_container_copy_construction() const
+   {  return small_vector_allocator(base_traits::select_on_container_copy_construction(*this));  }
+
+   //!Returns allocator_traits<Allocator>::max_size
+   size_type max_size() const
+   {  return base_traits::max_size(this->get_base_allocator());  }
+
+   #if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) || defined(BOOST_CONTAINER_DOXYGEN_INVOKED)
+   //!Constructs the object with allocator_traits<Allocator>::construct
+   template <class U, class ...Args>
+   void construct(U *p, BOOST_FWD_REF(Args)... args)
+   {  base_traits::construct(this->get_base_allocator(), p, ::boost::forward<Args>(args)...);  }
+   #else
+   #define BOOST_PP_LOCAL_MACRO(n)                                                                 \
+   template<class U BOOST_PP_ENUM_TRAILING_PARAMS(n, class P) >                                    \
+   void construct(U *p BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_LIST, _))                \
+   {                                                                                               \
+      base_traits::construct                                                                       \
+         (this->get_base_allocator(), p BOOST_PP_ENUM_TRAILING(n, BOOST_CONTAINER_PP_PARAM_FORWARD, _)); \
+   }                                                                                               \
+   //
+   #define BOOST_PP_LOCAL_LIMITS (0, BOOST_CONTAINER_MAX_CONSTRUCTOR_PARAMETERS)
+   #include BOOST_PP_LOCAL_ITERATE()
+   #endif   //#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+
+   //!Destroys the object with allocator_traits<Allocator>::destroy
+   template <class U>
+   void destroy(U *p)
+   {  base_traits::destroy(this->get_base_allocator(), p);  }
+
+   //!Returns the internal buffer if it is free and n <= N,
+   //!otherwise memory from Allocator
+   pointer allocate(size_type n)
+   {
+      if(!m_in_use && n <= N){
+         m_in_use = true;
+         return this->internal_storage();
+      }
+      return base_traits::allocate(this->get_base_allocator(), n);
+   }
+
+   //!Releases the internal buffer or gives p back to Allocator
+   void deallocate(const pointer &p, size_type n)
+   {
+      if(this->storage_is_internal(p)){
+         m_in_use = false;
+      }
+      else{
+         base_traits::deallocate(this->get_base_allocator(), p, n);
+      }
+   }
+
+   //!Returns true if p is the internal buffer
+   bool storage_is_internal(const pointer &p) const
+   {  return p == this->internal_storage();  }
+
+   //!Allocates the internal buffer, with received_size == N, if it is free and
+   //!limit_size <= N. The internal buffer can't be expanded or shrunk, other
+   //!commands are passed to Allocator (with the semantics of a version 1
+   //!allocator if Allocator is one).
+   std::pair<pointer, bool>
+      allocation_command(allocation_type command,
+                         size_type limit_size,
+                         size_type preferred_size,
+                         size_type &received_size, const pointer &reuse = pointer())
+   {
+      if(command & shrink_in_place){
+         if(this->storage_is_internal(reuse)){
+            return std::pair<pointer, bool>(pointer(), false);
+         }
+      }
+      else{
+         if(!m_in_use && (command & allocate_new) && limit_size <= N){
+            m_in_use = true;
+            received_size = N;
+            return std::pair<pointer, bool>(this->internal_storage(), false);
+         }
+         if(this->storage_is_internal(reuse)){
+            return base_version_traits::allocation_command
+               ( this->get_base_allocator(), command & ~(expand_fwd | expand_bwd)
+               , limit_size, preferred_size, received_size, pointer());
+         }
+      }
+      return base_version_traits::allocation_command
+         (this->get_base_allocator(), command, limit_size, preferred_size, received_size, reuse);
+   }
+
+   //!Node allocation functions, which always use Allocator
+   pointer allocate_one()
+   {  return base_version_traits::allocate_one(this->get_base_allocator());  }
+
+   void deallocate_one(const pointer &p)
+   {  base_version_traits::deallocate_one(this->get_base_allocator(), p);  }
+
+   void allocate_individual(size_type n, multiallocation_chain &chain)
+   {  base_version_traits::allocate_individual(this->get_base_allocator(), n, chain);  }
+
+   void deallocate_individual(multiallocation_chain &chain)
+   {  base_version_traits::deallocate_individual(this->get_base_allocator(), chain);  }
+
+   //!Allocators are equal if their Allocators are equal: they can deallocate
+   //!each other's memory, except for the internal buffers
+   friend bool operator==(const small_vector_allocator &l, const small_vector_allocator &r)
+   {  return l.get_base_allocator() == r.get_base_allocator();  }
+
+   friend bool operator!=(const small_vector_allocator &l, const small_vector_allocator &r)
+   {  return !(l == r);  }
+
+   /// @cond
+   private:
+   pointer internal_storage() const
+   {
+      return pointer(static_cast<T*>(const_cast<void*>(static_cast<const void*>(&m_storage))));
+   }
+
+   storage_t m_storage;
+   bool m_in_use;
+   /// @endcond
+};
+
+/// @cond
+
+namespace container_detail {
+
+template <class T, std::size_t N, class Allocator>
+struct is_internal_storage_allocator< small_vector_allocator<T, N, Allocator> >
+   : public container_detail::true_type
+{};
+
+}  //namespace container_detail {
+
+/// @endcond
+
+//! \class small_vector
+//! A small_vector is a vector that stores up to N elements inside the
+//! small_vector object, and allocates memory only for more elements.
+//! It is a vector that uses small_vector_allocator<T, N, Allocator>, so
+//! moving or swapping a small_vector moves the elements one by one if they
+//! are stored inside the object, and is constant time otherwise.
+//!
+//! The flat associative containers store their elements in a vector, so they
+//! become small containers with a small_vector_allocator, see small_flat_map.
+#ifdef BOOST_CONTAINER_DOXYGEN_INVOKED
+template <class T, std::size_t N, class Allocator = std::allocator<T> >
+#else
+template <class T, std::size_t N, class Allocator>
+#endif
+class small_vector
+   : public vector<T, small_vector_allocator<T, N, Allocator> >
+{
+   /// @cond
+   typedef vector<T, small_vector_allocator<T, N, Allocator> > base_t;
+   BOOST_COPYABLE_AND_MOVABLE(small_vector)
+   /// @endcond
+
+   public:
+   typedef typename base_t::size_type        size_type;
+   typedef typename base_t::allocator_type   allocator_type;
+
+   //!Number of elements stored inside the small_vector
+   static const std::size_t static_capacity = N;
+
+   //! <b>Effects</b>: Constructs a small_vector.
+   //!
+   //! <b>Throws</b>: If Allocator's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant.
+   small_vector()
+      : base_t()
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector that uses a copy of a.
+   //!
+   //! <b>Throws</b>: Nothing
+   //!
+   //! <b>Complexity</b>: Constant.
+   explicit small_vector(const allocator_type &a)
+      : base_t(a)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector and inserts n default
+   //!   constructed values.
+   //!
+   //! <b>Throws</b>: If Allocator's default constructor or allocation
+   //!   throws or T's default constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   explicit small_vector(size_type n)
+      : base_t(n)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector that uses a copy of a
+   //!   and inserts n copies of value.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to n.
+   small_vector(size_type n, const T &value, const allocator_type &a = allocator_type())
+      : base_t(n, value, a)
+   {}
+
+   //! <b>Effects</b>: Constructs a small_vector that uses a copy of a
+   //!   and inserts a copy of the range [first, last).
+   //!
+   //! <b>Throws</b>: If allocation throws or T's constructor taking an
+   //!   dereferenced InIt throws.
+   //!
+   //! <b>Complexity</b>: Linear to the range [first, last).
+   template <class InIt>
+   small_vector(InIt first, InIt last, const allocator_type &a = allocator_type())
+      : base_t(first, last, a)
+   {}
+
+   //! <b>Effects</b>: Copy constructs a small_vector.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   small_vector(const small_vector &x)
+      : base_t(static_cast<const base_t&>(x))
+   {}
+
+   //! <b>Effects</b>: Move constructor. Takes over the memory of x if it was
+   //!   allocated, otherwise moves the elements of x one by one.
+   //!
+   //! <b>Throws</b>: If the elements are moved and T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Constant, or linear to N if the elements are moved.
+   small_vector(BOOST_RV_REF(small_vector) x)
+      : base_t(boost::move(static_cast<base_t&>(x)))
+   {}
+
+   //! <b>Effects</b>: Copy constructs a small_vector that uses a copy of a.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   small_vector(const small_vector &x, const allocator_type &a)
+      : base_t(static_cast<const base_t&>(x), a)
+   {}
+
+   //! <b>Effects</b>: Copy assignment.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's copy constructor/assignment throws.
+   //!
+   //! <b>Complexity</b>: Linear to the elements x contains.
+   small_vector& operator=(BOOST_COPY_ASSIGN_REF(small_vector) x)
+   {
+      this->base_t::operator=(static_cast<const base_t&>(x));
+      return *this;
+   }
+
+   //! <b>Effects</b>: Move assignment. Takes over the memory of x if it was
+   //!   allocated and the allocators are equal, otherwise moves the elements
+   //!   of x one by one.
+   //!
+   //! <b>Throws</b>: If the elements are moved and T's move constructor/assignment
+   //!   or allocation throws.
+   //!
+   //! <b>Complexity</b>: Constant, or linear if the elements are moved.
+   small_vector& operator=(BOOST_RV_REF(small_vector) x)
+   {
+      this->base_t::operator=(boost::move(static_cast<base_t&>(x)));
+      return *this;
+   }
+
+   //! <b>Effects</b>: Swaps the contents of *this and x, see vector::swap.
+   void swap(small_vector &x)
+   {  this->base_t::swap(x);  }
+
+   //! <b>Effects</b>: Moves the elements into the internal buffer if they
+   //!   fit, otherwise into memory for exactly size() elements.
+   //!
+   //! <b>Throws</b>: If allocation throws or T's move constructor throws.
+   //!
+   //! <b>Complexity</b>: Linear to size().
+   void shrink_to_fit()
+   {
+      if(this->capacity() > N && this->size() < this->capacity()){
+         small_vector tmp( boost::make_move_iterator(this->begin())
+                         , boost::make_move_iterator(this->end())
+                         , this->get_stored_allocator());
+         this->swap(tmp);
+      }
+   }
+};
+
+template <class T, std::size_t N, class Allocator>
+inline void swap(small_vector<T, N, Allocator>& x, small_vector<T, N, Allocator>& y)
+{  x.swap(y);  }
+
+}}
+
+#include <boost/container/detail/config_end.hpp>
+
+#endif //   #ifndef  BOOST_CONTAINER_CONTAINER_SMALL_VECTOR_HPP
@@ -248,6 +248,15 @@ struct vector_value_traits
       >::type   ArrayDeallocator;
 };
 
+//!Allocators that keep a buffer inside the allocator object, like
+//!small_vector_allocator, specialize this trait to true. A vector can't hand
+//!that buffer over to another vector, so it moves the elements instead.
+//!Such allocators provide `bool storage_is_internal(const pointer &) const`.
+template <class Allocator>
+struct is_internal_storage_allocator
+   : public container_detail::false_type
+{};
+
 //!This struct deallocates and allocated memory
 template <class Allocator>
 struct vector_alloc_holder
@@ -334,6 +343,21 @@ struct vector_alloc_holder
    const Allocator &alloc() const
    {  return members_;  }
 
+   //Returns false if the buffer lives inside the allocator, so that it
+   //can't be taken over by another holder
+   bool is_buffer_transferable() const
+   {
+      return this->priv_is_buffer_transferable
+         (container_detail::bool_<is_internal_storage_allocator<Allocator>::value>());
+   }
+
+   private:
+   bool priv_is_buffer_transferable(container_detail::false_type) const
+   {  return true;  }
+
+   bool priv_is_buffer_transferable(container_detail::true_type) const
+   {  return !this->alloc().storage_is_internal(this->members_.m_start);  }
+
    protected:
    void prot_deallocate()
    {
@@ -496,13 +520,24 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
    }
 
    //! <b>Effects</b>: Move constructor. Moves mx's resources to *this.
+   //!   If mx's elements are stored inside its allocator (see small_vector),
+   //!   they are moved one by one.
    //!
-   //! <b>Throws</b>: Nothing
+   //! <b>Throws</b>: Nothing, unless the elements are moved one by one
+   //!   and T's move constructor or allocation throws.
    //!
-   //! <b>Complexity</b>: Constant.
-   vector(BOOST_RV_REF(vector) mx) BOOST_CONTAINER_NOEXCEPT
+   //! <b>Complexity</b>: Constant, or linear if the elements are moved one by one.
+   vector(BOOST_RV_REF(vector) mx)
+      BOOST_CONTAINER_NOEXCEPT_IF(!container_detail::is_internal_storage_allocator<Allocator>::value)
       :  base_t(boost::move(mx.alloc()))
-   {  this->swap_members(mx);   }
+   {
+      if(mx.is_buffer_transferable()){
+         this->swap_members(mx);
+      }
+      else{
+         this->priv_move_elements_from(mx);
+      }
+   }
 
    //! <b>Effects</b>: Copy constructs a vector using the specified allocator.
    //!
@@ -529,7 +564,7 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
    vector(BOOST_RV_REF(vector) mx, const allocator_type &a)
       :  base_t(a)
    {
-      if(mx.alloc() == a){
+      if(mx.alloc() == a && mx.is_buffer_transferable()){
          this->swap_members(mx);
       }
       else{
@@ -589,9 +624,13 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
          allocator_type &this_alloc = this->alloc();
          allocator_type &x_alloc    = x.alloc();
          //If allocators are equal we can just swap pointers
-         if(this_alloc == x_alloc){
-            //Destroy objects but retain memory in case x reuses it in the future
+         if(this_alloc == x_alloc && x.is_buffer_transferable()){
+            //Destroy objects but retain memory in case x reuses it in the future,
+            //unless it can't be handed over to x
             this->clear();
+            if(!this->is_buffer_transferable()){
+               this->prot_deallocate();
+            }
             this->swap_members(x);
             //Move allocator if needed
             container_detail::bool_<allocator_traits_type::
@@ -600,8 +639,7 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
          }
          //If unequal allocators, then do a one by one move
          else{
-            this->assign( boost::make_move_iterator(container_detail::to_raw_pointer(x.members_.m_start))
-                        , boost::make_move_iterator(container_detail::to_raw_pointer(x.members_.m_start + x.members_.m_size)));
+            this->priv_move_elements_from(x);
          }
       }
       return *this;
@@ -1291,12 +1329,21 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
    }
 
    //! <b>Effects</b>: Swaps the contents of *this and x.
+   //!   If the elements of *this or x are stored inside the allocator
+   //!   (see small_vector), they are moved one by one.
    //!
-   //! <b>Throws</b>: Nothing.
+   //! <b>Throws</b>: Nothing, unless the elements are moved one by one
+   //!   and T's move constructor/assignment or allocation throws.
    //!
-   //! <b>Complexity</b>: Constant.
+   //! <b>Complexity</b>: Constant, or linear if the elements are moved one by one.
    void swap(vector& x)
    {
+      if(!this->is_buffer_transferable() || !x.is_buffer_transferable()){
+         vector tmp(boost::move(x));
+         x = boost::move(*this);
+         *this = boost::move(tmp);
+         return;
+      }
       //Just swap internals
       this->swap_members(x);
       //And now the allocator
@@ -1337,6 +1384,15 @@ class vector : private container_detail::vector_alloc_holder<Allocator>
          (p.get_ptr(), 1, container_detail::get_insert_value_proxy<T*>(this->alloc(), ::boost::forward<U>(x)));
    }
 
+   //Replaces the elements of *this with the elements of x, moved one by one,
+   //and leaves x empty
+   void priv_move_elements_from(vector &x)
+   {
+      this->assign( boost::make_move_iterator(container_detail::to_raw_pointer(x.members_.m_start))
+                  , boost::make_move_iterator(container_detail::to_raw_pointer(x.members_.m_start + x.members_.m_size)));
+      x.clear();
+   }
+
    template <class U>
    void priv_push_back(BOOST_FWD_REF(U) x)
    {
@@ -407,6 +407,9 @@ class message_queue_t;
 
 typedef message_queue_t<offset_ptr<void> > message_queue;
 
+template<class T, class Allocator, bool SingleProducer = false>
+class ring_queue;
+
 }}  //namespace boost { namespace interprocess {
 
 //////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,469 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_RING_QUEUE_HPP
+#define BOOST_INTERPROCESS_RING_QUEUE_HPP
+
+#if (defined _MSC_VER) && (_MSC_VER >= 1200)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+
+#include <boost/interprocess/interprocess_fwd.hpp>
+#include <boost/interprocess/sync/detail/futex.hpp>
+#include <boost/interprocess/detail/utilities.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <cstddef>   //std::size_t
+#include <new>       //placement new
+
+//!\file
+//!Describes a bounded lock-free queue of objects to be placed in shared memory.
+//!Pushing and popping never lock; a thread only blocks when the queue is
+//!full when pushing or empty when popping.
+
+namespace boost{  namespace interprocess{
+
+/// @cond
+namespace ipcdetail
+{
+
+//Bytes that keep the producer and the consumer data of a ring_queue
+//in different cache lines
+static const std::size_t ring_queue_cache_line = 64;
+
+//Times a thread that finds the queue full or empty yields its time slice
+//and retries before it blocks. Blocking at once makes every element cost
+//a wake up when consumers are faster than producers, or the reverse
+static const unsigned int ring_queue_yields = 8;
+
+//!Every slot carries a sequence number that tells producers and
+//!consumers whose turn it is (Dmitry Vyukov's bounded MPMC queue):
+//!
+//!-> seq == pos: the slot is free and can be written by the producer
+//!   that claimed position "pos".
+//!
+//!-> seq == pos + 1: the slot holds the element pushed at "pos".
+//!
+//!-> When the element is popped, seq is advanced to pos + capacity,
+//!   the next position that maps to this slot.
+//!
+//!Positions are 32 bit counters that wrap around, compared through
+//!their signed difference.
+template<class T>
+struct ring_queue_slot
+{
+   explicit ring_queue_slot(boost::uint32_t pos)
+      : seq(pos)
+   {}
+
+   T *value()
+   {  return static_cast<T*>(static_cast<void*>(&data));  }
+
+   boost::atomic<boost::uint32_t> seq;
+   typename boost::aligned_storage
+      <sizeof(T), boost::alignment_of<T>::value>::type data;
+};
+
+//!The threads waiting until the queue is not full, or not empty, block on
+//!"epoch". Its lowest bit is set by the threads that are about to block, and
+//!only then does the other side increment it and wake them all up, so that
+//!a stream of pushes or pops makes one system call per sleep, not per element.
+struct ring_queue_waiters
+{
+   ring_queue_waiters()
+      : epoch(0)
+   {}
+
+   static const boost::uint32_t sleeping = 1u;
+
+   boost::atomic<boost::uint32_t> epoch;
+   char padding[ring_queue_cache_line - sizeof(boost::atomic<boost::uint32_t>)];
+};
+
+}  //namespace ipcdetail {
+/// @endcond
+
+//!A bounded FIFO queue of objects of type T, to be constructed in shared
+//!memory (for example with managed_shared_memory::construct) and shared by
+//!threads of several processes. Its slots are allocated with "Allocator",
+//!usually boost::interprocess::allocator<T, managed_shared_memory::segment_manager>,
+//!and referenced with the allocator's pointer, so the queue can be mapped at
+//!different addresses in each process.
+//!
+//!Pushing and popping claim a slot with one compare and swap and don't lock:
+//!a producer or a consumer that is preempted only delays the element it
+//!is pushing or popping. Threads only block, on a futex on Linux, when the
+//!queue is full when pushing or empty when popping.
+//!
+//!If "SingleProducer" is true, only one thread at a time may push elements,
+//!and it does so without the compare and swap. Any number of threads may
+//!pop elements: each element is received by one of them.
+//!
+//!T must not throw when copied, and must be placeable in shared memory:
+//!no raw pointers, references or virtual functions.
+template<class T, class Allocator, bool SingleProducer>
+class ring_queue
+{
+   /// @cond
+   //Blocking modes
+   enum block_t   {  blocking,   timed,   non_blocking   };
+
+   typedef ipcdetail::ring_queue_slot<T>                         slot_t;
+   typedef typename Allocator::template rebind<slot_t>::other    slot_allocator;
+   typedef typename slot_allocator::pointer                      slot_ptr;
+
+   ring_queue(const ring_queue &);
+   ring_queue &operator=(const ring_queue &);
+   /// @endcond
+
+   public:
+   typedef T                                    value_type;
+   typedef Allocator                            allocator_type;
+   typedef typename Allocator::size_type        size_type;
+
+   //!Creates a queue that can hold "capacity" elements, rounded up to a power of two,
+   //!allocating its slots with "a". Throws interprocess_exception if "capacity"
+   //!is bigger than 2^30, and what "a" throws if memory can't be allocated.
+   ring_queue(size_type capacity, const allocator_type &a);
+
+   //!Destroys the elements that are still in the queue and deallocates the slots.
+   //!No thread may be using the queue.
+   ~ring_queue();
+
+   //!Pushes a copy of "value". If the queue is full the thread is blocked.
+   void push(const T &value);
+
+   //!Pushes a copy of "value". If the queue is full the thread is not blocked
+   //!and returns false, otherwise returns true.
+   bool try_push(const T &value);
+
+   //!Pushes a copy of "value". If the queue is full the thread retries until time
+   //!"abs_time" is reached. Returns true if the value has been pushed. Returns false
+   //!if the timeout is reached.
+   bool timed_push(const T &value, const boost::posix_time::ptime &abs_time);
+
+   //!Pops the oldest element into "value". If the queue is empty the thread is blocked.
+   void pop(T &value);
+
+   //!Pops the oldest element into "value". If the queue is empty the thread is not
+   //!blocked and returns false, otherwise returns true.
+   bool try_pop(T &value);
+
+   //!Pops the oldest element into "value". If the queue is empty the thread retries
+   //!until time "abs_time" is reached. Returns true if an element has been popped.
+   //!Returns false if the timeout is reached.
+   bool timed_pop(T &value, const boost::posix_time::ptime &abs_time);
+
+   //!Returns the maximum number of elements the queue can hold.
+   //!Never throws
+   size_type capacity() const;
+
+   //!Returns the number of elements in the queue. The value is only
+   //!a snapshot if other threads are pushing or popping.
+   //!Never throws
+   size_type size() const;
+
+   //!Returns true if the queue holds no elements, with the same caveat as size().
+   //!Never throws
+   bool empty() const;
+
+   //!Returns a copy of the allocator the slots were allocated with.
+   //!Never throws
+   allocator_type get_allocator() const;
+
+   /// @cond
+   private:
+   bool enqueue(const T &value);
+   bool dequeue(T &value);
+   bool do_push(block_t block, const T &value, const boost::posix_time::ptime &abs_time);
+   bool do_pop(block_t block, T &value, const boost::posix_time::ptime &abs_time);
+   static boost::uint32_t prepare_wait(ipcdetail::ring_queue_waiters &waiters);
+   static void notify(ipcdetail::ring_queue_waiters &waiters);
+
+   slot_allocator    m_alloc;
+   slot_ptr          m_slots;
+   boost::uint32_t   m_mask;
+   char              m_padding0[ipcdetail::ring_queue_cache_line];
+   //Written by the producers
+   boost::atomic<boost::uint32_t> m_enqueue_pos;
+   char              m_padding1[ipcdetail::ring_queue_cache_line - sizeof(boost::atomic<boost::uint32_t>)];
+   //Written by the consumers
+   boost::atomic<boost::uint32_t> m_dequeue_pos;
+   char              m_padding2[ipcdetail::ring_queue_cache_line - sizeof(boost::atomic<boost::uint32_t>)];
+   ipcdetail::ring_queue_waiters m_not_empty;
+   ipcdetail::ring_queue_waiters m_not_full;
+   /// @endcond
+};
+
+/// @cond
+
+template<class T, class Allocator, bool SingleProducer>
+inline ring_queue<T, Allocator, SingleProducer>::ring_queue
+   (size_type capacity, const allocator_type &a)
+   : m_alloc(a), m_slots(), m_mask(0), m_enqueue_pos(0), m_dequeue_pos(0)
+{
+   //Positions are compared through their signed 32 bit difference
+   if(capacity > (size_type(1u) << 30u)){
+      throw interprocess_exception(size_error);
+   }
+   //A power of two, so that positions can be mapped to slots with a mask
+   size_type size = 2;
+   while(size < capacity){
+      size <<= 1;
+   }
+   m_slots = m_alloc.allocate(size);
+   slot_t *const slots = ipcdetail::to_raw_pointer(m_slots);
+   for(size_type i = 0; i != size; ++i){
+      ::new(slots + i) slot_t(boost::uint32_t(i));
+   }
+   m_mask = boost::uint32_t(size - 1);
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline ring_queue<T, Allocator, SingleProducer>::~ring_queue()
+{
+   slot_t *const slots = ipcdetail::to_raw_pointer(m_slots);
+   const boost::uint32_t end = m_enqueue_pos.load(boost::memory_order_relaxed);
+   for(boost::uint32_t pos = m_dequeue_pos.load(boost::memory_order_relaxed); pos != end; ++pos){
+      slots[pos & m_mask].value()->~T();
+   }
+   for(boost::uint32_t i = 0; i != m_mask + 1; ++i){
+      slots[i].~slot_t();
+   }
+   m_alloc.deallocate(m_slots, size_type(m_mask) + 1);
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline void ring_queue<T, Allocator, SingleProducer>::push(const T &value)
+{  this->do_push(blocking, value, boost::posix_time::ptime());  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::try_push(const T &value)
+{  return this->do_push(non_blocking, value, boost::posix_time::ptime());  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::timed_push
+   (const T &value, const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->push(value);
+      return true;
+   }
+   return this->do_push(timed, value, abs_time);
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline void ring_queue<T, Allocator, SingleProducer>::pop(T &value)
+{  this->do_pop(blocking, value, boost::posix_time::ptime());  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::try_pop(T &value)
+{  return this->do_pop(non_blocking, value, boost::posix_time::ptime());  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::timed_pop
+   (T &value, const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      this->pop(value);
+      return true;
+   }
+   return this->do_pop(timed, value, abs_time);
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline typename ring_queue<T, Allocator, SingleProducer>::size_type
+   ring_queue<T, Allocator, SingleProducer>::capacity() const
+{  return size_type(m_mask) + 1;  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline typename ring_queue<T, Allocator, SingleProducer>::size_type
+   ring_queue<T, Allocator, SingleProducer>::size() const
+{
+   //Read the consumers' position first, so that the difference can't be negative
+   const boost::uint32_t dequeue_pos = m_dequeue_pos.load(boost::memory_order_acquire);
+   const boost::uint32_t enqueue_pos = m_enqueue_pos.load(boost::memory_order_acquire);
+   const size_type n = size_type(boost::uint32_t(enqueue_pos - dequeue_pos));
+   return n < this->capacity() ? n : this->capacity();
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::empty() const
+{  return this->size() == 0;  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline typename ring_queue<T, Allocator, SingleProducer>::allocator_type
+   ring_queue<T, Allocator, SingleProducer>::get_allocator() const
+{  return allocator_type(m_alloc);  }
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::enqueue(const T &value)
+{
+   slot_t *const slots = ipcdetail::to_raw_pointer(m_slots);
+   boost::uint32_t pos = m_enqueue_pos.load(boost::memory_order_relaxed);
+   for(;;){
+      slot_t &slot = slots[pos & m_mask];
+      const boost::int32_t diff = boost::int32_t(slot.seq.load(boost::memory_order_acquire) - pos);
+      if(diff == 0){
+         //The only producer doesn't have to claim the position
+         if(SingleProducer){
+            m_enqueue_pos.store(pos + 1, boost::memory_order_relaxed);
+         }
+         else if(!m_enqueue_pos.compare_exchange_weak(pos, pos + 1, boost::memory_order_relaxed)){
+            //pos has been reloaded by the failed compare and swap
+            continue;
+         }
+         ::new(slot.value()) T(value);
+         slot.seq.store(pos + 1, boost::memory_order_release);
+         return true;
+      }
+      else if(diff < 0){
+         //The slot still holds the element pushed one round earlier: the queue is full
+         return false;
+      }
+      else{
+         pos = m_enqueue_pos.load(boost::memory_order_relaxed);
+      }
+   }
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::dequeue(T &value)
+{
+   slot_t *const slots = ipcdetail::to_raw_pointer(m_slots);
+   boost::uint32_t pos = m_dequeue_pos.load(boost::memory_order_relaxed);
+   for(;;){
+      slot_t &slot = slots[pos & m_mask];
+      const boost::int32_t diff = boost::int32_t(slot.seq.load(boost::memory_order_acquire) - (pos + 1));
+      if(diff == 0){
+         if(m_dequeue_pos.compare_exchange_weak(pos, pos + 1, boost::memory_order_relaxed)){
+            T *const p = slot.value();
+            value = *p;
+            p->~T();
+            slot.seq.store(pos + m_mask + 1, boost::memory_order_release);
+            return true;
+         }
+      }
+      else if(diff < 0){
+         //Nothing has been pushed at pos yet: the queue is empty
+         return false;
+      }
+      else{
+         pos = m_dequeue_pos.load(boost::memory_order_relaxed);
+      }
+   }
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline boost::uint32_t ring_queue<T, Allocator, SingleProducer>::prepare_wait
+   (ipcdetail::ring_queue_waiters &waiters)
+{
+   boost::uint32_t epoch = waiters.epoch.load(boost::memory_order_acquire);
+   while(!(epoch & waiters.sleeping) &&
+         !waiters.epoch.compare_exchange_weak(epoch, epoch | waiters.sleeping, boost::memory_order_acquire)){
+   }
+   //Pairs with the fence of notify(): either the caller sees the element
+   //that was pushed or popped when it retries, or notify() sees the bit
+   boost::atomic_thread_fence(boost::memory_order_seq_cst);
+   return epoch | waiters.sleeping;
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline void ring_queue<T, Allocator, SingleProducer>::notify
+   (ipcdetail::ring_queue_waiters &waiters)
+{
+   boost::atomic_thread_fence(boost::memory_order_seq_cst);
+   boost::uint32_t epoch = waiters.epoch.load(boost::memory_order_relaxed);
+   //Clears the bit. If the compare and swap fails, another thread has woken them up
+   if((epoch & waiters.sleeping) &&
+      waiters.epoch.compare_exchange_strong(epoch, epoch + 1, boost::memory_order_release)){
+      ipcdetail::futex_wake(waiters.epoch, boost::uint32_t(-1));
+   }
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::do_push
+   (block_t block, const T &value, const boost::posix_time::ptime &abs_time)
+{
+   bool pushed = this->enqueue(value);
+   if(!pushed && block != non_blocking){
+      for(unsigned int i = 0; !pushed && i != ipcdetail::ring_queue_yields; ++i){
+         ipcdetail::thread_yield();
+         pushed = this->enqueue(value);
+      }
+      while(!pushed){
+         const boost::uint32_t epoch = prepare_wait(m_not_full);
+         if((pushed = this->enqueue(value))){
+            break;
+         }
+         if(block == timed){
+            if(!ipcdetail::futex_timed_wait(m_not_full.epoch, epoch, abs_time)){
+               pushed = this->enqueue(value);
+               break;
+            }
+         }
+         else{
+            ipcdetail::futex_wait(m_not_full.epoch, epoch);
+         }
+      }
+   }
+   if(pushed){
+      notify(m_not_empty);
+   }
+   return pushed;
+}
+
+template<class T, class Allocator, bool SingleProducer>
+inline bool ring_queue<T, Allocator, SingleProducer>::do_pop
+   (block_t block, T &value, const boost::posix_time::ptime &abs_time)
+{
+   bool popped = this->dequeue(value);
+   if(!popped && block != non_blocking){
+      for(unsigned int i = 0; !popped && i != ipcdetail::ring_queue_yields; ++i){
+         ipcdetail::thread_yield();
+         popped = this->dequeue(value);
+      }
+      while(!popped){
+         const boost::uint32_t epoch = prepare_wait(m_not_empty);
+         if((popped = this->dequeue(value))){
+            break;
+         }
+         if(block == timed){
+            if(!ipcdetail::futex_timed_wait(m_not_empty.epoch, epoch, abs_time)){
+               popped = this->dequeue(value);
+               break;
+            }
+         }
+         else{
+            ipcdetail::futex_wait(m_not_empty.epoch, epoch);
+         }
+      }
+   }
+   if(popped){
+      notify(m_not_full);
+   }
+   return popped;
+}
+
+/// @endcond
+
+}} //namespace boost{  namespace interprocess{
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_RING_QUEUE_HPP
@@ -0,0 +1,121 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef BOOST_INTERPROCESS_DETAIL_FUTEX_HPP
+#define BOOST_INTERPROCESS_DETAIL_FUTEX_HPP
+
+#if (defined _MSC_VER) && (_MSC_VER >= 1200)
+#  pragma once
+#endif
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/detail/os_thread_functions.hpp>
+#include <boost/interprocess/detail/posix_time_types_wrk.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+//!\file
+//!Describes functions to block a thread until a 32 bit word placed in shared
+//!memory changes. Linux futexes are used when available; otherwise the thread
+//!yields its time slice and returns, so callers must be ready for spurious wakeups.
+
+#if defined(__linux__) && !defined(BOOST_INTERPROCESS_DONT_USE_FUTEX)
+#  define BOOST_INTERPROCESS_HAS_FUTEX
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#  include <time.h>
+#  include <climits>
+#  include <cerrno>
+#endif
+
+namespace boost {
+namespace interprocess {
+namespace ipcdetail {
+
+//The futex syscall works on the word itself, so an atomic must be just that word.
+//It must also be lock-free: the locks of the emulation are private to each process.
+BOOST_STATIC_ASSERT(sizeof(boost::atomic<boost::uint32_t>) == sizeof(boost::uint32_t));
+BOOST_STATIC_ASSERT(BOOST_ATOMIC_INT_LOCK_FREE == 2);
+
+#if defined(BOOST_INTERPROCESS_HAS_FUTEX)
+
+//Not FUTEX_WAIT_PRIVATE: the waiters and wakers may live in different processes
+inline int futex_syscall
+   (boost::atomic<boost::uint32_t> &word, int op, boost::uint32_t val, const struct timespec *ts)
+{
+   return static_cast<int>(::syscall(SYS_futex, reinterpret_cast<boost::uint32_t*>(&word), op, val, ts, 0, 0));
+}
+
+//!Blocks until "word" is woken up with futex_wake, if it still contains "old".
+//!Can return spuriously.
+inline void futex_wait(boost::atomic<boost::uint32_t> &word, boost::uint32_t old)
+{
+   futex_syscall(word, FUTEX_WAIT, old, 0);
+}
+
+//!Same as futex_wait but returns false if "abs_time" is reached.
+inline bool futex_timed_wait
+   (boost::atomic<boost::uint32_t> &word, boost::uint32_t old, const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time == boost::posix_time::pos_infin){
+      futex_wait(word, old);
+      return true;
+   }
+   const boost::posix_time::ptime now(microsec_clock::universal_time());
+   if(now >= abs_time){
+      return false;
+   }
+   //FUTEX_WAIT takes a relative timeout
+   const boost::posix_time::time_duration rel(abs_time - now);
+   struct timespec ts;
+   ts.tv_sec  = static_cast<time_t>(rel.total_seconds());
+   ts.tv_nsec = static_cast<long>(rel.total_nanoseconds() % 1000000000);
+   return !(futex_syscall(word, FUTEX_WAIT, old, &ts) == -1 && errno == ETIMEDOUT);
+}
+
+//!Wakes up to "count" threads blocked in "word".
+inline void futex_wake(boost::atomic<boost::uint32_t> &word, boost::uint32_t count)
+{
+   futex_syscall(word, FUTEX_WAKE, count > boost::uint32_t(INT_MAX) ? boost::uint32_t(INT_MAX) : count, 0);
+}
+
+#else
+
+inline void futex_wait(boost::atomic<boost::uint32_t> &, boost::uint32_t)
+{
+   ipcdetail::thread_yield();
+}
+
+inline bool futex_timed_wait
+   (boost::atomic<boost::uint32_t> &, boost::uint32_t, const boost::posix_time::ptime &abs_time)
+{
+   if(abs_time != boost::posix_time::pos_infin &&
+      microsec_clock::universal_time() >= abs_time){
+      return false;
+   }
+   ipcdetail::thread_yield();
+   return true;
+}
+
+inline void futex_wake(boost::atomic<boost::uint32_t> &, boost::uint32_t)
+{}
+
+#endif
+
+}  //namespace ipcdetail {
+}  //namespace interprocess {
+}  //namespace boost {
+
+#include <boost/interprocess/detail/config_end.hpp>
+
+#endif   //BOOST_INTERPROCESS_DETAIL_FUTEX_HPP
@@ -0,0 +1,47 @@
+//  boost lockfree: batch_size helper
+//
+//  Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_LOCKFREE_DETAIL_BATCH_SIZE_HPP_INCLUDED
+#define BOOST_LOCKFREE_DETAIL_BATCH_SIZE_HPP_INCLUDED
+
+#include <cstddef>
+#include <iterator>
+
+namespace boost    {
+namespace lockfree {
+namespace detail   {
+
+/* maximum number of nodes that are taken from or returned to the freelist at once */
+static const std::size_t max_batch_size = 64;
+
+template <typename Iterator>
+std::size_t batch_size(Iterator begin, Iterator end, std::input_iterator_tag)
+{
+    return max_batch_size;
+}
+
+template <typename Iterator>
+std::size_t batch_size(Iterator begin, Iterator end, std::forward_iterator_tag)
+{
+    std::size_t count = 0;
+    for (; begin != end && count != max_batch_size; ++begin)
+        ++count;
+    return count;
+}
+
+/* number of nodes that are needed for the next batch of elements from [begin, end). single-pass iterators can't be
+ * counted, so they always get a full batch. */
+template <typename Iterator>
+std::size_t batch_size(Iterator begin, Iterator end)
+{
+    return batch_size(begin, end, typename std::iterator_traits<Iterator>::iterator_category());
+}
+
+}}}
+
+#endif  /* BOOST_LOCKFREE_DETAIL_BATCH_SIZE_HPP_INCLUDED */
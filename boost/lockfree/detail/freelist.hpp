@@ -20,6 +20,7 @@
 #include <boost/lockfree/detail/atomic.hpp>
 #include <boost/lockfree/detail/parameter.hpp>
 #include <boost/lockfree/detail/tagged_ptr.hpp>
+#include <boost/lockfree/detail/thread_cache.hpp>
 
 namespace boost    {
 namespace lockfree {
@@ -107,6 +108,74 @@ public:
         deallocate<ThreadSafe>(n);
     }
 
+    /** Allocates up to n nodes, which are not constructed, and stores them in nodes.
+     *
+     *  The nodes are taken from the freelist with a single compare-and-swap. If the freelist runs out, the remaining
+     *  nodes are allocated from the allocator, unless Bounded is true.
+     *
+     *  \returns the number of nodes that have been allocated
+     * */
+    template <bool ThreadSafe, bool Bounded>
+    std::size_t allocate_n (T ** nodes, std::size_t n)
+    {
+        std::size_t count = ThreadSafe ? allocate_n_impl(nodes, n)
+                                       : allocate_n_impl_unsafe(nodes, n);
+        if (Bounded)
+            return count;
+
+        try {
+            for (; count != n; ++count)
+                nodes[count] = Alloc::allocate(1);
+        } catch (...) {
+            deallocate_n<ThreadSafe>(nodes, count);
+            throw;
+        }
+        return count;
+    }
+
+    /** Returns n nodes, which have already been destructed, to the freelist with a single compare-and-swap.
+     * */
+    template <bool ThreadSafe>
+    void deallocate_n (T * const * nodes, std::size_t n)
+    {
+        if (n == 0)
+            return;
+
+        for (std::size_t i = 0; i != n - 1; ++i) {
+            freelist_node * node = reinterpret_cast<freelist_node*>(static_cast<void*>(nodes[i]));
+            node->next.set_ptr(reinterpret_cast<freelist_node*>(static_cast<void*>(nodes[i + 1])));
+        }
+
+        freelist_node * first = reinterpret_cast<freelist_node*>(static_cast<void*>(nodes[0]));
+        freelist_node * last = reinterpret_cast<freelist_node*>(static_cast<void*>(nodes[n - 1]));
+
+        if (ThreadSafe) {
+            tagged_node_ptr old_pool = pool_.load(memory_order_consume);
+            for(;;) {
+                tagged_node_ptr new_pool (first, old_pool.get_tag());
+                last->next.set_ptr(old_pool.get_ptr());
+
+                if (pool_.compare_exchange_weak(old_pool, new_pool))
+                    return;
+            }
+        } else {
+            tagged_node_ptr old_pool = pool_.load(memory_order_relaxed);
+            tagged_node_ptr new_pool (first, old_pool.get_tag());
+            last->next.set_ptr(old_pool.get_ptr());
+            pool_.store(new_pool, memory_order_relaxed);
+        }
+    }
+
+    /** Destructs n nodes and returns them to the freelist with a single compare-and-swap.
+     * */
+    template <bool ThreadSafe>
+    void destruct_n (T * const * nodes, std::size_t n)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+            nodes[i]->~T();
+        deallocate_n<ThreadSafe>(nodes, n);
+    }
+
     ~freelist_stack(void)
     {
         tagged_node_ptr current (pool_);
@@ -183,6 +252,66 @@ private:
         }
     }
 
+    /* Takes a chain of up to n nodes from the top of the freelist. Another thread may allocate a node while the chain
+     * is being followed, and overwrite its next pointer, so the top of the freelist is checked again before each
+     * pointer is followed. As every allocation increments the tag, the chain is intact if the top is unchanged. */
+    std::size_t allocate_n_impl (T ** nodes, std::size_t n)
+    {
+        tagged_node_ptr old_pool = pool_.load(memory_order_consume);
+
+        for(;;) {
+            freelist_node * first = old_pool.get_ptr();
+            if (!first || n == 0)
+                return 0;
+
+            freelist_node * last = first;
+            std::size_t count = 1;
+            bool changed = false;
+
+            while (count != n) {
+                freelist_node * next = last->next.get_ptr();
+                if (!next)
+                    break;
+
+                tagged_node_ptr current_pool = pool_.load(memory_order_acquire);
+                if (current_pool != old_pool) {
+                    old_pool = current_pool;
+                    changed = true;
+                    break;
+                }
+
+                last = next;
+                ++count;
+            }
+
+            if (changed)
+                continue;
+
+            tagged_node_ptr new_pool (last->next.get_ptr(), old_pool.get_tag() + 1);
+
+            if (pool_.compare_exchange_weak(old_pool, new_pool)) {
+                freelist_node * current = first;
+                for (std::size_t i = 0; i != count; ++i) {
+                    nodes[i] = reinterpret_cast<T*>(static_cast<void*>(current));
+                    current = current->next.get_ptr();
+                }
+                return count;
+            }
+        }
+    }
+
+    std::size_t allocate_n_impl_unsafe (T ** nodes, std::size_t n)
+    {
+        std::size_t count = 0;
+        for (; count != n; ++count) {
+            T * node = allocate_impl_unsafe<true>();
+            if (!node)
+                break;
+            nodes[count] = node;
+        }
+        return count;
+    }
+
     template <bool Bounded>
     T * allocate_impl_unsafe (void)
     {
@@ -244,6 +373,157 @@ private:
     atomic<tagged_node_ptr> pool_;
 };
 
+/* freelist_stack with a small cache of free nodes for every thread in front of it.
+ *
+ * thread-safe allocations and deallocations are served from the cache of the calling thread, which is refilled from
+ * or drained to the shared freelist in batches, so that most operations do not touch the shared top of the freelist.
+ * the caches are owned by the freelist, so nodes are neither lost when a thread exits, nor when the freelist is
+ * destroyed. if there are more threads than caches, threads share caches, and a thread, that finds its cache locked,
+ * uses the shared freelist directly. before a new node is allocated from the allocator (or a bounded allocation fails),
+ * the caches of the other threads are searched for a free node.
+ * */
+template <typename T,
+          typename Alloc = std::allocator<T>
+         >
+class cached_freelist_stack:
+    public freelist_stack<T, Alloc>
+{
+    typedef freelist_stack<T, Alloc> base_type;
+
+    static const std::size_t magazine_size = 32;
+    static const std::size_t transfer_size = magazine_size / 2;
+    static const std::size_t magazine_count = 16;
+
+    typedef thread_cache_magazine<T, magazine_size> magazine;
+
+public:
+    typedef typename base_type::tagged_node_handle tagged_node_handle;
+
+    template <typename Allocator>
+    cached_freelist_stack (Allocator const & alloc, std::size_t n = 0):
+        base_type(alloc, n)
+    {}
+
+    ~cached_freelist_stack(void)
+    {
+        for (std::size_t i = 0; i != magazine_count; ++i)
+            base_type::template deallocate_n<false>(magazines_[i].nodes, magazines_[i].count);
+    }
+
+    template <bool ThreadSafe, bool Bounded>
+    T * construct (void)
+    {
+        T * node = allocate<ThreadSafe, Bounded>();
+        if (node)
+            new(node) T();
+        return node;
+    }
+
+    template <bool ThreadSafe, bool Bounded, typename ArgumentType>
+    T * construct (ArgumentType const & arg)
+    {
+        T * node = allocate<ThreadSafe, Bounded>();
+        if (node)
+            new(node) T(arg);
+        return node;
+    }
+
+    template <bool ThreadSafe, bool Bounded, typename ArgumentType1, typename ArgumentType2>
+    T * construct (ArgumentType1 const & arg1, ArgumentType2 const & arg2)
+    {
+        T * node = allocate<ThreadSafe, Bounded>();
+        if (node)
+            new(node) T(arg1, arg2);
+        return node;
+    }
+
+    template <bool ThreadSafe>
+    void destruct (tagged_node_handle tagged_ptr)
+    {
+        T * n = tagged_ptr.get_ptr();
+        n->~T();
+        deallocate<ThreadSafe>(n);
+    }
+
+    template <bool ThreadSafe>
+    void destruct (T * n)
+    {
+        n->~T();
+        deallocate<ThreadSafe>(n);
+    }
+
+protected:
+    template <bool ThreadSafe, bool Bounded>
+    T * allocate (void)
+    {
+        if (!ThreadSafe)
+            return base_type::template allocate<false, Bounded>();
+
+        magazine & m = magazines_[thread_cache_index() % magazine_count];
+        if (m.try_lock()) {
+            if (m.count == 0)
+                m.count = base_type::template allocate_n<true, true>(m.nodes, transfer_size);
+
+            if (m.count != 0) {
+                T * node = m.nodes[--m.count];
+                m.unlock();
+                return node;
+            }
+            m.unlock();
+        }
+
+        T * node = base_type::template allocate<true, true>();
+        if (node)
+            return node;
+
+        node = steal();
+        if (node || Bounded)
+            return node;
+
+        return base_type::template allocate<true, false>();
+    }
+
+    template <bool ThreadSafe>
+    void deallocate (T * n)
+    {
+        if (!ThreadSafe) {
+            base_type::template deallocate<false>(n);
+            return;
+        }
+
+        magazine & m = magazines_[thread_cache_index() % magazine_count];
+        if (m.try_lock()) {
+            if (m.count == magazine_size) {
+                m.count -= transfer_size;
+                base_type::template deallocate_n<true>(m.nodes + m.count, transfer_size);
+            }
+            m.nodes[m.count++] = n;
+            m.unlock();
+            return;
+        }
+
+        base_type::template deallocate<true>(n);
+    }
+
+private:
+    T * steal (void)
+    {
+        for (std::size_t i = 0; i != magazine_count; ++i) {
+            magazine & m = magazines_[i];
+            if (!m.try_lock())
+                continue;
+
+            T * node = m.count ? m.nodes[--m.count] : 0;
+            m.unlock();
+            if (node)
+                return node;
+        }
+        return 0;
+    }
+
+    magazine magazines_[magazine_count];
+};
+
 class tagged_index
 {
 public:
@@ -459,6 +739,67 @@ public:
         deallocate<ThreadSafe>(n - NodeStorage::nodes());
     }
 
+    /** \copydoc freelist_stack::allocate_n
+     *
+     *  \note The nodes are never allocated from the allocator.
+     * */
+    template <bool ThreadSafe, bool Bounded>
+    std::size_t allocate_n (T ** nodes, std::size_t n)
+    {
+        if (ThreadSafe)
+            return allocate_n_impl(nodes, n);
+
+        std::size_t count = 0;
+        for (; count != n; ++count) {
+            index_t index = allocate_impl_unsafe();
+            if (index == null_handle())
+                break;
+            nodes[count] = NodeStorage::nodes() + index;
+        }
+        return count;
+    }
+
+    /** \copydoc freelist_stack::deallocate_n
+     * */
+    template <bool ThreadSafe>
+    void deallocate_n (T * const * nodes, std::size_t n)
+    {
+        if (n == 0)
+            return;
+
+        for (std::size_t i = 0; i != n - 1; ++i)
+            node_next(nodes[i]).set_index(get_handle(nodes[i + 1]));
+
+        index_t first = get_handle(nodes[0]);
+        tagged_index & last_next = node_next(nodes[n - 1]);
+
+        if (ThreadSafe) {
+            tagged_index old_pool = pool_.load(memory_order_consume);
+            for(;;) {
+                tagged_index new_pool (first, old_pool.get_tag());
+                last_next.set_index(old_pool.get_index());
+
+                if (pool_.compare_exchange_weak(old_pool, new_pool))
+                    return;
+            }
+        } else {
+            tagged_index old_pool = pool_.load(memory_order_relaxed);
+            tagged_index new_pool (first, old_pool.get_tag());
+            last_next.set_index(old_pool.get_index());
+            pool_.store(new_pool, memory_order_relaxed);
+        }
+    }
+
+    /** \copydoc freelist_stack::destruct_n
+     * */
+    template <bool ThreadSafe>
+    void destruct_n (T * const * nodes, std::size_t n)
+    {
+        for (std::size_t i = 0; i != n; ++i)
+            nodes[i]->~T();
+        deallocate_n<ThreadSafe>(nodes, n);
+    }
+
     bool is_lock_free(void) const
     {
         return pool_.is_lock_free();
@@ -530,6 +871,57 @@ private:
         }
     }
 
+    tagged_index & node_next (T * node) const
+    {
+        return reinterpret_cast<freelist_node*>(static_cast<void*>(node))->next;
+    }
+
+    /* \copydoc freelist_stack::allocate_n_impl */
+    std::size_t allocate_n_impl (T ** nodes, std::size_t n)
+    {
+        tagged_index old_pool = pool_.load(memory_order_consume);
+
+        for(;;) {
+            index_t first = old_pool.get_index();
+            if (first == null_handle() || n == 0)
+                return 0;
+
+            index_t last = first;
+            std::size_t count = 1;
+            bool changed = false;
+
+            while (count != n) {
+                index_t next = node_next(NodeStorage::nodes() + last).get_index();
+                if (next == null_handle())
+                    break;
+
+                tagged_index current_pool = pool_.load(memory_order_acquire);
+                if (!(current_pool == old_pool)) {
+                    old_pool = current_pool;
+                    changed = true;
+                    break;
+                }
+
+                last = next;
+                ++count;
+            }
+
+            if (changed)
+                continue;
+
+            tagged_index new_pool(node_next(NodeStorage::nodes() + last).get_index(), old_pool.get_tag() + 1);
+
+            if (pool_.compare_exchange_weak(old_pool, new_pool)) {
+                index_t current = first;
+                for (std::size_t i = 0; i != count; ++i) {
+                    nodes[i] = NodeStorage::nodes() + current;
+                    current = node_next(nodes[i]).get_index();
+                }
+                return count;
+            }
+        }
+    }
+
     index_t allocate_impl_unsafe (void)
     {
         tagged_index old_pool = pool_.load(memory_order_consume);
@@ -588,7 +980,8 @@ template <typename T,
           typename Alloc,
           bool IsCompileTimeSized,
           bool IsFixedSize,
-          std::size_t Capacity
+          std::size_t Capacity,
+          bool UseThreadCache = false
           >
 struct select_freelist
 {
@@ -597,9 +990,14 @@ struct select_freelist
                                runtime_sized_freelist_storage<T, Alloc>
                               >::type fixed_sized_storage_type;
 
+    typedef typename mpl::if_c<UseThreadCache,
+                               cached_freelist_stack<T, Alloc>,
+                               freelist_stack<T, Alloc>
+                              >::type node_based_freelist_type;
+
     typedef typename mpl::if_c<IsCompileTimeSized || IsFixedSize,
                                fixed_size_freelist<T, fixed_sized_storage_type>,
-                               freelist_stack<T, Alloc>
+                               node_based_freelist_type
                               >::type type;
 };
 
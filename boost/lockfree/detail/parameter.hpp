@@ -65,6 +65,19 @@ struct extract_fixed_sized
     static const bool value = type::value;
 };
 
+template <typename bound_args>
+struct extract_thread_cache
+{
+    static const bool has_thread_cache = has_arg<bound_args, tag::thread_cache>::value;
+
+    typedef typename mpl::if_c<has_thread_cache,
+                               typename has_arg<bound_args, tag::thread_cache>::type,
+                               mpl::bool_<false>
+                              >::type type;
+
+    static const bool value = type::value;
+};
+
 
 } /* namespace detail */
 } /* namespace lockfree */
@@ -0,0 +1,74 @@
+//  per-thread node caches for the lock-free freelist
+//
+//  Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_LOCKFREE_DETAIL_THREAD_CACHE_HPP_INCLUDED
+#define BOOST_LOCKFREE_DETAIL_THREAD_CACHE_HPP_INCLUDED
+
+#include <cstddef>
+
+#include <boost/lockfree/detail/atomic.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
+
+#if defined(__GNUC__)
+#define BOOST_LOCKFREE_THREAD_LOCAL __thread
+#elif defined(_MSC_VER)
+#define BOOST_LOCKFREE_THREAD_LOCAL __declspec(thread)
+#endif
+
+namespace boost    {
+namespace lockfree {
+namespace detail   {
+
+/* returns a number, that is different for every thread, as long as there are less than 2**32 threads.
+ *
+ * the number is assigned on the first call from a thread. without compiler support for thread-local storage, the
+ * address of the stack is used instead, which is usually different for concurrently running threads. */
+inline std::size_t thread_cache_index(void)
+{
+#ifdef BOOST_LOCKFREE_THREAD_LOCAL
+    static BOOST_LOCKFREE_THREAD_LOCAL std::size_t index = 0;
+    if (index == 0) {
+        static atomic<std::size_t> next_index(0);
+        index = ++next_index;
+    }
+    return index;
+#else
+    char marker;
+    return reinterpret_cast<std::size_t>(&marker) >> 16;
+#endif
+}
+
+/* a small cache of free nodes. the owning thread locks it with a single exchange, that normally hits its own cache
+ * line. threads, which fail to lock it, do not wait, but fall back to the shared freelist. */
+template <typename T, std::size_t Size>
+struct BOOST_LOCKFREE_CACHELINE_ALIGNMENT thread_cache_magazine
+{
+    thread_cache_magazine(void):
+        locked(false), count(0)
+    {}
+
+    bool try_lock(void)
+    {
+        return !locked.load(memory_order_relaxed) && !locked.exchange(true, memory_order_acquire);
+    }
+
+    void unlock(void)
+    {
+        locked.store(false, memory_order_release);
+    }
+
+    atomic<bool> locked;
+    std::size_t count;
+    T * nodes[Size];
+};
+
+} /* namespace detail */
+} /* namespace lockfree */
+} /* namespace boost */
+
+#endif /* BOOST_LOCKFREE_DETAIL_THREAD_CACHE_HPP_INCLUDED */
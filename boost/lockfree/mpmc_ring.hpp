@@ -0,0 +1,466 @@
+//  lock-free bounded multi-producer/multi-consumer ringbuffer
+//  based on the bounded mpmc queue by Dmitry Vyukov
+//
+//  Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_LOCKFREE_MPMC_RING_HPP_INCLUDED
+#define BOOST_LOCKFREE_MPMC_RING_HPP_INCLUDED
+
+#include <cstddef>
+#include <new>
+
+#include <boost/array.hpp>
+#include <boost/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/lockfree/detail/atomic.hpp>
+#include <boost/lockfree/detail/branch_hints.hpp>
+#include <boost/lockfree/detail/copy_payload.hpp>
+#include <boost/lockfree/detail/parameter.hpp>
+#include <boost/lockfree/detail/prefix.hpp>
+
+
+namespace boost    {
+namespace lockfree {
+namespace detail   {
+
+typedef parameter::parameters<boost::parameter::optional<tag::capacity>,
+                              boost::parameter::optional<tag::allocator>
+                             > mpmc_ring_signature;
+
+/* every slot carries a sequence number, which tells producers and consumers whose turn it is:
+ * sequence == pos     the slot is free and can be written by the producer that claims pos
+ * sequence == pos + 1 the slot holds the element that was pushed at pos
+ * after the element has been popped, the sequence is advanced to pos + size, the next position that maps to this slot
+ * if copying the element into the slot throws, the slot is published without an element, and the consumer skips it
+ * */
+template <typename T>
+struct mpmc_ring_cell
+{
+    atomic<std::size_t> sequence;
+    bool filled;
+    T data;
+};
+
+template <typename T>
+class mpmc_ring_base:
+    boost::noncopyable
+{
+#ifndef BOOST_DOXYGEN_INVOKED
+    typedef std::size_t size_t;
+    static const int padding_size = BOOST_LOCKFREE_CACHELINE_BYTES - sizeof(size_t);
+
+    char padding0[BOOST_LOCKFREE_CACHELINE_BYTES]; /* keep the positions away from whatever precedes the ringbuffer */
+    atomic<size_t> enqueue_pos_;
+    char padding1[padding_size];                   /* force enqueue_pos and dequeue_pos to different cache lines */
+    atomic<size_t> dequeue_pos_;
+    char padding2[padding_size];
+
+protected:
+    typedef mpmc_ring_cell<T> cell;
+
+    mpmc_ring_base(void):
+        enqueue_pos_(0), dequeue_pos_(0)
+    {}
+
+    static void initialize(cell * buffer, size_t size)
+    {
+        for (size_t i = 0; i != size; ++i)
+            buffer[i].sequence.store(i, memory_order_relaxed);
+    }
+
+    /* size must be a power of two, so that positions can be mapped to slots with a mask */
+    static size_t round_up_to_power_of_two(size_t n)
+    {
+        size_t ret = 2;
+        while (ret < n)
+            ret <<= 1;
+        return ret;
+    }
+
+    bool push(T const & t, cell * buffer, size_t mask)
+    {
+        size_t pos = enqueue_pos_.load(memory_order_relaxed);
+
+        for (;;) {
+            cell & c = buffer[pos & mask];
+            size_t seq = c.sequence.load(memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - pos);
+
+            if (likely(diff == 0)) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    try {
+                        c.data = t;
+                    } catch (...) {
+                        /* the slot has been claimed, it has to be handed over to the consumer at pos */
+                        c.filled = false;
+                        c.sequence.store(pos + 1, memory_order_release);
+                        throw;
+                    }
+                    c.filled = true;
+                    c.sequence.store(pos + 1, memory_order_release);
+                    return true;
+                }
+                /* pos has been reloaded by the failed compare_exchange */
+            } else if (diff < 0)
+                return false; /* the slot still holds the element pushed one round earlier: ringbuffer is full */
+            else
+                pos = enqueue_pos_.load(memory_order_relaxed);
+        }
+    }
+
+    template <typename U>
+    bool pop(U & ret, cell * buffer, size_t mask)
+    {
+        size_t pos = dequeue_pos_.load(memory_order_relaxed);
+
+        for (;;) {
+            cell & c = buffer[pos & mask];
+            size_t seq = c.sequence.load(memory_order_acquire);
+            std::ptrdiff_t diff = static_cast<std::ptrdiff_t>(seq - (pos + 1));
+
+            if (likely(diff == 0)) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, memory_order_relaxed)) {
+                    if (unlikely(!c.filled)) {
+                        /* the producer failed to copy the element: release the slot, and try the next position */
+                        c.sequence.store(pos + mask + 1, memory_order_release);
+                        pos = dequeue_pos_.load(memory_order_relaxed);
+                        continue;
+                    }
+                    try {
+                        detail::copy_payload(c.data, ret);
+                    } catch (...) {
+                        c.sequence.store(pos + mask + 1, memory_order_release);
+                        throw;
+                    }
+                    c.sequence.store(pos + mask + 1, memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0)
+                return false; /* nothing has been pushed at pos yet: ringbuffer is empty */
+            else
+                pos = dequeue_pos_.load(memory_order_relaxed);
+        }
+    }
+#endif
+
+public:
+    /** Check if the ringbuffer is empty
+     *
+     * \return true, if the ringbuffer is empty, false otherwise
+     * \note Due to the concurrent nature of the ringbuffer the result may be inaccurate.
+     * */
+    bool empty(void)
+    {
+        return dequeue_pos_.load(memory_order_relaxed) == enqueue_pos_.load(memory_order_relaxed);
+    }
+
+    /**
+     * \return true, if implementation is lock-free.
+     *
+     * */
+    bool is_lock_free(void) const
+    {
+        return enqueue_pos_.is_lock_free() && dequeue_pos_.is_lock_free();
+    }
+};
+
+template <typename T, std::size_t max_size>
+class compile_time_sized_mpmc_ring:
+    public mpmc_ring_base<T>
+{
+    typedef std::size_t size_t;
+    typedef mpmc_ring_base<T> base_type;
+    typedef typename base_type::cell cell;
+
+    BOOST_STATIC_ASSERT(max_size >= 2);
+    BOOST_STATIC_ASSERT((max_size & (max_size - 1)) == 0);
+
+    static const size_t mask = max_size - 1;
+    boost::array<cell, max_size> array_;
+
+public:
+    compile_time_sized_mpmc_ring(void)
+    {
+        base_type::initialize(array_.c_array(), max_size);
+    }
+
+    size_t capacity(void) const
+    {
+        return max_size;
+    }
+
+    bool push(T const & t)
+    {
+        return base_type::push(t, array_.c_array(), mask);
+    }
+
+    template <typename U>
+    bool pop(U & ret)
+    {
+        return base_type::pop(ret, array_.c_array(), mask);
+    }
+};
+
+template <typename T, typename Alloc>
+class runtime_sized_mpmc_ring:
+    public mpmc_ring_base<T>,
+    private Alloc::template rebind<mpmc_ring_cell<T> >::other
+{
+    typedef std::size_t size_t;
+    typedef mpmc_ring_base<T> base_type;
+    typedef typename base_type::cell cell;
+    typedef typename Alloc::template rebind<cell>::other cell_allocator;
+    typedef typename cell_allocator::pointer pointer;
+
+    size_t max_elements_;
+    pointer array_;
+
+    void initialize(void)
+    {
+        array_ = cell_allocator::allocate(max_elements_);
+        cell * buffer = &*array_;
+        size_t i = 0;
+        try {
+            for (; i != max_elements_; ++i)
+                new (buffer + i) cell();
+        } catch (...) {
+            while (i != 0)
+                buffer[--i].~cell();
+            cell_allocator::deallocate(array_, max_elements_);
+            throw;
+        }
+        base_type::initialize(buffer, max_elements_);
+    }
+
+public:
+    explicit runtime_sized_mpmc_ring(size_t max_elements):
+        max_elements_(base_type::round_up_to_power_of_two(max_elements))
+    {
+        initialize();
+    }
+
+    template <typename U>
+    runtime_sized_mpmc_ring(typename Alloc::template rebind<U>::other const & alloc, size_t max_elements):
+        cell_allocator(alloc), max_elements_(base_type::round_up_to_power_of_two(max_elements))
+    {
+        initialize();
+    }
+
+    runtime_sized_mpmc_ring(Alloc const & alloc, size_t max_elements):
+        cell_allocator(alloc), max_elements_(base_type::round_up_to_power_of_two(max_elements))
+    {
+        initialize();
+    }
+
+    ~runtime_sized_mpmc_ring(void)
+    {
+        cell * buffer = &*array_;
+        for (size_t i = 0; i != max_elements_; ++i)
+            buffer[i].~cell();
+        cell_allocator::deallocate(array_, max_elements_);
+    }
+
+    size_t capacity(void) const
+    {
+        return max_elements_;
+    }
+
+    bool push(T const & t)
+    {
+        return base_type::push(t, &*array_, max_elements_ - 1);
+    }
+
+    template <typename U>
+    bool pop(U & ret)
+    {
+        return base_type::pop(ret, &*array_, max_elements_ - 1);
+    }
+};
+
+template <typename T, typename A0, typename A1>
+struct make_mpmc_ring
+{
+    typedef typename mpmc_ring_signature::bind<A0, A1>::type bound_args;
+
+    typedef extract_capacity<bound_args> extract_capacity_t;
+
+    static const bool runtime_sized = !extract_capacity_t::has_capacity;
+    static const size_t capacity    =  extract_capacity_t::capacity;
+
+    typedef extract_allocator<bound_args, T> extract_allocator_t;
+    typedef typename extract_allocator_t::type allocator;
+
+    // allocator argument is only sane, for run-time sized ringbuffers
+    BOOST_STATIC_ASSERT((mpl::if_<mpl::bool_<!runtime_sized>,
+                                  mpl::bool_<!extract_allocator_t::has_allocator>,
+                                  mpl::true_
+                                 >::type::value));
+
+    typedef typename mpl::if_c<runtime_sized,
+                               runtime_sized_mpmc_ring<T, allocator>,
+                               compile_time_sized_mpmc_ring<T, capacity>
+                              >::type ringbuffer_type;
+};
+
+
+} /* namespace detail */
+
+
+/** The mpmc_ring class provides a bounded multi-writer/multi-reader fifo queue, that is backed by an array of slots instead of
+ *  a linked list. Pushing and popping never allocates memory and never touches a freelist: each operation claims a slot with
+ *  a single compare-and-swap on a position counter, and hands the slot over by advancing the sequence number of the slot.
+ *
+ *  \b Policies:
+ *  - \c boost::lockfree::capacity<>, optional <br>
+ *    If this template argument is passed to the options, the size of the ringbuffer is set at compile-time. The capacity has
+ *    to be a power of two.
+ *
+ *  - \c boost::lockfree::allocator<>, defaults to \c boost::lockfree::allocator<std::allocator<T>> <br>
+ *    Specifies the allocator that is used to allocate the ringbuffer. This option is only valid, if the ringbuffer is configured
+ *    to be sized at run-time
+ *
+ *  \b Requirements:
+ *  - T must have a default constructor
+ *  - T must be copyable
+ *
+ *  If copying an element into or out of the ringbuffer throws, the exception is propagated and the element is lost. The slot
+ *  is released in either case, so the ringbuffer remains usable by all threads.
+ *
+ *  \note A thread that has claimed a slot, but has not finished copying the element, delays the threads that reach the same
+ *        slot: until it is done, push may report a full ringbuffer and pop may report an empty one, although other slots are
+ *        available.
+ * */
+#ifndef BOOST_DOXYGEN_INVOKED
+template <typename T,
+          class A0 = boost::parameter::void_,
+          class A1 = boost::parameter::void_>
+#else
+template <typename T, ...Options>
+#endif
+class mpmc_ring:
+    public detail::make_mpmc_ring<T, A0, A1>::ringbuffer_type
+{
+private:
+
+#ifndef BOOST_DOXYGEN_INVOKED
+    typedef typename detail::make_mpmc_ring<T, A0, A1>::ringbuffer_type base_type;
+    static const bool runtime_sized = detail::make_mpmc_ring<T, A0, A1>::runtime_sized;
+    typedef typename detail::make_mpmc_ring<T, A0, A1>::allocator allocator_arg;
+
+    struct implementation_defined
+    {
+        typedef allocator_arg allocator;
+        typedef std::size_t size_type;
+    };
+#endif
+
+public:
+    typedef T value_type;
+    typedef typename implementation_defined::allocator allocator;
+    typedef typename implementation_defined::size_type size_type;
+
+    /** Constructs a mpmc_ring
+     *
+     *  \pre mpmc_ring must be configured to be sized at compile-time
+     */
+    mpmc_ring(void)
+    {
+        BOOST_ASSERT(!runtime_sized);
+    }
+
+    /** Constructs a mpmc_ring for at least element_count elements. The size of the ringbuffer is rounded up to the next
+     *  power of two.
+     *
+     *  \pre mpmc_ring must be configured to be sized at run-time
+     */
+    // @{
+    explicit mpmc_ring(size_type element_count):
+        base_type(element_count)
+    {
+        BOOST_ASSERT(runtime_sized);
+    }
+
+    template <typename U>
+    mpmc_ring(size_type element_count, typename allocator::template rebind<U>::other const & alloc):
+        base_type(alloc, element_count)
+    {
+        BOOST_STATIC_ASSERT(runtime_sized);
+    }
+
+    mpmc_ring(size_type element_count, allocator_arg const & alloc):
+        base_type(alloc, element_count)
+    {
+        BOOST_ASSERT(runtime_sized);
+    }
+    // @}
+
+    /** \return the number of elements the ringbuffer can hold
+     * */
+    size_type capacity(void) const
+    {
+        return base_type::capacity();
+    }
+
+    /** Pushes object t to the ringbuffer.
+     *
+     * \post object will be pushed to the ringbuffer, unless it is full.
+     * \return true, if the push operation is successful.
+     *
+     * \note Thread-safe and non-blocking
+     * */
+    bool push(T const & t)
+    {
+        return base_type::push(t);
+    }
+
+    /** Pushes object t to the ringbuffer.
+     *
+     * \post object will be pushed to the ringbuffer, unless it is full.
+     * \return true, if the push operation is successful.
+     *
+     * \note Thread-safe and non-blocking. Equivalent to push, as the ringbuffer is always bounded. Provided for interface
+     *       compatibility with boost::lockfree::queue
+     * */
+    bool bounded_push(T const & t)
+    {
+        return base_type::push(t);
+    }
+
+    /** Pops one object from ringbuffer.
+     *
+     * \post if ringbuffer is not empty, object will be copied to ret.
+     * \return true, if the pop operation is successful, false if ringbuffer was empty.
+     *
+     * \note Thread-safe and non-blocking
+     */
+    bool pop(T & ret)
+    {
+        return base_type::pop(ret);
+    }
+
+    /** Pops one object from ringbuffer.
+     *
+     * \pre type U must be constructible by T and copyable, or T must be convertible to U
+     * \post if ringbuffer is not empty, object will be copied to ret.
+     * \return true, if the pop operation is successful, false if ringbuffer was empty.
+     *
+     * \note Thread-safe and non-blocking
+     */
+    template <typename U>
+    bool pop(U & ret)
+    {
+        return base_type::pop(ret);
+    }
+};
+
+} /* namespace lockfree */
+} /* namespace boost */
+
+
+#endif /* BOOST_LOCKFREE_MPMC_RING_HPP_INCLUDED */
@@ -21,6 +21,7 @@ namespace lockfree {
 namespace tag { struct allocator ; }
 namespace tag { struct fixed_sized; }
 namespace tag { struct capacity; }
+namespace tag { struct thread_cache; }
 
 #endif
 
@@ -45,6 +46,17 @@ struct capacity:
     boost::parameter::template_keyword<tag::capacity, boost::mpl::size_t<Size> >
 {};
 
+/** Puts a small \b cache of free nodes for every thread in front of the freelist of a node-based data structure.
+ *
+ *  Nodes are taken from and returned to the shared freelist in batches, so that most push and pop operations do not
+ *  modify the shared top of the freelist. Nodes are kept in the caches of threads that are not using the data structure
+ *  until another thread runs out of nodes, so this option is not compatible with \c fixed_sized<true> or \c capacity<>.
+ * */
+template <bool UseThreadCache>
+struct thread_cache:
+    boost::parameter::template_keyword<tag::thread_cache, boost::mpl::bool_<UseThreadCache> >
+{};
+
 /** Defines the \b allocator type of a data structure.
  * */
 template <class Alloc>
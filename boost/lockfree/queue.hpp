@@ -16,10 +16,12 @@
 #include <boost/assert.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/tuple/tuple.hpp>
 #include <boost/type_traits/has_trivial_assign.hpp>
 #include <boost/type_traits/has_trivial_destructor.hpp>
 
 #include <boost/lockfree/detail/atomic.hpp>
+#include <boost/lockfree/detail/batch_size.hpp>
 #include <boost/lockfree/detail/copy_payload.hpp>
 #include <boost/lockfree/detail/freelist.hpp>
 #include <boost/lockfree/detail/parameter.hpp>
@@ -30,7 +32,8 @@ namespace lockfree {
 namespace detail   {
 
 typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
-                              boost::parameter::optional<tag::capacity>
+                              boost::parameter::optional<tag::capacity>,
+                              boost::parameter::optional<tag::thread_cache>
                              > queue_signature;
 
 } /* namespace detail */
@@ -55,6 +58,10 @@ typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
  *  - \ref boost::lockfree::allocator, defaults to \c boost::lockfree::allocator<std::allocator<void>> \n
  *    Specifies the allocator that is used for the internal freelist
  *
+ *  - \ref boost::lockfree::thread_cache, defaults to \c boost::lockfree::thread_cache<false> \n
+ *    Puts a small cache of free nodes for every thread in front of the freelist, which is refilled and drained in batches.\n
+ *    Only valid for node-based queues.
+ *
  *  \b Requirements:
  *   - T must have a copy constructor
  *   - T must have a trivial assignment operator
@@ -89,6 +96,10 @@ private:
     static const size_t capacity = detail::extract_capacity<bound_args>::capacity;
     static const bool fixed_sized = detail::extract_fixed_sized<bound_args>::value;
     static const bool node_based = !(has_capacity || fixed_sized);
+    static const bool thread_cache = detail::extract_thread_cache<bound_args>::value;
+
+    // the per-thread caches are only implemented for node-based freelists
+    BOOST_STATIC_ASSERT(!thread_cache || node_based);
     static const bool compile_time_sized = has_capacity;
 
     struct BOOST_LOCKFREE_CACHELINE_ALIGNMENT node
@@ -117,7 +128,7 @@ private:
     };
 
     typedef typename detail::extract_allocator<bound_args, node>::type node_allocator;
-    typedef typename detail::select_freelist<node, node_allocator, compile_time_sized, fixed_sized, capacity>::type pool_t;
+    typedef typename detail::select_freelist<node, node_allocator, compile_time_sized, fixed_sized, capacity, thread_cache>::type pool_t;
     typedef typename pool_t::tagged_node_handle tagged_node_handle;
     typedef typename detail::select_tagged_handle<node, node_based>::handle_type handle_type;
 
@@ -276,14 +287,39 @@ private:
     template <bool Bounded>
     bool do_push(T const & t)
     {
-        using detail::likely;
-
         node * n = pool.template construct<true, Bounded>(t, pool.null_handle());
-        handle_type node_handle = pool.get_handle(n);
 
         if (n == NULL)
             return false;
 
+        link_nodes_atomic(n, n);
+        return true;
+    }
+
+    template <bool Bounded, typename ConstIterator>
+    ConstIterator do_push(ConstIterator begin, ConstIterator end)
+    {
+        node * first;
+        node * last;
+        ConstIterator ret;
+
+        tie(first, last) = prepare_node_list<Bounded>(begin, end, ret);
+        if (first)
+            link_nodes_atomic(first, last);
+
+        return ret;
+    }
+
+    /* appends the chain of nodes [first, last] to the queue. the chain is linked to the tail node with a single
+     * compare-and-swap. the tail may then lag behind the end of the queue by several nodes, which is handled in the
+     * same way as a lagging tail in the original algorithm. */
+    void link_nodes_atomic(node * first, node * last)
+    {
+        using detail::likely;
+
+        handle_type first_handle = pool.get_handle(first);
+        handle_type last_handle = pool.get_handle(last);
+
         for (;;) {
             tagged_node_handle tail = tail_.load(memory_order_acquire);
             node * tail_node = pool.get_pointer(tail);
@@ -293,11 +329,11 @@ private:
             tagged_node_handle tail2 = tail_.load(memory_order_acquire);
             if (likely(tail == tail2)) {
                 if (next_ptr == 0) {
-                    tagged_node_handle new_tail_next(node_handle, next.get_tag() + 1);
+                    tagged_node_handle new_tail_next(first_handle, next.get_tag() + 1);
                     if ( tail_node->next.compare_exchange_weak(next, new_tail_next) ) {
-                        tagged_node_handle new_tail(node_handle, tail.get_tag() + 1);
+                        tagged_node_handle new_tail(last_handle, tail.get_tag() + 1);
                         tail_.compare_exchange_strong(tail, new_tail);
-                        return true;
+                        return;
                     }
                 }
                 else {
@@ -307,9 +343,104 @@ private:
             }
         }
     }
+
+    /* links the nodes for as many elements of [begin, end) as nodes can be allocated. the nodes are taken from the
+     * freelist in batches, so that there is only one atomic operation per batch. */
+    template <bool Bounded, typename ConstIterator>
+    tuple<node*, node*> prepare_node_list(ConstIterator begin, ConstIterator end, ConstIterator & ret)
+    {
+        ConstIterator it = begin;
+        node * first = NULL;
+        node * last = NULL;
+
+        /* nodes [i, allocated) of the current batch are allocated, but not constructed */
+        node * nodes[detail::max_batch_size];
+        std::size_t allocated = 0;
+        std::size_t i = 0;
+
+        try {
+            while (it != end) {
+                std::size_t requested = detail::batch_size(it, end);
+                allocated = pool.template allocate_n<true, Bounded>(nodes, requested);
+
+                for (i = 0; i != allocated && it != end; ++i, ++it) {
+                    node * n = new(nodes[i]) node(*it, pool.null_handle());
+                    if (last) {
+                        tagged_node_handle old_next = last->next.load(memory_order_relaxed);
+                        last->next.store(tagged_node_handle(pool.get_handle(n), old_next.get_tag()),
+                                         memory_order_relaxed);
+                    } else
+                        first = n;
+                    last = n;
+                }
+                pool.template deallocate_n<true>(nodes + i, allocated - i);
+
+                if (allocated != requested)
+                    break; /* freelist is exhausted */
+                i = allocated = 0;
+            }
+        } catch (...) {
+            pool.template deallocate_n<true>(nodes + i, allocated - i);
+            if (first)
+                destruct_node_list(first, last);
+            throw;
+        }
+        ret = it;
+        return make_tuple(first, last);
+    }
+
+    /* returns the chain of nodes [first, last], which is not linked to the queue, to the freelist */
+    void destruct_node_list(node * first, node * last)
+    {
+        node * nodes[detail::max_batch_size];
+        std::size_t batched = 0;
+
+        for (node * current = first;;) {
+            node * next = pool.get_pointer(current->next.load(memory_order_relaxed));
+            nodes[batched++] = current;
+            if (batched == detail::max_batch_size) {
+                pool.template destruct_n<true>(nodes, batched);
+                batched = 0;
+            }
+            if (current == last)
+                break;
+            current = next;
+        }
+        pool.template destruct_n<true>(nodes, batched);
+    }
 #endif
 
 public:
+    /** Pushes as many objects from the range [begin, end) as freelist node can be allocated.
+     *
+     * \return iterator to the first element, which has not been pushed
+     *
+     * \note Operation is applied atomically. The nodes are taken from the freelist in batches and linked to the queue
+     *       with a single compare-and-swap.
+     * \note Thread-safe. If internal memory pool is exhausted and the memory pool is not fixed-sized, a new node will be allocated
+     *                    from the OS. This may not be lock-free.
+     * \throws if memory allocator throws
+     */
+    template <typename ConstIterator>
+    ConstIterator push(ConstIterator begin, ConstIterator end)
+    {
+        return do_push<false, ConstIterator>(begin, end);
+    }
+
+    /** Pushes as many objects from the range [begin, end) as freelist node can be allocated.
+     *
+     * \return iterator to the first element, which has not been pushed
+     *
+     * \note Operation is applied atomically. The nodes are taken from the freelist in batches and linked to the queue
+     *       with a single compare-and-swap.
+     * \note Thread-safe and non-blocking. If internal memory pool is exhausted, the push operation will fail
+     * \throws if memory allocator throws
+     */
+    template <typename ConstIterator>
+    ConstIterator bounded_push(ConstIterator begin, ConstIterator end)
+    {
+        return do_push<true, ConstIterator>(begin, end);
+    }
 
     /** Pushes object t to the queue.
      *
@@ -403,6 +534,101 @@ public:
         }
     }
 
+    /** Pops up to max objects from queue.
+     *
+     * \post the popped objects will be copied to the output iterator it, in the order in which they were pushed.
+     * \returns number of popped objects, 0 if queue was empty.
+     *
+     * \note Thread-safe and non-blocking. The objects are unlinked from the queue with a single compare-and-swap and
+     *       their nodes are returned to the freelist in batches.
+     * */
+    template <typename OutputIterator>
+    size_type pop (OutputIterator it, size_type max)
+    {
+        using detail::likely;
+        if (max == 0)
+            return 0;
+
+        for (;;) {
+            tagged_node_handle head = head_.load(memory_order_acquire);
+            node * head_ptr = pool.get_pointer(head);
+
+            tagged_node_handle tail = tail_.load(memory_order_acquire);
+            tagged_node_handle next = head_ptr->next.load(memory_order_acquire);
+            node * next_ptr = pool.get_pointer(next);
+
+            tagged_node_handle head2 = head_.load(memory_order_acquire);
+            if (!likely(head == head2))
+                continue;
+
+            if (pool.get_handle(head) == pool.get_handle(tail)) {
+                if (next_ptr == 0)
+                    return 0;
+
+                tagged_node_handle new_tail(pool.get_handle(next), tail.get_tag() + 1);
+                tail_.compare_exchange_strong(tail, new_tail);
+                continue;
+            }
+
+            if (next_ptr == 0)
+                /* see pop(U &) */
+                continue;
+
+            /* follow the chain of nodes after the head, but not beyond the tail that was read above, so that the
+             * head never passes the tail. another thread may pop a node and reuse it while the chain is followed, so
+             * the head is checked again before each node is accessed. */
+            node * last = next_ptr;
+            size_type count = 1;
+            bool changed = false;
+
+            while (count != max && pool.get_handle(last) != pool.get_handle(tail)) {
+                node * following = pool.get_pointer(last->next.load(memory_order_acquire));
+                if (following == 0)
+                    break;
+
+                if (!(head_.load(memory_order_acquire) == head)) {
+                    changed = true;
+                    break;
+                }
+
+                last = following;
+                ++count;
+            }
+
+            if (changed)
+                continue;
+
+            /* the last node becomes the new dummy node, so another thread may reuse it as soon as the head has been
+             * moved: its payload has to be copied first. */
+            T last_data;
+            detail::copy_payload(last->data, last_data);
+
+            tagged_node_handle new_head(pool.get_handle(last), head.get_tag() + 1);
+            if (head_.compare_exchange_weak(head, new_head)) {
+                /* the old dummy node and the nodes before the new dummy node now belong to this thread */
+                node * last_freed = head_ptr;
+                for (size_type i = 1; i != count; ++i)
+                    last_freed = pool.get_pointer(last_freed->next.load(memory_order_relaxed));
+
+                try {
+                    node * current = next_ptr;
+                    for (size_type i = 1; i != count; ++i) {
+                        *it = current->data;
+                        ++it;
+                        current = pool.get_pointer(current->next.load(memory_order_relaxed));
+                    }
+                    *it = last_data;
+                    ++it;
+                } catch (...) {
+                    destruct_node_list(head_ptr, last_freed);
+                    throw;
+                }
+                destruct_node_list(head_ptr, last_freed);
+                return count;
+            }
+        }
+    }
+
     /** Pops object from queue.
      *
      * \post if pop operation is successful, object will be copied to ret.
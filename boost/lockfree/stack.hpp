@@ -17,6 +17,7 @@
 #include <boost/type_traits/has_trivial_destructor.hpp>
 
 #include <boost/lockfree/detail/atomic.hpp>
+#include <boost/lockfree/detail/batch_size.hpp>
 #include <boost/lockfree/detail/copy_payload.hpp>
 #include <boost/lockfree/detail/freelist.hpp>
 #include <boost/lockfree/detail/parameter.hpp>
@@ -27,7 +28,8 @@ namespace lockfree {
 namespace detail   {
 
 typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
-                              boost::parameter::optional<tag::capacity>
+                              boost::parameter::optional<tag::capacity>,
+                              boost::parameter::optional<tag::thread_cache>
                              > stack_signature;
 
 }
@@ -52,6 +54,10 @@ typedef parameter::parameters<boost::parameter::optional<tag::allocator>,
  *  - \c boost::lockfree::allocator<>, defaults to \c boost::lockfree::allocator<std::allocator<void>> <br>
  *    Specifies the allocator that is used for the internal freelist
  *
+ *  - \c boost::lockfree::thread_cache<>, defaults to \c boost::lockfree::thread_cache<false> <br>
+ *    Puts a small cache of free nodes for every thread in front of the freelist, which is refilled and drained in batches.<br>
+ *    Only valid for node-based stacks.
+ *
  *  \b Requirements:
  *  - T must have a copy constructor
  * */
@@ -77,6 +83,10 @@ private:
     static const size_t capacity = detail::extract_capacity<bound_args>::capacity;
     static const bool fixed_sized = detail::extract_fixed_sized<bound_args>::value;
     static const bool node_based = !(has_capacity || fixed_sized);
+    static const bool thread_cache = detail::extract_thread_cache<bound_args>::value;
+
+    // the per-thread caches are only implemented for node-based freelists
+    BOOST_STATIC_ASSERT(!thread_cache || node_based);
     static const bool compile_time_sized = has_capacity;
 
     struct node
@@ -91,7 +101,7 @@ private:
     };
 
     typedef typename detail::extract_allocator<bound_args, node>::type node_allocator;
-    typedef typename detail::select_freelist<node, node_allocator, compile_time_sized, fixed_sized, capacity>::type pool_t;
+    typedef typename detail::select_freelist<node, node_allocator, compile_time_sized, fixed_sized, capacity, thread_cache>::type pool_t;
     typedef typename pool_t::tagged_node_handle tagged_node_handle;
 
     // check compile-time capacity
@@ -235,31 +245,42 @@ private:
         tos.store(new_tos, memory_order_relaxed);
     }
 
+    /* Links the nodes for as many elements of [begin, end) as nodes can be allocated. The nodes are taken from the
+     * freelist in batches, so that there is only one atomic operation per batch. */
     template <bool Threadsafe, bool Bounded, typename ConstIterator>
     tuple<node*, node*> prepare_node_list(ConstIterator begin, ConstIterator end, ConstIterator & ret)
     {
         ConstIterator it = begin;
-        node * end_node = pool.template construct<Threadsafe, Bounded>(*it++);
-        if (end_node == NULL) {
-            ret = begin;
-            return make_tuple<node*, node*>(NULL, NULL);
-        }
+        node * new_top_node = NULL;
+        node * end_node = NULL;
 
-        node * new_top_node = end_node;
-        end_node->next = NULL;
+        /* nodes [i, allocated) of the current batch are allocated, but not constructed */
+        node * nodes[detail::max_batch_size];
+        std::size_t allocated = 0;
+        std::size_t i = 0;
 
         try {
-            /* link nodes */
-            for (; it != end; ++it) {
-                node * newnode = pool.template construct<Threadsafe, Bounded>(*it);
-                if (newnode == NULL)
-                    break;
-                newnode->next = new_top_node;
-                new_top_node = newnode;
+            while (it != end) {
+                std::size_t requested = detail::batch_size(it, end);
+                allocated = pool.template allocate_n<Threadsafe, Bounded>(nodes, requested);
+
+                for (i = 0; i != allocated && it != end; ++i, ++it) {
+                    node * newnode = new(nodes[i]) node(*it);
+                    newnode->next = pool.get_handle(new_top_node);
+                    if (end_node == NULL)
+                        end_node = newnode;
+                    new_top_node = newnode;
+                }
+                pool.template deallocate_n<Threadsafe>(nodes + i, allocated - i);
+
+                if (allocated != requested)
+                    break; /* freelist is exhausted */
+                i = allocated = 0;
             }
         } catch (...) {
+            pool.template deallocate_n<Threadsafe>(nodes + i, allocated - i);
             for (node * current_node = new_top_node; current_node != NULL;) {
-                node * next = current_node->next;
+                node * next = pool.get_pointer(current_node->next);
                 pool.template destruct<Threadsafe>(current_node);
                 current_node = next;
             }
@@ -268,6 +289,25 @@ private:
         ret = it;
         return make_tuple(new_top_node, end_node);
     }
+
+    /* Returns a chain of count nodes, which has been unlinked from the stack, to the freelist. */
+    template <bool Threadsafe>
+    void destruct_node_list(node * first, size_type count)
+    {
+        node * nodes[detail::max_batch_size];
+        std::size_t batched = 0;
+
+        for (node * current_node = first; count != 0; --count) {
+            node * next = pool.get_pointer(current_node->next);
+            nodes[batched++] = current_node;
+            if (batched == detail::max_batch_size) {
+                pool.template destruct_n<Threadsafe>(nodes, batched);
+                batched = 0;
+            }
+            current_node = next;
+        }
+        pool.template destruct_n<Threadsafe>(nodes, batched);
+    }
 #endif
 
 public:
@@ -331,7 +371,8 @@ public:
      *
      * \return iterator to the first element, which has not been pushed
      *
-     * \note Operation is applied atomically
+     * \note Operation is applied atomically. The nodes are taken from the freelist in batches and linked to the stack
+     *       with a single compare-and-swap.
      * \note Thread-safe. If internal memory pool is exhausted and the memory pool is not fixed-sized, a new node will be allocated
      *                    from the OS. This may not be lock-free.
      * \throws if memory allocator throws
@@ -346,7 +387,8 @@ public:
      *
      * \return iterator to the first element, which has not been pushed
      *
-     * \note Operation is applied atomically
+     * \note Operation is applied atomically. The nodes are taken from the freelist in batches and linked to the stack
+     *       with a single compare-and-swap.
      * \note Thread-safe and non-blocking. If internal memory pool is exhausted, the push operation will fail
      * \throws if memory allocator throws
      */
@@ -443,6 +485,70 @@ public:
     }
 
 
+    /** Pops up to max objects from stack.
+     *
+     * \post the popped objects will be copied to the output iterator it, starting with the top of the stack.
+     * \returns number of popped objects, 0 if stack was empty.
+     *
+     * \note Thread-safe and non-blocking. The objects are unlinked from the stack with a single compare-and-swap and
+     *       returned to the freelist in batches.
+     * */
+    template <typename OutputIterator>
+    size_type pop(OutputIterator it, size_type max)
+    {
+        tagged_node_handle old_tos = tos.load(detail::memory_order_consume);
+
+        for (;;) {
+            node * first = pool.get_pointer(old_tos);
+            if (!first || max == 0)
+                return 0;
+
+            /* follow the chain of nodes below the top of the stack. another thread may pop a node and reuse it while
+             * the chain is followed, so the top of the stack is checked again before each node is accessed. popping
+             * increments the tag, so the chain is intact if the top of the stack is unchanged. */
+            node * last = first;
+            size_type count = 1;
+            bool changed = false;
+
+            while (count != max) {
+                node * next = pool.get_pointer(last->next);
+                if (!next)
+                    break;
+
+                tagged_node_handle current_tos = tos.load(detail::memory_order_acquire);
+                if (!(current_tos == old_tos)) {
+                    old_tos = current_tos;
+                    changed = true;
+                    break;
+                }
+
+                last = next;
+                ++count;
+            }
+
+            if (changed)
+                continue;
+
+            tagged_node_handle new_tos(last->next, old_tos.get_tag() + 1);
+
+            if (tos.compare_exchange_weak(old_tos, new_tos)) {
+                try {
+                    node * current_node = first;
+                    for (size_type i = 0; i != count; ++i) {
+                        *it = current_node->v;
+                        ++it;
+                        current_node = pool.get_pointer(current_node->next);
+                    }
+                } catch (...) {
+                    destruct_node_list<true>(first, count);
+                    throw;
+                }
+                destruct_node_list<true>(first, count);
+                return count;
+            }
+        }
+    }
+
     /** Pops object from stack.
      *
      * \post if pop operation is successful, object will be copied to ret.
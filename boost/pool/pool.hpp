@@ -23,6 +23,8 @@
 #include <exception>
 // std::max
 #include <algorithm>
+// CHAR_BIT
+#include <climits>
 
 #include <boost/pool/poolfwd.hpp>
 
@@ -313,6 +315,58 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
     //! finds which POD in the list 'chunk' was allocated from.
     details::PODptr<size_type> find_POD(void * const chunk) const;
 
+  private:
+    // The index of the memory blocks, sorted by address. For every block it
+    // holds a bitmap of the chunks that are in the free list, so that the
+    // ordered functions find the place of a chunk in the free list, or a run
+    // of free chunks, without walking the free list. The index and the bitmaps
+    // are allocated with UserAllocator.
+    // Chunks given back by free() are kept in a separate, unordered list, and
+    // are added to the ordered free list by the next ordered function that
+    // needs them.
+    // If UserAllocator can't allocate the index, the pool drops it, and the
+    // ordered functions walk the free list, until all the memory blocks have
+    // been freed; the unordered list is then sorted before it is merged.
+    struct block_entry
+    {
+      char * begin;
+      size_type num_chunks;
+      size_type free_chunks;
+      std::size_t * bits;
+    };
+
+    BOOST_STATIC_CONSTANT(size_type, bits_per_word = sizeof(std::size_t) * CHAR_BIT);
+
+    bool indexed;
+    block_entry * index;
+    size_type index_size;
+    size_type index_capacity;
+    void * unordered_first;
+    size_type unordered_count;
+
+    static size_type bitmap_words(const size_type num_chunks)
+    { //! \returns the number of words in the bitmap of a memory block of num_chunks chunks.
+      return static_cast<size_type>((num_chunks + bits_per_word - 1) / bits_per_word);
+    }
+
+    size_type find_block(void * const chunk) const;
+    bool index_block(char * const begin, const size_type num_chunks);
+    bool add_to_index(char * const begin, const size_type num_chunks);
+    void clear_index();
+    void drop_index();
+    bool release_ordered_memory();
+    void merge_unordered();
+    static void * sort_chunks(void * const chunks, const size_type n);
+    static void * merge_chunks(void * a, void * b);
+    void link_free_list();
+    void mark_chunks(void * const chunks, const size_type n, const bool free_chunks);
+    void * find_prev_free(void * const chunk) const;
+    bool find_free_run(size_type n, size_type & block, size_type & i) const;
+    void add_free_run(void * const chunks, const size_type n);
+    void * take_free_run(const size_type block, const size_type i, const size_type n);
+
+  protected:
+
     // is_from() tests a chunk to determine if it belongs in a block.
     static bool is_from(void * const chunk, char * const i,
         const size_type sizeof_i)
@@ -367,7 +421,8 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
         const size_type nnext_size = 32,
         const size_type nmax_size = 0)
     :
-        list(0, 0), requested_size(nrequested_size), next_size(nnext_size), start_size(nnext_size),max_size(nmax_size)
+        list(0, 0), requested_size(nrequested_size), next_size(nnext_size), start_size(nnext_size),max_size(nmax_size),
+        indexed(true), index(0), index_size(0), index_capacity(0), unordered_first(0), unordered_count(0)
     { //!   Constructs a new empty Pool that can be used to allocate chunks of size RequestedSize.
       //! \param nrequested_size  Requested chunk size
       //! \param  nnext_size parameter is of type size_type,
@@ -383,7 +438,6 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
     }
 
     // Releases memory blocks that don't have chunks allocated
-    // pre: lists are ordered
     //  Returns true if memory was actually deallocated
     bool release_memory();
 
@@ -424,10 +478,23 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
       //! for a block that has a free chunk, and returns that free chunk if found.
       //! Otherwise, creates a new memory block, adds its free list to pool's free list,
       //! \returns a free chunk from that block.
-      //! If a new memory block cannot be allocated, returns 0. Amortized O(1).
-      // Look for a non-empty storage
+      //! If a new memory block cannot be allocated, returns 0. Amortized O(1) for chunks given back by free(),
+      //! O(log B) otherwise, B being the number of memory blocks.
+      // Look for a chunk given back by free(), then for a non-empty storage
+      if (unordered_first != 0)
+      {
+        void * const ret = unordered_first;
+        unordered_first = nextof(ret);
+        --unordered_count;
+        return ret;
+      }
       if (!store().empty())
-        return (store().malloc)();
+      {
+        void * const ret = (store().malloc)();
+        if (indexed)
+          mark_chunks(ret, 1, false);
+        return ret;
+      }
       return malloc_need_resize();
     }
 
@@ -436,15 +503,22 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
       //! \returns a free chunk from that block.
       //! If a new memory block cannot be allocated, returns 0. Amortized O(1).
       // Look for a non-empty storage
+      merge_unordered();
       if (!store().empty())
-        return (store().malloc)();
+      {
+        void * const ret = (store().malloc)();
+        if (indexed)
+          mark_chunks(ret, 1, false);
+        return ret;
+      }
       return ordered_malloc_need_resize();
     }
 
     // Returns 0 if out-of-memory
     // Allocate a contiguous section of n chunks
     void * ordered_malloc(size_type n);
-      //! Same as malloc, only allocates enough contiguous chunks to cover n * requested_size bytes. Amortized O(n).
+      //! Same as malloc, only allocates enough contiguous chunks to cover n * requested_size bytes.
+      //! Searches the bitmaps of the blocks for n free chunks: O(C / w) in the number of chunks C in the pool, w being the number of bits in a word.
       //! \returns a free chunk from that block.
       //! If a new memory block cannot be allocated, returns 0. Amortized O(1).
 
@@ -458,7 +532,9 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
       //! spanning n * partition_sz bytes.
       //! deallocates each chunk in that block.
       //! Note that chunk may not be 0. O(n).
-      (store().free)(chunk);
+      nextof(chunk) = unordered_first;
+      unordered_first = chunk;
+      ++unordered_count;
     }
 
     // pre: 'chunk' must have been previously
@@ -466,9 +542,13 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
     void ordered_free(void * const chunk)
     { //! Same as above, but is order-preserving.
       //!
-      //! Note that chunk may not be 0. O(N) with respect to the size of the free list.
+      //! Note that chunk may not be 0. O(B + c / w), B being the number of memory blocks, c the number of chunks
+      //! in the block of chunk, and w the number of bits in a word.
       //! chunk must have been previously returned by t.malloc() or t.ordered_malloc().
-      store().ordered_free(chunk);
+      if (indexed)
+        add_free_run(chunk, 1);
+      else
+        store().ordered_free(chunk);
     }
 
     // pre: 'chunk' must have been previously
@@ -485,7 +565,11 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
       const size_type num_chunks = total_req_size / partition_size +
           ((total_req_size % partition_size) ? true : false);
 
-      store().free_n(chunks, num_chunks, partition_size);
+      if (num_chunks != 0)
+      {
+        unordered_first = this->segregate(chunks, num_chunks * partition_size, partition_size, unordered_first);
+        unordered_count += num_chunks;
+      }
     }
 
     // pre: 'chunk' must have been previously
@@ -494,7 +578,7 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
     { //! Assumes that chunk actually refers to a block of chunks spanning n * partition_sz bytes;
       //! deallocates each chunk in that block.
       //!
-      //! Note that chunk may not be 0. Order-preserving. O(N + n) where N is the size of the free list.
+      //! Note that chunk may not be 0. Order-preserving. O(B + n + c / w), as ordered_free(chunk).
       //! chunk must have been previously returned by t.malloc() or t.ordered_malloc().
 
       const size_type partition_size = alloc_size();
@@ -502,7 +586,10 @@ class pool: protected simple_segregated_storage < typename UserAllocator::size_t
       const size_type num_chunks = total_req_size / partition_size +
           ((total_req_size % partition_size) ? true : false);
 
-      store().ordered_free_n(chunks, num_chunks, partition_size);
+      if (!indexed)
+        store().ordered_free_n(chunks, num_chunks, partition_size);
+      else if (num_chunks != 0)
+        add_free_run(chunks, num_chunks);
     }
 
     // is_from() tests a chunk to determine if it was allocated from *this
@@ -526,9 +613,84 @@ typename pool<UserAllocator>::size_type const pool<UserAllocator>::min_align;
 
 template <typename UserAllocator>
 bool pool<UserAllocator>::release_memory()
-{ //! pool must be ordered. Frees every memory block that doesn't have any allocated chunks.
+{ //! Frees every memory block that doesn't have any allocated chunks.
+  //! The pool doesn't need to be ordered. O(B log B + C / w), B being the number of memory blocks,
+  //! C the number of chunks in the pool and w the number of bits in a word.
   //! \returns true if at least one memory block was freed.
+  merge_unordered();
+  if (!indexed)
+    return release_ordered_memory();
+
+  // ret is the return value: it will be set to true when we actually call
+  //  UserAllocator::free(..)
+  bool ret = false;
+
+  const size_type partition_size = alloc_size();
+
+  // Remove the chunks of the empty blocks from the free list. As it is
+  //  ordered, the chunks of a block follow each other in it, and the blocks
+  //  come in the order of the index.
+  void * prev_free_p = 0;
+  for (size_type b = 0; b < index_size; ++b)
+  {
+    const block_entry & e = index[b];
+    if (e.free_chunks == e.num_chunks)
+    {
+      void * const next_free_p = nextof(e.begin + (e.num_chunks - 1) * partition_size);
+      if (prev_free_p != 0)
+        nextof(prev_free_p) = next_free_p;
+      else
+        this->first = next_free_p;
+    }
+    else if (e.free_chunks != 0)
+      prev_free_p = find_prev_free(e.begin + e.num_chunks * partition_size);
+  }
+
+  // Remove the empty blocks from the list of memory blocks
+  details::PODptr<size_type> ptr = list;
+  details::PODptr<size_type> prev;
+  while (ptr.valid())
+  {
+    const details::PODptr<size_type> next = ptr.next();
+    const block_entry & e = index[find_block(ptr.begin())];
+    if (e.free_chunks == e.num_chunks)
+    {
+      if (prev.valid())
+        prev.next(next);
+      else
+        list = next;
+    }
+    else
+      prev = ptr;
+    ptr = next;
+  }
+
+  // And release memory, removing the blocks from the index
+  size_type kept = 0;
+  for (size_type b = 0; b < index_size; ++b)
+  {
+    if (index[b].free_chunks == index[b].num_chunks)
+    {
+      (UserAllocator::free)(index[b].begin);
+      (UserAllocator::free)(static_cast<char *>(static_cast<void *>(index[b].bits)));
+      ret = true;
+    }
+    else
+      index[kept++] = index[b];
+  }
+  index_size = kept;
+  if (index_size == 0)
+    clear_index();
 
+  next_size = start_size;
+  return ret;
+}
+
+template <typename UserAllocator>
+bool pool<UserAllocator>::release_ordered_memory()
+{ //! pool must be ordered. Frees every memory block that doesn't have any allocated chunks,
+  //! walking the free list; used when the pool has no index. O(N), N being the size of the free list.
+  //! \returns true if at least one memory block was freed.
   // ret is the return value: it will be set to true when we actually call
   //  UserAllocator::free(..)
   bool ret = false;
@@ -645,10 +807,332 @@ bool pool<UserAllocator>::release_memory()
     ptr = next;
   }
 
+  // Without any memory block left, the pool can have an index again.
+  if (!list.valid())
+    indexed = true;
+
   next_size = start_size;
   return ret;
 }
 
+template <typename UserAllocator>
+typename pool<UserAllocator>::size_type pool<UserAllocator>::find_block(void * const chunk) const
+{ //! \returns the position in the index of the last block that starts at or before chunk,
+  //! or index_size if there is none. O(log B).
+  std::less<void *> lt;
+  size_type lo = 0;
+  size_type hi = index_size;
+  while (lo < hi)
+  {
+    const size_type mid = lo + (hi - lo) / 2;
+    if (lt(chunk, index[mid].begin))
+      hi = mid;
+    else
+      lo = mid + 1;
+  }
+  return (lo == 0) ? index_size : lo - 1;
+}
+
+template <typename UserAllocator>
+bool pool<UserAllocator>::index_block(char * const begin, const size_type num_chunks)
+{ //! Adds a new memory block, none of whose chunks are free, to the index; drops the index if it can't.
+  //! \returns true if the pool still has an index.
+  if (indexed && !add_to_index(begin, num_chunks))
+    drop_index();
+  return indexed;
+}
+
+template <typename UserAllocator>
+bool pool<UserAllocator>::add_to_index(char * const begin, const size_type num_chunks)
+{ //! Adds a new memory block, none of whose chunks are free, to the index.
+  //! \returns false if out-of-memory.
+  std::size_t * const bits = static_cast<std::size_t *>(static_cast<void *>(
+      (UserAllocator::malloc)(static_cast<size_type>(bitmap_words(num_chunks) * sizeof(std::size_t)))));
+  if (bits == 0)
+    return false;
+  std::fill(bits, bits + bitmap_words(num_chunks), std::size_t(0));
+
+  if (index_size == index_capacity)
+  {
+    const size_type new_capacity = (index_capacity != 0) ? index_capacity * 2 : 8;
+    block_entry * const new_index = static_cast<block_entry *>(static_cast<void *>(
+        (UserAllocator::malloc)(static_cast<size_type>(new_capacity * sizeof(block_entry)))));
+    if (new_index == 0)
+    {
+      (UserAllocator::free)(static_cast<char *>(static_cast<void *>(bits)));
+      return false;
+    }
+    std::copy(index, index + index_size, new_index);
+    if (index != 0)
+      (UserAllocator::free)(static_cast<char *>(static_cast<void *>(index)));
+    index = new_index;
+    index_capacity = new_capacity;
+  }
+
+  const size_type b = find_block(begin);
+  const size_type pos = (b == index_size) ? 0 : b + 1;
+  std::copy_backward(index + pos, index + index_size, index + index_size + 1);
+  ++index_size;
+
+  block_entry & e = index[pos];
+  e.begin = begin;
+  e.num_chunks = num_chunks;
+  e.free_chunks = 0;
+  e.bits = bits;
+  return true;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::clear_index()
+{ //! Frees the index and the bitmaps.
+  for (size_type b = 0; b < index_size; ++b)
+    (UserAllocator::free)(static_cast<char *>(static_cast<void *>(index[b].bits)));
+  if (index != 0)
+    (UserAllocator::free)(static_cast<char *>(static_cast<void *>(index)));
+  index = 0;
+  index_size = 0;
+  index_capacity = 0;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::drop_index()
+{ //! Merges the free lists, so that the free list stays ordered, and frees the index.
+  merge_unordered();
+  clear_index();
+  indexed = false;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::merge_unordered()
+{ //! Adds the chunks given back by free() to the ordered free list.
+  //! A few chunks are inserted one at a time, as by ordered_free(). More are marked in the bitmaps, O(log B) each,
+  //! and the free list is then linked again from the bitmaps, O(C / w + N), N being the size of the free list.
+  if (unordered_first == 0)
+    return;
+
+  if (!indexed)
+    this->first = merge_chunks(this->first, sort_chunks(unordered_first, unordered_count));
+  else if (unordered_count < bits_per_word)
+  {
+    while (unordered_first != 0)
+    {
+      void * const chunk = unordered_first;
+      unordered_first = nextof(chunk);
+      add_free_run(chunk, 1);
+    }
+  }
+  else
+  {
+    for (void * p = unordered_first; p != 0; p = nextof(p))
+      mark_chunks(p, 1, true);
+    link_free_list();
+  }
+  unordered_first = 0;
+  unordered_count = 0;
+}
+
+template <typename UserAllocator>
+void * pool<UserAllocator>::sort_chunks(void * const chunks, const size_type n)
+{ //! Sorts a list of n chunks by address. O(n log n).
+  //! \returns the first chunk of the sorted list.
+  if (n < 2)
+    return chunks;
+  void * last = chunks;
+  for (size_type i = 1; i < n / 2; ++i)
+    last = nextof(last);
+  void * const second = nextof(last);
+  nextof(last) = 0;
+  return merge_chunks(sort_chunks(chunks, n / 2), sort_chunks(second, n - n / 2));
+}
+
+template <typename UserAllocator>
+void * pool<UserAllocator>::merge_chunks(void * a, void * b)
+{ //! Merges two lists of chunks sorted by address.
+  //! \returns the first chunk of the merged list.
+  std::less<void *> lt;
+  void * ret = 0;
+  void ** tail = &ret;
+  while (a != 0 && b != 0)
+  {
+    void * & lowest = lt(b, a) ? b : a;
+    *tail = lowest;
+    tail = &nextof(lowest);
+    lowest = *tail;
+  }
+  *tail = (a != 0) ? a : b;
+  return ret;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::link_free_list()
+{ //! Links the chunks marked in the bitmaps into the free list, in the order of addresses. O(C / w + N).
+  const size_type partition_size = alloc_size();
+
+  void * last = 0;
+  for (size_type b = 0; b < index_size; ++b)
+  {
+    const block_entry & e = index[b];
+    if (e.free_chunks == 0)
+      continue;
+    const size_type words = bitmap_words(e.num_chunks);
+    for (size_type w = 0; w < words; ++w)
+    {
+      const std::size_t word = e.bits[w];
+      for (size_type k = 0; k < bits_per_word && (word >> k) != 0; ++k)
+      {
+        if (!((word >> k) & 1))
+          continue;
+        void * const chunk = e.begin + (w * bits_per_word + k) * partition_size;
+        if (last != 0)
+          nextof(last) = chunk;
+        else
+          this->first = chunk;
+        last = chunk;
+      }
+    }
+  }
+  if (last != 0)
+    nextof(last) = 0;
+  else
+    this->first = 0;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::mark_chunks(void * const chunks, const size_type n, const bool free_chunks)
+{ //! Sets or clears the bits of n chunks, which are in one memory block. O(log B + n).
+  block_entry & e = index[find_block(chunks)];
+  const size_type start = static_cast<size_type>((static_cast<char *>(chunks) - e.begin) / alloc_size());
+  for (size_type i = start; i != start + n; ++i)
+  {
+    if (free_chunks)
+      e.bits[i / bits_per_word] |= std::size_t(1) << (i % bits_per_word);
+    else
+      e.bits[i / bits_per_word] &= ~(std::size_t(1) << (i % bits_per_word));
+  }
+  if (free_chunks)
+    e.free_chunks += n;
+  else
+    e.free_chunks -= n;
+}
+
+template <typename UserAllocator>
+void * pool<UserAllocator>::find_prev_free(void * const chunk) const
+{ //! \returns the last free chunk before chunk, or 0 if chunk would go at the beginning of the free list.
+  size_type b = find_block(chunk);
+  if (b == index_size)
+    return 0;
+
+  const size_type partition_size = alloc_size();
+  // number of chunks at the beginning of block b that are before chunk
+  size_type limit = static_cast<size_type>((static_cast<char *>(chunk) - index[b].begin) / partition_size);
+  if (limit > index[b].num_chunks)
+    limit = index[b].num_chunks;
+
+  while (true)
+  {
+    const block_entry & e = index[b];
+    if (e.free_chunks != 0)
+    {
+      size_type w = limit / bits_per_word;
+      std::size_t word = (limit % bits_per_word) ?
+          (e.bits[w] & ((std::size_t(1) << (limit % bits_per_word)) - 1)) : 0;
+      while (true)
+      {
+        if (word != 0)
+        {
+          size_type k = bits_per_word - 1;
+          while (!((word >> k) & 1))
+            --k;
+          return e.begin + (w * bits_per_word + k) * partition_size;
+        }
+        if (w == 0)
+          break;
+        word = e.bits[--w];
+      }
+    }
+    if (b == 0)
+      return 0;
+    --b;
+    limit = index[b].num_chunks;
+  }
+}
+
+template <typename UserAllocator>
+bool pool<UserAllocator>::find_free_run(const size_type n, size_type & block, size_type & i) const
+{ //! \pre n != 0
+  //! Finds the first run of n free chunks in one memory block; words without free chunks,
+  //! and words of free chunks that don't complete the run, are skipped as a whole.
+  //! \returns true if found, the run starts with chunk i of block.
+  for (size_type b = 0; b < index_size; ++b)
+  {
+    const block_entry & e = index[b];
+    if (e.free_chunks < n)
+      continue;
+
+    const size_type words = bitmap_words(e.num_chunks);
+    size_type run = 0;
+    for (size_type w = 0; w < words; ++w)
+    {
+      const std::size_t word = e.bits[w];
+      if (word == 0)
+      {
+        run = 0;
+        continue;
+      }
+      if (word == ~std::size_t(0) && run + bits_per_word < n)
+      {
+        run += bits_per_word;
+        continue;
+      }
+      for (size_type k = 0; k < bits_per_word; ++k)
+      {
+        if (!((word >> k) & 1))
+        {
+          run = 0;
+          continue;
+        }
+        if (++run == n)
+        {
+          block = b;
+          i = w * bits_per_word + k + 1 - n;
+          return true;
+        }
+      }
+    }
+  }
+  return false;
+}
+
+template <typename UserAllocator>
+void pool<UserAllocator>::add_free_run(void * const chunks, const size_type n)
+{ //! \pre n != 0, the n chunks are in one memory block.
+  //! Inserts the chunks into the free list in order.
+  const size_type partition_size = alloc_size();
+  void * const loc = find_prev_free(chunks);
+  if (loc == 0)
+    this->first = this->segregate(chunks, n * partition_size, partition_size, this->first);
+  else
+    nextof(loc) = this->segregate(chunks, n * partition_size, partition_size, nextof(loc));
+  mark_chunks(chunks, n, true);
+}
+
+template <typename UserAllocator>
+void * pool<UserAllocator>::take_free_run(const size_type block, const size_type i, const size_type n)
+{ //! \pre chunks i to i + n of block are free.
+  //! Removes the chunks from the free list; as it is ordered, they follow each other in it.
+  //! \returns the first chunk.
+  const size_type partition_size = alloc_size();
+  char * const chunks = index[block].begin + i * partition_size;
+  void * const last = chunks + (n - 1) * partition_size;
+  void * const loc = find_prev_free(chunks);
+  if (loc == 0)
+    this->first = nextof(last);
+  else
+    nextof(loc) = nextof(last);
+  mark_chunks(chunks, n, false);
+  return chunks;
+}
+
 template <typename UserAllocator>
 bool pool<UserAllocator>::purge_memory()
 { //! pool must be ordered.
@@ -658,6 +1142,11 @@ bool pool<UserAllocator>::purge_memory()
   //! by allocation functions of t.
   //! \returns true if at least one memory block was freed.
 
+  clear_index();
+  indexed = true;
+  unordered_first = 0;
+  unordered_count = 0;
+
   details::PODptr<size_type> iter = list;
 
   if (!iter.valid())
@@ -712,15 +1201,23 @@ void * pool<UserAllocator>::malloc_need_resize()
   else if( next_size*partition_size/requested_size < max_size)
     next_size = min BOOST_PREVENT_MACRO_SUBSTITUTION(next_size << 1, max_size*requested_size/ partition_size);
 
-  //  initialize it,
-  store().add_block(node.begin(), node.element_size(), partition_size);
+  //  initialize it: the free list is empty, so the chunks after the first one
+  //  are added to it in order.
+  const size_type num_chunks = node.element_size() / partition_size;
+  if (index_block(node.begin(), num_chunks))
+  {
+    if (num_chunks > 1)
+      add_free_run(node.begin() + partition_size, num_chunks - 1);
+  }
+  else if (num_chunks > 1)
+    store().add_block(node.begin() + partition_size, node.element_size() - partition_size, partition_size);
 
   //  insert it into the list,
   node.next(list);
   list = node;
 
-  //  and return a chunk from it.
-  return (store().malloc)();
+  //  and return the first chunk from it.
+  return node.begin();
 }
 
 template <typename UserAllocator>
@@ -752,11 +1249,16 @@ void * pool<UserAllocator>::ordered_malloc_need_resize()
   else if( next_size*partition_size/requested_size < max_size)
     next_size = min BOOST_PREVENT_MACRO_SUBSTITUTION(next_size << 1, max_size*requested_size/ partition_size);
 
-  //  initialize it,
-  //  (we can use "add_block" here because we know that
-  //  the free list is empty, so we don't have to use
-  //  the slower ordered version)
-  store().add_ordered_block(node.begin(), node.element_size(), partition_size);
+  //  initialize it: the free list is empty, so the chunks after the first one
+  //  are added to it in order.
+  const size_type num_chunks = node.element_size() / partition_size;
+  if (index_block(node.begin(), num_chunks))
+  {
+    if (num_chunks > 1)
+      add_free_run(node.begin() + partition_size, num_chunks - 1);
+  }
+  else if (num_chunks > 1)
+    store().add_ordered_block(node.begin() + partition_size, node.element_size() - partition_size, partition_size);
 
   //  insert it into the list,
   //   handle border case
@@ -783,8 +1285,8 @@ void * pool<UserAllocator>::ordered_malloc_need_resize()
     node.next(prev.next());
     prev.next(node);
   }
-  //  and return a chunk from it.
-  return (store().malloc)();
+  //  and return the first chunk from it.
+  return node.begin();
 }
 
 template <typename UserAllocator>
@@ -798,12 +1300,25 @@ void * pool<UserAllocator>::ordered_malloc(const size_type n)
   const size_type num_chunks = total_req_size / partition_size +
       ((total_req_size % partition_size) ? true : false);
 
-  void * ret = store().malloc_n(num_chunks, partition_size);
+  if (n == 0)
+    return 0;
+
+  merge_unordered();
+  void * ret = 0;
+  if (indexed)
+  {
+    size_type block;
+    size_type first_chunk;
+    if (find_free_run(num_chunks, block, first_chunk))
+      ret = take_free_run(block, first_chunk, num_chunks);
+  }
+  else
+    ret = store().malloc_n(num_chunks, partition_size);
 
 #ifdef BOOST_POOL_INSTRUMENT
   std::cout << "Allocating " << n << " chunks from pool of size " << partition_size << std::endl;
 #endif
-  if ((ret != 0) || (n == 0))
+  if (ret != 0)
     return ret;
 
 #ifdef BOOST_POOL_INSTRUMENT
@@ -834,7 +1349,12 @@ void * pool<UserAllocator>::ordered_malloc(const size_type n)
   const details::PODptr<size_type> node(ptr, POD_size);
 
   // Split up block so we can use what wasn't requested.
-  if (next_size > num_chunks)
+  if (index_block(node.begin(), next_size))
+  {
+    if (next_size > num_chunks)
+      add_free_run(node.begin() + num_chunks * partition_size, next_size - num_chunks);
+  }
+  else if (next_size > num_chunks)
     store().add_ordered_block(node.begin() + num_chunks * partition_size,
         node.element_size() - num_chunks * partition_size, partition_size);
 
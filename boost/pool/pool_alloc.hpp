@@ -226,9 +226,15 @@ class pool_allocator
        std::cout << "Allocating " << n << " * " << sizeof(T) << " bytes...\n"
           "Total allocated is now " << debug_info<true>::allocated << std::endl;
 #endif
-      const pointer ret = static_cast<pointer>(
-          singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator, Mutex,
-              NextSize, MaxSize>::ordered_malloc(n) );
+      // With a thread_cached_mutex, single objects are taken from the cache
+      // of the calling thread, at the cost of keeping the free list ordered.
+      const pointer ret = (n == 1 && details::pool::is_thread_cached<Mutex>::value) ?
+          static_cast<pointer>(
+              (singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator,
+                  Mutex, NextSize, MaxSize>::malloc)() ) :
+          static_cast<pointer>(
+              singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator,
+                  Mutex, NextSize, MaxSize>::ordered_malloc(n) );
       if ((ret == 0) && n)
         boost::throw_exception(std::bad_alloc());
       return ret;
@@ -252,8 +258,12 @@ class pool_allocator
       if (ptr == 0 || n == 0)
         return;
 #endif
-      singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator, Mutex,
-          NextSize, MaxSize>::ordered_free(ptr, n);
+      if (n == 1 && details::pool::is_thread_cached<Mutex>::value)
+        (singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator, Mutex,
+            NextSize, MaxSize>::free)(ptr);
+      else
+        singleton_pool<pool_allocator_tag, sizeof(T), UserAllocator, Mutex,
+            NextSize, MaxSize>::ordered_free(ptr, n);
     }
 };
 
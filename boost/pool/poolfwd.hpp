@@ -46,6 +46,12 @@ class pool;
 template <typename T, typename UserAllocator = default_user_allocator_new_delete>
 class object_pool;
 
+//
+// Location: <boost/pool/thread_cached_mutex.hpp>
+//
+template <typename Mutex = details::pool::default_mutex, unsigned CacheSize = 32>
+class thread_cached_mutex;
+
 //
 // Location: <boost/pool/singleton_pool.hpp>
 //
@@ -30,6 +30,51 @@
 
 namespace boost {
 
+namespace details {
+namespace pool {
+
+//! Whether a singleton_pool synchronized with Mutex keeps a cache of free chunks for every thread.
+//! Specialized for thread_cached_mutex in boost/pool/thread_cached_mutex.hpp.
+template <typename Mutex>
+struct is_thread_cached
+{
+    BOOST_STATIC_CONSTANT(bool, value = false);
+};
+
+//! The storage of a singleton_pool: the pool and the mutex that protects it.
+//! Specialized for thread_cached_mutex in boost/pool/thread_cached_mutex.hpp.
+template <typename Mutex, typename UserAllocator>
+class singleton_pool_base: public Mutex, public boost::pool<UserAllocator>
+{
+  public:
+    typedef typename boost::pool<UserAllocator>::size_type size_type;
+
+    singleton_pool_base(const size_type nrequested_size, const size_type nnext_size, const size_type nmax_size)
+    :boost::pool<UserAllocator>(nrequested_size, nnext_size, nmax_size)
+    {
+    }
+
+    void * malloc_chunk()
+    {
+      details::pool::guard<Mutex> g(*this);
+      return (this->malloc)();
+    }
+
+    void free_chunk(void * const chunk)
+    {
+      details::pool::guard<Mutex> g(*this);
+      (this->free)(chunk);
+    }
+
+    //! Called with the mutex locked.
+    void discard_caches()
+    {
+    }
+};
+
+} // namespace pool
+} // namespace details
+
  /*! 
  The singleton_pool class allows other pool interfaces
  for types of the same size to share the same pool.  Template
@@ -42,7 +87,9 @@ namespace boost {
  <B>UserAllocator</b> User allocator, default = default_user_allocator_new_delete.
 
  <b>Mutex</B> This class is the type of mutex to use to protect simultaneous access to the underlying Pool. 
- Can be any Boost.Thread Mutex type or <tt>boost::details::pool::null_mutex</tt>.
+ Can be any Boost.Thread Mutex type or <tt>boost::details::pool::null_mutex</tt>,
+ or <tt>boost::thread_cached_mutex</tt> from <tt>boost/pool/thread_cached_mutex.hpp</tt>, which gives every
+ thread a cache of free chunks in front of the pool so that malloc() and free() of single chunks rarely lock the mutex.
  It is exposed so that users may declare some singleton pools normally (i.e., with synchronization), but 
  some singleton pools without synchronization (by specifying <tt>boost::details::pool::null_mutex</tt>) for efficiency reasons.
  The member typedef <tt>mutex</tt> exposes the value of this template parameter.  The default for this
@@ -115,9 +162,9 @@ private:
     singleton_pool();
 
 #ifndef BOOST_DOXYGEN
-    struct pool_type: public Mutex, public pool<UserAllocator>
+    struct pool_type: public details::pool::singleton_pool_base<Mutex, UserAllocator>
     {
-      pool_type() : pool<UserAllocator>(RequestedSize, NextSize, MaxSize) {}
+      pool_type() : details::pool::singleton_pool_base<Mutex, UserAllocator>(RequestedSize, NextSize, MaxSize) {}
     }; //  struct pool_type: Mutex
 
 #else
@@ -132,9 +179,9 @@ public:
   public:
     static void * malloc BOOST_PREVENT_MACRO_SUBSTITUTION()
     { //! Equivalent to SingletonPool::p.malloc(); synchronized.
+      //! With a thread_cached_mutex, taken from the cache of the calling thread.
       pool_type & p = get_pool();
-      details::pool::guard<Mutex> g(p);
-      return (p.malloc)();
+      return p.malloc_chunk();
     }
     static void * ordered_malloc()
     {  //! Equivalent to SingletonPool::p.ordered_malloc(); synchronized.
@@ -157,9 +204,9 @@ public:
     }
     static void free BOOST_PREVENT_MACRO_SUBSTITUTION(void * const ptr)
     { //! Equivalent to SingletonPool::p.free(chunk); synchronized.
+      //! With a thread_cached_mutex, returned to the cache of the calling thread.
       pool_type & p = get_pool();
-      details::pool::guard<Mutex> g(p);
-      (p.free)(ptr);
+      p.free_chunk(ptr);
     }
     static void ordered_free(void * const ptr)
     { //! Equivalent to SingletonPool::p.ordered_free(chunk); synchronized.
@@ -187,8 +234,11 @@ public:
     }
     static bool purge_memory()
     { //! Equivalent to SingletonPool::p.purge_memory(); synchronized.
+      //! With a thread_cached_mutex, the caches of all threads are emptied as well,
+      //! so no other thread may use the pool at the same time.
       pool_type & p = get_pool();
       details::pool::guard<Mutex> g(p);
+      p.discard_caches();
       return p.purge_memory();
     }
 
@@ -0,0 +1,225 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See
+// accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org for updates, documentation, and revision history.
+
+#ifndef BOOST_POOL_THREAD_CACHED_MUTEX_HPP
+#define BOOST_POOL_THREAD_CACHED_MUTEX_HPP
+
+/*!
+  \file
+  \brief Thread-local caching of chunks for <tt>singleton_pool</tt>.
+  \details Provides the <tt>thread_cached_mutex</tt> template, which makes
+  <tt>singleton_pool</tt> keep a cache of free chunks for every thread.
+  This header must be included wherever a pool is used with a <tt>thread_cached_mutex</tt>;
+  it is not included by the other pool headers, as it depends on Boost.Thread.
+*/
+
+#include <boost/pool/poolfwd.hpp>
+
+// boost::singleton_pool, boost::details::pool::singleton_pool_base
+#include <boost/pool/singleton_pool.hpp>
+// boost::details::pool::guard
+#include <boost/pool/detail/guard.hpp>
+
+#include <boost/static_assert.hpp>
+
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_NO_MT) && !defined(BOOST_POOL_NO_MT) && !defined(BOOST_POOL_VALGRIND)
+#define BOOST_POOL_HAS_THREAD_CACHE
+// boost::thread_specific_ptr
+#include <boost/thread/tss.hpp>
+#endif
+
+namespace boost {
+
+/*!
+  A mutex type for <tt>singleton_pool</tt>, <tt>pool_allocator</tt> and <tt>fast_pool_allocator</tt>,
+  which gives every thread a cache of free chunks in front of the shared pool.
+
+  <b>Mutex</b> The mutex that protects the shared pool, default = <tt>details::pool::default_mutex</tt>.
+
+  <b>CacheSize</b> The maximum number of free chunks that a thread keeps (defaults to 32).
+
+  <tt>singleton_pool::malloc()</tt> and <tt>singleton_pool::free()</tt> of single chunks
+  take and return chunks from the cache of the calling thread without locking the mutex.
+  If the cache is empty, half of CacheSize chunks are taken from the shared pool under
+  one lock, and if it is full, half of its chunks are returned under one lock. The
+  cache of a thread is returned to the shared pool when the thread exits.
+  The ordered functions, and those for arrays of chunks, always use the shared pool.
+
+  \attention
+  The caches use <tt>boost::thread_specific_ptr</tt>, so the program has to link with Boost.Thread.
+  <tt>purge_memory()</tt> discards the chunks in the caches of all threads, so it must
+  not be called while other threads use the pool.
+  Without thread support, or with BOOST_POOL_VALGRIND, there are no caches, and
+  <tt>thread_cached_mutex</tt> behaves like <b>Mutex</b>.
+*/
+template <typename Mutex, unsigned CacheSize>
+class thread_cached_mutex: public Mutex
+{
+  BOOST_STATIC_ASSERT(CacheSize >= 2);
+
+  public:
+    typedef Mutex mutex; //!< The type of mutex that protects the shared pool.
+    BOOST_STATIC_CONSTANT(unsigned, cache_size = CacheSize); //!< The maximum number of chunks in the cache of a thread.
+};
+
+namespace details {
+namespace pool {
+
+#ifdef BOOST_POOL_HAS_THREAD_CACHE
+
+template <typename Mutex, unsigned CacheSize>
+struct is_thread_cached<thread_cached_mutex<Mutex, CacheSize> >
+{
+    BOOST_STATIC_CONSTANT(bool, value = true);
+};
+
+template <typename Mutex, unsigned CacheSize, typename UserAllocator>
+class singleton_pool_base<thread_cached_mutex<Mutex, CacheSize>, UserAllocator>
+  : public thread_cached_mutex<Mutex, CacheSize>, public boost::pool<UserAllocator>
+{
+  public:
+    typedef typename boost::pool<UserAllocator>::size_type size_type;
+
+  private:
+    typedef thread_cached_mutex<Mutex, CacheSize> mutex_type;
+
+    BOOST_STATIC_CONSTANT(unsigned, transfer_size = CacheSize / 2);
+
+    // The free chunks of one thread, linked through their first bytes.
+    // All caches are linked into a list, so that purge_memory can find them.
+    struct cache
+    {
+      singleton_pool_base * owner;
+      void * first;
+      unsigned count;
+      cache * prev;
+      cache * next;
+    };
+
+    boost::thread_specific_ptr<cache> caches;
+    cache * all_caches;
+
+    static void * & nextof(void * const ptr)
+    {
+      return *(static_cast<void **>(ptr));
+    }
+
+    //! Called when a thread exits.
+    static void release_cache(cache * const c)
+    {
+      singleton_pool_base & p = *c->owner;
+      {
+        details::pool::guard<mutex_type> g(p);
+        p.give_back(c, c->count);
+        if (c->prev != 0)
+          c->prev->next = c->next;
+        else
+          p.all_caches = c->next;
+        if (c->next != 0)
+          c->next->prev = c->prev;
+      }
+      delete c;
+    }
+
+    cache & get_cache()
+    {
+      cache * c = caches.get();
+      if (c == 0)
+      {
+        c = new cache();
+        c->owner = this;
+        c->first = 0;
+        c->count = 0;
+        c->prev = 0;
+        {
+          details::pool::guard<mutex_type> g(*this);
+          c->next = all_caches;
+          if (all_caches != 0)
+            all_caches->prev = c;
+          all_caches = c;
+        }
+        caches.reset(c);
+      }
+      return *c;
+    }
+
+    //! Returns n chunks of c to the pool; called with the mutex locked.
+    void give_back(cache * const c, unsigned n)
+    {
+      for (; n != 0; --n)
+      {
+        void * const chunk = c->first;
+        c->first = nextof(chunk);
+        --c->count;
+        (this->free)(chunk);
+      }
+    }
+
+  public:
+    singleton_pool_base(const size_type nrequested_size, const size_type nnext_size, const size_type nmax_size)
+    :boost::pool<UserAllocator>(nrequested_size, nnext_size, nmax_size), caches(&release_cache), all_caches(0)
+    {
+    }
+
+    void * malloc_chunk()
+    {
+      cache & c = get_cache();
+      if (c.count == 0)
+      {
+        details::pool::guard<mutex_type> g(*this);
+        while (c.count < transfer_size)
+        {
+          void * const chunk = (this->malloc)();
+          if (chunk == 0)
+            break;
+          nextof(chunk) = c.first;
+          c.first = chunk;
+          ++c.count;
+        }
+        if (c.count == 0)
+          return 0;
+      }
+
+      void * const chunk = c.first;
+      c.first = nextof(chunk);
+      --c.count;
+      return chunk;
+    }
+
+    void free_chunk(void * const chunk)
+    {
+      cache & c = get_cache();
+      if (c.count == CacheSize)
+      {
+        details::pool::guard<mutex_type> g(*this);
+        give_back(&c, transfer_size);
+      }
+      nextof(chunk) = c.first;
+      c.first = chunk;
+      ++c.count;
+    }
+
+    //! Called with the mutex locked.
+    void discard_caches()
+    {
+      for (cache * c = all_caches; c != 0; c = c->next)
+      {
+        c->first = 0;
+        c->count = 0;
+      }
+    }
+};
+
+#endif
+
+} // namespace pool
+} // namespace details
+
+} // namespace boost
+
+#endif
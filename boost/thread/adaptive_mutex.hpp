@@ -0,0 +1,274 @@
+#ifndef BOOST_THREAD_ADAPTIVE_MUTEX_HPP
+#define BOOST_THREAD_ADAPTIVE_MUTEX_HPP
+
+//  adaptive_mutex.hpp
+//
+//  (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/futex.hpp>
+#include <boost/thread/lockable_traits.hpp>
+#include <boost/smart_ptr/detail/yield_k.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#if defined BOOST_THREAD_USES_DATETIME
+#include <boost/thread/thread_time.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#endif
+
+// Largest number of pause instructions a thread executes before it blocks.
+#ifndef BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS
+#define BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS 2048
+#endif
+
+// Number of pause instructions a thread executes at least before it blocks.
+#ifndef BOOST_THREAD_ADAPTIVE_MUTEX_MIN_SPINS
+#define BOOST_THREAD_ADAPTIVE_MUTEX_MIN_SPINS 16
+#endif
+
+// Largest number of pause instructions between two reads of the mutex.
+#ifndef BOOST_THREAD_ADAPTIVE_MUTEX_MAX_BACKOFF
+#define BOOST_THREAD_ADAPTIVE_MUTEX_MAX_BACKOFF 64
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  /**
+   * A mutex for short critical sections: a thread that finds it locked spins for a while, with an
+   * exponential backoff between the reads of the mutex, and only blocks when the mutex isn't
+   * released in time.
+   *
+   * How long a thread spins depends on how long the mutex stayed locked the last times: the mutex
+   * keeps a moving average of the number of pause instructions the spinning threads executed before
+   * they got the mutex, and a thread spins up to twice that number. Threads block on a futex on
+   * Linux, with the usual three states: unlocked, locked, and locked with blocked threads.
+   */
+  class adaptive_mutex
+  {
+  public:
+    /**
+     * Counters of what happened to the mutex since it was constructed, or the statistics reset.
+     */
+    struct statistics
+    {
+      // number of times the mutex was locked
+      boost::uint64_t acquisitions;
+      // number of times it was found locked by a thread that then got it
+      boost::uint64_t contentions;
+      // number of pause instructions these threads executed
+      boost::uint64_t spins;
+      // number of times these threads blocked
+      boost::uint64_t parks;
+      // number of pause instructions a thread executes now before it blocks
+      boost::uint32_t spin_limit;
+    };
+
+  private:
+    static const boost::uint32_t unlocked = 0;
+    static const boost::uint32_t locked = 1;
+    // locked, and there may be threads blocked on the futex
+    static const boost::uint32_t contended = 2;
+
+    thread_detail::futex state_;
+    // moving average of the spins that got the mutex, multiplied by 8
+    boost::atomic<boost::uint32_t> spins_average_;
+    // only modified while the mutex is locked
+    boost::atomic<boost::uint64_t> acquisitions_;
+    boost::atomic<boost::uint64_t> contentions_;
+    boost::atomic<boost::uint64_t> spins_;
+    boost::atomic<boost::uint64_t> parks_;
+
+    static void increment(boost::atomic<boost::uint64_t>& counter, boost::uint64_t n)
+    {
+      counter.store(counter.load(boost::memory_order_relaxed) + n, boost::memory_order_relaxed);
+    }
+
+    static void pause(boost::uint32_t n)
+    {
+      for (boost::uint32_t i = 0; i != n; ++i)
+      {
+#if defined BOOST_SMT_PAUSE
+        BOOST_SMT_PAUSE
+#else
+        boost::atomic_signal_fence(boost::memory_order_seq_cst);
+#endif
+      }
+    }
+
+    boost::uint32_t spin_limit() const
+    {
+      boost::uint32_t const limit = spins_average_.load(boost::memory_order_relaxed) / 4 + BOOST_THREAD_ADAPTIVE_MUTEX_MIN_SPINS;
+      return limit < BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS ? limit : BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS;
+    }
+
+    bool try_acquire()
+    {
+      boost::uint32_t expected = unlocked;
+      return state_.value.compare_exchange_strong(expected, locked, boost::memory_order_acquire, boost::memory_order_relaxed);
+    }
+
+    // called with the mutex locked
+    void acquired(boost::uint32_t spins, boost::uint32_t parks)
+    {
+      increment(acquisitions_, 1);
+      increment(contentions_, 1);
+      increment(spins_, spins);
+      increment(parks_, parks);
+      // a thread that had to block counts as one that needed the largest number of spins
+      boost::uint32_t const sample = parks ? BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS : spins;
+      boost::uint32_t const average = spins_average_.load(boost::memory_order_relaxed);
+      spins_average_.store(average - average / 8 + sample, boost::memory_order_relaxed);
+    }
+
+    template <class Deadline>
+    bool lock_contended(Deadline const& deadline)
+    {
+      boost::uint32_t const limit = spin_limit();
+      boost::uint32_t spins = 0;
+      boost::uint32_t backoff = 1;
+      while (spins < limit)
+      {
+        pause(backoff);
+        spins += backoff;
+        if (backoff < BOOST_THREAD_ADAPTIVE_MUTEX_MAX_BACKOFF)
+        {
+          backoff *= 2;
+        }
+        if (state_.value.load(boost::memory_order_relaxed) == unlocked && try_acquire())
+        {
+          acquired(spins, 0);
+          return true;
+        }
+      }
+
+      boost::uint32_t parks = 0;
+      while (state_.value.exchange(contended, boost::memory_order_acquire) != unlocked)
+      {
+        if (!thread_detail::wait_until(state_, contended, deadline))
+        {
+          return false;
+        }
+        ++parks;
+      }
+      acquired(spins, parks);
+      return true;
+    }
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(adaptive_mutex)
+
+    adaptive_mutex() :
+      state_(unlocked), spins_average_(0), acquisitions_(0), contentions_(0), spins_(0), parks_(0)
+    {
+    }
+
+    void lock()
+    {
+      if (try_acquire())
+      {
+        increment(acquisitions_, 1);
+        return;
+      }
+      lock_contended(thread_detail::no_timeout());
+    }
+
+    bool try_lock()
+    {
+      if (try_acquire())
+      {
+        increment(acquisitions_, 1);
+        return true;
+      }
+      return false;
+    }
+
+#if defined BOOST_THREAD_USES_DATETIME
+    bool timed_lock(system_time const& abs_time)
+    {
+      return try_lock() || lock_contended(abs_time);
+    }
+
+    template<typename TimeDuration>
+    bool timed_lock(TimeDuration const & relative_time)
+    {
+      return timed_lock(get_system_time()+relative_time);
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return try_lock() || lock_contended(abs_time);
+    }
+#endif
+
+    void unlock()
+    {
+      if (state_.value.exchange(unlocked, boost::memory_order_release) == contended)
+      {
+        state_.wake_one();
+      }
+    }
+
+    /**
+     * The counters, as the last thread that locked the mutex left them.
+     */
+    statistics get_statistics() const
+    {
+      statistics s;
+      s.acquisitions = acquisitions_.load(boost::memory_order_relaxed);
+      s.contentions = contentions_.load(boost::memory_order_relaxed);
+      s.spins = spins_.load(boost::memory_order_relaxed);
+      s.parks = parks_.load(boost::memory_order_relaxed);
+      s.spin_limit = spin_limit();
+      return s;
+    }
+
+    /**
+     * Sets the counters to 0. Locks the mutex.
+     */
+    void reset_statistics()
+    {
+      lock();
+      acquisitions_.store(0, boost::memory_order_relaxed);
+      contentions_.store(0, boost::memory_order_relaxed);
+      spins_.store(0, boost::memory_order_relaxed);
+      parks_.store(0, boost::memory_order_relaxed);
+      unlock();
+    }
+  };
+
+  namespace sync
+  {
+#ifdef BOOST_THREAD_NO_AUTO_DETECT_MUTEX_TYPES
+    template<>
+    struct is_basic_lockable<adaptive_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+    template<>
+    struct is_lockable<adaptive_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+#endif
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,221 @@
+// (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_DETAIL_FUTEX_HPP
+#define BOOST_THREAD_DETAIL_FUTEX_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#if defined BOOST_THREAD_USES_DATETIME
+#include <boost/thread/thread_time.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#include <boost/chrono/ceil.hpp>
+#endif
+
+#if defined(__linux__) && !defined(BOOST_THREAD_DONT_USE_FUTEX)
+#define BOOST_THREAD_HAS_FUTEX
+#include <climits>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <boost/static_assert.hpp>
+#else
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+#include <boost/thread/detail/thread_interruption.hpp>
+#endif
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace thread_detail
+  {
+#if defined BOOST_THREAD_HAS_FUTEX
+    BOOST_STATIC_ASSERT(sizeof(boost::atomic<boost::uint32_t>) == sizeof(boost::uint32_t));
+#endif
+
+    /**
+     * A 32 bit atomic word threads can block on until it changes.
+     *
+     * On Linux the word is a futex. Elsewhere the waiters block on a mutex and a condition
+     * variable, and wake() takes the mutex, so that it can't run between the check of the
+     * value and the wait.
+     *
+     * wait(old) and its timed versions return when wake() is called after the value is no longer
+     * old, or spuriously. The timed versions return false once the timeout has expired. None of
+     * them is an interruption point.
+     */
+    class futex
+    {
+    public:
+      BOOST_THREAD_NO_COPYABLE(futex)
+
+      boost::atomic<boost::uint32_t> value;
+
+      explicit futex(boost::uint32_t v = 0) : value(v)
+      {
+      }
+
+      void wait(boost::uint32_t old)
+      {
+#if defined BOOST_THREAD_HAS_FUTEX
+        futex_wait(old, 0);
+#else
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+        boost::this_thread::disable_interruption do_not_disturb;
+#endif
+        boost::unique_lock<boost::mutex> lk(mtx_);
+        while (value.load(boost::memory_order_relaxed) == old)
+        {
+          cond_.wait(lk);
+        }
+#endif
+      }
+
+#if defined BOOST_THREAD_USES_DATETIME
+      bool timed_wait(boost::uint32_t old, system_time const& abs_time)
+      {
+#if defined BOOST_THREAD_HAS_FUTEX
+        boost::posix_time::time_duration const rel_time = abs_time - get_system_time();
+        if (rel_time <= boost::posix_time::time_duration(0, 0, 0, 0))
+        {
+          return false;
+        }
+        struct timespec ts;
+        ts.tv_sec = static_cast<long>(rel_time.total_seconds());
+        ts.tv_nsec = static_cast<long>(rel_time.total_microseconds() % 1000000) * 1000;
+        futex_wait(old, &ts);
+        return true;
+#else
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+        boost::this_thread::disable_interruption do_not_disturb;
+#endif
+        boost::unique_lock<boost::mutex> lk(mtx_);
+        while (value.load(boost::memory_order_relaxed) == old)
+        {
+          if (!cond_.timed_wait(lk, abs_time))
+          {
+            // the notification of wake_one() may have been for this thread
+            cond_.notify_one();
+            return false;
+          }
+        }
+        return true;
+#endif
+      }
+#endif
+
+#ifdef BOOST_THREAD_USES_CHRONO
+      template <class Clock, class Duration>
+      bool wait_until(boost::uint32_t old, chrono::time_point<Clock, Duration> const& abs_time)
+      {
+#if defined BOOST_THREAD_HAS_FUTEX
+        typename Clock::time_point const now = Clock::now();
+        if (abs_time <= now)
+        {
+          return false;
+        }
+        chrono::nanoseconds const rel_time = chrono::ceil<chrono::nanoseconds>(abs_time - now);
+        struct timespec ts;
+        ts.tv_sec = static_cast<long>(chrono::duration_cast<chrono::seconds>(rel_time).count());
+        ts.tv_nsec = static_cast<long>((rel_time - chrono::duration_cast<chrono::seconds>(rel_time)).count());
+        futex_wait(old, &ts);
+        return true;
+#else
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+        boost::this_thread::disable_interruption do_not_disturb;
+#endif
+        boost::unique_lock<boost::mutex> lk(mtx_);
+        while (value.load(boost::memory_order_relaxed) == old)
+        {
+          if (cv_status::timeout == cond_.wait_until(lk, abs_time))
+          {
+            // the notification of wake_one() may have been for this thread
+            cond_.notify_one();
+            return false;
+          }
+        }
+        return true;
+#endif
+      }
+#endif
+
+      // wakes all the threads blocked in wait()
+      void wake()
+      {
+#if defined BOOST_THREAD_HAS_FUTEX
+        ::syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0);
+#else
+        {
+          boost::unique_lock<boost::mutex> lk(mtx_);
+        }
+        cond_.notify_all();
+#endif
+      }
+
+      // wakes at least one of the threads blocked in wait()
+      void wake_one()
+      {
+#if defined BOOST_THREAD_HAS_FUTEX
+        ::syscall(SYS_futex, &value, FUTEX_WAKE_PRIVATE, 1, 0, 0, 0);
+#else
+        {
+          boost::unique_lock<boost::mutex> lk(mtx_);
+        }
+        cond_.notify_one();
+#endif
+      }
+
+    private:
+#if defined BOOST_THREAD_HAS_FUTEX
+      void futex_wait(boost::uint32_t old, struct timespec const* timeout)
+      {
+        ::syscall(SYS_futex, &value, FUTEX_WAIT_PRIVATE, old, timeout, 0, 0);
+      }
+#else
+      boost::mutex mtx_;
+      boost::condition_variable cond_;
+#endif
+    };
+
+    // Lets the algorithms that block on a futex take their timeout as a template parameter.
+    struct no_timeout
+    {
+    };
+
+    inline bool wait_until(futex& f, boost::uint32_t old, no_timeout const&)
+    {
+      f.wait(old);
+      return true;
+    }
+#if defined BOOST_THREAD_USES_DATETIME
+    inline bool wait_until(futex& f, boost::uint32_t old, system_time const& abs_time)
+    {
+      return f.timed_wait(old, abs_time);
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Clock, class Duration>
+    bool wait_until(futex& f, boost::uint32_t old, chrono::time_point<Clock, Duration> const& abs_time)
+    {
+      return f.wait_until(old, abs_time);
+    }
+#endif
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
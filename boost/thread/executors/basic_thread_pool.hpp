@@ -0,0 +1,247 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_BASIC_THREAD_POOL_HPP
+#define BOOST_THREAD_EXECUTORS_BASIC_THREAD_POOL_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/tss.hpp>
+#include <boost/detail/atomic_count.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/scoped_array.hpp>
+#include <boost/bind.hpp>
+#include <deque>
+#include <cstddef>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace executors
+  {
+    /**
+     * A fixed set of worker threads running the submitted closures.
+     *
+     * Each worker owns a queue. The closures submitted from a worker go to the back of its own queue and
+     * are taken back from there, so that nested work stays on the thread that created it; the closures
+     * submitted from any other thread are spread over the queues. A worker whose queue is empty steals
+     * from the front of the queues of the others before going to sleep.
+     *
+     * No order is guaranteed between the closures; see @c serial_executor.
+     */
+    class basic_thread_pool
+    {
+      struct worker
+      {
+        mutex mtx;
+        std::deque<work> tasks;
+      };
+
+      scoped_array<worker> workers_;
+      std::size_t size_;
+      thread_group threads_;
+      // the worker the current thread is, if it belongs to this pool
+      thread_specific_ptr<worker> current_worker_;
+      // number of closures in the queues, only changed with the lock of the queue held
+      boost::detail::atomic_count pending_;
+      // number of workers waiting on cv_, only changed with mtx_ held
+      boost::detail::atomic_count idle_;
+      boost::detail::atomic_count next_;
+      // 0 or 1, only changed with mtx_ held
+      boost::detail::atomic_count closed_;
+      mutex mtx_;
+      condition_variable cv_;
+
+      bool pop_back(worker& w, work& closure)
+      {
+        lock_guard<mutex> lk(w.mtx);
+        if (w.tasks.empty()) return false;
+        closure.swap(w.tasks.back());
+        w.tasks.pop_back();
+        --pending_;
+        return true;
+      }
+
+      bool pop_front(worker& w, work& closure)
+      {
+        lock_guard<mutex> lk(w.mtx);
+        if (w.tasks.empty()) return false;
+        closure.swap(w.tasks.front());
+        w.tasks.pop_front();
+        --pending_;
+        return true;
+      }
+
+      bool pop(std::size_t index, work& closure)
+      {
+        if (pop_back(workers_[index], closure)) return true;
+        for (std::size_t i = 1; i < size_; ++i)
+        {
+          if (pop_front(workers_[(index + i) % size_], closure)) return true;
+        }
+        return false;
+      }
+
+      void worker_loop(std::size_t index)
+      {
+        current_worker_.reset(&workers_[index]);
+        for (;;)
+        {
+          work closure;
+          if (pop(index, closure))
+          {
+            try
+            {
+              closure();
+            }
+            catch (...)
+            {
+              // nobody can be told: the exception is dropped and the worker goes on with the other closures
+            }
+            continue;
+          }
+          unique_lock<mutex> lk(mtx_);
+          ++idle_;
+          while (pending_ == 0 && closed_ == 0)
+          {
+            cv_.wait(lk);
+          }
+          --idle_;
+          if (pending_ == 0) break;
+        }
+        current_worker_.reset();
+      }
+
+      basic_thread_pool(basic_thread_pool const&);
+      basic_thread_pool& operator=(basic_thread_pool const&);
+    public:
+      /**
+       * Effects: creates a pool of @c thread_count worker threads, or of one if @c thread_count is 0.
+       * Throws: @c thread_resource_error if the threads can not be created.
+       */
+      explicit basic_thread_pool(unsigned int thread_count = thread::hardware_concurrency())
+      : workers_(new worker[thread_count ? thread_count : 1]),
+        size_(thread_count ? thread_count : 1),
+        current_worker_(0),
+        pending_(0),
+        idle_(0),
+        next_(0),
+        closed_(0)
+      {
+        try
+        {
+          for (std::size_t i = 0; i < size_; ++i)
+          {
+            threads_.create_thread(boost::bind(&basic_thread_pool::worker_loop, this, i));
+          }
+        }
+        catch (...)
+        {
+          close();
+          threads_.join_all();
+          throw;
+        }
+      }
+
+      /**
+       * Effects: closes the pool and waits until all the submitted closures have been run.
+       */
+      ~basic_thread_pool()
+      {
+        close();
+        join();
+      }
+
+      /**
+       * Returns: the number of worker threads.
+       */
+      std::size_t size() const BOOST_NOEXCEPT
+      {
+        return size_;
+      }
+
+      /**
+       * Effects: schedules @c closure to be run by one of the workers.
+       * Throws: @c executor_closed if the pool is closed, or any exception thrown while copying @c closure.
+       */
+      void submit(work const& closure)
+      {
+        if (closed_ != 0) boost::throw_exception(executor_closed());
+        worker* target = current_worker_.get();
+        if (target == 0)
+        {
+          target = &workers_[static_cast<unsigned long>(++next_) % size_];
+        }
+        {
+          lock_guard<mutex> lk(target->mtx);
+          target->tasks.push_back(closure);
+          ++pending_;
+        }
+        // pending_ is incremented before idle_ is read, and a worker increments idle_ before reading
+        // pending_: either the worker sees the closure or it is waiting when it is notified.
+        if (idle_ != 0)
+        {
+          lock_guard<mutex> lk(mtx_);
+          cv_.notify_one();
+        }
+      }
+
+      /**
+       * Effects: runs one of the pending closures, if any, on the calling thread.
+       * Returns: whether a closure has been run.
+       * Throws: any exception thrown by the closure.
+       *
+       * This allows a closure to make progress while it waits for the result of other closures.
+       */
+      bool try_executing_one()
+      {
+        worker* self = current_worker_.get();
+        work closure;
+        if (!pop(self ? static_cast<std::size_t>(self - workers_.get()) : 0, closure)) return false;
+        closure();
+        return true;
+      }
+
+      /**
+       * Effects: no more closures can be submitted. The workers finish the pending ones and then exit.
+       */
+      void close()
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (closed_ == 0) ++closed_;
+        cv_.notify_all();
+      }
+
+      bool closed() const BOOST_NOEXCEPT
+      {
+        return closed_ != 0;
+      }
+
+      /**
+       * Effects: waits until the pool has been closed and all the submitted closures have been run.
+       * Throws: @c thread_resource_error if called from one of the workers.
+       */
+      void join()
+      {
+        threads_.join_all();
+        // closures submitted concurrently with close() may have reached the queues after the workers exited
+        while (try_executing_one())
+        {
+        }
+      }
+    };
+  }
+  using executors::basic_thread_pool;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,159 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_LOOP_EXECUTOR_HPP
+#define BOOST_THREAD_EXECUTORS_LOOP_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/throw_exception.hpp>
+#include <deque>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace executors
+  {
+    /**
+     * An executor without threads of its own: the submitted closures are run, in the order they have been
+     * submitted, by the threads that call @c loop, @c run_queued_closures or @c try_executing_one.
+     *
+     * The exceptions thrown by the closures are propagated to these callers.
+     */
+    class loop_executor
+    {
+      std::deque<work> tasks_;
+      bool closed_;
+      mutex mtx_;
+      condition_variable cv_;
+
+      bool try_pop(work& closure)
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (tasks_.empty()) return false;
+        closure.swap(tasks_.front());
+        tasks_.pop_front();
+        return true;
+      }
+
+      loop_executor(loop_executor const&);
+      loop_executor& operator=(loop_executor const&);
+    public:
+      loop_executor()
+      : closed_(false)
+      {
+      }
+
+      /**
+       * Effects: closes the executor and destroys the closures that have not been run.
+       */
+      ~loop_executor()
+      {
+        close();
+      }
+
+      /**
+       * Effects: queues @c closure.
+       * Throws: @c executor_closed if the executor is closed, or any exception thrown while copying @c closure.
+       */
+      void submit(work const& closure)
+      {
+        lock_guard<mutex> lk(mtx_);
+        if (closed_) boost::throw_exception(executor_closed());
+        tasks_.push_back(closure);
+        cv_.notify_one();
+      }
+
+      /**
+       * Effects: runs the first queued closure, if any.
+       * Returns: whether a closure has been run.
+       */
+      bool try_executing_one()
+      {
+        work closure;
+        if (!try_pop(closure)) return false;
+        closure();
+        return true;
+      }
+
+      /**
+       * Effects: runs the closures queued at the time of the call, but not the ones they submit.
+       */
+      void run_queued_closures()
+      {
+        std::deque<work> tasks;
+        {
+          lock_guard<mutex> lk(mtx_);
+          tasks.swap(tasks_);
+        }
+        while (!tasks.empty())
+        {
+          work closure;
+          closure.swap(tasks.front());
+          tasks.pop_front();
+          try
+          {
+            closure();
+          }
+          catch (...)
+          {
+            // the closures that have not been run stay first in the queue
+            lock_guard<mutex> lk(mtx_);
+            tasks_.insert(tasks_.begin(), tasks.begin(), tasks.end());
+            throw;
+          }
+        }
+      }
+
+      /**
+       * Effects: runs the closures as they are submitted, until the executor is closed and its queue is empty.
+       */
+      void loop()
+      {
+        for (;;)
+        {
+          work closure;
+          {
+            unique_lock<mutex> lk(mtx_);
+            while (tasks_.empty() && !closed_)
+            {
+              cv_.wait(lk);
+            }
+            if (tasks_.empty()) return;
+            closure.swap(tasks_.front());
+            tasks_.pop_front();
+          }
+          closure();
+        }
+      }
+
+      /**
+       * Effects: no more closures can be submitted; @c loop returns once the queued ones have been run.
+       */
+      void close()
+      {
+        lock_guard<mutex> lk(mtx_);
+        closed_ = true;
+        cv_.notify_all();
+      }
+
+      bool closed()
+      {
+        lock_guard<mutex> lk(mtx_);
+        return closed_;
+      }
+    };
+  }
+  using executors::loop_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,177 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_SERIAL_EXECUTOR_HPP
+#define BOOST_THREAD_EXECUTORS_SERIAL_EXECUTOR_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/executors/work.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/throw_exception.hpp>
+#include <deque>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace executors
+  {
+    /**
+     * Runs the submitted closures on the underlying executor one at a time, in the order they have been
+     * submitted: a closure is handed to @c Executor only once the previous one has finished.
+     *
+     * Executor: any executor with a @c submit(work const&) function, e.g. @c basic_thread_pool or
+     * @c loop_executor. It must outlive the @c serial_executor and go on running closures until the
+     * @c serial_executor is destroyed.
+     */
+    template <class Executor>
+    class serial_executor
+    {
+      Executor& ex_;
+      std::deque<work> tasks_;
+      // whether a closure of ours has been handed to ex_
+      bool scheduled_;
+      bool closed_;
+      mutex mtx_;
+      condition_variable cv_;
+
+      struct run_next
+      {
+        serial_executor* that;
+        explicit run_next(serial_executor* that_) : that(that_) {}
+        void operator()() const
+        {
+          that->run_one();
+        }
+      };
+
+      void run_one()
+      {
+        work closure;
+        {
+          lock_guard<mutex> lk(mtx_);
+          closure.swap(tasks_.front());
+          tasks_.pop_front();
+        }
+        try
+        {
+          closure();
+        }
+        catch (...)
+        {
+          schedule_next();
+          throw;
+        }
+        schedule_next();
+      }
+
+      // Hands the next closure to ex_, if any. scheduled_ stays set meanwhile, so that no other thread
+      // submits to ex_; the lock is not held while calling ex_, which may run the closure at once.
+      void schedule_next()
+      {
+        {
+          lock_guard<mutex> lk(mtx_);
+          if (tasks_.empty())
+          {
+            scheduled_ = false;
+            cv_.notify_all();
+            return;
+          }
+        }
+        try
+        {
+          ex_.submit(run_next(this));
+        }
+        catch (...)
+        {
+          // the underlying executor is closed: the remaining closures can not be run
+          lock_guard<mutex> lk(mtx_);
+          tasks_.clear();
+          scheduled_ = false;
+          cv_.notify_all();
+        }
+      }
+
+      serial_executor(serial_executor const&);
+      serial_executor& operator=(serial_executor const&);
+    public:
+      explicit serial_executor(Executor& ex)
+      : ex_(ex), scheduled_(false), closed_(false)
+      {
+      }
+
+      /**
+       * Effects: closes the executor and waits until the submitted closures have been run.
+       */
+      ~serial_executor()
+      {
+        close();
+        unique_lock<mutex> lk(mtx_);
+        while (scheduled_)
+        {
+          cv_.wait(lk);
+        }
+      }
+
+      Executor& underlying_executor() BOOST_NOEXCEPT
+      {
+        return ex_;
+      }
+
+      /**
+       * Effects: queues @c closure, to be run after the closures submitted before.
+       * Throws: @c executor_closed if this executor is closed, or any exception thrown while copying
+       * @c closure or by the @c submit function of the underlying executor.
+       */
+      void submit(work const& closure)
+      {
+        {
+          lock_guard<mutex> lk(mtx_);
+          if (closed_) boost::throw_exception(executor_closed());
+          tasks_.push_back(closure);
+          if (scheduled_) return;
+          scheduled_ = true;
+        }
+        try
+        {
+          ex_.submit(run_next(this));
+        }
+        catch (...)
+        {
+          // the queue was empty when scheduled_ was set, so closure is the first one; those queued since
+          // can not be run either
+          lock_guard<mutex> lk(mtx_);
+          tasks_.clear();
+          scheduled_ = false;
+          cv_.notify_all();
+          throw;
+        }
+      }
+
+      /**
+       * Effects: no more closures can be submitted. The queued ones are still run.
+       */
+      void close()
+      {
+        lock_guard<mutex> lk(mtx_);
+        closed_ = true;
+      }
+
+      bool closed()
+      {
+        lock_guard<mutex> lk(mtx_);
+        return closed_;
+      }
+    };
+  }
+  using executors::serial_executor;
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
@@ -0,0 +1,43 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_THREAD_EXECUTORS_WORK_HPP
+#define BOOST_THREAD_EXECUTORS_WORK_HPP
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/exceptions.hpp>
+#include <boost/function.hpp>
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  namespace executors
+  {
+    /**
+     * The closures the executors store and run.
+     *
+     * Any nullary CopyConstructible callable can be submitted; the value it returns is ignored.
+     */
+    typedef boost::function<void()> work;
+
+    /**
+     * Thrown by @c submit when the executor has been closed.
+     */
+    class BOOST_SYMBOL_VISIBLE executor_closed:
+        public thread_exception
+    {
+          typedef thread_exception base_type;
+    public:
+        executor_closed()
+        : base_type(system::errc::operation_not_permitted, "boost::executors::executor_closed")
+        {}
+    };
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
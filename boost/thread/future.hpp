@@ -32,6 +32,7 @@
 #include <boost/thread/detail/is_convertible.hpp>
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/type_traits/remove_cv.hpp>
+#include <boost/type_traits/is_convertible.hpp>
 #include <boost/mpl/if.hpp>
 #include <boost/config.hpp>
 #include <boost/throw_exception.hpp>
@@ -47,6 +48,14 @@
 #include <vector>
 
 #include <boost/thread/future_error_code.hpp>
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+#include <boost/weak_ptr.hpp>
+#include <boost/container/vector.hpp>
+#include <iterator>
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_HDR_TUPLE
+#include <tuple>
+#endif
+#endif
 #ifdef BOOST_THREAD_USES_CHRONO
 #include <boost/chrono/system_clocks.hpp>
 #endif
@@ -181,15 +190,13 @@ namespace boost
           future_continuation_base() {}
           virtual ~future_continuation_base() {}
 
-          virtual void do_continuation(boost::unique_lock<boost::mutex>& ) {};
+          // called once the antecedent is ready, without holding its lock
+          virtual void launch_continuation() = 0;
         private:
           future_continuation_base(future_continuation_base const&);
           future_continuation_base& operator=(future_continuation_base const&);
         };
 
-        template <typename F, typename R, typename C>
-        struct future_continuation;
-
 #endif
 
         struct relocker
@@ -236,9 +243,8 @@ namespace boost
             bool thread_was_interrupted;
 //#endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
-            shared_ptr<future_continuation_base> continuation_ptr;
-#else
-            shared_ptr<void> continuation_ptr;
+            typedef std::vector<shared_ptr<future_continuation_base> > continuations_type;
+            continuations_type continuations;
 #endif
             future_object_base():
                 done(false),
@@ -247,9 +253,6 @@ namespace boost
                 is_constructed(false)
 //#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
               , thread_was_interrupted(false)
-//#endif
-//#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
-               , continuation_ptr()
 //#endif
             {}
             virtual ~future_object_base()
@@ -283,10 +286,19 @@ namespace boost
             }
 
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+            // Launches the continuations once the state is ready. The lock is released
+            // first, and this state must not be used afterwards: the continuations may
+            // hold the last reference to it.
             void do_continuation(boost::unique_lock<boost::mutex>& lock)
             {
-                if (continuation_ptr) {
-                  continuation_ptr->do_continuation(lock);
+                if (! continuations.empty()) {
+                  continuations_type to_launch;
+                  to_launch.swap(continuations);
+                  lock.unlock();
+                  for (continuations_type::iterator it = to_launch.begin(); it != to_launch.end(); ++it)
+                  {
+                    (*it)->launch_continuation();
+                  }
                 }
             }
 #else
@@ -295,9 +307,9 @@ namespace boost
             }
 #endif
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
-            void set_continuation_ptr(future_continuation_base* continuation, boost::unique_lock<boost::mutex>& lock)
+            void add_continuation(shared_ptr<future_continuation_base> const& continuation, boost::unique_lock<boost::mutex>& lock)
             {
-              continuation_ptr.reset(continuation);
+              continuations.push_back(continuation);
               if (done) {
                 do_continuation(lock);
               }
@@ -348,16 +360,16 @@ namespace boost
                   {
                       waiters.wait(lock);
                   }
+                }
 #if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
-                  if(rethrow && thread_was_interrupted)
-                  {
-                      throw boost::thread_interrupted();
-                  }
+                if(rethrow && thread_was_interrupted)
+                {
+                    throw boost::thread_interrupted();
+                }
 #endif
-                  if(rethrow && exception)
-                  {
-                      boost::rethrow_exception(exception);
-                  }
+                if(rethrow && exception)
+                {
+                    boost::rethrow_exception(exception);
                 }
               }
             }
@@ -509,7 +521,8 @@ namespace boost
             typedef T const& source_reference_type;
             struct dummy;
             typedef typename boost::mpl::if_<boost::is_fundamental<T>,dummy&,BOOST_THREAD_RV_REF(T)>::type rvalue_source_type;
-            typedef typename boost::mpl::if_<boost::is_fundamental<T>,T,BOOST_THREAD_RV_REF(T)>::type move_dest_type;
+            // by value: the future may release the shared state before the caller has used the result
+            typedef T move_dest_type;
 #elif defined BOOST_THREAD_USES_MOVE
             typedef T& source_reference_type;
             typedef typename boost::mpl::if_<boost::has_move_emulation_enabled<T>,BOOST_THREAD_RV_REF(T),T const&>::type rvalue_source_type;
@@ -519,6 +532,12 @@ namespace boost
             typedef typename boost::mpl::if_<boost::thread_detail::is_convertible<T&,BOOST_THREAD_RV_REF(T) >,BOOST_THREAD_RV_REF(T),T const&>::type rvalue_source_type;
             typedef typename boost::mpl::if_<boost::thread_detail::is_convertible<T&,BOOST_THREAD_RV_REF(T) >,BOOST_THREAD_RV_REF(T),T>::type move_dest_type;
 #endif
+#if ! defined BOOST_NO_CXX11_RVALUE_REFERENCES || defined BOOST_THREAD_USES_MOVE
+            // by value: future<T>::get() moves the result out while it still owns the shared state
+            typedef T future_get_result_type;
+#else
+            typedef move_dest_type future_get_result_type;
+#endif
 
             typedef const T& shared_future_get_result_type;
 
@@ -546,6 +565,7 @@ namespace boost
             struct rvalue_source_type
             {};
             typedef T& move_dest_type;
+            typedef T& future_get_result_type;
             typedef T& shared_future_get_result_type;
 
             static void init(storage_type& storage,T& t)
@@ -564,6 +584,7 @@ namespace boost
         {
             typedef bool storage_type;
             typedef void move_dest_type;
+            typedef void future_get_result_type;
             typedef void shared_future_get_result_type;
 
             static void init(storage_type& storage)
@@ -627,7 +648,11 @@ namespace boost
             move_dest_type get()
             {
                 wait();
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+                return boost::move(*result);
+#else
                 return static_cast<move_dest_type>(*result);
+#endif
             }
 
             shared_future_get_result_type get_sh()
@@ -855,7 +880,9 @@ namespace boost
 
           ~future_async_object()
           {
-            if (thr_.joinable()) thr_.join();
+            // a continuation run by the thread may release the last reference
+            if (thr_.get_id()==this_thread::get_id()) thr_.detach();
+            else if (thr_.joinable()) thr_.join();
           }
 
           move_dest_type get()
@@ -866,7 +893,11 @@ namespace boost
               boost::unique_lock<boost::mutex> lock(this->mutex);
               this->wait_internal(lock);
 
+#ifndef BOOST_NO_CXX11_RVALUE_REFERENCES
+              return boost::move(*(this->result));
+#else
               return static_cast<move_dest_type>(*(this->result));
+#endif
           }
 
           static void run(future_async_object* that, BOOST_THREAD_FWD_REF(Fp) f)
@@ -904,7 +935,9 @@ namespace boost
 
           ~future_async_object()
           {
-            if (thr_.joinable()) thr_.join();
+            // a continuation run by the thread may release the last reference
+            if (thr_.get_id()==this_thread::get_id()) thr_.detach();
+            else if (thr_.joinable()) thr_.join();
           }
 
           static void run(future_async_object* that, BOOST_THREAD_FWD_REF(Fp) f)
@@ -926,6 +959,75 @@ namespace boost
             }
           }
         };
+        ////////////////////////////
+        /// future_executor_object
+        ////////////////////////////
+        template<typename Rp, typename Fp>
+        struct future_executor_object: future_object<Rp>
+        {
+          typedef future_object<Rp> base_type;
+          Fp func_;
+
+        public:
+          explicit future_executor_object(BOOST_THREAD_FWD_REF(Fp) f)
+          : func_(boost::forward<Fp>(f))
+          {
+            this->set_async();
+          }
+
+          // the closure submitted to the executor shares the ownership of the state
+          static void run(shared_ptr<future_executor_object> that)
+          {
+            try
+            {
+              that->mark_finished_with_result(that->func_());
+            }
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+            catch(thread_interrupted& )
+            {
+              that->mark_interrupted_finish();
+            }
+#endif
+            catch(...)
+            {
+              that->mark_exceptional_finish();
+            }
+          }
+        };
+
+        template<typename Fp>
+        struct future_executor_object<void, Fp>: future_object<void>
+        {
+          typedef future_object<void> base_type;
+          Fp func_;
+
+        public:
+          explicit future_executor_object(BOOST_THREAD_FWD_REF(Fp) f)
+          : func_(boost::forward<Fp>(f))
+          {
+            this->set_async();
+          }
+
+          static void run(shared_ptr<future_executor_object> that)
+          {
+            try
+            {
+              that->func_();
+              that->mark_finished_with_result();
+            }
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+            catch(thread_interrupted& )
+            {
+              that->mark_interrupted_finish();
+            }
+#endif
+            catch(...)
+            {
+              that->mark_exceptional_finish();
+            }
+          }
+        };
+
         //////////////////////////
         /// future_deferred_object
         //////////////////////////
@@ -1365,6 +1467,14 @@ namespace boost
         template <class Rp, class Fp>
         BOOST_THREAD_FUTURE<Rp>
         make_future_deferred_object(BOOST_THREAD_FWD_REF(Fp) f);
+
+        template <class Rp, class Fp, class Executor>
+        BOOST_THREAD_FUTURE<Rp>
+        make_future_executor_object(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f);
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+        struct future_state_access;
+#endif
     }
 
     template <typename R>
@@ -1377,8 +1487,7 @@ namespace boost
         friend class shared_future<R>;
         friend class promise<R>;
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
-        template <typename, typename, typename>
-        friend struct detail::future_continuation;
+        friend struct detail::future_state_access;
 #endif
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
         template <class> friend class packaged_task; // todo check if this works in windows
@@ -1395,7 +1504,11 @@ namespace boost
         friend BOOST_THREAD_FUTURE<Rp>
         detail::make_future_deferred_object(BOOST_THREAD_FWD_REF(Fp) f);
 
-        typedef typename detail::future_traits<R>::move_dest_type move_dest_type;
+        template <class Rp, class Fp, class Executor>
+        friend BOOST_THREAD_FUTURE<Rp>
+        detail::make_future_executor_object(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f);
+
+        typedef typename detail::future_traits<R>::future_get_result_type move_dest_type;
 
         BOOST_THREAD_FUTURE(future_ptr a_future):
           base_type(a_future)
@@ -1460,11 +1573,16 @@ namespace boost
         inline BOOST_THREAD_FUTURE<RF> then(launch policy, RF(*func)(BOOST_THREAD_FUTURE&));
 #endif
         template<typename F>
-        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE&)>::type>
-        then(BOOST_THREAD_RV_REF(F) func);
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE&)>::type>
+        then(BOOST_THREAD_FWD_REF(F) func);
         template<typename F>
-        inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE&)>::type>
-        then(launch policy, BOOST_THREAD_RV_REF(F) func);
+        inline BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE&)>::type>
+        then(launch policy, BOOST_THREAD_FWD_REF(F) func);
+        template<typename Ex, typename F>
+        inline typename disable_if<is_convertible<Ex&, launch>,
+          BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE&)>::type>
+        >::type
+        then(Ex& ex, BOOST_THREAD_FWD_REF(F) func);
 #endif
     };
 
@@ -1479,6 +1597,9 @@ namespace boost
 
         friend class detail::future_waiter;
         friend class promise<R>;
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+        friend struct detail::future_state_access;
+#endif
 
 #if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
         template <class> friend class packaged_task;// todo check if this works in windows
@@ -2823,6 +2944,25 @@ namespace boost
       return BOOST_THREAD_FUTURE<Rp>(h);
     }
 
+    template <class PackagedTask>
+    void run_packaged_task(shared_ptr<PackagedTask> const& pt)
+    {
+      (*pt)();
+    }
+
+    ////////////////////////////////
+    // make_future_executor_object
+    ////////////////////////////////
+    template <class Rp, class Fp, class Executor>
+    BOOST_THREAD_FUTURE<Rp>
+    make_future_executor_object(Executor& ex, BOOST_THREAD_FWD_REF(Fp) f)
+    {
+      shared_ptr<future_executor_object<Rp, Fp> >
+          h(new future_executor_object<Rp, Fp>(boost::forward<Fp>(f)));
+      ex.submit(boost::bind(&future_executor_object<Rp, Fp>::run, h));
+      return BOOST_THREAD_FUTURE<Rp>(h);
+    }
+
     }
 
     ////////////////////////////////
@@ -2980,6 +3120,54 @@ namespace boost
         return async(launch(launch::any), boost::forward<F>(f));
     }
 
+  ////////////////////////////////
+  // template <class Ex, class F, class... ArgTypes>
+  // future<R> async(Ex&, F&&, ArgTypes&&...);
+  ////////////////////////////////
+  // The function is submitted to the executor instead of being run on a thread of its own, e.g. to
+  // reuse the threads of a basic_thread_pool. Ex is any class with a submit(executors::work const&)
+  // function.
+
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+    template <class Ex, class F, class ...ArgTypes>
+    typename disable_if<is_convertible<Ex&, launch>,
+      BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(
+          typename decay<ArgTypes>::type...
+      )>::type>
+    >::type
+    async(Ex& ex, BOOST_THREAD_FWD_REF(F) f, BOOST_THREAD_FWD_REF(ArgTypes)... args)
+    {
+      typedef detail::async_func<typename decay<F>::type, typename decay<ArgTypes>::type...> BF;
+      typedef typename BF::result_type Rp;
+
+      return boost::detail::make_future_executor_object<Rp>(ex,
+          BF(
+              thread_detail::decay_copy(boost::forward<F>(f))
+              , thread_detail::decay_copy(boost::forward<ArgTypes>(args))...
+          )
+      );
+    }
+#else
+    template <class Ex, class F>
+    typename disable_if<is_convertible<Ex&, launch>,
+      BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type()>::type>
+    >::type
+    async(Ex& ex, BOOST_THREAD_FWD_REF(F) f)
+    {
+      typedef typename boost::result_of<typename decay<F>::type()>::type R;
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK
+      typedef packaged_task<R()> packaged_task_type;
+#else
+      typedef packaged_task<R> packaged_task_type;
+#endif
+
+      shared_ptr<packaged_task_type> pt(new packaged_task_type(boost::forward<F>(f)));
+      BOOST_THREAD_FUTURE<R> ret = pt->get_future();
+      ex.submit(boost::bind(&detail::run_packaged_task<packaged_task_type>, pt));
+      return ::boost::move(ret);
+    }
+#endif
+
 
   ////////////////////////////////
   // make_future
@@ -3027,224 +3215,504 @@ namespace boost
 #if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
   namespace detail
   {
-      template <typename F, typename R, typename C>
-      struct future_continuation : future_continuation_base
+      struct future_state_access
       {
-        F& parent;
-        C continuation;
-        launch policy_;
-        promise<R> next;
-
-        future_continuation(F& f, BOOST_THREAD_FWD_REF(C) c) :
-          parent(f),
-          continuation(boost::forward<C>(c)),
-          policy_(f.launch_policy()),
-          next()
-        {}
-        future_continuation(F& f, BOOST_THREAD_FWD_REF(C) c, launch policy) :
-          parent(f),
-          continuation(boost::forward<C>(c)),
-          policy_(policy),
-          next()
-        {}
-        ~future_continuation()
+        template <typename F>
+        static shared_ptr<future_object_base> state(F const& f)
+        {
+          return f.future_;
+        }
+        template <typename Rp>
+        static BOOST_THREAD_FUTURE<Rp> make_future(shared_ptr<future_object<Rp> > const& state)
+        {
+          return BOOST_THREAD_FUTURE<Rp>(state);
+        }
+      };
+
+      template <typename Rp>
+      struct continuation_result
+      {
+        template <typename State, typename C, typename F>
+        static void apply(State& state, C& continuation, F& parent)
+        {
+          state.mark_finished_with_result(continuation(parent));
+        }
+      };
+      template <>
+      struct continuation_result<void>
+      {
+        template <typename State, typename C, typename F>
+        static void apply(State& state, C& continuation, F& parent)
+        {
+          continuation(parent);
+          state.mark_finished_with_result();
+        }
+      };
+
+      // The shared state of the future returned by then(). It owns the antecedent future, and is
+      // registered on the antecedent state, which launches it once ready. By default the
+      // continuation is run inline by the thread that makes the antecedent ready.
+      template <typename F, typename Rp, typename Fp>
+      struct future_continuation : future_object<Rp>, future_continuation_base
+      {
+        F parent;
+        Fp continuation;
+
+        future_continuation(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c) :
+          parent(boost::move(f)),
+          continuation(boost::forward<Fp>(c))
         {}
 
-        void do_continuation(boost::unique_lock<boost::mutex>& lk)
+        void run()
         {
           try
           {
-            lk.unlock();
-            // fixme what to do depending on inherits_launch_policy_ and policy_?
-//            if (int(policy_) & int(launch::deferred))
-            {
-              R val = continuation(parent);
-              next.set_value(boost::move(val));
-            }
-//            else
-//            {
-//              BOOST_THREAD_FUTURE<R> f = async(policy_, continuation, boost::ref(parent));
-//              R val = f.get();
-//              next.set_value(boost::move(val));
-//            }
+            continuation_result<Rp>::apply(*this, continuation, parent);
           }
-          catch (...)
+#if defined BOOST_THREAD_PROVIDES_INTERRUPTIONS
+          catch(thread_interrupted& )
           {
-            next.set_exception(boost::current_exception());
+            this->mark_interrupted_finish();
+          }
+#endif
+          catch(...)
+          {
+            this->mark_exceptional_finish();
           }
         }
-      private:
 
+        static void run_shared(shared_ptr<future_continuation> that)
+        {
+          that->run();
+        }
+
+        virtual void launch_continuation()
+        {
+          run();
+        }
+
+        // deferred continuations are run by the first thread waiting for the result
+        virtual void execute(boost::unique_lock<boost::mutex>& lk)
+        {
+          relocker relock(lk);
+          run();
+        }
+      private:
         future_continuation(future_continuation const&);
         future_continuation& operator=(future_continuation const&);
       };
-#if defined(BOOST_THREAD_RVALUE_REFERENCES_DONT_MATCH_FUNTION_PTR)
-      template <typename F, typename R, typename CR>
-      struct future_continuation<F,R,CR(*)(F&)> : future_continuation_base
+
+      template <typename F, typename Rp, typename Fp>
+      struct future_async_continuation : future_continuation<F, Rp, Fp>
       {
-        F& parent;
-        CR(*continuation)(F&) ;
-        launch policy_;
-        promise<R> next;
-
-        future_continuation(F& f, CR(*c)(F&)) :
-          parent(f),
-          continuation(c),
-          policy_(f.launch_policy()),
-          next()
-        {}
-        future_continuation(F& f, CR(*c)(F&), launch policy) :
-          parent(f),
-          continuation(c),
-          policy_(policy),
-          next()
-        {}
-        ~future_continuation()
-        {}
+        typedef future_continuation<F, Rp, Fp> base_type;
 
-        void do_continuation(boost::unique_lock<boost::mutex>& lk)
+        future_async_continuation(BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c) :
+          base_type(boost::move(f), boost::forward<Fp>(c))
+        {
+          this->set_async();
+        }
+
+        virtual void launch_continuation()
         {
           try
           {
-            lk.unlock();
-            // fixme what to do depending on inherits_launch_policy_ and policy_?
-//            if (int(policy_) & int(launch::deferred))
-            {
-              R val = continuation(parent);
-              next.set_value(boost::move(val));
-            }
-//            else
-//            {
-//              BOOST_THREAD_FUTURE<R> f = async(policy_, continuation, boost::ref(parent));
-//              R val = f.get();
-//              next.set_value(boost::move(val));
-//            }
+            boost::thread(&base_type::run_shared,
+                static_pointer_cast<base_type>(this->shared_from_this())).detach();
           }
-          catch (...)
+          catch(...)
           {
-            next.set_exception(boost::current_exception());
+            this->mark_exceptional_finish();
           }
         }
-      private:
+      };
 
-        future_continuation(future_continuation const&);
-        future_continuation& operator=(future_continuation const&);
+      template <typename F, typename Rp, typename Fp, typename Executor>
+      struct future_executor_continuation : future_continuation<F, Rp, Fp>
+      {
+        typedef future_continuation<F, Rp, Fp> base_type;
+        Executor& ex_;
+
+        future_executor_continuation(Executor& ex, BOOST_THREAD_RV_REF(F) f, BOOST_THREAD_FWD_REF(Fp) c) :
+          base_type(boost::move(f), boost::forward<Fp>(c)),
+          ex_(ex)
+        {
+          this->set_async();
+        }
+
+        virtual void launch_continuation()
+        {
+          try
+          {
+            ex_.submit(boost::bind(&base_type::run_shared,
+                static_pointer_cast<base_type>(this->shared_from_this())));
+          }
+          catch(...)
+          {
+            this->mark_exceptional_finish();
+          }
+        }
       };
-#endif
+
+      // Registers the continuation on the antecedent state. The continuation of a deferred future is
+      // deferred as well, as nothing would make the antecedent ready otherwise.
+      template <typename Rp, typename State>
+      BOOST_THREAD_FUTURE<Rp>
+      attach_continuation(shared_ptr<future_object_base> const& antecedent, shared_ptr<State> const& state, bool deferred)
+      {
+        boost::unique_lock<boost::mutex> lock(antecedent->mutex);
+        if (deferred || antecedent->is_deferred())
+        {
+          lock.unlock();
+          state->set_deferred();
+        }
+        else
+        {
+          antecedent->add_continuation(state, lock);
+        }
+        return future_state_access::make_future<Rp>(state);
+      }
   }
 
   ////////////////////////////////
   // template<typename F>
   // auto future<R>::then(F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
   ////////////////////////////////
+  // The future is moved into the continuation, so it is no longer valid once then() returns.
 
   template <typename R>
   template <typename F>
-  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>&)>::type>
-  BOOST_THREAD_FUTURE<R>::then(launch policy, BOOST_THREAD_RV_REF(F) func)
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE<R>&)>::type>
+  BOOST_THREAD_FUTURE<R>::then(launch policy, BOOST_THREAD_FWD_REF(F) func)
   {
-
-    typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>&)>::type future_type;
+    typedef typename decay<F>::type continuation_type;
+    typedef typename boost::result_of<continuation_type(BOOST_THREAD_FUTURE<R>&)>::type future_type;
 
     if (this->future_)
     {
-      boost::unique_lock<boost::mutex> lock(this->future_->mutex);
-      detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, F > *ptr =
-          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, F>(*this, boost::forward<F>(func), policy);
-      if (ptr==0)
+      shared_ptr<detail::future_object_base> antecedent(this->future_);
+      if (int(policy) & int(launch::async))
       {
-        return BOOST_THREAD_FUTURE<future_type>();
+        shared_ptr<detail::future_async_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type> > ptr(
+            new detail::future_async_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type>(
+                boost::move(*this), thread_detail::decay_copy(boost::forward<F>(func))));
+        return detail::attach_continuation<future_type>(antecedent, ptr, false);
       }
-      this->future_->set_continuation_ptr(ptr, lock);
-      return ptr->next.get_future();
+      shared_ptr<detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type> > ptr(
+          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type>(
+              boost::move(*this), thread_detail::decay_copy(boost::forward<F>(func))));
+      return detail::attach_continuation<future_type>(antecedent, ptr, (int(policy) & int(launch::deferred))!=0);
     }
     else
     {
       // fixme what to do when the future has no associated state?
       return BOOST_THREAD_FUTURE<future_type>();
     }
-
   }
+
   template <typename R>
   template <typename F>
-  inline BOOST_THREAD_FUTURE<typename boost::result_of<F(BOOST_THREAD_FUTURE<R>&)>::type>
-  BOOST_THREAD_FUTURE<R>::then(BOOST_THREAD_RV_REF(F) func)
+  inline BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE<R>&)>::type>
+  BOOST_THREAD_FUTURE<R>::then(BOOST_THREAD_FWD_REF(F) func)
   {
+    return this->then(launch(launch::none), boost::forward<F>(func));
+  }
 
-    typedef typename boost::result_of<F(BOOST_THREAD_FUTURE<R>&)>::type future_type;
+  ////////////////////////////////
+  // template<typename Ex, typename F>
+  // auto future<R>::then(Ex& ex, F&& func) -> BOOST_THREAD_FUTURE<decltype(func(*this))>;
+  ////////////////////////////////
+  // The continuation is submitted to the executor once the future is ready.
+
+  template <typename R>
+  template <typename Ex, typename F>
+  inline typename disable_if<is_convertible<Ex&, launch>,
+    BOOST_THREAD_FUTURE<typename boost::result_of<typename decay<F>::type(BOOST_THREAD_FUTURE<R>&)>::type>
+  >::type
+  BOOST_THREAD_FUTURE<R>::then(Ex& ex, BOOST_THREAD_FWD_REF(F) func)
+  {
+    typedef typename decay<F>::type continuation_type;
+    typedef typename boost::result_of<continuation_type(BOOST_THREAD_FUTURE<R>&)>::type future_type;
 
     if (this->future_)
     {
-      boost::unique_lock<boost::mutex> lock(this->future_->mutex);
-      detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, F > *ptr =
-          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, F>(*this, boost::forward<F>(func));
-      if (ptr==0)
-      {
-        return BOOST_THREAD_FUTURE<future_type>();
-      }
-      this->future_->set_continuation_ptr(ptr, lock);
-      return ptr->next.get_future();
-    } else {
-      // fixme what to do when the future has no associated state?
+      shared_ptr<detail::future_object_base> antecedent(this->future_);
+      shared_ptr<detail::future_executor_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type, Ex> > ptr(
+          new detail::future_executor_continuation<BOOST_THREAD_FUTURE<R>, future_type, continuation_type, Ex>(
+              ex, boost::move(*this), thread_detail::decay_copy(boost::forward<F>(func))));
+      return detail::attach_continuation<future_type>(antecedent, ptr, false);
+    }
+    else
+    {
       return BOOST_THREAD_FUTURE<future_type>();
     }
-
   }
+
 #if defined(BOOST_THREAD_RVALUE_REFERENCES_DONT_MATCH_FUNTION_PTR)
   template <typename R>
   template<typename RF>
   BOOST_THREAD_FUTURE<RF>
   BOOST_THREAD_FUTURE<R>::then(RF(*func)(BOOST_THREAD_FUTURE<R>&))
   {
-
-    typedef RF future_type;
-
-    if (this->future_)
-    {
-      boost::unique_lock<boost::mutex> lock(this->future_->mutex);
-      detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, RF(*)(BOOST_THREAD_FUTURE&) > *ptr =
-          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, RF(*)(BOOST_THREAD_FUTURE&)>(*this, func);
-      if (ptr==0)
-      {
-        return BOOST_THREAD_FUTURE<future_type>();
-      }
-      this->future_->set_continuation_ptr(ptr, lock);
-      return ptr->next.get_future();
-    } else {
-      // fixme what to do when the future has no associated state?
-      return BOOST_THREAD_FUTURE<future_type>();
-    }
-
+    return this->then(launch(launch::none), func);
   }
   template <typename R>
   template<typename RF>
   BOOST_THREAD_FUTURE<RF>
   BOOST_THREAD_FUTURE<R>::then(launch policy, RF(*func)(BOOST_THREAD_FUTURE<R>&))
   {
-
-    typedef RF future_type;
+    typedef RF(*continuation_type)(BOOST_THREAD_FUTURE<R>&);
 
     if (this->future_)
     {
-      boost::unique_lock<boost::mutex> lock(this->future_->mutex);
-      detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, RF(*)(BOOST_THREAD_FUTURE&) > *ptr =
-          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, future_type, RF(*)(BOOST_THREAD_FUTURE&)>(*this, func, policy);
-      if (ptr==0)
+      shared_ptr<detail::future_object_base> antecedent(this->future_);
+      if (int(policy) & int(launch::async))
       {
-        return BOOST_THREAD_FUTURE<future_type>();
+        shared_ptr<detail::future_async_continuation<BOOST_THREAD_FUTURE<R>, RF, continuation_type> > ptr(
+            new detail::future_async_continuation<BOOST_THREAD_FUTURE<R>, RF, continuation_type>(
+                boost::move(*this), func));
+        return detail::attach_continuation<RF>(antecedent, ptr, false);
       }
-      this->future_->set_continuation_ptr(ptr, lock);
-      return ptr->next.get_future();
-    } else {
+      shared_ptr<detail::future_continuation<BOOST_THREAD_FUTURE<R>, RF, continuation_type> > ptr(
+          new detail::future_continuation<BOOST_THREAD_FUTURE<R>, RF, continuation_type>(
+              boost::move(*this), func));
+      return detail::attach_continuation<RF>(antecedent, ptr, (int(policy) & int(launch::deferred))!=0);
+    }
+    else
+    {
       // fixme what to do when the future has no associated state?
-      return BOOST_THREAD_FUTURE<future_type>();
+      return BOOST_THREAD_FUTURE<RF>();
     }
-
   }
 #endif
 
 #endif
 
+
+  ////////////////////////////////
+  // detail::future_when_object
+  ////////////////////////////////
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY && defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+  namespace detail
+  {
+      typedef std::vector<shared_ptr<future_object_base> > future_states;
+
+      // The shared state of the future returned by when_all() and when_any(). It owns the futures,
+      // and is made ready with them once all of them, or any of them, are ready. No thread waits
+      // for them: a waiter is registered as a continuation on each of their states.
+      // If some of the futures are deferred, the result is deferred as well, and the first thread
+      // waiting for it runs them, as nothing would make them ready otherwise.
+      template <typename T>
+      struct future_when_object : future_object<T>
+      {
+        T futures_;
+        std::size_t pending_;
+        bool any_;
+        future_states deferred_;
+
+        future_when_object(BOOST_THREAD_RV_REF(T) futures, std::size_t count, bool any) :
+          futures_(boost::move(futures)),
+          pending_(count),
+          any_(any)
+        {}
+
+        void on_ready()
+        {
+          boost::unique_lock<boost::mutex> lk(this->mutex);
+          if (this->done) return;
+          if (any_ || --pending_ == 0)
+          {
+            this->mark_finished_with_result_internal(boost::move(futures_), lk);
+          }
+        }
+
+        virtual void execute(boost::unique_lock<boost::mutex>& lk)
+        {
+          future_states deferred;
+          deferred.swap(deferred_);
+          for (future_states::const_iterator it = deferred.begin(); it != deferred.end() && !this->done; ++it)
+          {
+            relocker relock(lk);
+            (*it)->wait(false);
+          }
+          // the futures that are not deferred may still be running
+          while (!this->done)
+          {
+            this->waiters.wait(lk);
+          }
+        }
+      };
+
+      // The waiter doesn't own the aggregate state, which is released once its future is abandoned
+      // even if some of the futures are never ready.
+      template <typename T>
+      struct future_when_waiter : future_continuation_base
+      {
+        weak_ptr<future_when_object<T> > that_;
+
+        explicit future_when_waiter(shared_ptr<future_when_object<T> > const& that) :
+          that_(that)
+        {}
+
+        virtual void launch_continuation()
+        {
+          shared_ptr<future_when_object<T> > that = that_.lock();
+          if (that) that->on_ready();
+        }
+      };
+
+      template <typename T>
+      BOOST_THREAD_FUTURE<T>
+      make_future_when_object(BOOST_THREAD_RV_REF(T) futures, future_states const& states, bool any)
+      {
+        shared_ptr<future_when_object<T> > that(new future_when_object<T>(boost::move(futures), states.size(), any));
+        BOOST_THREAD_FUTURE<T> result = future_state_access::make_future<T>(that);
+        if (states.empty())
+        {
+          that->mark_finished_with_result(boost::move(that->futures_));
+          return ::boost::move(result);
+        }
+
+        shared_ptr<future_continuation_base> waiter(new future_when_waiter<T>(that));
+        for (future_states::const_iterator it = states.begin(); it != states.end(); ++it)
+        {
+          if (*it)
+          {
+            boost::unique_lock<boost::mutex> lock((*it)->mutex);
+            if ((*it)->is_deferred()) that->deferred_.push_back(*it);
+            (*it)->add_continuation(waiter, lock);
+          }
+          else
+          {
+            // a future without shared state counts as ready
+            that->on_ready();
+          }
+        }
+        {
+          boost::unique_lock<boost::mutex> lock(that->mutex);
+          if (!that->done && !that->deferred_.empty())
+          {
+            that->set_deferred();
+          }
+        }
+        return ::boost::move(result);
+      }
+
+      template <typename C, typename R>
+      void when_push_back(C& futures, BOOST_THREAD_FUTURE<R>& f)
+      {
+        futures.push_back(boost::move(f));
+      }
+      template <typename C, typename R>
+      void when_push_back(C& futures, shared_future<R> const& f)
+      {
+        futures.push_back(f);
+      }
+
+      template <typename InputIterator>
+      struct when_range_result
+      {
+        typedef BOOST_THREAD_FUTURE<container::vector<typename std::iterator_traits<InputIterator>::value_type> > type;
+      };
+
+      template <typename InputIterator>
+      BOOST_THREAD_FUTURE<container::vector<typename std::iterator_traits<InputIterator>::value_type> >
+      when_range(InputIterator first, InputIterator last, bool any)
+      {
+        typedef container::vector<typename std::iterator_traits<InputIterator>::value_type> container_type;
+        container_type futures;
+        for (; first != last; ++first)
+        {
+          when_push_back(futures, *first);
+        }
+        future_states states;
+        states.reserve(futures.size());
+        for (typename container_type::iterator it = futures.begin(); it != futures.end(); ++it)
+        {
+          states.push_back(future_state_access::state(*it));
+        }
+        return make_future_when_object(boost::move(futures), states, any);
+      }
+
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_HDR_TUPLE && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+      inline void when_collect(future_states&)
+      {
+      }
+      template <typename F, typename ...Fs>
+      void when_collect(future_states& states, F const& f, Fs const& ...fs)
+      {
+        states.push_back(future_state_access::state(f));
+        when_collect(states, fs...);
+      }
+#endif
+  }
+
+  ////////////////////////////////
+  // template <class InputIterator>
+  // future<vector<typename iterator_traits<InputIterator>::value_type>> when_all(InputIterator first, InputIterator last);
+  // template <class InputIterator>
+  // future<vector<typename iterator_traits<InputIterator>::value_type>> when_any(InputIterator first, InputIterator last);
+  ////////////////////////////////
+  // The futures are moved, and the shared futures copied, into the result.
+
+  template <typename InputIterator>
+  typename boost::lazy_disable_if<is_future_type<InputIterator>, detail::when_range_result<InputIterator> >::type
+  when_all(InputIterator first, InputIterator last)
+  {
+    return detail::when_range(first, last, false);
+  }
+
+  template <typename InputIterator>
+  typename boost::lazy_disable_if<is_future_type<InputIterator>, detail::when_range_result<InputIterator> >::type
+  when_any(InputIterator first, InputIterator last)
+  {
+    return detail::when_range(first, last, true);
+  }
+
+#if ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_HDR_TUPLE && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+  ////////////////////////////////
+  // template <class... Futures>
+  // future<tuple<decay_t<Futures>...>> when_all(Futures&&... futures);
+  // template <class... Futures>
+  // future<tuple<decay_t<Futures>...>> when_any(Futures&&... futures);
+  ////////////////////////////////
+
+  inline BOOST_THREAD_FUTURE<std::tuple<> > when_all()
+  {
+    return make_future(std::tuple<>());
+  }
+
+  template <typename F, typename ...Fs>
+  typename boost::enable_if<is_future_type<typename decay<F>::type>,
+    BOOST_THREAD_FUTURE<std::tuple<typename decay<F>::type, typename decay<Fs>::type...> >
+  >::type
+  when_all(F&& f, Fs&& ...fs)
+  {
+    typedef std::tuple<typename decay<F>::type, typename decay<Fs>::type...> container_type;
+    detail::future_states states;
+    detail::when_collect(states, f, fs...);
+    return detail::make_future_when_object(container_type(boost::forward<F>(f), boost::forward<Fs>(fs)...), states, false);
+  }
+
+  inline BOOST_THREAD_FUTURE<std::tuple<> > when_any()
+  {
+    return make_future(std::tuple<>());
+  }
+
+  template <typename F, typename ...Fs>
+  typename boost::enable_if<is_future_type<typename decay<F>::type>,
+    BOOST_THREAD_FUTURE<std::tuple<typename decay<F>::type, typename decay<Fs>::type...> >
+  >::type
+  when_any(F&& f, Fs&& ...fs)
+  {
+    typedef std::tuple<typename decay<F>::type, typename decay<Fs>::type...> container_type;
+    detail::future_states states;
+    detail::when_collect(states, f, fs...);
+    return detail::make_future_when_object(container_type(boost::forward<F>(f), boost::forward<Fs>(fs)...), states, true);
+  }
+#endif
+
+#endif
 }
 
 #endif // BOOST_NO_EXCEPTION
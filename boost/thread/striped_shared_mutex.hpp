@@ -0,0 +1,566 @@
+#ifndef BOOST_THREAD_STRIPED_SHARED_MUTEX_HPP
+#define BOOST_THREAD_STRIPED_SHARED_MUTEX_HPP
+
+//  striped_shared_mutex.hpp
+//
+//  (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/thread/detail/config.hpp>
+#include <boost/thread/detail/delete.hpp>
+#include <boost/thread/detail/futex.hpp>
+#include <boost/thread/lockable_traits.hpp>
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <cstddef>
+#if defined BOOST_THREAD_USES_DATETIME
+#include <boost/thread/thread_time.hpp>
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+#include <boost/chrono/system_clocks.hpp>
+#endif
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#include <sched.h>
+#define BOOST_THREAD_STRIPED_SHARED_MUTEX_USES_SCHED_GETCPU
+#endif
+
+// Number of reader counts of a striped_shared_mutex, has to be a power of two.
+#ifndef BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES
+#define BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES 32
+#endif
+
+#ifndef BOOST_THREAD_CACHE_LINE_SIZE
+#define BOOST_THREAD_CACHE_LINE_SIZE 64
+#endif
+
+#include <boost/config/abi_prefix.hpp>
+
+namespace boost
+{
+  /**
+   * A writer-preferring shared_mutex for data that is read far more often than it is written.
+   *
+   * The readers are counted in BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES counters, each on a
+   * cache line of its own and selected by the CPU the thread runs on, so that lock_shared() and
+   * unlock_shared() are an atomic increment and decrement of a line that other CPUs seldom touch,
+   * and a load of a line that is only written by writers. A thread may release its shared
+   * ownership through another counter than the one it acquired it: only the sum matters.
+   *
+   * The exclusive and upgrade owners are recorded in a state word. A writer sets its bit there,
+   * which makes the new readers back off and block, and then waits for the readers that got in
+   * before to leave. Threads block on futexes on Linux.
+   */
+  class striped_shared_mutex
+  {
+  private:
+    BOOST_STATIC_ASSERT((BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES & (BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES - 1)) == 0);
+
+    static const boost::uint32_t exclusive_bit = 1;
+    static const boost::uint32_t upgrade_bit = 2;
+    // some thread blocks on state_ until one of the other bits is cleared
+    static const boost::uint32_t waiting_bit = 4;
+
+    struct stripe
+    {
+      boost::atomic<boost::uint32_t> readers;
+      char padding[BOOST_THREAD_CACHE_LINE_SIZE - sizeof(boost::atomic<boost::uint32_t>) % BOOST_THREAD_CACHE_LINE_SIZE];
+
+      stripe() : readers(0)
+      {
+      }
+    };
+
+    struct padded_futex
+    {
+      thread_detail::futex word;
+      char padding[BOOST_THREAD_CACHE_LINE_SIZE - sizeof(thread_detail::futex) % BOOST_THREAD_CACHE_LINE_SIZE];
+    };
+
+    padded_futex state_;
+    // 1 while the writer waits for the readers to leave
+    padded_futex drain_;
+    stripe stripes_[BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES];
+
+    boost::atomic<boost::uint32_t>& state()
+    {
+      return state_.word.value;
+    }
+
+    boost::atomic<boost::uint32_t>& local_readers()
+    {
+      std::size_t index;
+#if defined BOOST_THREAD_STRIPED_SHARED_MUTEX_USES_SCHED_GETCPU
+      int const cpu = ::sched_getcpu();
+      if (cpu >= 0)
+      {
+        index = static_cast<std::size_t>(cpu);
+      }
+      else
+#endif
+      {
+        // the stacks of the threads are far apart
+        char c;
+        boost::uint32_t h = static_cast<boost::uint32_t>(reinterpret_cast<std::size_t>(&c) >> 16);
+        index = static_cast<std::size_t>((h * 2654435761u) >> 16);
+      }
+      return stripes_[index & (BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES - 1)].readers;
+    }
+
+    boost::uint32_t readers()
+    {
+      boost::uint32_t n = 0;
+      for (std::size_t i = 0; i != BOOST_THREAD_STRIPED_SHARED_MUTEX_STRIPES; ++i)
+      {
+        n += stripes_[i].readers.load(boost::memory_order_seq_cst);
+      }
+      return n;
+    }
+
+    // blocks until none of the bits in mask is set
+    template <class Deadline>
+    bool wait_for_state(boost::uint32_t mask, Deadline const& deadline)
+    {
+      boost::uint32_t s = state().load(boost::memory_order_seq_cst);
+      while (s & mask)
+      {
+        if (!(s & waiting_bit))
+        {
+          if (!state().compare_exchange_weak(s, s | waiting_bit, boost::memory_order_seq_cst))
+          {
+            continue;
+          }
+          s |= waiting_bit;
+        }
+        if (!thread_detail::wait_until(state_.word, s, deadline))
+        {
+          return false;
+        }
+        s = state().load(boost::memory_order_seq_cst);
+      }
+      return true;
+    }
+
+    // sets bit, which is exclusive_bit or upgrade_bit, if neither is set
+    bool try_set(boost::uint32_t bit)
+    {
+      boost::uint32_t s = state().load(boost::memory_order_relaxed);
+      do
+      {
+        if (s & (exclusive_bit | upgrade_bit))
+        {
+          return false;
+        }
+      } while (!state().compare_exchange_weak(s, s | bit, boost::memory_order_seq_cst));
+      return true;
+    }
+
+    template <class Deadline>
+    bool set(boost::uint32_t bit, Deadline const& deadline)
+    {
+      while (!try_set(bit))
+      {
+        if (!wait_for_state(exclusive_bit | upgrade_bit, deadline))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // replaces the bits in clear by those in set, and wakes up the blocked threads
+    void reset(boost::uint32_t clear, boost::uint32_t set)
+    {
+      boost::uint32_t s = state().load(boost::memory_order_relaxed);
+      while (!state().compare_exchange_weak(s, (s & ~(clear | waiting_bit)) | set, boost::memory_order_seq_cst))
+      {
+      }
+      if (s & waiting_bit)
+      {
+        state_.word.wake();
+      }
+    }
+
+    // called by the readers that leave while the exclusive bit is set
+    void notify_writer()
+    {
+      if (drain_.word.value.load(boost::memory_order_seq_cst) != 0
+          && drain_.word.value.exchange(0, boost::memory_order_seq_cst) != 0)
+      {
+        drain_.word.wake();
+      }
+    }
+
+    // called with the exclusive bit set: blocks until there are count readers left
+    template <class Deadline>
+    bool wait_for_readers(boost::uint32_t count, Deadline const& deadline)
+    {
+      for (;;)
+      {
+        drain_.word.value.store(1, boost::memory_order_seq_cst);
+        if (readers() == count)
+        {
+          break;
+        }
+        if (!thread_detail::wait_until(drain_.word, 1, deadline))
+        {
+          drain_.word.value.store(0, boost::memory_order_relaxed);
+          return false;
+        }
+      }
+      drain_.word.value.store(0, boost::memory_order_relaxed);
+      return true;
+    }
+
+    template <class Deadline>
+    bool lock_shared_until(Deadline const& deadline)
+    {
+      while (!try_lock_shared())
+      {
+        if (!wait_for_state(exclusive_bit, deadline))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    template <class Deadline>
+    bool lock_until(Deadline const& deadline)
+    {
+      if (!set(exclusive_bit, deadline))
+      {
+        return false;
+      }
+      if (!wait_for_readers(0, deadline))
+      {
+        reset(exclusive_bit, 0);
+        return false;
+      }
+      return true;
+    }
+
+    template <class Deadline>
+    bool unlock_upgrade_and_lock_until(Deadline const& deadline)
+    {
+      boost::uint32_t s = state().load(boost::memory_order_relaxed);
+      while (!state().compare_exchange_weak(s, (s & ~upgrade_bit) | exclusive_bit, boost::memory_order_seq_cst))
+      {
+      }
+      if (!wait_for_readers(0, deadline))
+      {
+        reset(exclusive_bit, upgrade_bit);
+        return false;
+      }
+      return true;
+    }
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+    template <class Deadline>
+    bool unlock_shared_and_lock_until(Deadline const& deadline)
+    {
+      if (!set(exclusive_bit, deadline))
+      {
+        return false;
+      }
+      if (!wait_for_readers(1, deadline))
+      {
+        reset(exclusive_bit, 0);
+        return false;
+      }
+      local_readers().fetch_sub(1, boost::memory_order_seq_cst);
+      return true;
+    }
+#endif
+
+  public:
+    BOOST_THREAD_NO_COPYABLE(striped_shared_mutex)
+
+    striped_shared_mutex()
+    {
+    }
+
+    // Shared ownership
+
+    void lock_shared()
+    {
+      lock_shared_until(thread_detail::no_timeout());
+    }
+
+    bool try_lock_shared()
+    {
+      boost::atomic<boost::uint32_t>& r = local_readers();
+      r.fetch_add(1, boost::memory_order_seq_cst);
+      if (!(state().load(boost::memory_order_seq_cst) & exclusive_bit))
+      {
+        return true;
+      }
+      r.fetch_sub(1, boost::memory_order_seq_cst);
+      notify_writer();
+      return false;
+    }
+
+#if defined BOOST_THREAD_USES_DATETIME
+    bool timed_lock_shared(system_time const& timeout)
+    {
+      return lock_shared_until(timeout);
+    }
+
+    template<typename TimeDuration>
+    bool timed_lock_shared(TimeDuration const & relative_time)
+    {
+      return timed_lock_shared(get_system_time()+relative_time);
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_shared_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_shared_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_shared_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return lock_shared_until(abs_time);
+    }
+#endif
+
+    void unlock_shared()
+    {
+      local_readers().fetch_sub(1, boost::memory_order_seq_cst);
+      if (state().load(boost::memory_order_seq_cst) & exclusive_bit)
+      {
+        notify_writer();
+      }
+    }
+
+    // Exclusive ownership
+
+    void lock()
+    {
+      lock_until(thread_detail::no_timeout());
+    }
+
+#if defined BOOST_THREAD_USES_DATETIME
+    bool timed_lock(system_time const& timeout)
+    {
+      return lock_until(timeout);
+    }
+
+    template<typename TimeDuration>
+    bool timed_lock(TimeDuration const & relative_time)
+    {
+      return timed_lock(get_system_time()+relative_time);
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return lock_until(abs_time);
+    }
+#endif
+
+    bool try_lock()
+    {
+      if (!try_set(exclusive_bit))
+      {
+        return false;
+      }
+      if (readers() != 0)
+      {
+        reset(exclusive_bit, 0);
+        return false;
+      }
+      return true;
+    }
+
+    void unlock()
+    {
+      reset(exclusive_bit, 0);
+    }
+
+    // Upgrade ownership
+
+    void lock_upgrade()
+    {
+      set(upgrade_bit, thread_detail::no_timeout());
+    }
+
+#if defined BOOST_THREAD_USES_DATETIME
+    bool timed_lock_upgrade(system_time const& timeout)
+    {
+      return set(upgrade_bit, timeout);
+    }
+
+    template<typename TimeDuration>
+    bool timed_lock_upgrade(TimeDuration const & relative_time)
+    {
+      return timed_lock_upgrade(get_system_time()+relative_time);
+    }
+#endif
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_lock_upgrade_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_lock_upgrade_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_lock_upgrade_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return set(upgrade_bit, abs_time);
+    }
+#endif
+
+    bool try_lock_upgrade()
+    {
+      return try_set(upgrade_bit);
+    }
+
+    void unlock_upgrade()
+    {
+      reset(upgrade_bit, 0);
+    }
+
+    // Upgrade <-> Exclusive
+
+    void unlock_upgrade_and_lock()
+    {
+      unlock_upgrade_and_lock_until(thread_detail::no_timeout());
+    }
+
+    void unlock_and_lock_upgrade()
+    {
+      reset(exclusive_bit, upgrade_bit);
+    }
+
+    bool try_unlock_upgrade_and_lock()
+    {
+      boost::uint32_t s = state().load(boost::memory_order_relaxed);
+      while (!state().compare_exchange_weak(s, (s & ~upgrade_bit) | exclusive_bit, boost::memory_order_seq_cst))
+      {
+      }
+      if (readers() != 0)
+      {
+        reset(exclusive_bit, upgrade_bit);
+        return false;
+      }
+      return true;
+    }
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_unlock_upgrade_and_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_unlock_upgrade_and_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_unlock_upgrade_and_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return unlock_upgrade_and_lock_until(abs_time);
+    }
+#endif
+
+    // Shared <-> Exclusive
+
+    void unlock_and_lock_shared()
+    {
+      local_readers().fetch_add(1, boost::memory_order_seq_cst);
+      reset(exclusive_bit, 0);
+    }
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+    bool try_unlock_shared_and_lock()
+    {
+      if (!try_set(exclusive_bit))
+      {
+        return false;
+      }
+      if (readers() != 1)
+      {
+        reset(exclusive_bit, 0);
+        return false;
+      }
+      local_readers().fetch_sub(1, boost::memory_order_seq_cst);
+      return true;
+    }
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_unlock_shared_and_lock_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_unlock_shared_and_lock_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_unlock_shared_and_lock_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      return unlock_shared_and_lock_until(abs_time);
+    }
+#endif
+#endif
+
+    // Shared <-> Upgrade
+
+    void unlock_upgrade_and_lock_shared()
+    {
+      local_readers().fetch_add(1, boost::memory_order_seq_cst);
+      reset(upgrade_bit, 0);
+    }
+
+#ifdef BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+    bool try_unlock_shared_and_lock_upgrade()
+    {
+      if (!try_set(upgrade_bit))
+      {
+        return false;
+      }
+      local_readers().fetch_sub(1, boost::memory_order_seq_cst);
+      return true;
+    }
+#ifdef BOOST_THREAD_USES_CHRONO
+    template <class Rep, class Period>
+    bool try_unlock_shared_and_lock_upgrade_for(const chrono::duration<Rep, Period>& rel_time)
+    {
+      return try_unlock_shared_and_lock_upgrade_until(chrono::steady_clock::now() + rel_time);
+    }
+    template <class Clock, class Duration>
+    bool try_unlock_shared_and_lock_upgrade_until(const chrono::time_point<Clock, Duration>& abs_time)
+    {
+      if (!set(upgrade_bit, abs_time))
+      {
+        return false;
+      }
+      local_readers().fetch_sub(1, boost::memory_order_seq_cst);
+      return true;
+    }
+#endif
+#endif
+  };
+
+  namespace sync
+  {
+#ifdef BOOST_THREAD_NO_AUTO_DETECT_MUTEX_TYPES
+    template<>
+    struct is_basic_lockable<striped_shared_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+    template<>
+    struct is_lockable<striped_shared_mutex>
+    {
+      BOOST_STATIC_CONSTANT(bool, value = true);
+    };
+#endif
+  }
+}
+
+#include <boost/config/abi_suffix.hpp>
+
+#endif
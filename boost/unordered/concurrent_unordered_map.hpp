@@ -0,0 +1,348 @@
+
+// Copyright (C) 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/unordered for documentation
+
+#ifndef BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+#define BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <boost/unordered/concurrent_unordered_map_fwd.hpp>
+#include <boost/unordered/detail/concurrent_table.hpp>
+#include <boost/unordered/detail/util.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/move/move.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+#include <initializer_list>
+#endif
+
+namespace boost
+{
+namespace unordered
+{
+    // concurrent_unordered_map
+    //
+    // An unordered map with unique keys whose member functions can be
+    // called from several threads at the same time, other than the
+    // constructors and destructor.
+    //
+    // There are no iterators, as another thread could erase the element
+    // that an iterator points to. Instead, elements are accessed by passing
+    // a function object to visit, insert_or_visit or for_each, which is
+    // called with a reference to the element while no other thread can
+    // access it. The function object mustn't use the container, and should
+    // be quick, as it can delay other threads.
+    //
+    // The elements are divided into a fixed number of shards by their hash
+    // value, each with its own lock. Each shard is rehashed on its own when
+    // it grows, so an insert never has to wait for the whole container to
+    // be rehashed.
+    //
+    // The allocator is used from several threads at the same time.
+
+    template <class K, class T, class H, class P, class A>
+    class concurrent_unordered_map
+    {
+    public:
+
+        typedef K key_type;
+        typedef std::pair<const K, T> value_type;
+        typedef T mapped_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef A allocator_type;
+
+    private:
+
+        typedef boost::unordered::detail::flat_map<A, K, T, H, P> types;
+        typedef typename types::traits allocator_traits;
+        typedef boost::unordered::detail::concurrent_table<types> table;
+
+        concurrent_unordered_map(concurrent_unordered_map const&);
+        concurrent_unordered_map& operator=(concurrent_unordered_map const&);
+
+    public:
+
+        typedef typename allocator_traits::pointer pointer;
+        typedef typename allocator_traits::const_pointer const_pointer;
+
+        typedef value_type& reference;
+        typedef value_type const& const_reference;
+
+        typedef std::size_t size_type;
+        typedef std::ptrdiff_t difference_type;
+
+    private:
+
+        table table_;
+
+    public:
+
+        // constructors
+
+        explicit concurrent_unordered_map(
+                size_type n = boost::unordered::detail::default_bucket_count,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_(n, hf, eql, a)
+        {
+        }
+
+        explicit concurrent_unordered_map(allocator_type const& a)
+          : table_(boost::unordered::detail::default_bucket_count,
+                hasher(), key_equal(), a)
+        {
+        }
+
+        template <class InputIt>
+        concurrent_unordered_map(InputIt f, InputIt l,
+                size_type n = boost::unordered::detail::default_bucket_count,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_(boost::unordered::detail::initial_size(f, l, n),
+                hf, eql, a)
+        {
+            table_.insert_range(f, l);
+        }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        concurrent_unordered_map(
+                std::initializer_list<value_type> list,
+                size_type n = boost::unordered::detail::default_bucket_count,
+                const hasher& hf = hasher(),
+                const key_equal& eql = key_equal(),
+                const allocator_type& a = allocator_type())
+          : table_(boost::unordered::detail::initial_size(
+                    list.begin(), list.end(), n),
+                hf, eql, a)
+        {
+            table_.insert_range(list.begin(), list.end());
+        }
+#endif
+
+        ~concurrent_unordered_map() {}
+
+        allocator_type get_allocator() const
+        {
+            return table_.value_alloc();
+        }
+
+        // size and capacity
+        //
+        // If other threads are modifying the container, these might not
+        // give a value that the container ever actually had.
+
+        bool empty() const
+        {
+            return table_.size() == 0;
+        }
+
+        size_type size() const
+        {
+            return table_.size();
+        }
+
+        // emplace
+        //
+        // Returns true if a new element was inserted.
+
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <class... Args>
+        bool emplace(BOOST_FWD_REF(Args)... args)
+        {
+            return table_.emplace(boost::forward<Args>(args)...);
+        }
+#else
+
+        template <typename A0>
+        bool emplace(BOOST_FWD_REF(A0) a0)
+        {
+            return table_.emplace(
+                boost::unordered::detail::create_emplace_args(
+                    boost::forward<A0>(a0))
+            );
+        }
+
+        template <typename A0, typename A1>
+        bool emplace(
+            BOOST_FWD_REF(A0) a0,
+            BOOST_FWD_REF(A1) a1)
+        {
+            return table_.emplace(
+                boost::unordered::detail::create_emplace_args(
+                    boost::forward<A0>(a0),
+                    boost::forward<A1>(a1))
+            );
+        }
+
+        template <typename A0, typename A1, typename A2>
+        bool emplace(
+            BOOST_FWD_REF(A0) a0,
+            BOOST_FWD_REF(A1) a1,
+            BOOST_FWD_REF(A2) a2)
+        {
+            return table_.emplace(
+                boost::unordered::detail::create_emplace_args(
+                    boost::forward<A0>(a0),
+                    boost::forward<A1>(a1),
+                    boost::forward<A2>(a2))
+            );
+        }
+
+#endif
+
+        bool insert(value_type const& x)
+        {
+            return this->emplace(x);
+        }
+
+        bool insert(BOOST_RV_REF(value_type) x)
+        {
+            return this->emplace(boost::move(x));
+        }
+
+        template <class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            table_.insert_range(first, last);
+        }
+
+#if !defined(BOOST_NO_CXX11_HDR_INITIALIZER_LIST)
+        void insert(std::initializer_list<value_type> list)
+        {
+            table_.insert_range(list.begin(), list.end());
+        }
+#endif
+
+        // Inserts 'x', or if there's already an element with an equivalent
+        // key, calls 'f' with a reference to it. Returns true if 'x' was
+        // inserted.
+
+        template <class F>
+        bool insert_or_visit(value_type const& x, F f)
+        {
+            return table_.emplace_or_visit(x.first, f,
+                BOOST_UNORDERED_EMPLACE_ARGS1(x));
+        }
+
+        template <class F>
+        bool insert_or_visit(BOOST_RV_REF(value_type) x, F f)
+        {
+            return table_.emplace_or_visit(x.first, f,
+                BOOST_UNORDERED_EMPLACE_ARGS1(boost::move(x)));
+        }
+
+        // modifiers
+
+        size_type erase(const key_type& k)
+        {
+            return table_.erase_key(k);
+        }
+
+        void clear()
+        {
+            table_.clear();
+        }
+
+        // observers
+
+        hasher hash_function() const
+        {
+            return table_.hash_function();
+        }
+
+        key_equal key_eq() const
+        {
+            return table_.key_eq();
+        }
+
+        // lookup
+        //
+        // visit calls 'f' with a reference to the element with a key
+        // equivalent to 'k', if there is one, and returns the number of
+        // elements visited. for_each calls 'f' for every element, locking
+        // one shard at a time, so elements inserted or erased at the same
+        // time might or might not be visited.
+
+        template <class F>
+        size_type visit(const key_type& k, F f)
+        {
+            return table_.visit(k, f);
+        }
+
+        template <class F>
+        size_type visit(const key_type& k, F f) const
+        {
+            boost::unordered::detail::concurrent_const_visitor<value_type, F>
+                v(f);
+            return table_.visit(k, v);
+        }
+
+        template <class F>
+        F for_each(F f)
+        {
+            table_.for_each(f);
+            return f;
+        }
+
+        template <class F>
+        F for_each(F f) const
+        {
+            boost::unordered::detail::concurrent_const_visitor<value_type, F>
+                v(f);
+            table_.for_each(v);
+            return f;
+        }
+
+        size_type count(const key_type& k) const
+        {
+            return table_.count(k);
+        }
+
+        // bucket interface
+
+        size_type bucket_count() const
+        {
+            return table_.slot_count();
+        }
+
+        // hash policy
+
+        float load_factor() const
+        {
+            return table_.load_factor();
+        }
+
+        float max_load_factor() const
+        {
+            return table_.max_load_factor();
+        }
+
+        void max_load_factor(float m)
+        {
+            table_.max_load_factor(m);
+        }
+
+        void rehash(size_type n)
+        {
+            table_.rehash(n);
+        }
+
+        void reserve(size_type n)
+        {
+            table_.reserve(n);
+        }
+    }; // class template concurrent_unordered_map
+
+} // namespace unordered
+} // namespace boost
+
+#endif // BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_HPP_INCLUDED
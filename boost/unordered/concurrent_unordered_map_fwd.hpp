@@ -0,0 +1,34 @@
+
+// Copyright (C) 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_FWD_HPP_INCLUDED
+#define BOOST_UNORDERED_CONCURRENT_UNORDERED_MAP_FWD_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <memory>
+#include <functional>
+#include <boost/functional/hash_fwd.hpp>
+#include <boost/unordered/detail/fwd.hpp>
+
+namespace boost
+{
+    namespace unordered
+    {
+        template <class K,
+            class T,
+            class H = boost::hash<K>,
+            class P = std::equal_to<K>,
+            class A = std::allocator<std::pair<const K, T> > >
+        class concurrent_unordered_map;
+    }
+
+    using boost::unordered::concurrent_unordered_map;
+}
+
+#endif
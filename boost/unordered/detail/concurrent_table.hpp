@@ -0,0 +1,434 @@
+
+// Copyright (C) 2026 Joshua Napoli
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_DETAIL_CONCURRENT_TABLE_HPP_INCLUDED
+#define BOOST_UNORDERED_DETAIL_CONCURRENT_TABLE_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <boost/unordered/detail/flat_table.hpp>
+#include <boost/smart_ptr/detail/spinlock.hpp>
+#include <boost/limits.hpp>
+#include <new>
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable:4127) // conditional expression is constant
+#endif
+
+namespace boost { namespace unordered { namespace detail {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // concurrent_shard
+    //
+    // A flat table and the spinlock which protects it. The padding keeps the
+    // locks of neighbouring shards on different cache lines.
+
+    template <typename Types>
+    struct concurrent_shard
+    {
+        typedef boost::unordered::detail::flat_table<Types> table;
+
+        boost::detail::spinlock mutex_;
+        table table_;
+        char padding_[64];
+
+        concurrent_shard(std::size_t num_slots,
+                typename table::hasher const& hf,
+                typename table::key_equal const& eq,
+                typename table::value_allocator const& a) :
+            table_(num_slots, hf, eq, a)
+        {
+            boost::detail::spinlock init = BOOST_DETAIL_SPINLOCK_INIT;
+            mutex_ = init;
+        }
+
+    private:
+
+        concurrent_shard(concurrent_shard const&);
+        concurrent_shard& operator=(concurrent_shard const&);
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // concurrent_const_visitor
+    //
+    // Only lets a function object see an element as const.
+
+    template <typename Value, typename F>
+    struct concurrent_const_visitor
+    {
+        F& f_;
+
+        explicit concurrent_const_visitor(F& f) : f_(f) {}
+
+        void operator()(Value& v) const {
+            f_(const_cast<Value const&>(v));
+        }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // concurrent_table
+    //
+    // The elements are divided between a fixed number of shards by their
+    // hash value, and each shard is a flat table with its own lock. So
+    // operations on different shards don't block each other, and a rehash
+    // only has to move the elements of a single shard while the rest of
+    // the table remains available.
+    //
+    // The hash value is only calculated once, and is passed to the shard's
+    // table. The shard is picked from a multiplicative hash of the whole
+    // value, so that it isn't correlated with the bits that the table uses
+    // to pick a group.
+    //
+    // Function objects passed to visit and for_each are called while the
+    // shard is locked, so they mustn't use the table.
+
+    template <typename Types>
+    struct concurrent_table :
+        boost::unordered::detail::functions<
+            typename Types::hasher,
+            typename Types::key_equal>
+    {
+    private:
+        concurrent_table(concurrent_table const&);
+        concurrent_table& operator=(concurrent_table const&);
+    public:
+        typedef typename Types::hasher hasher;
+        typedef typename Types::key_equal key_equal;
+        typedef typename Types::key_type key_type;
+        typedef typename Types::extractor extractor;
+        typedef typename Types::value_type value_type;
+        typedef typename Types::policy policy;
+
+        typedef boost::unordered::detail::functions<
+            typename Types::hasher,
+            typename Types::key_equal> functions;
+
+        typedef boost::unordered::detail::concurrent_shard<Types> shard;
+        typedef typename shard::table table;
+        typedef typename table::value_allocator value_allocator;
+        typedef typename table::emplace_return emplace_return;
+
+        typedef typename Types::allocator allocator;
+        typedef typename boost::unordered::detail::
+            rebind_wrap<allocator, shard>::type shard_allocator;
+        typedef boost::unordered::detail::allocator_traits<shard_allocator>
+            shard_allocator_traits;
+        typedef typename shard_allocator_traits::pointer shard_pointer;
+
+        typedef boost::detail::spinlock::scoped_lock scoped_lock;
+
+        enum { shard_bits = 8, shard_count = 1 << shard_bits };
+
+        ////////////////////////////////////////////////////////////////////////
+        // Members
+
+        value_allocator alloc_;
+        shard_pointer shards_;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors
+
+        concurrent_table(std::size_t num_slots,
+                hasher const& hf,
+                key_equal const& eq,
+                value_allocator const& a) :
+            functions(hf, eq),
+            alloc_(a),
+            shards_()
+        {
+            std::size_t shard_slots = num_slots / shard_count;
+            shard_allocator shard_alloc(alloc_);
+            shard_pointer p =
+                shard_allocator_traits::allocate(shard_alloc, shard_count);
+            shard* s = boost::addressof(*p);
+            std::size_t constructed = 0;
+
+            BOOST_TRY {
+                for (; constructed < shard_count; ++constructed) {
+                    new (static_cast<void*>(s + constructed))
+                        shard(shard_slots, hf, eq, alloc_);
+                }
+            }
+            BOOST_CATCH(...) {
+                while (constructed) s[--constructed].~shard();
+                shard_allocator_traits::deallocate(shard_alloc, p,
+                    shard_count);
+                BOOST_RETHROW;
+            }
+            BOOST_CATCH_END
+
+            shards_ = p;
+        }
+
+        ~concurrent_table()
+        {
+            shard_allocator shard_alloc(alloc_);
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) s[i].~shard();
+            shard_allocator_traits::deallocate(shard_alloc, shards_,
+                shard_count);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Data access
+
+        value_allocator const& value_alloc() const
+        {
+            return alloc_;
+        }
+
+        shard* shards() const
+        {
+            return boost::addressof(*shards_);
+        }
+
+        std::size_t hash(key_type const& k) const
+        {
+            return policy::apply_hash(this->hash_function(), k);
+        }
+
+        shard& shard_for_hash(std::size_t key_hash) const
+        {
+            // Fibonacci hashing, using the top bits of the product.
+            std::size_t const multiplier = 2654435769u;
+            return shards()[(key_hash * multiplier) >>
+                (std::numeric_limits<std::size_t>::digits - shard_bits)];
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Size and capacity
+        //
+        // These lock each shard in turn, so if the table is modified at the
+        // same time, the result might not match any single state of the
+        // table.
+
+        std::size_t size() const
+        {
+            std::size_t n = 0;
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                n += s[i].table_.size_;
+            }
+            return n;
+        }
+
+        std::size_t slot_count() const
+        {
+            std::size_t n = 0;
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                n += s[i].table_.slot_count();
+            }
+            return n;
+        }
+
+        float load_factor() const
+        {
+            std::size_t slots = slot_count();
+            return slots ?
+                static_cast<float>(size()) / static_cast<float>(slots) :
+                0.0f;
+        }
+
+        float max_load_factor() const
+        {
+            scoped_lock lock(shards()[0].mutex_);
+            return shards()[0].table_.mlf_;
+        }
+
+        void max_load_factor(float z)
+        {
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                s[i].table_.max_load_factor(z);
+            }
+        }
+
+        // The elements are not spread perfectly evenly between the shards,
+        // so this is only approximate.
+        void rehash(std::size_t min_slots)
+        {
+            std::size_t shard_slots =
+                (min_slots + shard_count - 1) / shard_count;
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                s[i].table_.rehash(shard_slots);
+            }
+        }
+
+        void reserve(std::size_t n)
+        {
+            std::size_t shard_size = (n + shard_count - 1) / shard_count;
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                s[i].table_.reserve(shard_size);
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Visit
+
+        template <typename F>
+        std::size_t visit(key_type const& k, F& f) const
+        {
+            std::size_t key_hash = hash(k);
+            shard& s = shard_for_hash(key_hash);
+            scoped_lock lock(s.mutex_);
+
+            std::size_t i = s.table_.find_slot(key_hash, k);
+            if (i == s.table_.slot_count()) return 0;
+            f(s.table_.values()[i]);
+            return 1;
+        }
+
+        template <typename F>
+        void for_each(F& f) const
+        {
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                for (typename table::iterator it = s[i].table_.begin(),
+                        e = s[i].table_.end(); it != e; ++it)
+                    f(*it);
+            }
+        }
+
+        std::size_t count(key_type const& k) const
+        {
+            std::size_t key_hash = hash(k);
+            shard& s = shard_for_hash(key_hash);
+            scoped_lock lock(s.mutex_);
+            return s.table_.find_slot(key_hash, k) == s.table_.slot_count() ?
+                0 : 1;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Insert
+
+        struct no_visit
+        {
+            void operator()(value_type&) const {}
+        };
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#   if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        bool emplace(boost::unordered::detail::emplace_args1<
+                boost::unordered::detail::please_ignore_this_overload> const&)
+        {
+            BOOST_ASSERT(false);
+            return false;
+        }
+#   else
+        bool emplace(
+                boost::unordered::detail::please_ignore_this_overload const&)
+        {
+            BOOST_ASSERT(false);
+            return false;
+        }
+#   endif
+#endif
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        bool emplace(BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+            return emplace_impl(
+                extractor::extract(BOOST_UNORDERED_EMPLACE_FORWARD),
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+#else
+            return emplace_impl(
+                extractor::extract(args.a0, args.a1),
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+#endif
+        }
+
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <typename A0>
+        bool emplace(boost::unordered::detail::emplace_args1<A0> const& args)
+        {
+            return emplace_impl(extractor::extract(args.a0), args);
+        }
+#endif
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        bool emplace_impl(key_type const& k, BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            no_visit f;
+            return emplace_or_visit(k, f, BOOST_UNORDERED_EMPLACE_FORWARD);
+        }
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        bool emplace_impl(no_key, BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            // Construct the value before locking, so that the lock isn't
+            // held while the constructor runs.
+            flat_value_holder<value_allocator> a(alloc_);
+            a.construct_with_value(BOOST_UNORDERED_EMPLACE_FORWARD);
+            return emplace_impl(extractor::extract(a.value()),
+                BOOST_UNORDERED_EMPLACE_ARGS1(boost::move(a.value())));
+        }
+
+        // Insert a new element, or call 'f' for the existing element with an
+        // equivalent key.
+        template <typename F, BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        bool emplace_or_visit(key_type const& k, F& f,
+                BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            std::size_t key_hash = hash(k);
+            shard& s = shard_for_hash(key_hash);
+            scoped_lock lock(s.mutex_);
+
+            emplace_return r = s.table_.emplace_hashed(key_hash, k,
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+            if (!r.second) f(*r.first);
+            return r.second;
+        }
+
+        template <class InputIt>
+        void insert_range(InputIt i, InputIt j)
+        {
+            for (; i != j; ++i) emplace_impl(extractor::extract(*i),
+                BOOST_UNORDERED_EMPLACE_ARGS1(*i));
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Erase
+
+        std::size_t erase_key(key_type const& k)
+        {
+            std::size_t key_hash = hash(k);
+            shard& s = shard_for_hash(key_hash);
+            scoped_lock lock(s.mutex_);
+
+            std::size_t i = s.table_.find_slot(key_hash, k);
+            if (i == s.table_.slot_count()) return 0;
+            s.table_.erase_slot(i);
+            return 1;
+        }
+
+        void clear()
+        {
+            shard* s = shards();
+            for (std::size_t i = 0; i < shard_count; ++i) {
+                scoped_lock lock(s[i].mutex_);
+                s[i].table_.clear();
+            }
+        }
+    };
+}}}
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop)
+#endif
+
+#endif
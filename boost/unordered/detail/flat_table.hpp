@@ -0,0 +1,1254 @@
+
+// Copyright (C) 2026 Joshua Napoli
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_UNORDERED_DETAIL_FLAT_TABLE_HPP_INCLUDED
+#define BOOST_UNORDERED_DETAIL_FLAT_TABLE_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <boost/unordered/detail/buckets.hpp>
+#include <boost/unordered/detail/extract_key.hpp>
+#include <boost/unordered/detail/util.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/tuple/tuple.hpp>
+#include <boost/assert.hpp>
+#include <boost/limits.hpp>
+#include <boost/iterator.hpp>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+// The control bytes of each group are compared 16 at a time using SSE2 when
+// it is available.
+#if !defined(BOOST_UNORDERED_DISABLE_SSE2)
+#   if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) \
+        || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#       define BOOST_UNORDERED_FLAT_SSE2
+#       include <emmintrin.h>
+#   endif
+#endif
+
+// Elements are moved rather than copied when the table grows, if moving
+// can't throw.
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES) && \
+    !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES) && \
+    !defined(BOOST_NO_CXX11_NOEXCEPT) && \
+    !defined(BOOST_NO_CXX11_HDR_TYPE_TRAITS)
+#   define BOOST_UNORDERED_FLAT_MOVE_IF_NOEXCEPT
+#endif
+
+#if defined(BOOST_MSVC)
+#pragma warning(push)
+#pragma warning(disable:4127) // conditional expression is constant
+#endif
+
+namespace boost { namespace unordered { namespace detail {
+
+    template <typename Types> struct flat_table;
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Control bytes
+    //
+    // Every slot in a flat table has a control byte. A full slot's control
+    // byte holds the top 7 bits of its element's hash, so that most slots
+    // holding a different key can be skipped without calling the equality
+    // predicate. Empty and deleted slots have the top bit set. The control
+    // bytes are followed by a sentinel, which stops iteration at the end of
+    // the table.
+    //
+    // The slots are split into groups of 16, whose control bytes are
+    // examined together. Probing moves from one group to the next until it
+    // finds a group with an empty slot.
+
+    struct flat_ctrl
+    {
+        enum {
+            empty = 0x80,
+            deleted = 0xfe,
+            sentinel = 0xff
+        };
+
+        static bool is_full(unsigned char c) {
+            return c < empty;
+        }
+
+        static bool is_free(unsigned char c) {
+            return c >= empty && c != sentinel;
+        }
+
+        static unsigned char h2(std::size_t hash) {
+            return static_cast<unsigned char>(
+                hash >> (std::numeric_limits<std::size_t>::digits - 7));
+        }
+    };
+
+    struct flat_group
+    {
+        enum { width = 16 };
+
+#if defined(BOOST_UNORDERED_FLAT_SSE2)
+
+        // Returns a mask with bit i set if control byte i is equal to h.
+        static unsigned int match(unsigned char const* ctrl, unsigned char h)
+        {
+            __m128i g = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(ctrl));
+            return static_cast<unsigned int>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(h)))));
+        }
+
+        // Returns a mask with bit i set if slot i is empty or deleted.
+        static unsigned int match_free(unsigned char const* ctrl)
+        {
+            __m128i g = _mm_loadu_si128(
+                reinterpret_cast<__m128i const*>(ctrl));
+            return static_cast<unsigned int>(_mm_movemask_epi8(g));
+        }
+
+#else
+
+        static unsigned int match(unsigned char const* ctrl, unsigned char h)
+        {
+            unsigned int mask = 0;
+            for (unsigned int i = 0; i < width; ++i)
+                mask |= static_cast<unsigned int>(ctrl[i] == h) << i;
+            return mask;
+        }
+
+        static unsigned int match_free(unsigned char const* ctrl)
+        {
+            unsigned int mask = 0;
+            for (unsigned int i = 0; i < width; ++i)
+                mask |= static_cast<unsigned int>(ctrl[i] >> 7) << i;
+            return mask;
+        }
+
+#endif
+
+        // Returns a mask with bit i set if slot i is empty.
+        static unsigned int match_empty(unsigned char const* ctrl)
+        {
+            return match(ctrl, static_cast<unsigned char>(flat_ctrl::empty));
+        }
+
+        // Index of the lowest set bit in a non-zero mask.
+        static unsigned int lowest(unsigned int mask)
+        {
+            BOOST_ASSERT(mask);
+#if defined(__GNUC__)
+            return static_cast<unsigned int>(__builtin_ctz(mask));
+#else
+            unsigned int i = 0;
+            while (!(mask & 1u)) { mask >>= 1; ++i; }
+            return i;
+#endif
+        }
+    };
+
+}}}
+
+namespace boost { namespace unordered { namespace iterator_detail {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Flat table iterators
+    //
+    // all no throw
+
+    template <typename Value> struct flat_iterator;
+    template <typename Value> struct flat_c_iterator;
+
+    template <typename Value>
+    struct flat_iterator
+        : public boost::iterator<
+            std::forward_iterator_tag,
+            Value,
+            std::ptrdiff_t,
+            Value*,
+            Value&>
+    {
+#if !defined(BOOST_NO_MEMBER_TEMPLATE_FRIENDS)
+        template <typename>
+        friend struct boost::unordered::iterator_detail::flat_c_iterator;
+        template <typename>
+        friend struct boost::unordered::detail::flat_table;
+    private:
+#endif
+        unsigned char const* ctrl_;
+        Value* value_;
+
+    public:
+
+        typedef Value value_type;
+
+        flat_iterator() : ctrl_(), value_() {}
+
+        flat_iterator(unsigned char const* c, Value* v) :
+            ctrl_(c), value_(v) {}
+
+        value_type& operator*() const {
+            return *value_;
+        }
+
+        value_type* operator->() const {
+            return value_;
+        }
+
+        flat_iterator& operator++() {
+            ++ctrl_;
+            ++value_;
+            skip_free();
+            return *this;
+        }
+
+        flat_iterator operator++(int) {
+            flat_iterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(flat_iterator const& x) const {
+            return ctrl_ == x.ctrl_;
+        }
+
+        bool operator!=(flat_iterator const& x) const {
+            return ctrl_ != x.ctrl_;
+        }
+
+        void skip_free() {
+            while (boost::unordered::detail::flat_ctrl::is_free(*ctrl_)) {
+                ++ctrl_;
+                ++value_;
+            }
+        }
+    };
+
+    template <typename Value>
+    struct flat_c_iterator
+        : public boost::iterator<
+            std::forward_iterator_tag,
+            Value,
+            std::ptrdiff_t,
+            Value const*,
+            Value const&>
+    {
+#if !defined(BOOST_NO_MEMBER_TEMPLATE_FRIENDS)
+        template <typename>
+        friend struct boost::unordered::detail::flat_table;
+    private:
+#endif
+        typedef boost::unordered::iterator_detail::flat_iterator<Value>
+            iterator;
+        iterator it_;
+
+    public:
+
+        typedef Value value_type;
+
+        flat_c_iterator() : it_() {}
+
+        flat_c_iterator(iterator const& x) : it_(x) {}
+
+        value_type const& operator*() const {
+            return *it_;
+        }
+
+        value_type const* operator->() const {
+            return it_.operator->();
+        }
+
+        flat_c_iterator& operator++() {
+            ++it_;
+            return *this;
+        }
+
+        flat_c_iterator operator++(int) {
+            flat_c_iterator tmp(*this);
+            ++it_;
+            return tmp;
+        }
+
+        friend bool operator==(flat_c_iterator const& x,
+                flat_c_iterator const& y) {
+            return x.it_ == y.it_;
+        }
+
+        friend bool operator!=(flat_c_iterator const& x,
+                flat_c_iterator const& y) {
+            return x.it_ != y.it_;
+        }
+    };
+}}}
+
+namespace boost { namespace unordered { namespace detail {
+
+    ////////////////////////////////////////////////////////////////////////////
+    // flat_value_holder
+    //
+    // Temporary storage for an element constructed before its key is known.
+
+    template <typename ValueAllocator>
+    struct flat_value_holder
+    {
+        typedef typename allocator_traits<ValueAllocator>::value_type
+            value_type;
+
+        ValueAllocator& alloc_;
+        typename boost::aligned_storage<
+            sizeof(value_type),
+            boost::alignment_of<value_type>::value>::type data_;
+        bool constructed_;
+
+        explicit flat_value_holder(ValueAllocator& a)
+            : alloc_(a), constructed_(false) {}
+
+        ~flat_value_holder() {
+            if (constructed_)
+                boost::unordered::detail::destroy_value_impl(alloc_,
+                    value_ptr());
+        }
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        void construct_with_value(BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            BOOST_ASSERT(!constructed_);
+            boost::unordered::detail::construct_value_impl(
+                alloc_, value_ptr(), BOOST_UNORDERED_EMPLACE_FORWARD);
+            constructed_ = true;
+        }
+
+        value_type* value_ptr() {
+            return static_cast<value_type*>(static_cast<void*>(&data_));
+        }
+
+        value_type& value() {
+            BOOST_ASSERT(constructed_);
+            return *value_ptr();
+        }
+
+    private:
+
+        flat_value_holder(flat_value_holder const&);
+        flat_value_holder& operator=(flat_value_holder const&);
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // Types for the flat containers
+
+    template <typename A, typename T, typename H, typename P>
+    struct flat_set
+    {
+        typedef boost::unordered::detail::flat_set<A, T, H, P> types;
+
+        typedef A allocator;
+        typedef T value_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef T key_type;
+
+        typedef boost::unordered::detail::allocator_traits<allocator> traits;
+        typedef boost::unordered::detail::flat_table<types> table;
+        typedef boost::unordered::detail::set_extractor<value_type> extractor;
+
+        typedef boost::unordered::detail::pick_policy::type policy;
+    };
+
+    template <typename A, typename K, typename M, typename H, typename P>
+    struct flat_map
+    {
+        typedef boost::unordered::detail::flat_map<A, K, M, H, P> types;
+
+        typedef A allocator;
+        typedef std::pair<K const, M> value_type;
+        typedef H hasher;
+        typedef P key_equal;
+        typedef K key_type;
+
+        typedef boost::unordered::detail::allocator_traits<allocator> traits;
+        typedef boost::unordered::detail::flat_table<types> table;
+        typedef boost::unordered::detail::map_extractor<key_type, value_type>
+            extractor;
+
+        typedef boost::unordered::detail::pick_policy::type policy;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////
+    // flat_table
+    //
+    // An open addressing hash table with unique keys. The elements are stored
+    // in one array of slots, and the control bytes in another, so there is no
+    // allocation per element. The number of groups is chosen by the hash
+    // policy, in the same way as the bucket count of the node based tables.
+    //
+    // Iterators and references are invalidated by a rehash.
+
+    template <typename Types>
+    struct flat_table :
+        boost::unordered::detail::functions<
+            typename Types::hasher,
+            typename Types::key_equal>
+    {
+    private:
+        flat_table& operator=(flat_table const&);
+    public:
+        typedef typename Types::hasher hasher;
+        typedef typename Types::key_equal key_equal;
+        typedef typename Types::key_type key_type;
+        typedef typename Types::extractor extractor;
+        typedef typename Types::value_type value_type;
+        typedef typename Types::policy policy;
+
+        typedef boost::unordered::detail::functions<
+            typename Types::hasher,
+            typename Types::key_equal> functions;
+
+        typedef typename Types::allocator allocator;
+        typedef typename boost::unordered::detail::
+            rebind_wrap<allocator, value_type>::type value_allocator;
+        typedef typename boost::unordered::detail::
+            rebind_wrap<allocator, unsigned char>::type ctrl_allocator;
+        typedef boost::unordered::detail::allocator_traits<value_allocator>
+            value_allocator_traits;
+        typedef boost::unordered::detail::allocator_traits<ctrl_allocator>
+            ctrl_allocator_traits;
+        typedef typename value_allocator_traits::pointer value_pointer;
+        typedef typename ctrl_allocator_traits::pointer ctrl_pointer;
+
+        typedef boost::unordered::iterator_detail::
+            flat_iterator<value_type> iterator;
+        typedef boost::unordered::iterator_detail::
+            flat_c_iterator<value_type> c_iterator;
+
+        typedef std::pair<iterator, bool> emplace_return;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Members
+
+        value_allocator alloc_;
+        std::size_t group_count_;
+        std::size_t size_;
+        std::size_t deleted_;
+        float mlf_;
+        std::size_t max_load_;
+        ctrl_pointer ctrl_;
+        value_pointer slots_;
+
+        ////////////////////////////////////////////////////////////////////////
+        // Data access
+
+        value_allocator const& value_alloc() const
+        {
+            return alloc_;
+        }
+
+        value_allocator& value_alloc()
+        {
+            return alloc_;
+        }
+
+        std::size_t slot_count() const
+        {
+            return group_count_ * flat_group::width;
+        }
+
+        std::size_t max_group_count() const
+        {
+            return policy::prev_bucket_count(
+                value_allocator_traits::max_size(alloc_) / flat_group::width);
+        }
+
+        unsigned char* ctrl() const
+        {
+            BOOST_ASSERT(ctrl_);
+            return boost::addressof(*ctrl_);
+        }
+
+        value_type* values() const
+        {
+            BOOST_ASSERT(slots_);
+            return boost::addressof(*slots_);
+        }
+
+        iterator begin() const
+        {
+            if (!size_) return end();
+            iterator it(ctrl(), values());
+            it.skip_free();
+            return it;
+        }
+
+        // The end iterator points to the sentinel, or is null if there's no
+        // storage.
+        iterator end() const
+        {
+            return ctrl_ ?
+                iterator(ctrl() + slot_count(), values() + slot_count()) :
+                iterator();
+        }
+
+        float load_factor() const
+        {
+            return group_count_ ?
+                static_cast<float>(size_) / static_cast<float>(slot_count()) :
+                0.0f;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Load methods
+
+        // The load includes deleted slots, and can never reach the number of
+        // slots, as probing stops at the first group with an empty slot.
+
+        static float maximum_max_load_factor()
+        {
+            return 0.875f;
+        }
+
+        std::size_t max_size() const
+        {
+            using namespace std;
+
+            return boost::unordered::detail::double_to_size(floor(
+                    static_cast<double>(mlf_) *
+                    static_cast<double>(max_group_count()) *
+                    static_cast<double>(flat_group::width)
+                )) - 1;
+        }
+
+        void recalculate_max_load()
+        {
+            using namespace std;
+
+            max_load_ = ctrl_ ? boost::unordered::detail::double_to_size(floor(
+                    static_cast<double>(mlf_) *
+                    static_cast<double>(slot_count())
+                )) : 0;
+        }
+
+        void max_load_factor(float z)
+        {
+            BOOST_ASSERT(z > 0);
+            mlf_ = (std::min)((std::max)(z, minimum_max_load_factor),
+                maximum_max_load_factor());
+            recalculate_max_load();
+        }
+
+        std::size_t min_groups_for_size(std::size_t size) const
+        {
+            using namespace std;
+
+            // size <= mlf_ * slot_count
+            std::size_t slots = boost::unordered::detail::double_to_size(
+                ceil(static_cast<double>(size) /
+                    static_cast<double>(mlf_))) + 1;
+            return policy::new_bucket_count(
+                (slots + flat_group::width - 1) / flat_group::width);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Constructors
+
+        flat_table(std::size_t num_slots,
+                hasher const& hf,
+                key_equal const& eq,
+                value_allocator const& a) :
+            functions(hf, eq),
+            alloc_(a),
+            group_count_(policy::new_bucket_count(
+                (num_slots + flat_group::width - 1) / flat_group::width)),
+            size_(0),
+            deleted_(0),
+            mlf_(maximum_max_load_factor()),
+            max_load_(0),
+            ctrl_(),
+            slots_()
+        {}
+
+        flat_table(flat_table const& x) :
+            functions(x),
+            alloc_(value_allocator_traits::
+                select_on_container_copy_construction(x.alloc_)),
+            group_count_(x.min_groups_for_size(x.size_)),
+            size_(0),
+            deleted_(0),
+            mlf_(x.mlf_),
+            max_load_(0),
+            ctrl_(),
+            slots_()
+        {
+            copy_from(x);
+        }
+
+        flat_table(flat_table const& x, value_allocator const& a) :
+            functions(x),
+            alloc_(a),
+            group_count_(x.min_groups_for_size(x.size_)),
+            size_(0),
+            deleted_(0),
+            mlf_(x.mlf_),
+            max_load_(0),
+            ctrl_(),
+            slots_()
+        {
+            copy_from(x);
+        }
+
+        flat_table(flat_table& x, boost::unordered::detail::move_tag) :
+            functions(x),
+            alloc_(boost::move(x.alloc_)),
+            group_count_(x.group_count_),
+            size_(0),
+            deleted_(0),
+            mlf_(x.mlf_),
+            max_load_(0),
+            ctrl_(),
+            slots_()
+        {
+            take_storage(x);
+        }
+
+        flat_table(flat_table& x, value_allocator const& a,
+                boost::unordered::detail::move_tag) :
+            functions(x),
+            alloc_(a),
+            group_count_(x.group_count_),
+            size_(0),
+            deleted_(0),
+            mlf_(x.mlf_),
+            max_load_(0),
+            ctrl_(),
+            slots_()
+        {
+            if (alloc_ == x.alloc_) {
+                take_storage(x);
+            }
+            else if (x.size_) {
+                group_count_ = x.min_groups_for_size(x.size_);
+                create_storage(group_count_);
+                for (iterator it = x.begin(), e = x.end(); it != e; ++it)
+                    add_unique(*it, true);
+            }
+        }
+
+        ~flat_table()
+        {
+            delete_storage();
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Storage
+
+        // Allocate empty storage, replacing the current storage, which must
+        // already be empty.
+        void create_storage(std::size_t new_group_count)
+        {
+            BOOST_ASSERT(!ctrl_ && !slots_);
+            std::size_t slots = new_group_count * flat_group::width;
+
+            ctrl_allocator ctrl_alloc(alloc_);
+            ctrl_pointer new_ctrl =
+                ctrl_allocator_traits::allocate(ctrl_alloc, slots + 1);
+            BOOST_TRY {
+                slots_ = value_allocator_traits::allocate(alloc_, slots);
+            }
+            BOOST_CATCH(...) {
+                ctrl_allocator_traits::deallocate(ctrl_alloc, new_ctrl,
+                    slots + 1);
+                BOOST_RETHROW;
+            }
+            BOOST_CATCH_END
+
+            ctrl_ = new_ctrl;
+            group_count_ = new_group_count;
+            reset_ctrl();
+            recalculate_max_load();
+        }
+
+        void reset_ctrl()
+        {
+            std::memset(ctrl(), flat_ctrl::empty, slot_count());
+            ctrl()[slot_count()] = static_cast<unsigned char>(
+                flat_ctrl::sentinel);
+            deleted_ = 0;
+        }
+
+        void destroy_values()
+        {
+            if (!size_) return;
+            unsigned char* c = ctrl();
+            value_type* v = values();
+            for (std::size_t i = 0, n = slot_count(); i < n; ++i) {
+                if (flat_ctrl::is_full(c[i]))
+                    boost::unordered::detail::destroy_value_impl(alloc_,
+                        v + i);
+            }
+            size_ = 0;
+        }
+
+        void delete_storage()
+        {
+            if (ctrl_) {
+                destroy_values();
+                deallocate_storage(ctrl_, slots_, slot_count());
+                ctrl_ = ctrl_pointer();
+                slots_ = value_pointer();
+                deleted_ = 0;
+                max_load_ = 0;
+            }
+        }
+
+        void deallocate_storage(ctrl_pointer c, value_pointer v,
+                std::size_t slots)
+        {
+            ctrl_allocator ctrl_alloc(alloc_);
+            ctrl_allocator_traits::deallocate(ctrl_alloc, c, slots + 1);
+            value_allocator_traits::deallocate(alloc_, v, slots);
+        }
+
+        void take_storage(flat_table& x)
+        {
+            BOOST_ASSERT(!ctrl_);
+            ctrl_ = x.ctrl_;
+            slots_ = x.slots_;
+            group_count_ = x.group_count_;
+            size_ = x.size_;
+            deleted_ = x.deleted_;
+            max_load_ = x.max_load_;
+            x.ctrl_ = ctrl_pointer();
+            x.slots_ = value_pointer();
+            x.size_ = 0;
+            x.deleted_ = 0;
+            x.max_load_ = 0;
+        }
+
+        void copy_from(flat_table const& x)
+        {
+            if (!x.size_) return;
+            create_storage(group_count_);
+            for (iterator it = x.begin(), e = x.end(); it != e; ++it)
+                add_unique(*it, false);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Swap and Move
+
+        void swap_allocators(flat_table& other, false_type)
+        {
+            // According to 23.2.1.8, if propagate_on_container_swap is
+            // false the behaviour is undefined unless the allocators
+            // are equal.
+            BOOST_ASSERT(alloc_ == other.alloc_);
+        }
+
+        void swap_allocators(flat_table& other, true_type)
+        {
+            boost::swap(alloc_, other.alloc_);
+        }
+
+        void swap(flat_table& x)
+        {
+            boost::unordered::detail::set_hash_functions<hasher, key_equal>
+                op1(*this, x);
+            boost::unordered::detail::set_hash_functions<hasher, key_equal>
+                op2(x, *this);
+
+            swap_allocators(x,
+                boost::unordered::detail::integral_constant<bool,
+                    allocator_traits<value_allocator>::
+                    propagate_on_container_swap::value>());
+
+            boost::swap(ctrl_, x.ctrl_);
+            boost::swap(slots_, x.slots_);
+            boost::swap(group_count_, x.group_count_);
+            boost::swap(size_, x.size_);
+            boost::swap(deleted_, x.deleted_);
+            std::swap(mlf_, x.mlf_);
+            std::swap(max_load_, x.max_load_);
+            op1.commit();
+            op2.commit();
+        }
+
+        void assign(flat_table const& x)
+        {
+            if (this != boost::addressof(x))
+            {
+                boost::unordered::detail::set_hash_functions<hasher, key_equal>
+                    new_func_this(*this, x);
+
+                // Delete everything with the current allocator before
+                // assigning the new one.
+                delete_storage();
+                if (allocator_traits<value_allocator>::
+                        propagate_on_container_copy_assignment::value)
+                    alloc_ = x.alloc_;
+
+                new_func_this.commit();
+                mlf_ = x.mlf_;
+                group_count_ = min_groups_for_size(x.size_);
+                copy_from(x);
+            }
+        }
+
+        void move_assign(flat_table& x)
+        {
+            if (this != boost::addressof(x))
+            {
+                boost::unordered::detail::set_hash_functions<hasher, key_equal>
+                    new_func_this(*this, x);
+
+                delete_storage();
+                if (allocator_traits<value_allocator>::
+                        propagate_on_container_move_assignment::value)
+                    alloc_ = x.alloc_;
+
+                new_func_this.commit();
+                mlf_ = x.mlf_;
+
+                if (alloc_ == x.alloc_) {
+                    take_storage(x);
+                }
+                else {
+                    group_count_ = min_groups_for_size(x.size_);
+                    if (x.size_) {
+                        create_storage(group_count_);
+                        for (iterator it = x.begin(), e = x.end();
+                                it != e; ++it)
+                            add_unique(*it, true);
+                    }
+                }
+            }
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Find
+
+        template <typename Key, typename Hash>
+        std::size_t hash(Key const& k, Hash const& hf) const
+        {
+            return policy::apply_hash(hf, k);
+        }
+
+        std::size_t hash(key_type const& k) const
+        {
+            return policy::apply_hash(this->hash_function(), k);
+        }
+
+        std::size_t hash_to_group(std::size_t hash) const
+        {
+            return policy::to_bucket(group_count_, hash);
+        }
+
+        std::size_t next_group(std::size_t g) const
+        {
+            return g + 1 == group_count_ ? 0 : g + 1;
+        }
+
+        // Returns the position of the slot holding an element with an
+        // equivalent key, or slot_count() if there isn't one.
+        template <typename Key, typename Pred>
+        std::size_t find_slot(std::size_t key_hash, Key const& k,
+                Pred const& eq) const
+        {
+            if (!size_) return slot_count();
+
+            unsigned char const* c = ctrl();
+            value_type const* v = values();
+            unsigned char h2 = flat_ctrl::h2(key_hash);
+
+            for (std::size_t g = hash_to_group(key_hash);; g = next_group(g))
+            {
+                std::size_t base = g * flat_group::width;
+                unsigned int mask = flat_group::match(c + base, h2);
+                while (mask) {
+                    std::size_t i = base + flat_group::lowest(mask);
+                    if (eq(k, extractor::extract(v[i]))) return i;
+                    mask &= mask - 1;
+                }
+
+                if (flat_group::match_empty(c + base)) return slot_count();
+            }
+        }
+
+        std::size_t find_slot(std::size_t key_hash, key_type const& k) const
+        {
+            return find_slot(key_hash, k, this->key_eq());
+        }
+
+        // Returns the first empty or deleted slot in the probe sequence. The
+        // table must have storage.
+        std::size_t find_free_slot(std::size_t key_hash) const
+        {
+            unsigned char const* c = ctrl();
+
+            for (std::size_t g = hash_to_group(key_hash);; g = next_group(g))
+            {
+                std::size_t base = g * flat_group::width;
+                unsigned int mask = flat_group::match_free(c + base);
+                if (mask) return base + flat_group::lowest(mask);
+            }
+        }
+
+        iterator slot_iterator(std::size_t i) const
+        {
+            return i == slot_count() ? end() :
+                iterator(ctrl() + i, values() + i);
+        }
+
+        template <class Key, class Hash, class Pred>
+        iterator generic_find(Key const& k, Hash const& hf,
+                Pred const& eq) const
+        {
+            if (!size_) return end();
+            return slot_iterator(find_slot(hash(k, hf), k, eq));
+        }
+
+        iterator find(key_type const& k) const
+        {
+            if (!size_) return end();
+            return slot_iterator(find_slot(hash(k), k));
+        }
+
+        std::size_t count(key_type const& k) const
+        {
+            return find(k) == end() ? 0 : 1;
+        }
+
+        value_type& at(key_type const& k) const
+        {
+            if (size_) {
+                iterator it = find(k);
+                if (it != end()) return *it;
+            }
+
+            boost::throw_exception(
+                std::out_of_range("Unable to find key in unordered_flat_map."));
+        }
+
+        std::pair<iterator, iterator>
+            equal_range(key_type const& k) const
+        {
+            iterator n = find(k);
+            iterator e = end();
+            if (n == e) return std::make_pair(e, e);
+            iterator next = n;
+            ++next;
+            return std::make_pair(n, next);
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Reserve and rehash
+
+        // Make sure that there is space for 'size' elements, including any
+        // deleted slots.
+        void reserve_for_insert(std::size_t size)
+        {
+            if (!ctrl_) {
+                create_storage((std::max)(group_count_,
+                    min_groups_for_size(size)));
+            }
+            else if (size + deleted_ > max_load_) {
+                rehash_impl(min_groups_for_size(size));
+            }
+        }
+
+        void rehash(std::size_t min_slots)
+        {
+            using namespace std;
+
+            std::size_t min_groups = policy::new_bucket_count(
+                (min_slots + flat_group::width - 1) / flat_group::width);
+
+            if (!size_) {
+                delete_storage();
+                group_count_ = min_groups;
+            }
+            else {
+                min_groups = (std::max)(min_groups,
+                    min_groups_for_size(size_));
+
+                if (min_groups != group_count_ || deleted_)
+                    rehash_impl(min_groups);
+            }
+        }
+
+        void reserve(std::size_t n)
+        {
+            rehash(static_cast<std::size_t>(
+                std::ceil(static_cast<double>(n) /
+                    static_cast<double>(mlf_))));
+        }
+
+        // Move the elements to new storage, dropping any deleted slots.
+        //
+        // Strong exception safety if elements are copied. When elements can
+        // be moved without throwing, they're moved instead, so if the hash
+        // function throws the elements that were already moved are left in a
+        // valid but unspecified state.
+        void rehash_impl(std::size_t new_group_count)
+        {
+            flat_table dst(new_group_count * flat_group::width,
+                this->hash_function(), this->key_eq(), alloc_);
+            dst.mlf_ = mlf_;
+            dst.create_storage(new_group_count);
+
+            if (size_) {
+                unsigned char const* c = ctrl();
+                value_type* v = values();
+                for (std::size_t i = 0, n = slot_count(); i < n; ++i) {
+                    if (flat_ctrl::is_full(c[i])) dst.transfer(v[i]);
+                }
+            }
+
+            destroy_values();
+            deallocate_storage(ctrl_, slots_, slot_count());
+            ctrl_ = dst.ctrl_;
+            slots_ = dst.slots_;
+            group_count_ = dst.group_count_;
+            size_ = dst.size_;
+            deleted_ = 0;
+            max_load_ = dst.max_load_;
+            dst.ctrl_ = ctrl_pointer();
+            dst.slots_ = value_pointer();
+            dst.size_ = 0;
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Insert
+
+        // Add an element that isn't already in the table, which must have
+        // enough space for it.
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        std::size_t add_value(std::size_t key_hash,
+                BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            std::size_t i = find_free_slot(key_hash);
+            boost::unordered::detail::construct_value_impl(
+                alloc_, values() + i, BOOST_UNORDERED_EMPLACE_FORWARD);
+
+            unsigned char& c = ctrl()[i];
+            if (c == flat_ctrl::deleted) --deleted_;
+            c = flat_ctrl::h2(key_hash);
+            ++size_;
+            return i;
+        }
+
+        // Used when copying elements from a table with unique keys, so no
+        // lookup is needed.
+        void add_unique(value_type& v, bool move)
+        {
+            std::size_t key_hash = hash(extractor::extract(v));
+            if (move)
+                add_value(key_hash,
+                    BOOST_UNORDERED_EMPLACE_ARGS1(boost::move(v)));
+            else
+                add_value(key_hash, BOOST_UNORDERED_EMPLACE_ARGS1(
+                    const_cast<value_type const&>(v)));
+        }
+
+        void transfer(value_type& v)
+        {
+#if defined(BOOST_UNORDERED_FLAT_MOVE_IF_NOEXCEPT)
+            std::size_t key_hash = hash(extractor::extract(v));
+            add_value(key_hash, std::move_if_noexcept(v));
+#else
+            add_unique(v, false);
+#endif
+        }
+
+        value_type& operator[](key_type const& k)
+        {
+            std::size_t key_hash = this->hash(k);
+            std::size_t i = find_slot(key_hash, k);
+            if (i != slot_count()) return values()[i];
+
+            reserve_for_insert(size_ + 1);
+            i = add_value(key_hash, BOOST_UNORDERED_EMPLACE_ARGS3(
+                boost::unordered::piecewise_construct,
+                boost::make_tuple(k),
+                boost::make_tuple()));
+            return values()[i];
+        }
+
+#if defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+#   if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        emplace_return emplace(boost::unordered::detail::emplace_args1<
+                boost::unordered::detail::please_ignore_this_overload> const&)
+        {
+            BOOST_ASSERT(false);
+            return emplace_return(this->begin(), false);
+        }
+#   else
+        emplace_return emplace(
+                boost::unordered::detail::please_ignore_this_overload const&)
+        {
+            BOOST_ASSERT(false);
+            return emplace_return(this->begin(), false);
+        }
+#   endif
+#endif
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        emplace_return emplace(BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+#if !defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+            return emplace_impl(
+                extractor::extract(BOOST_UNORDERED_EMPLACE_FORWARD),
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+#else
+            return emplace_impl(
+                extractor::extract(args.a0, args.a1),
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+#endif
+        }
+
+#if defined(BOOST_NO_CXX11_VARIADIC_TEMPLATES)
+        template <typename A0>
+        emplace_return emplace(
+                boost::unordered::detail::emplace_args1<A0> const& args)
+        {
+            return emplace_impl(extractor::extract(args.a0), args);
+        }
+#endif
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        emplace_return emplace_impl(key_type const& k,
+            BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            return emplace_hashed(this->hash(k), k,
+                BOOST_UNORDERED_EMPLACE_FORWARD);
+        }
+
+        // Used when the hash has already been calculated.
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        emplace_return emplace_hashed(std::size_t key_hash, key_type const& k,
+            BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            std::size_t i = find_slot(key_hash, k);
+
+            if (i != slot_count())
+                return emplace_return(slot_iterator(i), false);
+
+            // If the constructor throws after a rehash, the elements are
+            // unchanged but iterators are invalidated.
+            reserve_for_insert(size_ + 1);
+            i = add_value(key_hash, BOOST_UNORDERED_EMPLACE_FORWARD);
+            return emplace_return(slot_iterator(i), true);
+        }
+
+        template <BOOST_UNORDERED_EMPLACE_TEMPLATE>
+        emplace_return emplace_impl(no_key, BOOST_UNORDERED_EMPLACE_ARGS)
+        {
+            // Don't have a key, so construct the value first in order
+            // to be able to lookup the position.
+            flat_value_holder<value_allocator> a(alloc_);
+            a.construct_with_value(BOOST_UNORDERED_EMPLACE_FORWARD);
+            return emplace_impl(extractor::extract(a.value()),
+                BOOST_UNORDERED_EMPLACE_ARGS1(boost::move(a.value())));
+        }
+
+        template <class InputIt>
+        void insert_range(InputIt i, InputIt j)
+        {
+            if (i == j) return;
+
+            std::size_t n = boost::unordered::detail::insert_size(i, j);
+            if (size_ + n > max_load_) reserve_for_insert(size_ + n);
+
+            for (; i != j; ++i) emplace_impl(extractor::extract(*i),
+                BOOST_UNORDERED_EMPLACE_ARGS1(*i));
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Erase
+
+        // A slot can be marked empty if its group has another empty slot, as
+        // a probe can't have passed through that group. Otherwise it's
+        // marked as deleted, so that probes continue past it.
+        void erase_slot(std::size_t i)
+        {
+            unsigned char* c = ctrl();
+            boost::unordered::detail::destroy_value_impl(alloc_, values() + i);
+            --size_;
+
+            std::size_t base = i - i % flat_group::width;
+            if (flat_group::match_empty(c + base)) {
+                c[i] = static_cast<unsigned char>(flat_ctrl::empty);
+            }
+            else {
+                c[i] = static_cast<unsigned char>(flat_ctrl::deleted);
+                ++deleted_;
+            }
+        }
+
+        std::size_t slot_index(c_iterator it) const
+        {
+            return static_cast<std::size_t>(it.it_.ctrl_ - ctrl());
+        }
+
+        iterator erase(c_iterator r)
+        {
+            BOOST_ASSERT(r != c_iterator(end()));
+            std::size_t i = slot_index(r);
+            iterator next(ctrl() + i + 1, values() + i + 1);
+            next.skip_free();
+            erase_slot(i);
+            return next;
+        }
+
+        iterator erase_range(c_iterator r1, c_iterator r2)
+        {
+            if (r1 == r2) return r2.it_;
+            std::size_t end_index = r2 == c_iterator(end()) ?
+                slot_count() : slot_index(r2);
+            unsigned char const* c = ctrl();
+            for (std::size_t i = slot_index(r1); i != end_index; ++i)
+                if (flat_ctrl::is_full(c[i])) erase_slot(i);
+            return slot_iterator(end_index);
+        }
+
+        std::size_t erase_key(key_type const& k)
+        {
+            if (!size_) return 0;
+            std::size_t i = find_slot(hash(k), k);
+            if (i == slot_count()) return 0;
+            erase_slot(i);
+            return 1;
+        }
+
+        void clear()
+        {
+            if (!ctrl_) return;
+            destroy_values();
+            reset_ctrl();
+        }
+
+        ////////////////////////////////////////////////////////////////////////
+        // Equality
+
+        bool equals(flat_table const& other) const
+        {
+            if (size_ != other.size_) return false;
+
+            for (iterator it = begin(), e = end(); it != e; ++it)
+            {
+                iterator other_pos = other.find(extractor::extract(*it));
+                if (other_pos == other.end() || !(*it == *other_pos))
+                    return false;
+            }
+
+            return true;
+        }
+    };
+}}}
+
+#if defined(BOOST_MSVC)
+#pragma warning(pop)
+#endif
+
+#endif
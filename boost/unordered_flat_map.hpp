@@ -0,0 +1,17 @@
+
+// Copyright (C) 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+//  See http://www.boost.org/libs/unordered for documentation
+
+#ifndef BOOST_UNORDERED_FLAT_MAP_HPP_INCLUDED
+#define BOOST_UNORDERED_FLAT_MAP_HPP_INCLUDED
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1020)
+# pragma once
+#endif
+
+#include <boost/unordered/unordered_flat_map.hpp>
+
+#endif // BOOST_UNORDERED_FLAT_MAP_HPP_INCLUDED
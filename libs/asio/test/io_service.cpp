@@ -17,6 +17,7 @@
 #include <boost/asio/io_service.hpp>
 
 #include <sstream>
+#include <boost/detail/atomic_count.hpp>
 #include <boost/thread/thread.hpp>
 #include <boost/bind.hpp>
 #include <boost/asio/deadline_timer.hpp>
@@ -254,6 +255,154 @@ void io_service_test()
   BOOST_CHECK(exception_count == 2);
 }
 
+void atomic_increment(boost::detail::atomic_count* count)
+{
+  ++(*count);
+}
+
+void fan_out(io_service* ios, int depth, boost::detail::atomic_count* count)
+{
+  ++(*count);
+  if (depth > 0)
+  {
+    ios->post(boost::bind(fan_out, ios, depth - 1, count));
+    ios->post(boost::bind(fan_out, ios, depth - 1, count));
+  }
+}
+
+void io_service_work_stealing_test()
+{
+  io_service ios(BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING_THREADS(4));
+  int count = 10;
+
+  ios.post(boost::bind(decrement_to_zero, &ios, &count));
+
+  // No handlers can be called until run() is called.
+  BOOST_CHECK(!ios.stopped());
+  BOOST_CHECK(count == 10);
+
+  ios.run();
+
+  // Handlers posted from within a handler are run by the same thread.
+  BOOST_CHECK(ios.stopped());
+  BOOST_CHECK(count == 0);
+
+  // Each fan_out handler posts two more from within the handler, so most of
+  // the handlers must be stolen from the thread-local queues.
+  boost::detail::atomic_count fan_out_count(0);
+  ios.reset();
+  ios.post(boost::bind(fan_out, &ios, 12, &fan_out_count));
+  ios.post(boost::bind(fan_out, &ios, 12, &fan_out_count));
+  boost::thread thread1(boost::bind(io_service_run, &ios));
+  boost::thread thread2(boost::bind(io_service_run, &ios));
+  boost::thread thread3(boost::bind(io_service_run, &ios));
+  boost::thread thread4(boost::bind(io_service_run, &ios));
+  boost::thread thread5(boost::bind(io_service_run, &ios));
+  thread1.join();
+  thread2.join();
+  thread3.join();
+  thread4.join();
+  thread5.join();
+
+  // The run() calls will not return until all work has finished.
+  BOOST_CHECK(ios.stopped());
+  BOOST_CHECK(fan_out_count == 2 * ((1 << 13) - 1));
+
+  // Threads parked waiting for work must wake up when the io_service stops.
+  count = 0;
+  ios.reset();
+  io_service::work* w = new io_service::work(ios);
+  boost::thread thread6(boost::bind(io_service_run, &ios));
+  boost::thread thread7(boost::bind(io_service_run, &ios));
+  ios.post(boost::bind(increment, &count));
+  ios.post(boost::bind(&io_service::stop, &ios));
+  thread6.join();
+  thread7.join();
+  BOOST_CHECK(ios.stopped());
+  delete w;
+
+  // Handlers left on the thread-local queues are still delivered by poll().
+  boost::detail::atomic_count poll_count(0);
+  ios.reset();
+  ios.post(boost::bind(fan_out, &ios, 3, &poll_count));
+  ios.run_one();
+  BOOST_CHECK(poll_count == 1);
+  ios.poll();
+  BOOST_CHECK(ios.stopped());
+  BOOST_CHECK(poll_count == 15);
+
+  // Exceptions propagate out of run() without losing queued handlers.
+  boost::detail::atomic_count handler_count(0);
+  int exception_count = 0;
+  ios.reset();
+  ios.post(&throw_exception);
+  ios.post(boost::bind(atomic_increment, &handler_count));
+  ios.post(boost::bind(atomic_increment, &handler_count));
+  ios.post(&throw_exception);
+  ios.post(boost::bind(atomic_increment, &handler_count));
+
+  for (;;)
+  {
+    try
+    {
+      ios.run();
+      break;
+    }
+    catch (int)
+    {
+      ++exception_count;
+    }
+  }
+
+  BOOST_CHECK(ios.stopped());
+  BOOST_CHECK(handler_count == 3);
+  BOOST_CHECK(exception_count == 2);
+}
+
+void batch_member(io_service* ios, int rounds, int* remaining);
+
+void post_batch(io_service* ios, int rounds, int* remaining)
+{
+  *remaining = 4;
+  for (int i = 0; i < 4; ++i)
+    ios->post(boost::bind(batch_member, ios, rounds, remaining));
+}
+
+void batch_member(io_service* ios, int rounds, int* remaining)
+{
+  if (--*remaining == 0 && rounds > 0)
+    post_batch(ios, rounds - 1, remaining);
+}
+
+void io_service_handler_allocation_test()
+{
+  io_service ios;
+  int remaining = 0;
+
+  handler_allocation_counters before = get_handler_allocation_counters();
+
+  // Each batch has four handlers outstanding at once. The memory freed by one
+  // batch must be reused by the next.
+  post_batch(&ios, 100, &remaining);
+  ios.run();
+  BOOST_CHECK(remaining == 0);
+
+  // The thread's counts are added to the totals when run() returns.
+  handler_allocation_counters after = get_handler_allocation_counters();
+
+#if !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
+  boost::uint64_t hits = after.hits - before.hits;
+  boost::uint64_t misses = after.misses - before.misses;
+  BOOST_CHECK(hits + misses == 400);
+  BOOST_CHECK(hits > misses * 10);
+  BOOST_CHECK(after.overflows == before.overflows);
+#else // !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
+  BOOST_CHECK(after.hits == 0);
+  BOOST_CHECK(after.misses == 0);
+  BOOST_CHECK(after.overflows == 0);
+#endif // !defined(BOOST_ASIO_DISABLE_SMALL_BLOCK_RECYCLING)
+}
+
 class test_service : public boost::asio::io_service::service
 {
 public:
@@ -324,10 +473,132 @@ void io_service_service_test()
   BOOST_CHECK(!boost::asio::has_service<test_service>(ios3));
 }
 
+void record_metrics(io_service* ios, io_service_metrics* metrics)
+{
+  *metrics = ios->get_metrics();
+}
+
+boost::uint64_t histogram_total(const boost::uint64_t* histogram)
+{
+  boost::uint64_t total = 0;
+  for (int i = 0; i < io_service_metrics::histogram_buckets; ++i)
+    total += histogram[i];
+  return total;
+}
+
+void record_thread_metrics(io_service* ios,
+    std::vector<io_service_metrics>* metrics)
+{
+  *metrics = ios->get_thread_metrics();
+}
+
+void io_service_metrics_idle_test(std::size_t concurrency_hint)
+{
+  io_service ios(concurrency_hint);
+  boost::detail::atomic_count count(0);
+
+  // Keep a thread running the io_service, so that it goes idle instead of
+  // returning from run().
+  io_service::work* work = new io_service::work(ios);
+  boost::thread thread1(boost::bind(io_service_run, &ios));
+
+  for (int i = 0; i < 10; ++i)
+    ios.post(boost::bind(atomic_increment, &count));
+
+  // The thread adds its counts to the totals before it blocks.
+  io_service_metrics metrics = io_service_metrics();
+  for (int i = 0; i < 10000 && metrics.handlers_run < 10; ++i)
+  {
+    boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+    metrics = ios.get_metrics();
+  }
+  BOOST_CHECK(count == 10);
+  BOOST_CHECK(metrics.handlers_run == 10);
+
+  std::vector<io_service_metrics> thread_metrics = ios.get_thread_metrics();
+  BOOST_CHECK(thread_metrics.size() == 1);
+  if (thread_metrics.size() == 1)
+    BOOST_CHECK(thread_metrics[0].handlers_run == 10);
+
+  // A handler sees its own thread's entry.
+  ios.post(boost::bind(record_thread_metrics, &ios, &thread_metrics));
+
+  delete work;
+  thread1.join();
+
+  BOOST_CHECK(thread_metrics.size() == 1);
+  if (thread_metrics.size() == 1)
+    BOOST_CHECK(thread_metrics[0].handlers_run == 10);
+
+  // Threads that have returned from run() are no longer listed.
+  BOOST_CHECK(ios.get_thread_metrics().empty());
+  BOOST_CHECK(ios.get_metrics().handlers_run == 11);
+}
+
+void io_service_metrics_test()
+{
+#if !defined(BOOST_ASIO_HAS_IOCP)
+  io_service ios(BOOST_ASIO_CONCURRENCY_HINT(
+        BOOST_ASIO_CONCURRENCY_HINT_METRICS, 1));
+  int count = 0;
+
+  for (int i = 0; i < 100; ++i)
+    ios.post(boost::bind(increment, &count));
+
+  io_service_metrics metrics = ios.get_metrics();
+  BOOST_CHECK(metrics.handlers_run == 0);
+  BOOST_CHECK(metrics.queue_depth == 100);
+  BOOST_CHECK(metrics.outstanding_work == 100);
+
+  // A handler sees the counts for the handlers run before it on its thread.
+  io_service_metrics inside_metrics = io_service_metrics();
+  ios.post(boost::bind(record_metrics, &ios, &inside_metrics));
+
+  deadline_timer t(ios, boost::posix_time::milliseconds(10));
+  t.async_wait(boost::bind(increment, &count));
+
+  ios.run();
+  BOOST_CHECK(count == 101);
+  BOOST_CHECK(inside_metrics.handlers_run == 100);
+
+  metrics = ios.get_metrics();
+  BOOST_CHECK(metrics.handlers_run == 102);
+  BOOST_CHECK(metrics.queue_depth == 0);
+  BOOST_CHECK(metrics.outstanding_work == 0);
+  BOOST_CHECK(metrics.reactor_waits > 0);
+#if defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  BOOST_CHECK(histogram_total(metrics.scheduling_delay) == 102);
+  BOOST_CHECK(histogram_total(metrics.execution_time) == 102);
+#else // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+  // The hint has no effect unless handler timing is compiled in.
+  BOOST_CHECK(histogram_total(metrics.scheduling_delay) == 0);
+  BOOST_CHECK(histogram_total(metrics.execution_time) == 0);
+#endif // defined(BOOST_ASIO_ENABLE_HANDLER_TIMING)
+
+  // Without the hint, handlers are counted but not timed.
+  io_service ios2;
+  for (int i = 0; i < 10; ++i)
+    ios2.post(boost::bind(increment, &count));
+  ios2.run();
+
+  metrics = ios2.get_metrics();
+  BOOST_CHECK(metrics.handlers_run == 10);
+  BOOST_CHECK(histogram_total(metrics.scheduling_delay) == 0);
+  BOOST_CHECK(histogram_total(metrics.execution_time) == 0);
+
+  io_service_metrics_idle_test(0);
+  io_service_metrics_idle_test(
+      BOOST_ASIO_CONCURRENCY_HINT_WORK_STEALING_THREADS(2));
+#endif // !defined(BOOST_ASIO_HAS_IOCP)
+}
+
 test_suite* init_unit_test_suite(int, char*[])
 {
   test_suite* test = BOOST_TEST_SUITE("io_service");
   test->add(BOOST_TEST_CASE(&io_service_test));
+  test->add(BOOST_TEST_CASE(&io_service_work_stealing_test));
+  test->add(BOOST_TEST_CASE(&io_service_handler_allocation_test));
+  test->add(BOOST_TEST_CASE(&io_service_metrics_test));
   test->add(BOOST_TEST_CASE(&io_service_service_test));
   return test;
 }
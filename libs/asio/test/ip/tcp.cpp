@@ -21,7 +21,13 @@
 
 #include <boost/array.hpp>
 #include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
 #include <cstring>
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+# include <stdlib.h>
+# include <unistd.h>
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+#include <boost/asio/deadline_timer.hpp>
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/placeholders.hpp>
 #include <boost/asio/read.hpp>
@@ -370,6 +376,12 @@ void test()
     socket1.async_read_some(buffer(mutable_char_buffer), &read_some_handler);
     socket1.async_read_some(mutable_buffers, &read_some_handler);
     socket1.async_read_some(null_buffers(), &read_some_handler);
+
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+    socket1.async_send_file(0, 0, 0, &write_some_handler);
+    socket1.send_file(0, 0, 0, ec);
+    socket1.send_file(0, 0, 0);
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
   }
   catch (std::exception&)
   {
@@ -544,10 +556,190 @@ void test()
   BOOST_CHECK(read_eof_completed);
 }
 
+// Destroying the io_service while a read is outstanding must not invoke its
+// handler, and must wait until the read's buffer is no longer in use.
+void test_outstanding_at_shutdown()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  static char read_buffer[1024];
+  bool read_called = false;
+
+  {
+    io_service ios;
+
+    ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+    ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+    server_endpoint.address(ip::address_v4::loopback());
+
+    ip::tcp::socket client_side_socket(ios);
+    ip::tcp::socket server_side_socket(ios);
+
+    client_side_socket.connect(server_endpoint);
+    acceptor.accept(server_side_socket);
+
+    server_side_socket.async_read_some(buffer(read_buffer),
+        boost::bind(handle_read, placeholders::error,
+          placeholders::bytes_transferred, &read_called));
+
+    ios.poll();
+  }
+
+  BOOST_CHECK(!read_called);
+}
+
 } // namespace ip_tcp_socket_runtime
 
 //------------------------------------------------------------------------------
 
+// ip_tcp_send_file_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the send_file and
+// async_send_file member functions of ip::tcp::socket.
+
+namespace ip_tcp_send_file_runtime {
+
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+
+static const char file_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+void handle_send_file(const boost::system::error_code& err,
+    size_t bytes_transferred, boost::system::error_code* out_err,
+    size_t* out_bytes_transferred)
+{
+  *out_err = err;
+  *out_bytes_transferred = bytes_transferred;
+}
+
+void test()
+{
+  using namespace std; // For memcmp.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  char file_name[] = "/tmp/asio_send_file_XXXXXX";
+  int fd = ::mkstemp(file_name);
+  BOOST_REQUIRE(fd != -1);
+  ::unlink(file_name);
+  BOOST_REQUIRE(::write(fd, file_data, sizeof(file_data))
+      == static_cast<ssize_t>(sizeof(file_data)));
+
+  io_service ios;
+
+  ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ios);
+  ip::tcp::socket server_side_socket(ios);
+
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  char read_buffer[sizeof(file_data)];
+  boost::system::error_code error;
+  size_t length = 0;
+
+  // Asynchronous send of part of the file.
+
+  error = boost::asio::error::would_block;
+  client_side_socket.async_send_file(fd, 10, 26,
+      boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &error, &length));
+
+  ios.run();
+  BOOST_CHECK(!error);
+  BOOST_CHECK(length == 26);
+
+  boost::asio::read(server_side_socket, buffer(read_buffer, 26));
+  BOOST_CHECK(memcmp(read_buffer, file_data + 10, 26) == 0);
+
+  // Asynchronous send past the end of the file.
+
+  ios.reset();
+  error = boost::asio::error::would_block;
+  client_side_socket.async_send_file(fd, sizeof(file_data) - 5, 20,
+      boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &error, &length));
+
+  ios.run();
+  BOOST_CHECK(error == boost::asio::error::eof);
+  BOOST_CHECK(length == 5);
+
+  boost::asio::read(server_side_socket, buffer(read_buffer, 5));
+  BOOST_CHECK(memcmp(read_buffer, file_data + sizeof(file_data) - 5, 5) == 0);
+
+  // Synchronous send of the whole file.
+
+  length = client_side_socket.send_file(fd, 0, sizeof(file_data));
+  BOOST_CHECK(length == sizeof(file_data));
+
+  boost::asio::read(server_side_socket, buffer(read_buffer));
+  BOOST_CHECK(memcmp(read_buffer, file_data, sizeof(file_data)) == 0);
+
+  ::close(fd);
+
+  // Asynchronous send from a pipe that holds more than the socket buffers,
+  // so that the operation must wait for the socket to become writable.
+
+  int pipe_fds[2];
+  BOOST_REQUIRE(::pipe(pipe_fds) == 0);
+
+  static char pipe_data[48 * 1024];
+  for (size_t i = 0; i < sizeof(pipe_data); ++i)
+    pipe_data[i] = file_data[i % (sizeof(file_data) - 1)];
+  BOOST_REQUIRE(::write(pipe_fds[1], pipe_data, sizeof(pipe_data))
+      == static_cast<ssize_t>(sizeof(pipe_data)));
+
+  client_side_socket.set_option(socket_base::send_buffer_size(4096));
+  server_side_socket.set_option(socket_base::receive_buffer_size(4096));
+
+  ios.reset();
+  error = boost::asio::error::would_block;
+  client_side_socket.async_send_file(pipe_fds[0], 0, sizeof(pipe_data),
+      boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &error, &length));
+
+  static char pipe_read_buffer[sizeof(pipe_data)];
+  boost::system::error_code read_error = boost::asio::error::would_block;
+  size_t read_length = 0;
+  boost::asio::async_read(server_side_socket, buffer(pipe_read_buffer),
+      boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &read_error, &read_length));
+
+  ios.run();
+  BOOST_CHECK(!error);
+  BOOST_CHECK(length == sizeof(pipe_data));
+  BOOST_CHECK(!read_error);
+  BOOST_CHECK(read_length == sizeof(pipe_data));
+  BOOST_CHECK(memcmp(pipe_read_buffer, pipe_data, sizeof(pipe_data)) == 0);
+
+  ::close(pipe_fds[0]);
+  ::close(pipe_fds[1]);
+}
+
+#else // defined(BOOST_ASIO_HAS_SENDFILE)
+
+void test()
+{
+}
+
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+
+} // namespace ip_tcp_send_file_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_tcp_acceptor_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -559,6 +751,10 @@ void accept_handler(const boost::system::error_code&)
 {
 }
 
+void accept_batch_handler(const boost::system::error_code&, std::size_t)
+{
+}
+
 void test()
 {
   using namespace boost::asio;
@@ -674,6 +870,16 @@ void test()
 
     acceptor1.async_accept(peer_socket, &accept_handler);
     acceptor1.async_accept(peer_socket, peer_endpoint, &accept_handler);
+
+#if !defined(BOOST_ASIO_HAS_IOCP)
+    ip::tcp::socket* peer_sockets[1] = { &peer_socket };
+    std::size_t accepted1 = acceptor1.accept_batch(peer_sockets, 1);
+    (void)accepted1;
+    std::size_t accepted2 = acceptor1.accept_batch(peer_sockets, 1, ec);
+    (void)accepted2;
+
+    acceptor1.async_accept_batch(peer_sockets, 1, &accept_batch_handler);
+#endif // !defined(BOOST_ASIO_HAS_IOCP)
   }
   catch (std::exception&)
   {
@@ -764,6 +970,393 @@ void test()
 
 //------------------------------------------------------------------------------
 
+// ip_tcp_accept_batch_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the accept_batch and
+// async_accept_batch functions of ip::tcp::acceptor, and of
+// ip::tcp::reuse_port_acceptor.
+
+namespace ip_tcp_accept_batch_runtime {
+
+#if !defined(BOOST_ASIO_HAS_IOCP)
+
+const int num_sockets = 4;
+
+void handle_accept_batch(const boost::system::error_code& err,
+    std::size_t connections_accepted, boost::system::error_code* out_err,
+    std::size_t* out_connections_accepted)
+{
+  *out_err = err;
+  *out_connections_accepted = connections_accepted;
+}
+
+void close_all(boost::asio::ip::tcp::socket** sockets, int count)
+{
+  for (int i = 0; i < count; ++i)
+    sockets[i]->close();
+}
+
+void test()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  io_service ios;
+
+  ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket* client_sockets[num_sockets];
+  ip::tcp::socket* server_sockets[num_sockets];
+  for (int i = 0; i < num_sockets; ++i)
+  {
+    client_sockets[i] = new ip::tcp::socket(ios);
+    server_sockets[i] = new ip::tcp::socket(ios);
+  }
+
+  // Connections that are already pending are all accepted at once.
+  for (int i = 0; i < 3; ++i)
+    client_sockets[i]->connect(server_endpoint);
+
+  std::size_t n = acceptor.accept_batch(server_sockets, num_sockets);
+  BOOST_CHECK(n == 3);
+  for (int i = 0; i < 3; ++i)
+  {
+    BOOST_CHECK(server_sockets[i]->is_open());
+    BOOST_CHECK(server_sockets[i]->remote_endpoint()
+        == client_sockets[i]->local_endpoint());
+  }
+  BOOST_CHECK(!server_sockets[3]->is_open());
+
+  // A socket that is already open cannot be used.
+  boost::system::error_code ec;
+  n = acceptor.accept_batch(server_sockets, num_sockets, ec);
+  BOOST_CHECK(ec == boost::asio::error::already_open);
+  BOOST_CHECK(n == 0);
+
+  close_all(client_sockets, num_sockets);
+  close_all(server_sockets, num_sockets);
+
+  // With nothing pending, a non-blocking acceptor reports would_block.
+  acceptor.non_blocking(true);
+  n = acceptor.accept_batch(server_sockets, num_sockets, ec);
+  BOOST_CHECK(ec == boost::asio::error::would_block);
+  BOOST_CHECK(n == 0);
+  acceptor.non_blocking(false);
+
+  for (int i = 0; i < 2; ++i)
+    client_sockets[i]->connect(server_endpoint);
+
+  std::size_t async_n = 0;
+  acceptor.async_accept_batch(server_sockets, num_sockets,
+      boost::bind(handle_accept_batch, _1, _2, &ec, &async_n));
+
+  ios.run();
+
+  BOOST_CHECK(!ec);
+  BOOST_CHECK(async_n == 2);
+  BOOST_CHECK(server_sockets[0]->is_open());
+  BOOST_CHECK(server_sockets[1]->is_open());
+  BOOST_CHECK(!server_sockets[2]->is_open());
+
+  close_all(client_sockets, num_sockets);
+  close_all(server_sockets, num_sockets);
+
+  // A connection that cannot be assigned to its socket is closed, and the
+  // error is reported along with the connections already accepted.
+  ios.reset();
+  async_n = 0;
+  acceptor.async_accept_batch(server_sockets, num_sockets,
+      boost::bind(handle_accept_batch, _1, _2, &ec, &async_n));
+  server_sockets[1]->open(ip::tcp::v4());
+  for (int i = 0; i < 2; ++i)
+    client_sockets[i]->connect(server_endpoint);
+
+  ios.run();
+
+  BOOST_CHECK(ec == boost::asio::error::already_open);
+  BOOST_CHECK(async_n == 1);
+  BOOST_CHECK(server_sockets[0]->is_open());
+  BOOST_CHECK(server_sockets[0]->remote_endpoint()
+      == client_sockets[0]->local_endpoint());
+  char data = 0;
+  client_sockets[1]->read_some(boost::asio::buffer(&data, 1), ec);
+  BOOST_CHECK(ec == boost::asio::error::eof
+      || ec == boost::asio::error::connection_reset);
+
+  close_all(client_sockets, num_sockets);
+  close_all(server_sockets, num_sockets);
+
+#if defined(BOOST_ASIO_HAS_REUSE_PORT)
+  // Connections to a group of acceptors are spread across its members, each
+  // on its own io_service.
+  io_service ios1, ios2;
+  ip::tcp::reuse_port_acceptor group(ip::tcp::endpoint(ip::tcp::v4(), 0));
+  group.add(ios1);
+  group.add(ios2);
+  BOOST_CHECK(group.size() == 2);
+  BOOST_CHECK(group.local_endpoint().port() != 0);
+  BOOST_CHECK(group.acceptor(1).local_endpoint() == group.local_endpoint());
+  BOOST_CHECK(&group.acceptor(0).get_io_service() == &ios1);
+  BOOST_CHECK(&group.acceptor(1).get_io_service() == &ios2);
+
+  server_endpoint = group.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+  for (int i = 0; i < num_sockets; ++i)
+    client_sockets[i]->connect(server_endpoint);
+
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < group.size(); ++i)
+  {
+    group.acceptor(i).non_blocking(true);
+    total += group.acceptor(i).accept_batch(
+        server_sockets + total, num_sockets - total, ec);
+  }
+  BOOST_CHECK(total == num_sockets);
+
+  group.close();
+  BOOST_CHECK(!group.acceptor(0).is_open());
+  BOOST_CHECK(!group.acceptor(1).is_open());
+#endif // defined(BOOST_ASIO_HAS_REUSE_PORT)
+
+  for (int i = 0; i < num_sockets; ++i)
+  {
+    delete client_sockets[i];
+    delete server_sockets[i];
+  }
+}
+
+#else // !defined(BOOST_ASIO_HAS_IOCP)
+
+void test()
+{
+}
+
+#endif // !defined(BOOST_ASIO_HAS_IOCP)
+
+} // namespace ip_tcp_accept_batch_runtime
+
+//------------------------------------------------------------------------------
+
+// ip_tcp_reactor_shards_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of ip::tcp sockets when the
+// reactor is divided into shards that are run by several threads at once.
+
+namespace ip_tcp_reactor_shards_runtime {
+
+const int num_connections = 8;
+const int num_rounds = 100;
+
+struct connection
+{
+  explicit connection(boost::asio::io_service& ios)
+    : client(ios), server(ios), request(0), reply(0), echo(0), rounds(0),
+      errors(0)
+  {
+  }
+
+  boost::asio::ip::tcp::socket client;
+  boost::asio::ip::tcp::socket server;
+  char request;
+  char reply;
+  char echo;
+  int rounds;
+  int errors;
+};
+
+// The test framework is not thread-safe, so the handlers only record errors
+// and the results are checked once the threads have exited.
+void record(connection* c, bool ok)
+{
+  if (!ok)
+    ++c->errors;
+}
+
+void handle_server_write(connection* c, const boost::system::error_code& err);
+void handle_client_write(connection* c, const boost::system::error_code& err);
+
+void handle_server_read(connection* c, const boost::system::error_code& err)
+{
+  // The client shuts down its side of the connection after the last round.
+  if (!err)
+  {
+    boost::asio::async_write(c->server, boost::asio::buffer(&c->echo, 1),
+        boost::bind(handle_server_write, c, boost::asio::placeholders::error));
+  }
+}
+
+void handle_server_write(connection* c, const boost::system::error_code& err)
+{
+  record(c, !err);
+  boost::asio::async_read(c->server, boost::asio::buffer(&c->echo, 1),
+      boost::bind(handle_server_read, c, boost::asio::placeholders::error));
+}
+
+void start_round(connection* c)
+{
+  c->request = static_cast<char>('a' + c->rounds % 26);
+  boost::asio::async_write(c->client, boost::asio::buffer(&c->request, 1),
+      boost::bind(handle_client_write, c, boost::asio::placeholders::error));
+}
+
+void handle_client_read(connection* c, const boost::system::error_code& err)
+{
+  record(c, !err);
+  record(c, c->reply == c->request);
+  if (++c->rounds < num_rounds)
+    start_round(c);
+  else
+    c->client.shutdown(boost::asio::ip::tcp::socket::shutdown_send);
+}
+
+void handle_client_write(connection* c, const boost::system::error_code& err)
+{
+  record(c, !err);
+  boost::asio::async_read(c->client, boost::asio::buffer(&c->reply, 1),
+      boost::bind(handle_client_read, c, boost::asio::placeholders::error));
+}
+
+void io_service_run(boost::asio::io_service* ios)
+{
+  ios->run();
+}
+
+void test()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  io_service ios(BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS_THREADS(4));
+
+  ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  // The sockets are spread across the shards as they are opened.
+  connection* connections[num_connections];
+  for (int i = 0; i < num_connections; ++i)
+  {
+    connections[i] = new connection(ios);
+    connections[i]->client.connect(server_endpoint);
+    acceptor.accept(connections[i]->server);
+  }
+
+  for (int i = 0; i < num_connections; ++i)
+  {
+    boost::asio::async_read(connections[i]->server,
+        boost::asio::buffer(&connections[i]->echo, 1),
+        boost::bind(handle_server_read, connections[i],
+          boost::asio::placeholders::error));
+    start_round(connections[i]);
+  }
+
+  boost::thread thread1(boost::bind(io_service_run, &ios));
+  boost::thread thread2(boost::bind(io_service_run, &ios));
+  boost::thread thread3(boost::bind(io_service_run, &ios));
+  boost::thread thread4(boost::bind(io_service_run, &ios));
+  thread1.join();
+  thread2.join();
+  thread3.join();
+  thread4.join();
+
+  BOOST_CHECK(ios.stopped());
+  for (int i = 0; i < num_connections; ++i)
+  {
+    BOOST_CHECK(connections[i]->rounds == num_rounds);
+    BOOST_CHECK(connections[i]->errors == 0);
+  }
+
+  // Threads blocked waiting on any of the shards must wake up when the
+  // io_service stops.
+  ios.reset();
+  io_service::work* w = new io_service::work(ios);
+  boost::thread thread5(boost::bind(io_service_run, &ios));
+  boost::thread thread6(boost::bind(io_service_run, &ios));
+  boost::thread thread7(boost::bind(io_service_run, &ios));
+  boost::thread thread8(boost::bind(io_service_run, &ios));
+  ios.post(boost::bind(&io_service::stop, &ios));
+  thread5.join();
+  thread6.join();
+  thread7.join();
+  thread8.join();
+  BOOST_CHECK(ios.stopped());
+  delete w;
+
+  for (int i = 0; i < num_connections; ++i)
+    delete connections[i];
+}
+
+void handle_idle_read(int* reads, const boost::system::error_code& err)
+{
+  if (!err)
+    ++*reads;
+}
+
+void handle_idle_timer(connection** connections,
+    const boost::system::error_code& err)
+{
+  BOOST_CHECK(!err);
+  for (int i = 0; i < num_connections; ++i)
+    boost::asio::write(connections[i]->client,
+        boost::asio::buffer(&connections[i]->request, 1));
+}
+
+// A single thread running an idle io_service must block, rather than poll
+// each shard in turn, and must still see events on every shard.
+void test_idle()
+{
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  io_service ios(BOOST_ASIO_CONCURRENCY_HINT_REACTOR_SHARDS_THREADS(4));
+
+  ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  int reads = 0;
+  connection* connections[num_connections];
+  for (int i = 0; i < num_connections; ++i)
+  {
+    connections[i] = new connection(ios);
+    connections[i]->client.connect(server_endpoint);
+    acceptor.accept(connections[i]->server);
+    boost::asio::async_read(connections[i]->server,
+        boost::asio::buffer(&connections[i]->echo, 1),
+        boost::bind(handle_idle_read, &reads,
+          boost::asio::placeholders::error));
+  }
+
+  deadline_timer timer(ios, boost::posix_time::milliseconds(500));
+  timer.async_wait(boost::bind(handle_idle_timer, connections,
+        boost::asio::placeholders::error));
+
+  boost::posix_time::ptime start =
+    boost::posix_time::microsec_clock::universal_time();
+  ios.run();
+  boost::posix_time::time_duration elapsed =
+    boost::posix_time::microsec_clock::universal_time() - start;
+
+  BOOST_CHECK(reads == num_connections);
+  BOOST_CHECK(elapsed >= boost::posix_time::milliseconds(500));
+
+  // A thread that polled the shards in turn would run the reactor many times
+  // while waiting for the timer. A blocking thread runs it once to wait for
+  // the timer, and at most once more for each of the reads.
+  io_service_metrics metrics = ios.get_metrics();
+  BOOST_CHECK(metrics.reactor_waits + metrics.reactor_polls
+      <= 2 * num_connections + 2);
+
+  for (int i = 0; i < num_connections; ++i)
+    delete connections[i];
+}
+
+} // namespace ip_tcp_reactor_shards_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_tcp_resolver_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -833,8 +1426,14 @@ test_suite* init_unit_test_suite(int, char*[])
   test->add(BOOST_TEST_CASE(&ip_tcp_runtime::test));
   test->add(BOOST_TEST_CASE(&ip_tcp_socket_compile::test));
   test->add(BOOST_TEST_CASE(&ip_tcp_socket_runtime::test));
+  test->add(BOOST_TEST_CASE(
+        &ip_tcp_socket_runtime::test_outstanding_at_shutdown));
+  test->add(BOOST_TEST_CASE(&ip_tcp_send_file_runtime::test));
   test->add(BOOST_TEST_CASE(&ip_tcp_acceptor_compile::test));
   test->add(BOOST_TEST_CASE(&ip_tcp_acceptor_runtime::test));
+  test->add(BOOST_TEST_CASE(&ip_tcp_accept_batch_runtime::test));
+  test->add(BOOST_TEST_CASE(&ip_tcp_reactor_shards_runtime::test));
+  test->add(BOOST_TEST_CASE(&ip_tcp_reactor_shards_runtime::test_idle));
   test->add(BOOST_TEST_CASE(&ip_tcp_resolver_compile::test));
   return test;
 }
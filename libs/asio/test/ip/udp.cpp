@@ -299,6 +299,26 @@ void test()
         endpoint, in_flags, &receive_handler);
     socket1.async_receive_from(null_buffers(),
         endpoint, in_flags, &receive_handler);
+
+#if defined(BOOST_ASIO_HAS_MMSG)
+    ip::udp::socket::send_message_type send_messages[2] = {
+      ip::udp::socket::send_message_type(buffer(const_char_buffer),
+          ip::udp::endpoint(ip::udp::v4(), 0)),
+      ip::udp::socket::send_message_type(buffer(mutable_char_buffer),
+          ip::udp::endpoint(ip::udp::v4(), 0)) };
+    socket1.send_to_batch(send_messages, 2);
+    socket1.send_to_batch(send_messages, 2, in_flags, ec);
+    socket1.async_send_to_batch(send_messages, 2, &send_handler);
+    socket1.async_send_to_batch(send_messages, 2, in_flags, &send_handler);
+
+    ip::udp::socket::receive_message_type receive_messages[1] = {
+      ip::udp::socket::receive_message_type(buffer(mutable_char_buffer)) };
+    socket1.receive_from_batch(receive_messages, 1);
+    socket1.receive_from_batch(receive_messages, 1, in_flags, ec);
+    socket1.async_receive_from_batch(receive_messages, 1, &receive_handler);
+    socket1.async_receive_from_batch(receive_messages, 1,
+        in_flags, &receive_handler);
+#endif // defined(BOOST_ASIO_HAS_MMSG)
   }
   catch (std::exception&)
   {
@@ -376,6 +396,126 @@ void test()
 
 //------------------------------------------------------------------------------
 
+// ip_udp_socket_batch_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the batched send and
+// receive functions of the ip::udp::socket class.
+
+namespace ip_udp_socket_batch_runtime {
+
+#if defined(BOOST_ASIO_HAS_MMSG)
+
+void handle_batch(boost::system::error_code* out_ec, size_t* out_n,
+    const boost::system::error_code& err, size_t n)
+{
+  *out_ec = err;
+  *out_n = n;
+}
+
+void test()
+{
+  using namespace std; // For memcmp and memset.
+  using namespace boost::asio;
+  namespace ip = boost::asio::ip;
+
+  io_service ios;
+
+  ip::udp::socket s1(ios, ip::udp::endpoint(ip::udp::v4(), 0));
+  ip::udp::endpoint target_endpoint = s1.local_endpoint();
+  target_endpoint.address(ip::address_v4::loopback());
+
+  ip::udp::socket s2(ios, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+
+  const size_t num_msgs = 8;
+  char send_data[num_msgs][16];
+  char recv_data[num_msgs][16];
+  ip::udp::socket::send_message_type send_msgs[num_msgs];
+  ip::udp::socket::receive_message_type recv_msgs[num_msgs];
+  for (size_t i = 0; i < num_msgs; ++i)
+  {
+    memset(send_data[i], 'a' + static_cast<int>(i), sizeof(send_data[i]));
+    send_msgs[i] = ip::udp::socket::send_message_type(
+        buffer(send_data[i], i + 1), target_endpoint);
+    recv_msgs[i] = ip::udp::socket::receive_message_type(
+        buffer(recv_data[i]));
+  }
+
+  // Synchronous send and receive.
+  size_t sent = s2.send_to_batch(send_msgs, num_msgs);
+  BOOST_CHECK(sent == num_msgs);
+  for (size_t i = 0; i < sent; ++i)
+    BOOST_CHECK(send_msgs[i].bytes_transferred() == i + 1);
+
+  size_t recvd = 0;
+  while (recvd < num_msgs)
+  {
+    size_t n = s1.receive_from_batch(recv_msgs + recvd, num_msgs - recvd);
+    BOOST_CHECK(n > 0);
+    recvd += n;
+  }
+  for (size_t i = 0; i < num_msgs; ++i)
+  {
+    BOOST_CHECK(recv_msgs[i].bytes_transferred() == i + 1);
+    BOOST_CHECK(memcmp(recv_data[i], send_data[i], i + 1) == 0);
+    BOOST_CHECK(recv_msgs[i].endpoint() == s2.local_endpoint());
+  }
+
+  // Asynchronous send and receive.
+  memset(recv_data, 0, sizeof(recv_data));
+  boost::system::error_code send_ec, recv_ec;
+  size_t send_n = 0, recv_n = 0;
+  s2.async_send_to_batch(send_msgs, num_msgs,
+      boost::bind(handle_batch, &send_ec, &send_n,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred));
+  ios.run();
+  BOOST_CHECK(!send_ec);
+  BOOST_CHECK(send_n == num_msgs);
+
+  // All datagrams are now queued on s1, so a single receive gets them all.
+  ios.reset();
+  s1.async_receive_from_batch(recv_msgs, num_msgs,
+      boost::bind(handle_batch, &recv_ec, &recv_n,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred));
+  ios.run();
+  BOOST_CHECK(!recv_ec);
+  BOOST_CHECK(recv_n == num_msgs);
+  for (size_t i = 0; i < recv_n; ++i)
+  {
+    BOOST_CHECK(recv_msgs[i].bytes_transferred() == i + 1);
+    BOOST_CHECK(memcmp(recv_data[i], send_data[i], i + 1) == 0);
+    BOOST_CHECK(recv_msgs[i].endpoint() == s2.local_endpoint());
+  }
+
+  // A receive with nothing queued completes when data arrives.
+  ios.reset();
+  recv_n = 0;
+  s1.async_receive_from_batch(recv_msgs, num_msgs,
+      boost::bind(handle_batch, &recv_ec, &recv_n,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred));
+  ios.poll();
+  BOOST_CHECK(recv_n == 0);
+  s2.send_to(buffer(send_data[0], 3), target_endpoint);
+  ios.run();
+  BOOST_CHECK(!recv_ec);
+  BOOST_CHECK(recv_n == 1);
+  BOOST_CHECK(recv_msgs[0].bytes_transferred() == 3);
+}
+
+#else // defined(BOOST_ASIO_HAS_MMSG)
+
+void test()
+{
+}
+
+#endif // defined(BOOST_ASIO_HAS_MMSG)
+
+} // namespace ip_udp_socket_batch_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_udp_resolver_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -443,6 +583,7 @@ test_suite* init_unit_test_suite(int, char*[])
   test_suite* test = BOOST_TEST_SUITE("ip/udp");
   test->add(BOOST_TEST_CASE(&ip_udp_socket_compile::test));
   test->add(BOOST_TEST_CASE(&ip_udp_socket_runtime::test));
+  test->add(BOOST_TEST_CASE(&ip_udp_socket_batch_runtime::test));
   test->add(BOOST_TEST_CASE(&ip_udp_resolver_compile::test));
   return test;
 }
@@ -0,0 +1,240 @@
+//
+// connection_rate.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Compares the rate at which connections are accepted by a single acceptor
+// shared by all server threads with the rate for a group of SO_REUSEPORT
+// acceptors, one per thread, each accepting in batches. Client threads
+// connect to the server over the loopback interface and reset each
+// connection as soon as it has been established.
+
+#include <boost/asio/basic_reuse_port_acceptor.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/detail/atomic_count.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using boost::asio::ip::tcp;
+using boost::posix_time::ptime;
+using boost::posix_time::microsec_clock;
+
+const int batch_size = 16;
+
+// Set when the clients should stop connecting.
+volatile bool stopping = false;
+
+void run_client(tcp::endpoint endpoint)
+{
+  boost::asio::io_service io_service;
+  while (!stopping)
+  {
+    tcp::socket socket(io_service);
+    boost::system::error_code ec;
+    socket.connect(endpoint, ec);
+    if (!ec)
+    {
+      // Reset the connection on close, so that the client's ports do not
+      // accumulate in the TIME_WAIT state.
+      socket.set_option(tcp::socket::linger(true, 0), ec);
+    }
+  }
+}
+
+// Accepts one connection at a time on an acceptor shared by all threads.
+class single_acceptor_session
+{
+public:
+  single_acceptor_session(boost::asio::io_service& io_service,
+      tcp::acceptor& acceptor, boost::detail::atomic_count& count)
+    : acceptor_(acceptor),
+      socket_(io_service),
+      count_(count)
+  {
+  }
+
+  void start()
+  {
+    acceptor_.async_accept(socket_,
+        boost::bind(&single_acceptor_session::handle_accept, this, _1));
+  }
+
+private:
+  void handle_accept(const boost::system::error_code& err)
+  {
+    if (!err)
+    {
+      ++count_;
+      socket_.close();
+      start();
+    }
+  }
+
+  tcp::acceptor& acceptor_;
+  tcp::socket socket_;
+  boost::detail::atomic_count& count_;
+};
+
+// Accepts connections in batches on an acceptor used only by one thread.
+class batch_acceptor_session
+{
+public:
+  batch_acceptor_session(boost::asio::io_service& io_service,
+      tcp::acceptor& acceptor, boost::detail::atomic_count& count)
+    : acceptor_(acceptor),
+      count_(count)
+  {
+    for (int i = 0; i < batch_size; ++i)
+      sockets_[i] = new tcp::socket(io_service);
+  }
+
+  ~batch_acceptor_session()
+  {
+    for (int i = 0; i < batch_size; ++i)
+      delete sockets_[i];
+  }
+
+  void start()
+  {
+    acceptor_.async_accept_batch(sockets_, batch_size,
+        boost::bind(&batch_acceptor_session::handle_accept, this, _1, _2));
+  }
+
+private:
+  void handle_accept(const boost::system::error_code& err, std::size_t n)
+  {
+    if (!err)
+    {
+      for (std::size_t i = 0; i < n; ++i)
+      {
+        ++count_;
+        sockets_[i]->close();
+      }
+      start();
+    }
+  }
+
+  tcp::acceptor& acceptor_;
+  tcp::socket* sockets_[batch_size];
+  boost::detail::atomic_count& count_;
+};
+
+// Run the clients against the server for the given time and report the rate.
+void run_clients(const char* name, tcp::endpoint endpoint,
+    int num_clients, int seconds, boost::detail::atomic_count& accepted)
+{
+  endpoint.address(boost::asio::ip::address_v4::loopback());
+
+  stopping = false;
+  boost::thread_group clients;
+  for (int i = 0; i < num_clients; ++i)
+    clients.create_thread(boost::bind(run_client, endpoint));
+
+  ptime start = microsec_clock::universal_time();
+  long start_accepted = accepted;
+  boost::this_thread::sleep(boost::posix_time::seconds(seconds));
+  long stop_accepted = accepted;
+  ptime stop = microsec_clock::universal_time();
+
+  stopping = true;
+  clients.join_all();
+
+  double elapsed_usec = static_cast<double>(
+      (stop - start).total_microseconds());
+  std::printf("%s\n", name);
+  std::printf("  rate\t%f connections/sec\n",
+      (stop_accepted - start_accepted) * 1000000.0 / elapsed_usec);
+}
+
+void test_single(int num_threads, int num_clients, int seconds)
+{
+  boost::asio::io_service io_service(num_threads);
+  tcp::acceptor acceptor(io_service, tcp::endpoint(tcp::v4(), 0));
+  boost::detail::atomic_count accepted(0);
+
+  std::vector<single_acceptor_session*> sessions;
+  for (int i = 0; i < num_threads; ++i)
+  {
+    sessions.push_back(
+        new single_acceptor_session(io_service, acceptor, accepted));
+    sessions.back()->start();
+  }
+
+  boost::thread_group threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.create_thread(
+        boost::bind(&boost::asio::io_service::run, &io_service));
+
+  run_clients("single acceptor", acceptor.local_endpoint(),
+      num_clients, seconds, accepted);
+
+  io_service.stop();
+  threads.join_all();
+
+  for (std::size_t i = 0; i < sessions.size(); ++i)
+    delete sessions[i];
+}
+
+void test_reuse_port(int num_threads, int num_clients, int seconds)
+{
+  std::vector<boost::asio::io_service*> io_services;
+  for (int i = 0; i < num_threads; ++i)
+    io_services.push_back(new boost::asio::io_service(1));
+
+  tcp::reuse_port_acceptor acceptors(tcp::endpoint(tcp::v4(), 0));
+  boost::detail::atomic_count accepted(0);
+
+  std::vector<batch_acceptor_session*> sessions;
+  for (int i = 0; i < num_threads; ++i)
+  {
+    acceptors.add(*io_services[i]);
+    sessions.push_back(new batch_acceptor_session(
+          *io_services[i], acceptors.acceptor(i), accepted));
+    sessions.back()->start();
+  }
+
+  boost::thread_group threads;
+  for (int i = 0; i < num_threads; ++i)
+    threads.create_thread(
+        boost::bind(&boost::asio::io_service::run, io_services[i]));
+
+  run_clients("reuse_port acceptors", acceptors.local_endpoint(),
+      num_clients, seconds, accepted);
+
+  for (int i = 0; i < num_threads; ++i)
+    io_services[i]->stop();
+  threads.join_all();
+
+  for (std::size_t i = 0; i < sessions.size(); ++i)
+    delete sessions[i];
+  acceptors.close();
+  for (std::size_t i = 0; i < io_services.size(); ++i)
+    delete io_services[i];
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::fprintf(stderr,
+        "Usage: connection_rate <nthreads> <nclients> <seconds>\n");
+    return 1;
+  }
+
+  int num_threads = std::atoi(argv[1]);
+  int num_clients = std::atoi(argv[2]);
+  int seconds = std::atoi(argv[3]);
+
+  test_single(num_threads, num_clients, seconds);
+  test_reuse_port(num_threads, num_clients, seconds);
+}
@@ -0,0 +1,143 @@
+//
+// strand_contention.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Compares the pooled strand implementation with the hashed one. Each strand
+// runs a chain of handlers, where every handler does a little work and then
+// posts its successor. The time from each post to the start of the handler is
+// recorded. With hashing, unrelated strands that share an implementation are
+// serialised with one another, which shows up in the upper percentiles.
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/detail/pooled_strand_service.hpp>
+#include <boost/asio/detail/strand_service.hpp>
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/thread.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "high_res_clock.hpp"
+
+using boost::posix_time::ptime;
+using boost::posix_time::microsec_clock;
+
+const int samples_per_strand = 1000;
+
+template <typename Service>
+struct strand_state
+{
+  Service* service;
+  typename Service::implementation_type impl;
+  boost::uint64_t* samples;
+  int count;
+  int spin;
+};
+
+template <typename Service>
+struct chain_handler
+{
+  strand_state<Service>* state;
+  boost::uint64_t posted;
+
+  void operator()()
+  {
+    state->samples[state->count] = high_res_clock() - posted;
+
+    for (volatile int i = 0; i < state->spin; ++i) {}
+
+    if (++state->count < samples_per_strand)
+    {
+      chain_handler h = { state, high_res_clock() };
+      state->service->post(state->impl, h);
+    }
+  }
+};
+
+template <typename Service>
+void run_test(const char* name, int num_threads, int num_strands, int spin)
+{
+  boost::asio::io_service io_service(num_threads);
+  Service& service = boost::asio::use_service<Service>(io_service);
+
+  std::vector<boost::uint64_t> samples(
+      static_cast<std::size_t>(num_strands) * samples_per_strand);
+  std::vector<strand_state<Service>*> states;
+  for (int i = 0; i < num_strands; ++i)
+  {
+    strand_state<Service>* state = new strand_state<Service>;
+    state->service = &service;
+    service.construct(state->impl);
+    state->samples = &samples[static_cast<std::size_t>(i) * samples_per_strand];
+    state->count = 0;
+    state->spin = spin;
+    states.push_back(state);
+  }
+
+  ptime start = microsec_clock::universal_time();
+  boost::uint64_t start_hr = high_res_clock();
+
+  for (int i = 0; i < num_strands; ++i)
+  {
+    chain_handler<Service> h = { states[i], high_res_clock() };
+    service.post(states[i]->impl, h);
+  }
+
+  boost::thread_group threads;
+  for (int i = 1; i < num_threads; ++i)
+    threads.create_thread(
+        boost::bind(&boost::asio::io_service::run, &io_service));
+  io_service.run();
+  threads.join_all();
+
+  ptime stop = microsec_clock::universal_time();
+  boost::uint64_t stop_hr = high_res_clock();
+  boost::uint64_t elapsed_usec = (stop - start).total_microseconds();
+  boost::uint64_t elapsed_hr = stop_hr - start_hr;
+  double scale = 1.0 * elapsed_usec / elapsed_hr;
+
+  for (int i = 0; i < num_strands; ++i)
+    delete states[i];
+
+  std::size_t n = samples.size();
+  std::sort(samples.begin(), samples.end());
+  std::printf("%s\n", name);
+  std::printf("  0.0%%\t%f\n", samples[0] * scale);
+  std::printf(" 10.0%%\t%f\n", samples[n / 10 - 1] * scale);
+  std::printf(" 50.0%%\t%f\n", samples[n * 5 / 10 - 1] * scale);
+  std::printf(" 90.0%%\t%f\n", samples[n * 9 / 10 - 1] * scale);
+  std::printf(" 99.0%%\t%f\n", samples[n * 99 / 100 - 1] * scale);
+  std::printf(" 99.9%%\t%f\n", samples[n * 999 / 1000 - 1] * scale);
+  std::printf("100.0%%\t%f\n", samples[n - 1] * scale);
+
+  double total = 0.0;
+  for (std::size_t i = 0; i < n; ++i) total += samples[i] * scale;
+  std::printf("  mean\t%f\n", total / n);
+  std::printf("  rate\t%f handlers/sec\n", n * 1000000.0 / elapsed_usec);
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::fprintf(stderr,
+        "Usage: strand_contention <nthreads> <nstrands> <spin>\n");
+    return 1;
+  }
+
+  int num_threads = std::atoi(argv[1]);
+  int num_strands = std::atoi(argv[2]);
+  int spin = std::atoi(argv[3]);
+
+  run_test<boost::asio::detail::strand_service>(
+      "hashed", num_threads, num_strands, spin);
+  run_test<boost::asio::detail::pooled_strand_service>(
+      "pooled", num_threads, num_strands, spin);
+}
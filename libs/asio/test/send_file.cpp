@@ -0,0 +1,191 @@
+//
+// send_file.cpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/send_file.hpp>
+
+#include <boost/bind.hpp>
+#include <cstring>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/placeholders.hpp>
+#include <boost/asio/posix/stream_descriptor.hpp>
+#include <boost/asio/read.hpp>
+#include <boost/asio/write.hpp>
+#include "unit_test.hpp"
+
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+
+#include <unistd.h>
+
+using namespace std; // For memcmp.
+
+static const char write_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+struct socket_pair
+{
+  explicit socket_pair(boost::asio::io_service& ios)
+    : client(ios), server(ios)
+  {
+    namespace ip = boost::asio::ip;
+    ip::tcp::acceptor acceptor(ios, ip::tcp::endpoint(ip::tcp::v4(), 0));
+    ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+    server_endpoint.address(ip::address_v4::loopback());
+    client.connect(server_endpoint);
+    acceptor.accept(server);
+  }
+
+  boost::asio::ip::tcp::socket client;
+  boost::asio::ip::tcp::socket server;
+};
+
+struct pipe_pair
+{
+  explicit pipe_pair(boost::asio::io_service& ios)
+    : read_end(ios), write_end(ios)
+  {
+    int fds[2] = { -1, -1 };
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    read_end.assign(fds[0]);
+    write_end.assign(fds[1]);
+  }
+
+  boost::asio::posix::stream_descriptor read_end;
+  boost::asio::posix::stream_descriptor write_end;
+};
+
+void handle_send_file(const boost::system::error_code& err,
+    size_t bytes_transferred, boost::system::error_code* out_err,
+    size_t* out_bytes_transferred)
+{
+  *out_err = err;
+  *out_bytes_transferred = bytes_transferred;
+}
+
+void handle_pipe_write(pipe_pair* pipe, size_t* chunks)
+{
+  // Feed the pipe one chunk at a time so that the send has to wait for it.
+  if (*chunks * 13 < sizeof(write_data))
+  {
+    boost::asio::write(pipe->write_end,
+        boost::asio::buffer(write_data + *chunks * 13,
+          (std::min)(sizeof(write_data) - *chunks * 13, size_t(13))));
+    ++*chunks;
+    pipe->write_end.get_io_service().post(
+        boost::bind(handle_pipe_write, pipe, chunks));
+  }
+}
+
+void test_3_arg_send_file()
+{
+  boost::asio::io_service ios;
+  socket_pair sockets(ios);
+  pipe_pair pipe(ios);
+
+  boost::asio::write(pipe.write_end, boost::asio::buffer(write_data));
+
+  size_t bytes_transferred = boost::asio::send_file(
+      sockets.client, pipe.read_end, sizeof(write_data));
+  BOOST_CHECK(bytes_transferred == sizeof(write_data));
+
+  char read_buffer[sizeof(write_data)];
+  boost::asio::read(sockets.server, boost::asio::buffer(read_buffer));
+  BOOST_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+}
+
+void test_4_arg_send_file()
+{
+  boost::asio::io_service ios;
+  socket_pair sockets(ios);
+  pipe_pair pipe(ios);
+
+  boost::asio::write(pipe.write_end, boost::asio::buffer(write_data));
+  pipe.write_end.close();
+
+  boost::system::error_code error;
+  size_t bytes_transferred = boost::asio::send_file(
+      sockets.client, pipe.read_end, sizeof(write_data) + 10, error);
+  BOOST_CHECK(error == boost::asio::error::eof);
+  BOOST_CHECK(bytes_transferred == sizeof(write_data));
+
+  char read_buffer[sizeof(write_data)];
+  boost::asio::read(sockets.server, boost::asio::buffer(read_buffer));
+  BOOST_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+}
+
+void test_async_send_file()
+{
+  boost::asio::io_service ios;
+  socket_pair sockets(ios);
+  pipe_pair pipe(ios);
+
+  boost::system::error_code error = boost::asio::error::would_block;
+  size_t bytes_transferred = 0;
+  boost::asio::async_send_file(sockets.client, pipe.read_end,
+      sizeof(write_data), boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &error, &bytes_transferred));
+
+  size_t chunks = 0;
+  ios.post(boost::bind(handle_pipe_write, &pipe, &chunks));
+
+  ios.run();
+  BOOST_CHECK(!error);
+  BOOST_CHECK(bytes_transferred == sizeof(write_data));
+
+  char read_buffer[sizeof(write_data)];
+  boost::asio::read(sockets.server, boost::asio::buffer(read_buffer));
+  BOOST_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+}
+
+void test_async_send_file_eof()
+{
+  boost::asio::io_service ios;
+  socket_pair sockets(ios);
+  pipe_pair pipe(ios);
+
+  boost::asio::write(pipe.write_end, boost::asio::buffer(write_data, 10));
+  pipe.write_end.close();
+
+  boost::system::error_code error;
+  size_t bytes_transferred = 0;
+  boost::asio::async_send_file(sockets.client, pipe.read_end,
+      sizeof(write_data), boost::bind(handle_send_file,
+        boost::asio::placeholders::error,
+        boost::asio::placeholders::bytes_transferred,
+        &error, &bytes_transferred));
+
+  ios.run();
+  BOOST_CHECK(error == boost::asio::error::eof);
+  BOOST_CHECK(bytes_transferred == 10);
+}
+
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+
+test_suite* init_unit_test_suite(int, char*[])
+{
+  test_suite* test = BOOST_TEST_SUITE("send_file");
+#if defined(BOOST_ASIO_HAS_SENDFILE)
+  test->add(BOOST_TEST_CASE(&test_3_arg_send_file));
+  test->add(BOOST_TEST_CASE(&test_4_arg_send_file));
+  test->add(BOOST_TEST_CASE(&test_async_send_file));
+  test->add(BOOST_TEST_CASE(&test_async_send_file_eof));
+#else // defined(BOOST_ASIO_HAS_SENDFILE)
+  test->add(BOOST_TEST_CASE(&null_test));
+#endif // defined(BOOST_ASIO_HAS_SENDFILE)
+  return test;
+}
@@ -17,6 +17,7 @@
 #include <boost/asio/strand.hpp>
 
 #include <sstream>
+#include <vector>
 #include <boost/thread/thread.hpp>
 #include <boost/bind.hpp>
 #include <boost/asio/deadline_timer.hpp>
@@ -179,9 +180,79 @@ void strand_test()
   BOOST_CHECK(count == 0);
 }
 
+struct strand_counter
+{
+  strand_counter(io_service& ios) : s(ios), count(0), busy(false), overlaps(0) {}
+  strand s;
+  int count;
+  bool busy;
+  int overlaps;
+};
+
+void serialised_increment(strand_counter* c)
+{
+  if (c->busy)
+    ++c->overlaps;
+  c->busy = true;
+  for (volatile int i = 0; i < 100; ++i) {}
+  ++c->count;
+  c->busy = false;
+}
+
+void post_serialised_increments(strand_counter* c, int n)
+{
+  for (int i = 0; i < n; ++i)
+    c->s.post(boost::bind(serialised_increment, c));
+}
+
+void strand_independence_test()
+{
+  io_service ios;
+  const int num_strands = 64;
+  const int num_handlers = 1000;
+  std::vector<strand_counter*> counters;
+  for (int i = 0; i < num_strands; ++i)
+  {
+    counters.push_back(new strand_counter(ios));
+    ios.post(boost::bind(post_serialised_increments,
+          counters.back(), num_handlers));
+  }
+
+  boost::thread thread1(boost::bind(io_service_run, &ios));
+  boost::thread thread2(boost::bind(io_service_run, &ios));
+  boost::thread thread3(boost::bind(io_service_run, &ios));
+  ios.run();
+  thread1.join();
+  thread2.join();
+  thread3.join();
+
+  // Handlers on each strand must have run one at a time.
+  for (int i = 0; i < num_strands; ++i)
+  {
+    BOOST_CHECK(counters[i]->count == num_handlers);
+    BOOST_CHECK(counters[i]->overlaps == 0);
+    delete counters[i];
+  }
+
+  // Handlers posted through a strand still run after the strand object, and
+  // all copies of it, have been destroyed.
+  int count = 0;
+  ios.reset();
+  {
+    strand s1(ios);
+    strand s2(s1);
+    s1.post(boost::bind(increment, &count));
+    s2.post(boost::bind(increment, &count));
+    s2.post(s1.wrap(boost::bind(increment, &count)));
+  }
+  ios.run();
+  BOOST_CHECK(count == 3);
+}
+
 test_suite* init_unit_test_suite(int, char*[])
 {
   test_suite* test = BOOST_TEST_SUITE("strand");
   test->add(BOOST_TEST_CASE(&strand_test));
+  test->add(BOOST_TEST_CASE(&strand_independence_test));
   return test;
 }
@@ -0,0 +1,190 @@
+//
+// timer_wheel_traits.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2026 Joshua Napoli
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include <boost/asio/timer_wheel_traits.hpp>
+
+#include <vector>
+#include <boost/bind.hpp>
+#include <boost/asio/basic_deadline_timer.hpp>
+#include <boost/asio/basic_waitable_timer.hpp>
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/placeholders.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/time_traits.hpp>
+#include <boost/asio/wait_traits.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include "unit_test.hpp"
+
+using namespace boost::posix_time;
+
+typedef boost::asio::basic_deadline_timer<ptime,
+    boost::asio::timer_wheel_traits<boost::asio::time_traits<ptime> > >
+  wheel_deadline_timer;
+
+void record_expiry(const boost::system::error_code& ec,
+    wheel_deadline_timer* t, std::vector<ptime>* expiries,
+    int* early, int* errors)
+{
+  if (ec)
+  {
+    ++*errors;
+    return;
+  }
+
+  // The handler must not run before the timer's expiry time.
+  if (microsec_clock::universal_time() < t->expires_at())
+    ++*early;
+  expiries->push_back(t->expires_at());
+}
+
+void record_error(const boost::system::error_code& ec,
+    boost::system::error_code* result)
+{
+  *result = ec;
+}
+
+void timer_wheel_order_test()
+{
+  boost::asio::io_service ios;
+
+  // Spread the timers over more than one block of the wheel's first level so
+  // that some of them have to be cascaded down from the second level.
+  const int num_timers = 40;
+  std::vector<wheel_deadline_timer*> timers;
+  std::vector<ptime> expiries;
+  int early = 0;
+  int errors = 0;
+  ptime start = microsec_clock::universal_time();
+  for (int i = 0; i < num_timers; ++i)
+  {
+    int msec = ((i * 7919) % num_timers) * 10 + 1;
+    wheel_deadline_timer* t = new wheel_deadline_timer(ios,
+        start + milliseconds(msec));
+    t->async_wait(boost::bind(record_expiry,
+          boost::asio::placeholders::error, t, &expiries, &early, &errors));
+    timers.push_back(t);
+  }
+
+  ios.run();
+
+  BOOST_CHECK(errors == 0);
+  BOOST_CHECK(early == 0);
+  BOOST_CHECK(static_cast<int>(expiries.size()) == num_timers);
+  for (std::size_t i = 1; i < expiries.size(); ++i)
+    BOOST_CHECK(!(expiries[i] < expiries[i - 1]));
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+    delete timers[i];
+}
+
+void timer_wheel_cancel_test()
+{
+  boost::asio::io_service ios;
+
+  boost::system::error_code long_result = boost::asio::error::would_block;
+  wheel_deadline_timer t1(ios, seconds(60));
+  t1.async_wait(boost::bind(record_error,
+        boost::asio::placeholders::error, &long_result));
+
+  boost::system::error_code rearm_result = boost::asio::error::would_block;
+  wheel_deadline_timer t2(ios, hours(24));
+  t2.async_wait(boost::bind(record_error,
+        boost::asio::placeholders::error, &rearm_result));
+
+  // Re-arming cancels the outstanding wait.
+  ios.poll();
+  BOOST_CHECK(t2.expires_from_now(milliseconds(20)) == 1);
+  ios.poll();
+  BOOST_CHECK(rearm_result == boost::asio::error::operation_aborted);
+
+  rearm_result = boost::asio::error::would_block;
+  t2.async_wait(boost::bind(record_error,
+        boost::asio::placeholders::error, &rearm_result));
+
+  ios.run_one();
+  BOOST_CHECK(!rearm_result);
+  BOOST_CHECK(long_result == boost::asio::error::would_block);
+
+  BOOST_CHECK(t1.cancel() == 1);
+  ios.run();
+  BOOST_CHECK(long_result == boost::asio::error::operation_aborted);
+}
+
+void timer_wheel_never_expires_test()
+{
+  boost::asio::io_service ios;
+
+  boost::system::error_code result = boost::asio::error::would_block;
+  wheel_deadline_timer t1(ios, ptime(pos_infin));
+  t1.async_wait(boost::bind(record_error,
+        boost::asio::placeholders::error, &result));
+
+  ios.poll();
+  BOOST_CHECK(result == boost::asio::error::would_block);
+
+  BOOST_CHECK(t1.cancel() == 1);
+  ios.run();
+  BOOST_CHECK(result == boost::asio::error::operation_aborted);
+}
+
+#if defined(BOOST_ASIO_HAS_STD_CHRONO) \
+  || defined(BOOST_ASIO_HAS_BOOST_CHRONO)
+
+typedef boost::asio::steady_timer::clock_type steady_clock;
+
+typedef boost::asio::basic_waitable_timer<steady_clock,
+    boost::asio::timer_wheel_traits<boost::asio::wait_traits<steady_clock> > >
+  wheel_steady_timer;
+
+void timer_wheel_waitable_timer_test()
+{
+  boost::asio::io_service ios;
+
+  steady_clock::time_point start = steady_clock::now();
+
+  wheel_steady_timer t1(ios, start + boost::asio::steady_timer::duration(0));
+  t1.expires_from_now(boost::asio::steady_timer::duration(300000000));
+  t1.wait();
+
+  // The timer must block until after its expiry time.
+  BOOST_CHECK(!(steady_clock::now() < t1.expires_at()));
+
+  boost::system::error_code result = boost::asio::error::would_block;
+  t1.expires_from_now(boost::asio::steady_timer::duration(20000000));
+  t1.async_wait(boost::bind(record_error,
+        boost::asio::placeholders::error, &result));
+
+  ios.run();
+  BOOST_CHECK(!result);
+  BOOST_CHECK(!(steady_clock::now() < t1.expires_at()));
+}
+
+#endif // defined(BOOST_ASIO_HAS_STD_CHRONO)
+       //   || defined(BOOST_ASIO_HAS_BOOST_CHRONO)
+
+test_suite* init_unit_test_suite(int, char*[])
+{
+  test_suite* test = BOOST_TEST_SUITE("timer_wheel_traits");
+  test->add(BOOST_TEST_CASE(&timer_wheel_order_test));
+  test->add(BOOST_TEST_CASE(&timer_wheel_cancel_test));
+  test->add(BOOST_TEST_CASE(&timer_wheel_never_expires_test));
+#if defined(BOOST_ASIO_HAS_STD_CHRONO) \
+  || defined(BOOST_ASIO_HAS_BOOST_CHRONO)
+  test->add(BOOST_TEST_CASE(&timer_wheel_waitable_timer_test));
+#endif // defined(BOOST_ASIO_HAS_STD_CHRONO)
+       //   || defined(BOOST_ASIO_HAS_BOOST_CHRONO)
+  return test;
+}
@@ -1,22 +1,259 @@
-#include <boost/atomic.hpp>
-
 //  Copyright (c) 2011 Helge Bahmann
 //
 //  Distributed under the Boost Software License, Version 1.0.
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/integer/static_log2.hpp>
+#include <boost/static_assert.hpp>
+
+#if !(BOOST_ATOMIC_INT_LOCK_FREE == 2) && !defined(BOOST_ATOMIC_FLAG_LOCK_FREE)
+#include <boost/thread/mutex.hpp>
+#endif
+
+// Number of locks in the pool, has to be a power of two.
+#ifndef BOOST_ATOMIC_LOCK_POOL_SIZE
+#define BOOST_ATOMIC_LOCK_POOL_SIZE 64
+#endif
+
+#ifndef BOOST_ATOMIC_CACHE_LINE_SIZE
+#define BOOST_ATOMIC_CACHE_LINE_SIZE 64
+#endif
+
 namespace boost {
 namespace atomics {
 namespace detail {
 
-static lockpool::lock_type lock_pool_[41];
+namespace {
+
+BOOST_STATIC_ASSERT(BOOST_ATOMIC_LOCK_POOL_SIZE > 0);
+BOOST_STATIC_ASSERT((BOOST_ATOMIC_LOCK_POOL_SIZE & (BOOST_ATOMIC_LOCK_POOL_SIZE - 1)) == 0);
+
+const unsigned int lock_pool_bits = boost::static_log2<BOOST_ATOMIC_LOCK_POOL_SIZE>::value;
+
+inline void pause()
+{
+#if defined(BOOST_ATOMIC_X86_PAUSE)
+    BOOST_ATOMIC_X86_PAUSE();
+#endif
+}
+
+#if BOOST_ATOMIC_INT_LOCK_FREE == 2
+
+// A reader-writer spinlock. A waiting writer sets writer_pending, which
+// keeps new readers out until it has got the lock.
+class lock_type
+{
+public:
+    lock_type() : state_(0), contentions_(0) {}
+
+    void lock()
+    {
+        unsigned int s = state_.load(memory_order_relaxed);
+        if (s == 0 && state_.compare_exchange_strong(s, writer, memory_order_acquire, memory_order_relaxed))
+            return;
+
+        contentions_.fetch_add(1, memory_order_relaxed);
+        for (;;) {
+            s = state_.load(memory_order_relaxed);
+            if ((s & ~writer_pending) == 0) {
+                if (state_.compare_exchange_weak(s, writer, memory_order_acquire, memory_order_relaxed))
+                    return;
+            } else if (!(s & writer_pending)) {
+                state_.fetch_or(writer_pending, memory_order_relaxed);
+            } else {
+                pause();
+            }
+        }
+    }
+
+    void unlock()
+    {
+        state_.fetch_and(~writer, memory_order_release);
+    }
+
+    void lock_shared()
+    {
+        unsigned int s = state_.load(memory_order_relaxed);
+        if (!(s & (writer | writer_pending)) && state_.compare_exchange_strong(s, s + 1, memory_order_acquire, memory_order_relaxed))
+            return;
+
+        contentions_.fetch_add(1, memory_order_relaxed);
+        for (;;) {
+            s = state_.load(memory_order_relaxed);
+            if (!(s & (writer | writer_pending))) {
+                if (state_.compare_exchange_weak(s, s + 1, memory_order_acquire, memory_order_relaxed))
+                    return;
+            } else {
+                pause();
+            }
+        }
+    }
+
+    void unlock_shared()
+    {
+        state_.fetch_sub(1, memory_order_release);
+    }
+
+    std::size_t contentions() const
+    {
+        return contentions_.load(memory_order_relaxed);
+    }
+
+    void reset_contentions()
+    {
+        contentions_.store(0, memory_order_relaxed);
+    }
+
+private:
+    static const unsigned int writer = 1u << (sizeof(unsigned int) * 8 - 1);
+    static const unsigned int writer_pending = writer >> 1;
+
+    atomic<unsigned int> state_;
+    atomic<unsigned int> contentions_;
+};
+
+#else
+
+// Without a lock-free atomic<unsigned int>, loads take the lock
+// exclusively, and the counter is only modified while holding the lock.
+class lock_type
+{
+public:
+    lock_type() : contentions_(0)
+    {
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+        flag_.clear();
+#endif
+    }
+
+    void lock()
+    {
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+        if (flag_.test_and_set(memory_order_acquire)) {
+            while (flag_.test_and_set(memory_order_acquire))
+                pause();
+            ++contentions_;
+        }
+#else
+        if (!mutex_.try_lock()) {
+            mutex_.lock();
+            ++contentions_;
+        }
+#endif
+    }
+
+    void unlock()
+    {
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+        flag_.clear(memory_order_release);
+#else
+        mutex_.unlock();
+#endif
+    }
+
+    void lock_shared() { lock(); }
+    void unlock_shared() { unlock(); }
+
+    std::size_t contentions() const
+    {
+        return contentions_;
+    }
+
+    void reset_contentions()
+    {
+        lock();
+        contentions_ = 0;
+        unlock();
+    }
+
+private:
+#ifdef BOOST_ATOMIC_FLAG_LOCK_FREE
+    atomic_flag flag_;
+#else
+    mutex mutex_;
+#endif
+    std::size_t contentions_;
+};
+
+#endif
+
+// Every lock gets a cache line of its own, so that threads that use
+// different locks don't invalidate each other's cache lines.
+struct padded_lock
+{
+    lock_type lock;
+    char padding[BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(lock_type) % BOOST_ATOMIC_CACHE_LINE_SIZE];
+};
+
+padded_lock lock_pool_[BOOST_ATOMIC_LOCK_POOL_SIZE];
+
+// Fibonacci hashing: the multiplication mixes all bits of the address into
+// the top bits of the product, so that objects which are a multiple of the
+// pool size apart, or in adjacent cache lines, get different locks. The
+// low bits are dropped first, objects within 16 bytes share a cache line
+// anyway.
+inline std::size_t hash_address(const volatile void * addr)
+{
+    if (lock_pool_bits == 0)
+        return 0;
+    boost::uint64_t h = static_cast<boost::uint64_t>(reinterpret_cast<std::size_t>(addr) >> 4);
+    h *= UINT64_C(0x9E3779B97F4A7C15);
+    return static_cast<std::size_t>(h >> (64 - lock_pool_bits));
+}
+
+inline lock_type& get_lock_for(const volatile void * addr)
+{
+    return lock_pool_[hash_address(addr)].lock;
+}
+
+}
+
+BOOST_ATOMIC_DECL std::size_t lockpool::size(void)
+{
+    return BOOST_ATOMIC_LOCK_POOL_SIZE;
+}
+
+BOOST_ATOMIC_DECL std::size_t lockpool::index_of(const volatile void * addr)
+{
+    return hash_address(addr);
+}
+
+BOOST_ATOMIC_DECL std::size_t lockpool::contention_count(std::size_t index)
+{
+    return lock_pool_[index].lock.contentions();
+}
+
+BOOST_ATOMIC_DECL void lockpool::reset_contention_counts(void)
+{
+    for (std::size_t i = 0; i < BOOST_ATOMIC_LOCK_POOL_SIZE; ++i)
+        lock_pool_[i].lock.reset_contentions();
+}
+
+BOOST_ATOMIC_DECL void * lockpool::lock(const volatile void * addr)
+{
+    lock_type& l = get_lock_for(addr);
+    l.lock();
+    return &l;
+}
+
+BOOST_ATOMIC_DECL void lockpool::unlock(void * lock)
+{
+    static_cast<lock_type *>(lock)->unlock();
+}
+
+BOOST_ATOMIC_DECL void * lockpool::lock_shared(const volatile void * addr)
+{
+    lock_type& l = get_lock_for(addr);
+    l.lock_shared();
+    return &l;
+}
 
-// NOTE: This function must NOT be inline. Otherwise MSVC 9 will sometimes generate broken code for modulus operation which result in crashes.
-BOOST_ATOMIC_DECL lockpool::lock_type& lockpool::get_lock_for(const volatile void* addr)
+BOOST_ATOMIC_DECL void lockpool::unlock_shared(void * lock)
 {
-    std::size_t index = reinterpret_cast<std::size_t>(addr) % (sizeof(lock_pool_) / sizeof(*lock_pool_));
-    return lock_pool_[index];
+    static_cast<lock_type *>(lock)->unlock_shared();
 }
 
 }
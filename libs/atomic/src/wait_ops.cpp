@@ -0,0 +1,207 @@
+//  Copyright (c) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+
+#if defined(__linux__)
+#include <climits>
+#include <cstring>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#define BOOST_ATOMIC_HAS_FUTEX
+#endif
+
+#if defined(BOOST_HAS_PTHREADS)
+#include <pthread.h>
+#elif defined(BOOST_WINDOWS) && defined(_WIN32_WINNT) && (_WIN32_WINNT >= 0x0600)
+#include <windows.h>
+#define BOOST_ATOMIC_HAS_WIN32_CONDITION_VARIABLE
+#elif defined(BOOST_WINDOWS)
+#include <windows.h>
+#endif
+
+// Number of entries in the table of waiters, has to be a power of two.
+#ifndef BOOST_ATOMIC_WAIT_TABLE_SIZE
+#define BOOST_ATOMIC_WAIT_TABLE_SIZE 64
+#endif
+
+#ifndef BOOST_ATOMIC_CACHE_LINE_SIZE
+#define BOOST_ATOMIC_CACHE_LINE_SIZE 64
+#endif
+
+namespace boost {
+namespace atomics {
+namespace detail {
+
+namespace {
+
+BOOST_STATIC_ASSERT((BOOST_ATOMIC_WAIT_TABLE_SIZE & (BOOST_ATOMIC_WAIT_TABLE_SIZE - 1)) == 0);
+
+// An entry of the table. epoch is incremented by every notify that finds
+// waiters, and block waits for it to change; waiters counts the threads
+// between prepare_wait and the end of block or cancel_wait.
+class waiter_list
+{
+public:
+    waiter_list() : waiters_(0), epoch_(0)
+    {
+#if defined(BOOST_HAS_PTHREADS)
+        pthread_mutex_init(&mutex_, 0);
+        pthread_cond_init(&cond_, 0);
+#elif defined(BOOST_ATOMIC_HAS_WIN32_CONDITION_VARIABLE)
+        InitializeSRWLock(&mutex_);
+        InitializeConditionVariable(&cond_);
+#endif
+    }
+
+    unsigned int prepare_wait()
+    {
+        waiters_.fetch_add(1, memory_order_seq_cst);
+        // pairs with the fence in notify: either the waiter sees the new
+        // value of the object, or notify sees the waiter
+        atomic_thread_fence(memory_order_seq_cst);
+        return epoch_.load(memory_order_acquire);
+    }
+
+    void cancel_wait()
+    {
+        waiters_.fetch_sub(1, memory_order_relaxed);
+    }
+
+    void block(unsigned int epoch)
+    {
+#if defined(BOOST_HAS_PTHREADS)
+        pthread_mutex_lock(&mutex_);
+        while (epoch_.load(memory_order_relaxed) == epoch)
+            pthread_cond_wait(&cond_, &mutex_);
+        pthread_mutex_unlock(&mutex_);
+#elif defined(BOOST_ATOMIC_HAS_WIN32_CONDITION_VARIABLE)
+        AcquireSRWLockExclusive(&mutex_);
+        while (epoch_.load(memory_order_relaxed) == epoch)
+            SleepConditionVariableSRW(&cond_, &mutex_, INFINITE, 0);
+        ReleaseSRWLockExclusive(&mutex_);
+#elif defined(BOOST_WINDOWS)
+        // no condition variables before Vista: give up the time slice, and
+        // let atomic<T>::wait check the object again
+        if (epoch_.load(memory_order_acquire) == epoch)
+            Sleep(0);
+#endif
+        waiters_.fetch_sub(1, memory_order_relaxed);
+    }
+
+    bool has_waiters()
+    {
+        atomic_thread_fence(memory_order_seq_cst);
+        return waiters_.load(memory_order_relaxed) != 0;
+    }
+
+    void notify_all()
+    {
+#if defined(BOOST_HAS_PTHREADS)
+        pthread_mutex_lock(&mutex_);
+        epoch_.fetch_add(1, memory_order_release);
+        pthread_cond_broadcast(&cond_);
+        pthread_mutex_unlock(&mutex_);
+#elif defined(BOOST_ATOMIC_HAS_WIN32_CONDITION_VARIABLE)
+        AcquireSRWLockExclusive(&mutex_);
+        epoch_.fetch_add(1, memory_order_release);
+        ReleaseSRWLockExclusive(&mutex_);
+        WakeAllConditionVariable(&cond_);
+#else
+        epoch_.fetch_add(1, memory_order_release);
+#endif
+    }
+
+private:
+    atomic<unsigned int> waiters_;
+    atomic<unsigned int> epoch_;
+#if defined(BOOST_HAS_PTHREADS)
+    pthread_mutex_t mutex_;
+    pthread_cond_t cond_;
+#elif defined(BOOST_ATOMIC_HAS_WIN32_CONDITION_VARIABLE)
+    SRWLOCK mutex_;
+    CONDITION_VARIABLE cond_;
+#endif
+};
+
+// Every entry gets a cache line of its own, see lockpool.cpp.
+struct padded_waiter_list
+{
+    waiter_list list;
+    char padding[BOOST_ATOMIC_CACHE_LINE_SIZE - sizeof(waiter_list) % BOOST_ATOMIC_CACHE_LINE_SIZE];
+};
+
+padded_waiter_list wait_table_[BOOST_ATOMIC_WAIT_TABLE_SIZE];
+
+inline waiter_list& get_waiter_list(const volatile void * addr)
+{
+    boost::uint64_t h = static_cast<boost::uint64_t>(reinterpret_cast<std::size_t>(addr) >> 2);
+    h *= UINT64_C(0x9E3779B97F4A7C15);
+    return wait_table_[static_cast<std::size_t>(h >> 32) & (BOOST_ATOMIC_WAIT_TABLE_SIZE - 1)].list;
+}
+
+#ifdef BOOST_ATOMIC_HAS_FUTEX
+inline void futex_wait(const volatile void * addr, boost::uint32_t old)
+{
+    ::syscall(SYS_futex, const_cast<void *>(addr), FUTEX_WAIT_PRIVATE, old, 0, 0, 0);
+}
+
+inline void futex_wake(const volatile void * addr, int count)
+{
+    ::syscall(SYS_futex, const_cast<void *>(addr), FUTEX_WAKE_PRIVATE, count, 0, 0, 0);
+}
+#endif
+
+}
+
+BOOST_ATOMIC_DECL unsigned int wait_ops::prepare_wait(const volatile void * addr)
+{
+    return get_waiter_list(addr).prepare_wait();
+}
+
+BOOST_ATOMIC_DECL void wait_ops::cancel_wait(const volatile void * addr)
+{
+    get_waiter_list(addr).cancel_wait();
+}
+
+BOOST_ATOMIC_DECL void wait_ops::block(const volatile void * addr, std::size_t size, const void * old, unsigned int epoch)
+{
+    waiter_list& list = get_waiter_list(addr);
+#ifdef BOOST_ATOMIC_HAS_FUTEX
+    if (size == sizeof(boost::uint32_t)) {
+        boost::uint32_t old_value;
+        std::memcpy(&old_value, old, sizeof(old_value));
+        futex_wait(addr, old_value);
+        list.cancel_wait();
+        return;
+    }
+#endif
+    list.block(epoch);
+}
+
+BOOST_ATOMIC_DECL void wait_ops::notify(const volatile void * addr, std::size_t size, bool all)
+{
+    waiter_list& list = get_waiter_list(addr);
+    if (!list.has_waiters())
+        return;
+
+#ifdef BOOST_ATOMIC_HAS_FUTEX
+    if (size == sizeof(boost::uint32_t)) {
+        futex_wake(addr, all ? INT_MAX : 1);
+        return;
+    }
+#endif
+    // the entry may be shared with other objects, so all of its waiters are
+    // woken up, and the others wait again
+    list.notify_all();
+}
+
+}
+}
+}
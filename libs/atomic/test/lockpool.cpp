@@ -0,0 +1,99 @@
+//  Copyright (c) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks the locks that are used for atomic objects that are not
+// lock-free: distribution of addresses over the pool, mutual exclusion
+// between loads and modifications, and the contention counters.
+
+/* force fallback implementation using locks */
+#define BOOST_ATOMIC_FORCE_FALLBACK 1
+
+#include <set>
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/test/minimal.hpp>
+#include <boost/thread.hpp>
+
+using boost::atomics::detail::lockpool;
+
+struct pair_of_counters
+{
+    boost::uint64_t first;
+    boost::uint64_t second;
+};
+
+static const int iterations = 100000;
+
+static void increment(boost::atomic<pair_of_counters> * a)
+{
+    for (int i = 0; i < iterations; ++i) {
+        pair_of_counters expected = a->load();
+        pair_of_counters desired;
+        do {
+            desired.first = expected.first + 1;
+            desired.second = expected.second + 1;
+        } while (!a->compare_exchange_weak(expected, desired));
+    }
+}
+
+static void check_loads(boost::atomic<pair_of_counters> * a, boost::atomic<bool> * running, bool * torn)
+{
+    while (running->load()) {
+        pair_of_counters value = a->load();
+        if (value.first != value.second)
+            *torn = true;
+    }
+}
+
+int test_main(int, char *[])
+{
+    // the pool has a power of two locks, and objects next to each other
+    // mostly get different locks
+    std::size_t size = lockpool::size();
+    BOOST_REQUIRE(size != 0 && (size & (size - 1)) == 0);
+
+    static pair_of_counters objects[64];
+    std::set<std::size_t> indices;
+    for (std::size_t i = 0; i < 64; ++i) {
+        std::size_t index = lockpool::index_of(&objects[i]);
+        BOOST_CHECK(index < size);
+        indices.insert(index);
+    }
+    BOOST_CHECK(indices.size() >= (size < 64 ? size : 64) / 2);
+
+    lockpool::reset_contention_counts();
+    for (std::size_t i = 0; i < size; ++i)
+        BOOST_CHECK(lockpool::contention_count(i) == 0);
+
+    // loads must never see a half-written value
+    pair_of_counters zero = {0, 0};
+    boost::atomic<pair_of_counters> a(zero);
+    BOOST_CHECK(!a.is_lock_free());
+
+    boost::atomic<bool> running(true);
+    bool torn = false;
+
+    boost::thread_group readers;
+    for (int i = 0; i < 2; ++i)
+        readers.create_thread(boost::bind(check_loads, &a, &running, &torn));
+
+    boost::thread_group writers;
+    for (int i = 0; i < 2; ++i)
+        writers.create_thread(boost::bind(increment, &a));
+    writers.join_all();
+
+    running.store(false);
+    readers.join_all();
+
+    pair_of_counters result = a.load();
+    BOOST_CHECK(result.first == 2 * iterations);
+    BOOST_CHECK(result.second == 2 * iterations);
+    BOOST_CHECK(!torn);
+
+    return 0;
+}
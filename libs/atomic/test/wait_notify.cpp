@@ -0,0 +1,102 @@
+//  Copyright (c) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0.
+//  See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+// Checks atomic<T>::wait, notify_one and notify_all: for objects of 4
+// bytes (waited for with a futex on Linux), of other sizes, and of
+// structures that have no lock-free implementation.
+
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/test/minimal.hpp>
+#include <boost/thread.hpp>
+
+struct triple
+{
+    boost::uint32_t a, b, c;
+};
+
+inline bool operator==(triple const& x, triple const& y)
+{
+    return x.a == y.a && x.b == y.b && x.c == y.c;
+}
+
+// small enough for the value to fit into a byte
+static const int rounds = 100;
+
+// ping-pong between two threads: the main thread sets odd values, the
+// other one even values, and each waits for the other one's turn
+template<typename T>
+static void pong(boost::atomic<T> * a)
+{
+    for (int i = 0; i < rounds; ++i) {
+        a->wait(static_cast<T>(2 * i));
+        a->store(static_cast<T>(2 * i + 2));
+        a->notify_one();
+    }
+}
+
+template<typename T>
+static void test_ping_pong(void)
+{
+    boost::atomic<T> a(0);
+    boost::thread other(boost::bind(pong<T>, &a));
+    for (int i = 0; i < rounds; ++i) {
+        a.store(static_cast<T>(2 * i + 1));
+        a.notify_one();
+        a.wait(static_cast<T>(2 * i + 1));
+        BOOST_CHECK(a.load() == static_cast<T>(2 * i + 2));
+    }
+    other.join();
+}
+
+template<typename T>
+static void wait_for(boost::atomic<T> * a, T old, boost::atomic<int> * woken)
+{
+    a->wait(old);
+    woken->fetch_add(1);
+}
+
+template<typename T>
+static void test_notify_all(T old, T value)
+{
+    boost::atomic<T> a(old);
+    boost::atomic<int> woken(0);
+
+    boost::thread_group waiters;
+    for (int i = 0; i < 4; ++i)
+        waiters.create_thread(boost::bind(wait_for<T>, &a, old, &woken));
+
+    boost::this_thread::sleep(boost::posix_time::milliseconds(50));
+    BOOST_CHECK(woken.load() == 0);
+
+    a.store(value);
+    a.notify_all();
+    waiters.join_all();
+    BOOST_CHECK(woken.load() == 4);
+}
+
+int test_main(int, char *[])
+{
+    // wait returns at once if the value differs
+    boost::atomic<int> i(1);
+    i.wait(0);
+    i.notify_one();
+    i.notify_all();
+
+    test_ping_pong<boost::uint32_t>();
+    test_ping_pong<boost::uint8_t>();
+    test_ping_pong<boost::uint64_t>();
+
+    test_notify_all<int>(0, 1);
+    test_notify_all<boost::uint16_t>(0, 1);
+    test_notify_all<boost::uint64_t>(0, 1);
+
+    triple x = {1, 2, 3}, y = {1, 2, 4};
+    test_notify_all<triple>(x, y);
+
+    return 0;
+}
@@ -0,0 +1,299 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/container for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/container/detail/config_begin.hpp>
+#include <memory>
+#include <vector>
+#include <set>
+#include <map>
+#include <iostream>
+#include <functional>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/container/flat_map.hpp>
+#include <boost/container/flat_set.hpp>
+#include <boost/container/scoped_allocator.hpp>
+#include <boost/move/utility.hpp>
+#include "check_equal_containers.hpp"
+#include "movable_int.hpp"
+#include "dummy_test_allocator.hpp"
+#include "vector_test.hpp"
+#include "set_test.hpp"
+#include "map_test.hpp"
+
+using namespace boost::container;
+
+namespace boost {
+namespace container {
+
+//Explicit instantiation to detect compilation errors
+template class boost::container::small_vector<test::movable_and_copyable_int, 10>;
+
+template class boost::container::vector<test::movable_and_copyable_int,
+   small_vector_allocator<test::movable_and_copyable_int, 10> >;
+
+template class boost::container::vector<test::movable_and_copyable_int,
+   small_vector_allocator<test::movable_and_copyable_int, 10,
+      test::simple_allocator<test::movable_and_copyable_int> > >;
+
+template class flat_map
+   < test::movable_and_copyable_int
+   , test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , small_vector_allocator
+      < std::pair<test::movable_and_copyable_int, test::movable_and_copyable_int>, 10 >
+   >;
+
+template class flat_set
+   < test::movable_and_copyable_int
+   , std::less<test::movable_and_copyable_int>
+   , small_vector_allocator<test::movable_and_copyable_int, 10>
+   >;
+
+}}
+
+//An allocator with a state, to check that the elements get it
+template <class T>
+class state_allocator
+{
+   public:
+   typedef T value_type;
+
+   state_allocator(int state)
+      : m_state(state)
+   {}
+
+   template <class U>
+   state_allocator(const state_allocator<U> &other)
+      : m_state(other.m_state)
+   {}
+
+   T* allocate(std::size_t n)
+   {  return std::allocator<T>().allocate(n);  }
+
+   void deallocate(T* p, std::size_t n)
+   {  std::allocator<T>().deallocate(p, n);  }
+
+   int get_state() const
+   {  return m_state;  }
+
+   friend bool operator==(const state_allocator &l, const state_allocator &r)
+   {  return l.m_state == r.m_state;  }
+
+   friend bool operator!=(const state_allocator &l, const state_allocator &r)
+   {  return l.m_state != r.m_state;  }
+
+   int m_state;
+};
+
+bool is_inside(const void *object, std::size_t object_size, const void *p)
+{
+   std::less_equal<const char *> le;
+   std::less<const char *> lt;
+   const char *begin = static_cast<const char *>(object);
+   return le(begin, static_cast<const char *>(p)) && lt(static_cast<const char *>(p), begin + object_size);
+}
+
+template<class SmallVector>
+bool is_internal(const SmallVector &v)
+{  return is_inside(&v, sizeof(v), &v[0]);  }
+
+bool small_vector_storage_test()
+{
+   typedef small_vector<int, 10> small_vector_t;
+
+   //No memory is allocated for up to 10 elements
+   small_vector_t v;
+   for(int i = 0; i != 10; ++i){
+      v.push_back(i);
+   }
+   if(v.capacity() != 10 || !is_internal(v))
+      return false;
+
+   //More elements are stored in allocated memory
+   v.push_back(10);
+   if(v.capacity() <= 10 || is_internal(v))
+      return false;
+
+   //The allocated memory is taken over by moves
+   const int *data = &v[0];
+   small_vector_t moved(boost::move(v));
+   if(&moved[0] != data || moved.size() != 11 || !v.empty())
+      return false;
+   v = boost::move(moved);
+   if(&v[0] != data || v.size() != 11 || !moved.empty())
+      return false;
+
+   //The internal buffer is not: the elements are moved
+   small_vector_t small(5u, 7);
+   small_vector_t small_moved(boost::move(small));
+   if(!is_internal(small_moved) || small_moved.size() != 5 || small_moved[4] != 7 || !small.empty())
+      return false;
+   small = boost::move(small_moved);
+   if(!is_internal(small) || small.size() != 5 || small[4] != 7 || !small_moved.empty())
+      return false;
+
+   //Swap between the internal buffer and allocated memory
+   small.swap(v);
+   if(small.size() != 11 || &small[0] != data || v.size() != 5 || !is_internal(v) || v[4] != 7)
+      return false;
+   for(int i = 0; i != 11; ++i){
+      if(small[i] != i)
+         return false;
+   }
+   boost::container::swap(small, v);
+   if(v.size() != 11 || &v[0] != data || small.size() != 5 || !is_internal(small))
+      return false;
+
+   //Copies have a buffer of their own
+   small_vector_t copy(small);
+   if(!is_internal(copy) || copy.size() != 5 || &copy[0] == &small[0])
+      return false;
+   copy = v;
+   if(copy.size() != 11 || is_internal(copy))
+      return false;
+
+   //shrink_to_fit moves the elements back into the buffer
+   v.erase(v.begin() + 3, v.end());
+   v.shrink_to_fit();
+   if(!is_internal(v) || v.size() != 3 || v[2] != 2)
+      return false;
+   v.clear();
+   v.shrink_to_fit();
+   if(!v.empty())
+      return false;
+
+   //The buffer is reused after growing and shrinking
+   v.assign(20u, 1);
+   v.resize(2);
+   v.shrink_to_fit();
+   if(!is_internal(v) || v.capacity() != 10)
+      return false;
+
+   //A vector that uses the allocator behaves in the same way
+   typedef vector<int, small_vector_allocator<int, 4> > vector_t;
+   vector_t v4;
+   v4.push_back(1);
+   if(v4.capacity() != 4 || !is_internal(v4))
+      return false;
+   vector_t v4_moved(boost::move(v4));
+   if(!is_internal(v4_moved) || v4_moved.size() != 1 || v4_moved[0] != 1)
+      return false;
+   return true;
+}
+
+bool small_flat_tree_test()
+{
+   typedef flat_map<int, int, std::less<int>, small_vector_allocator<std::pair<int, int>, 8> > small_flat_map_t;
+   typedef flat_set<int, std::less<int>, small_vector_allocator<int, 8> > small_flat_set_t;
+
+   small_flat_map_t m;
+   for(int i = 7; i >= 0; --i){
+      m.insert(std::pair<int, int>(i, i*2));
+   }
+   if(m.size() != 8 || !is_inside(&m, sizeof(m), &*m.begin()))
+      return false;
+   small_flat_map_t m_moved(boost::move(m));
+   if(m_moved.size() != 8 || m_moved.find(3)->second != 6 || !is_inside(&m_moved, sizeof(m_moved), &*m_moved.begin()))
+      return false;
+   m_moved[8] = 16;
+   if(is_inside(&m_moved, sizeof(m_moved), &*m_moved.begin()) || m_moved.size() != 9)
+      return false;
+   m.swap(m_moved);
+   if(m.size() != 9 || !m_moved.empty() || m[8] != 16)
+      return false;
+
+   small_flat_set_t s;
+   s.insert(3);
+   s.insert(1);
+   s.insert(2);
+   small_flat_set_t s_copy(s);
+   if(s_copy.size() != 3 || *s_copy.begin() != 1 || !is_inside(&s_copy, sizeof(s_copy), &*s_copy.begin()))
+      return false;
+
+   #if !defined(BOOST_NO_CXX11_TEMPLATE_ALIASES)
+   small_flat_map<int, int, 8> alias_map(m);
+   small_flat_multimap<int, int, 8> alias_multimap;
+   small_flat_set<int, 8> alias_set(s);
+   small_flat_multiset<int, 8> alias_multiset;
+   if(alias_map.size() != 9 || alias_set.size() != 3)
+      return false;
+   #endif
+   return true;
+}
+
+bool small_vector_scoped_allocator_test()
+{
+   //The elements are constructed with the inner allocator
+   typedef vector<int, state_allocator<int> > inner_vector_t;
+   typedef scoped_allocator_adaptor<state_allocator<inner_vector_t> > scoped_allocator_t;
+   typedef small_vector<inner_vector_t, 2, scoped_allocator_t> small_vector_t;
+
+   small_vector_t v(scoped_allocator_t(5));
+   v.emplace_back();
+   v.emplace_back();
+   v.emplace_back();
+   for(std::size_t i = 0; i != v.size(); ++i){
+      if(v[i].get_allocator().get_state() != 5)
+         return false;
+   }
+   return v.get_stored_allocator().get_base_allocator().get_state() == 5;
+}
+
+int main()
+{
+   using namespace boost::container::test;
+
+   typedef small_vector<int, 10> MyVector;
+   typedef small_vector<test::movable_int, 10> MyMoveVector;
+   typedef small_vector<test::movable_and_copyable_int, 10> MyCopyMoveVector;
+   typedef small_vector<test::copyable_int, 10> MyCopyVector;
+
+   if(test::vector_test<MyVector>())
+      return 1;
+   if(test::vector_test<MyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyMoveVector>())
+      return 1;
+   if(test::vector_test<MyCopyVector>())
+      return 1;
+
+   if(!small_vector_storage_test()){
+      std::cout << "Error in small_vector_storage_test" << std::endl;
+      return 1;
+   }
+
+   if(!small_flat_tree_test()){
+      std::cout << "Error in small_flat_tree_test" << std::endl;
+      return 1;
+   }
+
+   if(!small_vector_scoped_allocator_test()){
+      std::cout << "Error in small_vector_scoped_allocator_test" << std::endl;
+      return 1;
+   }
+
+   typedef flat_set<int, std::less<int>, small_vector_allocator<int, 16> > MyBoostSet;
+   typedef flat_multiset<int, std::less<int>, small_vector_allocator<int, 16> > MyBoostMultiSet;
+   typedef flat_map<int, int, std::less<int>, small_vector_allocator<std::pair<int, int>, 16> > MyBoostMap;
+   typedef flat_multimap<int, int, std::less<int>, small_vector_allocator<std::pair<int, int>, 16> > MyBoostMultiMap;
+
+   if (0 != set_test<MyBoostSet, std::set<int>, MyBoostMultiSet, std::multiset<int> >()){
+      std::cout << "Error in set_test<MyBoostSet>" << std::endl;
+      return 1;
+   }
+
+   if (0 != map_test<MyBoostMap, std::map<int, int>, MyBoostMultiMap, std::multimap<int, int> >()){
+      std::cout << "Error in map_test<MyBoostMap>" << std::endl;
+      return 1;
+   }
+
+   return 0;
+}
+#include <boost/container/detail/config_end.hpp>
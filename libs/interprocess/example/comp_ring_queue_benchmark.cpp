@@ -0,0 +1,154 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// Throughput of message_queue against ring_queue: producer threads send
+// fixed size messages through a queue in shared memory to consumer threads.
+// The queues are shared between threads here, but they are used exactly as
+// they would be from several processes.
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+#include <boost/interprocess/ipc/message_queue.hpp>
+#include <boost/interprocess/ipc/ring_queue.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <iostream>
+#include <string>
+#include "../test/get_process_id_name.hpp"
+
+using namespace boost::interprocess;
+
+struct message
+{
+   unsigned int   sequence;
+   char           payload[28];
+};
+
+typedef allocator<message, managed_shared_memory::segment_manager>   ShmemAllocator;
+
+static const unsigned int NumMsg   = 1000000;
+static const unsigned int Capacity = 1024;
+
+//message_queue only notifies a waiting thread when the queue stops being
+//empty or full, which can leave threads blocked when several of them wait:
+//retry after a while instead of blocking forever. Try first, so that
+//the clock is only read when the queue is full or empty
+boost::posix_time::ptime retry_time()
+{  return microsec_clock::universal_time() + boost::posix_time::milliseconds(10);  }
+
+void mq_producer(message_queue *mq, unsigned int n)
+{
+   message m = message();
+   for(unsigned int i = 0; i < n; ++i){
+      m.sequence = i;
+      while(!mq->try_send(&m, sizeof(m), 0) &&
+            !mq->timed_send(&m, sizeof(m), 0, retry_time())){
+      }
+   }
+}
+
+void mq_consumer(message_queue *mq, unsigned int n)
+{
+   message m;
+   message_queue::size_type recvd_size;
+   unsigned int priority;
+   for(unsigned int i = 0; i < n; ++i){
+      while(!mq->try_receive(&m, sizeof(m), recvd_size, priority) &&
+            !mq->timed_receive(&m, sizeof(m), recvd_size, priority, retry_time())){
+      }
+   }
+}
+
+template<class Queue>
+void ring_producer(Queue *q, unsigned int n)
+{
+   message m = message();
+   for(unsigned int i = 0; i < n; ++i){
+      m.sequence = i;
+      q->push(m);
+   }
+}
+
+template<class Queue>
+void ring_consumer(Queue *q, unsigned int n)
+{
+   message m;
+   for(unsigned int i = 0; i < n; ++i){
+      q->pop(m);
+   }
+}
+
+//Runs the producers and the consumers, NumMsg messages in all,
+//and returns the number of messages per second
+template<class Producer, class Consumer>
+double run(Producer producer, Consumer consumer, unsigned int producers, unsigned int consumers)
+{
+   boost::thread_group threads;
+   const boost::posix_time::ptime start(microsec_clock::universal_time());
+   for(unsigned int i = 0; i < consumers; ++i){
+      threads.create_thread(boost::bind(consumer, NumMsg/consumers));
+   }
+   for(unsigned int i = 0; i < producers; ++i){
+      threads.create_thread(boost::bind(producer, NumMsg/producers));
+   }
+   threads.join_all();
+   const boost::posix_time::time_duration elapsed(microsec_clock::universal_time() - start);
+   const double us = double(elapsed.total_microseconds());
+   return us > 0 ? double(NumMsg/producers*producers)*1000000.0/us : 0.0;
+}
+
+template<bool SingleProducer>
+double run_ring(managed_shared_memory &segment, unsigned int producers, unsigned int consumers)
+{
+   typedef ring_queue<message, ShmemAllocator, SingleProducer> queue_t;
+   queue_t *q = segment.construct<queue_t>("queue")(Capacity, segment.get_segment_manager());
+   const double rate = run( boost::bind(&ring_producer<queue_t>, q, _1)
+                          , boost::bind(&ring_consumer<queue_t>, q, _1)
+                          , producers, consumers);
+   segment.destroy<queue_t>("queue");
+   return rate;
+}
+
+int main()
+{
+   const std::string mq_name(test::add_to_process_id_name("mq"));
+   const std::string shm_name(test::add_to_process_id_name("shm"));
+   const unsigned int sizes[][2] = { {1, 1}, {1, 4}, {4, 4} };
+
+   for(unsigned int s = 0; s < sizeof(sizes)/sizeof(sizes[0]); ++s){
+      const unsigned int producers = sizes[s][0], consumers = sizes[s][1];
+      std::cout << producers << " producer(s), " << consumers << " consumer(s)" << std::endl;
+      {
+         message_queue::remove(mq_name.c_str());
+         message_queue mq(create_only, mq_name.c_str(), Capacity, sizeof(message));
+         const double rate = run( boost::bind(&mq_producer, &mq, _1)
+                                , boost::bind(&mq_consumer, &mq, _1)
+                                , producers, consumers);
+         std::cout << "  message_queue:             " << rate << " msgs/s" << std::endl;
+         message_queue::remove(mq_name.c_str());
+      }
+      {
+         shared_memory_object::remove(shm_name.c_str());
+         managed_shared_memory segment(create_only, shm_name.c_str(), 1 << 20);
+         if(producers == 1){
+            std::cout << "  ring_queue single producer: " << run_ring<true>(segment, producers, consumers)
+                      << " msgs/s" << std::endl;
+         }
+         std::cout << "  ring_queue:                " << run_ring<false>(segment, producers, consumers)
+                   << " msgs/s" << std::endl;
+      }
+      shared_memory_object::remove(shm_name.c_str());
+   }
+   return 0;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/detail/workaround.hpp>
+//[doc_ring_queue
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/interprocess/ipc/ring_queue.hpp>
+#include <string>
+#include <cstdlib> //std::system
+//<-
+#include "../test/get_process_id_name.hpp"
+//->
+
+using namespace boost::interprocess;
+
+//A market data update: plain data that can be copied between processes
+struct quote
+{
+   int            instrument;
+   double         price;
+   unsigned int   sequence;
+};
+
+//The slots of the queue are allocated from the managed_shared_memory
+typedef allocator<quote, managed_shared_memory::segment_manager>  ShmemAllocator;
+
+//A queue with a single producer, the child process
+typedef ring_queue<quote, ShmemAllocator, true> QuoteQueue;
+
+static const unsigned int NumQuotes = 1000;
+
+//Main function. For parent process argc == 1, for child process argc == 2
+int main(int argc, char *argv[])
+{
+   if(argc == 1){ //Parent process
+      //Remove shared memory on construction and destruction
+      struct shm_remove
+      {
+      //<-
+      #if 1
+         shm_remove() { shared_memory_object::remove(test::get_process_id_name()); }
+         ~shm_remove(){ shared_memory_object::remove(test::get_process_id_name()); }
+      #else
+      //->
+         shm_remove() { shared_memory_object::remove("MySharedMemory"); }
+         ~shm_remove(){ shared_memory_object::remove("MySharedMemory"); }
+      //<-
+      #endif
+      //->
+      } remover;
+      //<-
+      (void)remover;
+      //->
+
+      //Create a new segment with given name and size
+      //<-
+      #if 1
+      managed_shared_memory segment(create_only, test::get_process_id_name(), 65536);
+      #else
+      //->
+      managed_shared_memory segment(create_only, "MySharedMemory", 65536);
+      //<-
+      #endif
+      //->
+
+      //Construct a queue of 1024 quotes named "QuoteQueue" in shared memory
+      QuoteQueue *queue = segment.construct<QuoteQueue>("QuoteQueue")
+         (1024u, ShmemAllocator(segment.get_segment_manager()));
+
+      //Launch child process, that will send the quotes
+      std::string s(argv[0]); s += " child ";
+      //<-
+      s += test::get_process_id_name();
+      //->
+      if(0 != std::system(s.c_str()))
+         return 1;
+
+      //Receive the quotes in order. try_pop() returns false if the queue is empty
+      quote q;
+      for(unsigned int i = 0; i < NumQuotes; ++i){
+         if(!queue->try_pop(q) || q.sequence != i)
+            return 1;
+      }
+      if(!queue->empty())
+         return 1;
+
+      //When done, destroy the queue from the segment
+      segment.destroy<QuoteQueue>("QuoteQueue");
+   }
+   else{ //Child process
+      //Open the managed segment
+      //<-
+      #if 1
+      managed_shared_memory segment(open_only, argv[2]);
+      #else
+      //->
+      managed_shared_memory segment(open_only, "MySharedMemory");
+      //<-
+      #endif
+      //->
+
+      //Find the queue using the c-string name
+      QuoteQueue *queue = segment.find<QuoteQueue>("QuoteQueue").first;
+      if(!queue)
+         return 1;
+
+      //Send the quotes. push() would block if the queue were full
+      for(unsigned int i = 0; i < NumQuotes; ++i){
+         quote q = { int(i % 16), 100.0 + i, i };
+         queue->push(q);
+      }
+   }
+
+   return 0;
+}
+
+//]
+#include <boost/interprocess/detail/config_end.hpp>
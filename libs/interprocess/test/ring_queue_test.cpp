@@ -0,0 +1,240 @@
+//////////////////////////////////////////////////////////////////////////////
+//
+// (C) Copyright Joshua Napoli 2026. Distributed under the Boost
+// Software License, Version 1.0. (See accompanying file
+// LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// See http://www.boost.org/libs/interprocess for documentation.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#include <boost/interprocess/detail/config_begin.hpp>
+#include <boost/interprocess/ipc/ring_queue.hpp>
+#include <boost/interprocess/managed_shared_memory.hpp>
+#include <boost/interprocess/allocators/allocator.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <vector>
+#include <cstddef>
+#include "get_process_id_name.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+//                                                                            //
+//  This example tests the process shared ring queue.                         //
+//                                                                            //
+////////////////////////////////////////////////////////////////////////////////
+
+using namespace boost::interprocess;
+
+typedef allocator<int, managed_shared_memory::segment_manager> int_allocator_t;
+
+//Counts its live instances, to check the queue destroys what it holds
+struct counted
+{
+   static int live;
+
+   counted(int v = 0) : value(v) {  ++live;  }
+   counted(const counted &o) : value(o.value) {  ++live;  }
+   ~counted() {  --live;  }
+   counted &operator=(const counted &o) {  value = o.value;  return *this;  }
+
+   int value;
+};
+
+int counted::live = 0;
+
+//This test fills and empties the queue in a single thread, many times
+//so that the positions wrap around the slots, and checks elements come
+//out in FIFO order
+template<bool SingleProducer>
+bool test_fifo_order()
+{
+   typedef ring_queue<int, int_allocator_t, SingleProducer> queue_t;
+   shared_memory_object::remove(test::get_process_id_name());
+   {
+      managed_shared_memory segment(create_only, test::get_process_id_name(), 65536);
+      queue_t *q = segment.construct<queue_t>("queue")(5u, segment.get_segment_manager());
+
+      //The capacity is rounded up to a power of two
+      if(q->capacity() != 8 || !q->empty()){
+         return false;
+      }
+      int value = 0;
+      if(q->try_pop(value)){
+         return false;
+      }
+      int next = 0;
+      for(int round = 0; round < 100; ++round){
+         int pushed = 0;
+         while(q->try_push(next + pushed)){
+            ++pushed;
+         }
+         if(pushed != 8 || q->size() != 8){
+            return false;
+         }
+         for(int i = 0; i < pushed; ++i){
+            if(!q->try_pop(value) || value != next++){
+               return false;
+            }
+         }
+         if(!q->empty()){
+            return false;
+         }
+      }
+      segment.destroy<queue_t>("queue");
+   }
+   shared_memory_object::remove(test::get_process_id_name());
+   return true;
+}
+
+//This test checks that timed operations give up when the queue
+//stays full or empty
+bool test_timeout()
+{
+   typedef ring_queue<int, int_allocator_t> queue_t;
+   shared_memory_object::remove(test::get_process_id_name());
+   {
+      managed_shared_memory segment(create_only, test::get_process_id_name(), 65536);
+      queue_t *q = segment.construct<queue_t>("queue")(2u, segment.get_segment_manager());
+
+      int value = 0;
+      boost::posix_time::ptime abs_time =
+         microsec_clock::universal_time() + boost::posix_time::milliseconds(100);
+      if(q->timed_pop(value, abs_time)){
+         return false;
+      }
+      if(microsec_clock::universal_time() < abs_time){
+         return false;
+      }
+      q->push(1);
+      q->push(2);
+      abs_time = microsec_clock::universal_time() + boost::posix_time::milliseconds(100);
+      if(q->timed_push(3, abs_time)){
+         return false;
+      }
+      if(microsec_clock::universal_time() < abs_time){
+         return false;
+      }
+      if(!q->timed_pop(value, boost::posix_time::pos_infin) || value != 1){
+         return false;
+      }
+      segment.destroy<queue_t>("queue");
+   }
+   shared_memory_object::remove(test::get_process_id_name());
+   return true;
+}
+
+//This test checks that the elements left in the queue are destroyed
+//with it, and that popped ones are destroyed in their slots
+bool test_destruction()
+{
+   typedef allocator<counted, managed_shared_memory::segment_manager> counted_allocator_t;
+   typedef ring_queue<counted, counted_allocator_t> queue_t;
+   shared_memory_object::remove(test::get_process_id_name());
+   {
+      managed_shared_memory segment(create_only, test::get_process_id_name(), 65536);
+      const managed_shared_memory::size_type free_memory = segment.get_free_memory();
+      queue_t *q = segment.construct<queue_t>("queue")(4u, segment.get_segment_manager());
+      {
+         counted c;
+         q->push(c);
+         q->push(c);
+         q->push(c);
+         q->pop(c);
+         if(counted::live != 3){
+            return false;
+         }
+      }
+      segment.destroy<queue_t>("queue");
+      if(counted::live != 0 || segment.get_free_memory() != free_memory){
+         return false;
+      }
+   }
+   shared_memory_object::remove(test::get_process_id_name());
+   return true;
+}
+
+static const int NumMsg = 100000;
+
+template<class Queue>
+void producer(Queue *q, int id, int producers)
+{
+   for(int i = id; i < NumMsg; i += producers){
+      q->push(i);
+   }
+}
+
+template<class Queue>
+void consumer(Queue *q, std::vector<int> *received, int count)
+{
+   int value;
+   for(int i = 0; i < count; ++i){
+      q->pop(value);
+      ++(*received)[value];
+   }
+}
+
+//This test pushes and pops through a small queue from several threads,
+//so that they block, and checks every element is received exactly once
+template<bool SingleProducer>
+bool test_threads(int producers, int consumers)
+{
+   typedef ring_queue<int, int_allocator_t, SingleProducer> queue_t;
+   shared_memory_object::remove(test::get_process_id_name());
+   {
+      managed_shared_memory segment(create_only, test::get_process_id_name(), 65536);
+      queue_t *q = segment.construct<queue_t>("queue")(4u, segment.get_segment_manager());
+
+      std::vector<std::vector<int> > received(consumers, std::vector<int>(NumMsg, 0));
+      boost::thread_group threads;
+      for(int i = 0; i < consumers; ++i){
+         const int count = NumMsg / consumers + (i < NumMsg % consumers ? 1 : 0);
+         threads.create_thread(boost::bind(&consumer<queue_t>, q, &received[i], count));
+      }
+      for(int i = 0; i < producers; ++i){
+         threads.create_thread(boost::bind(&producer<queue_t>, q, i, producers));
+      }
+      threads.join_all();
+
+      for(int v = 0; v < NumMsg; ++v){
+         int times = 0;
+         for(int i = 0; i < consumers; ++i){
+            times += received[i][v];
+         }
+         if(times != 1){
+            return false;
+         }
+      }
+      if(!q->empty()){
+         return false;
+      }
+      segment.destroy<queue_t>("queue");
+   }
+   shared_memory_object::remove(test::get_process_id_name());
+   return true;
+}
+
+int main ()
+{
+   if(!test_fifo_order<false>()){
+      return 1;
+   }
+   if(!test_fifo_order<true>()){
+      return 1;
+   }
+   if(!test_timeout()){
+      return 1;
+   }
+   if(!test_destruction()){
+      return 1;
+   }
+   if(!test_threads<true>(1, 3)){
+      return 1;
+   }
+   if(!test_threads<false>(3, 3)){
+      return 1;
+   }
+   return 0;
+}
+
+#include <boost/interprocess/detail/config_end.hpp>
@@ -0,0 +1,175 @@
+//  Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/lockfree/queue.hpp>
+#include <boost/lockfree/stack.hpp>
+
+#define BOOST_TEST_MAIN
+#ifdef BOOST_LOCKFREE_INCLUDE_TESTS
+#include <boost/test/included/unit_test.hpp>
+#else
+#include <boost/test/unit_test.hpp>
+#endif
+
+#include <cassert>
+#include <vector>
+#include <stdexcept>
+
+#include "test_helpers.hpp"
+
+using boost::lockfree::detail::atomic;
+
+// pushes and pops elements in batches from several threads, and checks that every element is popped exactly once
+struct bulk_stress_tester
+{
+    static const unsigned int buckets = 1<<13;
+#ifndef BOOST_LOCKFREE_STRESS_TEST
+    static const long node_count = 4992;
+#else
+    static const long node_count = 499200;
+#endif
+    static const int batch = 16;   /* node_count is a multiple of batch */
+    static const int thread_count = 4;
+
+    static_hashed_set<long, buckets> data;
+    static_hashed_set<long, buckets> dequeued;
+
+    atomic<int> writers_finished;
+    atomic<long> push_count, pop_count;
+
+    bulk_stress_tester(void):
+        writers_finished(0), push_count(0), pop_count(0)
+    {}
+
+    template <typename container>
+    void add_items(container & c)
+    {
+        std::vector<long> ids;
+        for (long i = 0; i < node_count; i += batch) {
+            ids.clear();
+            for (int j = 0; j != batch; ++j) {
+                long id = generate_id<long>();
+                bool inserted = data.insert(id);
+                assert(inserted);
+                ids.push_back(id);
+            }
+
+            std::vector<long>::const_iterator it = ids.begin();
+            while (it != ids.end())
+                it = c.bounded_push(it, std::vector<long>::const_iterator(ids.end()));
+            push_count += batch;
+        }
+        writers_finished += 1;
+    }
+
+    template <typename container>
+    bool consume_items(container & c)
+    {
+        long ids[batch];
+        std::size_t count = c.pop(ids, batch);
+
+        for (std::size_t i = 0; i != count; ++i) {
+            bool erased = data.erase(ids[i]);
+            bool inserted = dequeued.insert(ids[i]);
+            assert(erased);
+            assert(inserted);
+        }
+        pop_count += static_cast<long>(count);
+        return count != 0;
+    }
+
+    template <typename container>
+    void get_items(container & c)
+    {
+        for (;;) {
+            if (consume_items(c))
+                continue;
+
+            if (writers_finished.load() == thread_count)
+                break;
+        }
+
+        while (consume_items(c));
+    }
+
+    template <typename container>
+    void run(container & c)
+    {
+        boost::thread_group writers;
+        boost::thread_group readers;
+
+        for (int i = 0; i != thread_count; ++i)
+            readers.create_thread(boost::bind(&bulk_stress_tester::template get_items<container>, this, boost::ref(c)));
+
+        for (int i = 0; i != thread_count; ++i)
+            writers.create_thread(boost::bind(&bulk_stress_tester::template add_items<container>, this, boost::ref(c)));
+
+        writers.join_all();
+        readers.join_all();
+
+        BOOST_REQUIRE_EQUAL(data.count_nodes(), (size_t)0);
+        BOOST_REQUIRE(c.empty());
+        BOOST_REQUIRE_EQUAL(push_count.load(), pop_count.load());
+        BOOST_REQUIRE_EQUAL(push_count.load(), thread_count * node_count);
+    }
+};
+
+BOOST_AUTO_TEST_CASE( queue_bulk_stress_test )
+{
+    boost::scoped_ptr<bulk_stress_tester> tester(new bulk_stress_tester);
+    boost::lockfree::queue<long> q(128);
+    tester->run(q);
+}
+
+BOOST_AUTO_TEST_CASE( queue_fixedsize_bulk_stress_test )
+{
+    boost::scoped_ptr<bulk_stress_tester> tester(new bulk_stress_tester);
+    boost::lockfree::queue<long, boost::lockfree::capacity<64> > q;
+    tester->run(q);
+}
+
+BOOST_AUTO_TEST_CASE( stack_bulk_stress_test )
+{
+    boost::scoped_ptr<bulk_stress_tester> tester(new bulk_stress_tester);
+    boost::lockfree::stack<long> s(128);
+    tester->run(s);
+}
+
+BOOST_AUTO_TEST_CASE( stack_fixedsize_bulk_stress_test )
+{
+    boost::scoped_ptr<bulk_stress_tester> tester(new bulk_stress_tester);
+    boost::lockfree::stack<long, boost::lockfree::capacity<64> > s;
+    tester->run(s);
+}
+
+// throws from its copy constructor once copies_left reaches zero
+struct throwing_copy
+{
+    static int copies_left;
+
+    throwing_copy(void) {}
+    throwing_copy(throwing_copy const &)
+    {
+        if (copies_left-- == 0)
+            throw std::runtime_error("copy");
+    }
+};
+
+int throwing_copy::copies_left = 0;
+
+BOOST_AUTO_TEST_CASE( stack_bulk_push_exception_test )
+{
+    boost::lockfree::stack<throwing_copy, boost::lockfree::capacity<32> > s;
+    std::vector<throwing_copy> items(32);
+
+    // the copy in the middle of a batch throws, no node may be lost
+    throwing_copy::copies_left = 10;
+    BOOST_REQUIRE_THROW(s.bounded_push(items.begin(), items.end()), std::runtime_error);
+    BOOST_REQUIRE(s.empty());
+
+    throwing_copy::copies_left = 1000;
+    BOOST_REQUIRE(s.bounded_push(items.begin(), items.end()) == items.end());
+}
@@ -92,6 +92,8 @@ void run_tests(void)
     run_test<boost::lockfree::detail::freelist_stack<dummy>, true, bounded>();
     run_test<boost::lockfree::detail::freelist_stack<dummy>, false, bounded>();
     run_test<boost::lockfree::detail::fixed_size_freelist<dummy>, true, bounded>();
+    run_test<boost::lockfree::detail::cached_freelist_stack<dummy>, true, bounded>();
+    run_test<boost::lockfree::detail::cached_freelist_stack<dummy>, false, bounded>();
 }
 
 BOOST_AUTO_TEST_CASE( freelist_tests )
@@ -119,9 +121,50 @@ BOOST_AUTO_TEST_CASE( oom_tests )
     oom_test<boost::lockfree::detail::freelist_stack<dummy>, false >();
     oom_test<boost::lockfree::detail::fixed_size_freelist<dummy>, true >();
     oom_test<boost::lockfree::detail::fixed_size_freelist<dummy>, false >();
+    oom_test<boost::lockfree::detail::cached_freelist_stack<dummy>, true >();
+    oom_test<boost::lockfree::detail::cached_freelist_stack<dummy>, false >();
 }
 
 
+template <typename freelist_type, bool threadsafe>
+void batch_test(void)
+{
+    freelist_type fl(std::allocator<int>(), 8);
+
+    dummy * nodes[16];
+    BOOST_REQUIRE_EQUAL((fl.template allocate_n<threadsafe, true>(nodes, 5)), 5u);
+    BOOST_REQUIRE_EQUAL((fl.template allocate_n<threadsafe, true>(nodes + 5, 5)), 3u);
+    BOOST_REQUIRE_EQUAL((fl.template allocate_n<threadsafe, true>(nodes + 8, 1)), 0u);
+
+    std::set<dummy*> distinct(nodes, nodes + 8);
+    BOOST_REQUIRE_EQUAL(distinct.size(), 8u);
+
+    fl.template deallocate_n<threadsafe>(nodes, 6);
+    fl.template deallocate_n<threadsafe>(nodes + 6, 2);
+
+    BOOST_REQUIRE_EQUAL((fl.template allocate_n<threadsafe, true>(nodes, 16)), 8u);
+    std::set<dummy*> reallocated(nodes, nodes + 8);
+    BOOST_REQUIRE(reallocated == distinct);
+
+    fl.template deallocate_n<threadsafe>(nodes, 8);
+}
+
+BOOST_AUTO_TEST_CASE( batch_tests )
+{
+    batch_test<boost::lockfree::detail::freelist_stack<dummy>, true >();
+    batch_test<boost::lockfree::detail::freelist_stack<dummy>, false >();
+    batch_test<boost::lockfree::detail::fixed_size_freelist<dummy>, true >();
+    batch_test<boost::lockfree::detail::fixed_size_freelist<dummy>, false >();
+
+    // unbounded freelists allocate the nodes that are missing
+    boost::lockfree::detail::freelist_stack<dummy> fl(std::allocator<int>(), 2);
+    dummy * nodes[4];
+    BOOST_REQUIRE_EQUAL((fl.allocate_n<true, false>(nodes, 4)), 4u);
+    fl.deallocate_n<true>(nodes, 4);
+    BOOST_REQUIRE_EQUAL((fl.allocate_n<true, true>(nodes, 4)), 4u);
+    fl.deallocate_n<true>(nodes, 4);
+}
+
 template <typename freelist_type, bool bounded>
 struct freelist_tester
 {
@@ -228,3 +271,37 @@ BOOST_AUTO_TEST_CASE( fixed_size_freelist_test )
     typedef freelist_tester<boost::lockfree::detail::fixed_size_freelist<dummy>, true > test_type;
     run_tester<test_type>();
 }
+
+BOOST_AUTO_TEST_CASE( unbounded_cached_freelist_test )
+{
+    typedef freelist_tester<boost::lockfree::detail::cached_freelist_stack<dummy>, false > test_type;
+    run_tester<test_type>();
+}
+
+BOOST_AUTO_TEST_CASE( bounded_cached_freelist_test )
+{
+    typedef freelist_tester<boost::lockfree::detail::cached_freelist_stack<dummy>, true > test_type;
+    run_tester<test_type>();
+}
+
+// nodes, which are cached by one thread, can be allocated by other threads
+BOOST_AUTO_TEST_CASE( cached_freelist_steal_test )
+{
+    typedef boost::lockfree::detail::cached_freelist_stack<dummy> freelist_type;
+    freelist_type fl(std::allocator<int>(), 4);
+
+    dummy * nodes[4];
+    for (int i = 0; i != 4; ++i)
+        nodes[i] = fl.construct<true, true>();
+    BOOST_REQUIRE((fl.construct<true, true>() == NULL));
+
+    for (int i = 0; i != 4; ++i)
+        fl.destruct<true>(nodes[i]);
+
+    boost::thread_group threads;
+    for (int i = 0; i != 4; ++i)
+        threads.create_thread(boost::bind(&freelist_type::construct<true, true>, &fl));
+    threads.join_all();
+
+    BOOST_REQUIRE((fl.construct<true, true>() == NULL));
+}
@@ -0,0 +1,176 @@
+//  Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+
+#include <boost/lockfree/mpmc_ring.hpp>
+
+#include <boost/thread.hpp>
+
+#define BOOST_TEST_MAIN
+#ifdef BOOST_LOCKFREE_INCLUDE_TESTS
+#include <boost/test/included/unit_test.hpp>
+#else
+#include <boost/test/unit_test.hpp>
+#endif
+
+#include <memory>
+#include <stdexcept>
+
+#include "test_helpers.hpp"
+#include "test_common.hpp"
+
+using namespace boost;
+using namespace boost::lockfree;
+using namespace std;
+
+BOOST_AUTO_TEST_CASE( simple_mpmc_ring_test )
+{
+    mpmc_ring<int, capacity<64> > f;
+
+    BOOST_REQUIRE(f.empty());
+    BOOST_REQUIRE_EQUAL(f.capacity(), 64u);
+    f.push(1);
+    f.push(2);
+
+    int i1(0), i2(0);
+
+    BOOST_REQUIRE(f.pop(i1));
+    BOOST_REQUIRE_EQUAL(i1, 1);
+
+    BOOST_REQUIRE(f.pop(i2));
+    BOOST_REQUIRE_EQUAL(i2, 2);
+    BOOST_REQUIRE(f.empty());
+}
+
+BOOST_AUTO_TEST_CASE( simple_mpmc_ring_test_runtime_size )
+{
+    mpmc_ring<int> f(50);
+
+    BOOST_REQUIRE(f.empty());
+    BOOST_REQUIRE_EQUAL(f.capacity(), 64u);
+    f.push(1);
+    f.push(2);
+
+    long i1(0), i2(0);
+
+    BOOST_REQUIRE(f.pop(i1));
+    BOOST_REQUIRE_EQUAL(i1, 1);
+
+    BOOST_REQUIRE(f.pop(i2));
+    BOOST_REQUIRE_EQUAL(i2, 2);
+    BOOST_REQUIRE(f.empty());
+}
+
+BOOST_AUTO_TEST_CASE( mpmc_ring_allocator_test )
+{
+    mpmc_ring<int, boost::lockfree::allocator<std::allocator<int> > > f(16, std::allocator<int>());
+    mpmc_ring<int, boost::lockfree::allocator<std::allocator<int> > > g(16, std::allocator<char>());
+
+    BOOST_REQUIRE(f.push(1));
+    BOOST_REQUIRE(g.push(1));
+}
+
+/* the ringbuffer has to wrap around several times, and has to report full and empty at the right time */
+template <typename ringbuffer>
+void mpmc_ring_full_empty(ringbuffer & f)
+{
+    const int size = static_cast<int>(f.capacity());
+    int next_push = 0, next_pop = 0;
+
+    for (int round = 0; round != 8; ++round) {
+        while (next_push - next_pop != size)
+            BOOST_REQUIRE(f.push(next_push++));
+        BOOST_REQUIRE(!f.push(next_push));
+
+        for (int i = 0; i != 1 + round % size; ++i) {
+            int out;
+            BOOST_REQUIRE(f.pop(out));
+            BOOST_REQUIRE_EQUAL(out, next_pop++);
+        }
+    }
+
+    int out;
+    while (next_pop != next_push) {
+        BOOST_REQUIRE(f.pop(out));
+        BOOST_REQUIRE_EQUAL(out, next_pop++);
+    }
+    BOOST_REQUIRE(!f.pop(out));
+    BOOST_REQUIRE(f.empty());
+}
+
+BOOST_AUTO_TEST_CASE( mpmc_ring_full_empty_test )
+{
+    mpmc_ring<int, capacity<16> > f;
+    mpmc_ring_full_empty(f);
+
+    mpmc_ring<int> g(16);
+    mpmc_ring_full_empty(g);
+
+    mpmc_ring<int> h(1);
+    BOOST_REQUIRE_EQUAL(h.capacity(), 2u);
+    mpmc_ring_full_empty(h);
+}
+
+// assignment throws when value is negative
+struct throwing_assign
+{
+    int value;
+
+    throwing_assign(int v = 0):
+        value(v)
+    {}
+
+    throwing_assign & operator=(throwing_assign const & rhs)
+    {
+        if (rhs.value < 0)
+            throw std::runtime_error("assign");
+        value = rhs.value;
+        return *this;
+    }
+};
+
+BOOST_AUTO_TEST_CASE( mpmc_ring_exception_test )
+{
+    mpmc_ring<throwing_assign, capacity<4> > f;
+
+    // the slot claimed by a failed push is skipped
+    BOOST_REQUIRE(f.push(throwing_assign(1)));
+    BOOST_REQUIRE_THROW(f.push(throwing_assign(-1)), std::runtime_error);
+    BOOST_REQUIRE(f.push(throwing_assign(2)));
+
+    throwing_assign t;
+    BOOST_REQUIRE(f.pop(t));
+    BOOST_REQUIRE_EQUAL(t.value, 1);
+    BOOST_REQUIRE(f.pop(t));
+    BOOST_REQUIRE_EQUAL(t.value, 2);
+    BOOST_REQUIRE(!f.pop(t));
+
+    // every slot can still be used
+    for (int round = 0; round != 3; ++round) {
+        for (int i = 0; i != 4; ++i)
+            BOOST_REQUIRE(f.push(throwing_assign(i)));
+        BOOST_REQUIRE(!f.push(throwing_assign(4)));
+        for (int i = 0; i != 4; ++i) {
+            BOOST_REQUIRE(f.pop(t));
+            BOOST_REQUIRE_EQUAL(t.value, i);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( mpmc_ring_test_stress )
+{
+    boost::scoped_ptr<queue_stress_tester<> > tester(new queue_stress_tester<>(4, 4));
+
+    boost::scoped_ptr<mpmc_ring<long> > q(new mpmc_ring<long>(128));
+    tester->run(*q);
+}
+
+BOOST_AUTO_TEST_CASE( mpmc_ring_test_stress_compile_time_size )
+{
+    boost::scoped_ptr<queue_stress_tester<> > tester(new queue_stress_tester<>(4, 4));
+
+    boost::scoped_ptr<mpmc_ring<long, capacity<16> > > q(new mpmc_ring<long, capacity<16> >);
+    tester->run(*q);
+}
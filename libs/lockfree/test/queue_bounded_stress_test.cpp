@@ -23,3 +23,12 @@ BOOST_AUTO_TEST_CASE( queue_test_bounded )
     boost::lockfree::queue<long> q(128);
     tester->run(q);
 }
+
+BOOST_AUTO_TEST_CASE( queue_test_bounded_thread_cache )
+{
+    typedef queue_stress_tester<true> tester_type;
+    boost::scoped_ptr<tester_type> tester(new tester_type(4, 4) );
+
+    boost::lockfree::queue<long, boost::lockfree::thread_cache<true> > q(128);
+    tester->run(q);
+}
@@ -14,7 +14,10 @@
 #include <boost/test/unit_test.hpp>
 #endif
 
+#include <iterator>
+#include <list>
 #include <memory>
+#include <vector>
 
 using namespace boost;
 using namespace boost::lockfree;
@@ -123,3 +126,56 @@ BOOST_AUTO_TEST_CASE( queue_convert_pop_test )
 
     BOOST_REQUIRE(f.empty());
 }
+
+BOOST_AUTO_TEST_CASE( ranged_queue_test )
+{
+    queue<int> f(16);
+
+    int data[100];
+    for (int i = 0; i != 100; ++i)
+        data[i] = i;
+
+    BOOST_REQUIRE_EQUAL(f.push(data, data + 100), data + 100);
+    BOOST_REQUIRE(f.push(100));
+
+    int out[101];
+    BOOST_REQUIRE_EQUAL(f.pop(out, 0), 0u);
+    BOOST_REQUIRE_EQUAL(f.pop(out, 30), 30u);
+    for (int i = 0; i != 30; ++i)
+        BOOST_REQUIRE_EQUAL(out[i], i);
+
+    int i1(0);
+    BOOST_REQUIRE(f.pop(i1));
+    BOOST_REQUIRE_EQUAL(i1, 30);
+
+    std::vector<int> rest;
+    BOOST_REQUIRE_EQUAL(f.pop(std::back_inserter(rest), 1000), 70u);
+    for (int i = 0; i != 70; ++i)
+        BOOST_REQUIRE_EQUAL(rest[i], 31 + i);
+
+    BOOST_REQUIRE_EQUAL(f.pop(out, 10), 0u);
+    BOOST_REQUIRE(f.empty());
+}
+
+BOOST_AUTO_TEST_CASE( ranged_queue_test_capacity )
+{
+    queue<int, capacity<65> > f;
+
+    std::list<int> data;
+    for (int i = 0; i != 100; ++i)
+        data.push_back(i);
+
+    // one node is always used as the dummy node
+    std::list<int>::iterator it = f.push(data.begin(), data.end());
+    BOOST_REQUIRE_EQUAL(std::distance(data.begin(), it), 64);
+
+    int out[100];
+    BOOST_REQUIRE_EQUAL(f.pop(out, 100), 64u);
+    for (int i = 0; i != 64; ++i)
+        BOOST_REQUIRE_EQUAL(out[i], i);
+    BOOST_REQUIRE(f.empty());
+
+    BOOST_REQUIRE(f.bounded_push(data.begin(), data.end()) != data.end());
+    BOOST_REQUIRE_EQUAL(f.pop(out, 100), 64u);
+    BOOST_REQUIRE(f.empty());
+}
@@ -23,3 +23,12 @@ BOOST_AUTO_TEST_CASE( queue_test_unbounded )
     boost::lockfree::queue<long> q(128);
     tester->run(q);
 }
+
+BOOST_AUTO_TEST_CASE( queue_test_unbounded_thread_cache )
+{
+    typedef queue_stress_tester<false> tester_type;
+    boost::scoped_ptr<tester_type> tester(new tester_type(4, 4) );
+
+    boost::lockfree::queue<long, boost::lockfree::thread_cache<true> > q(128);
+    tester->run(q);
+}
@@ -8,6 +8,9 @@
 #include <boost/thread.hpp>
 #include <boost/lockfree/stack.hpp>
 
+#include <iterator>
+#include <vector>
+
 #define BOOST_TEST_MAIN
 #ifdef BOOST_LOCKFREE_INCLUDE_TESTS
 #include <boost/test/included/unit_test.hpp>
@@ -107,3 +110,49 @@ BOOST_AUTO_TEST_CASE( bounded_stack_test_exhausted )
     BOOST_REQUIRE(!stk.pop(out));
     BOOST_REQUIRE(stk.empty());
 }
+
+BOOST_AUTO_TEST_CASE( ranged_pop_test )
+{
+    boost::lockfree::stack<long> stk(128);
+
+    long data[100];
+    for (int i = 0; i != 100; ++i)
+        data[i] = i;
+
+    BOOST_REQUIRE_EQUAL(stk.push(data, data + 100), data + 100);
+
+    long out[100];
+    BOOST_REQUIRE_EQUAL(stk.pop(out, 0), 0u);
+    BOOST_REQUIRE_EQUAL(stk.pop(out, 30), 30u);
+    for (int i = 0; i != 30; ++i)
+        BOOST_REQUIRE_EQUAL(out[i], 99 - i);
+
+    std::vector<long> rest;
+    BOOST_REQUIRE_EQUAL(stk.pop(std::back_inserter(rest), 100), 70u);
+    BOOST_REQUIRE_EQUAL(rest.size(), 70u);
+    for (int i = 0; i != 70; ++i)
+        BOOST_REQUIRE_EQUAL(rest[i], 69 - i);
+
+    BOOST_REQUIRE_EQUAL(stk.pop(out, 10), 0u);
+    BOOST_REQUIRE(stk.empty());
+}
+
+BOOST_AUTO_TEST_CASE( fixed_size_ranged_test_exhausted )
+{
+    boost::lockfree::stack<long, boost::lockfree::capacity<80> > stk;
+
+    long data[100];
+    for (int i = 0; i != 100; ++i)
+        data[i] = i;
+
+    BOOST_REQUIRE_EQUAL(stk.push(data, data + 100), data + 80);
+
+    long out[100];
+    BOOST_REQUIRE_EQUAL(stk.pop(out, 100), 80u);
+    for (int i = 0; i != 80; ++i)
+        BOOST_REQUIRE_EQUAL(out[i], 79 - i);
+
+    BOOST_REQUIRE_EQUAL(stk.push(data, data + 100), data + 80);
+    BOOST_REQUIRE_EQUAL(stk.pop(out, 100), 80u);
+    BOOST_REQUIRE(stk.empty());
+}
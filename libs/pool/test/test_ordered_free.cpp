@@ -0,0 +1,189 @@
+/* Copyright (C) 2026 Joshua Napoli
+*
+* Use, modification and distribution is subject to the
+* Boost Software License, Version 1.0. (See accompanying
+* file LICENSE_1_0.txt or http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// Checks the ordered functions of pool, which use the bitmaps of free chunks,
+// against a model of the allocated chunks, also when they are mixed with the
+// unordered functions, and that release_memory() frees exactly the empty blocks.
+
+#include <boost/pool/pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+// The pool allocates its index and bitmaps with the same allocator as its
+// memory blocks, so the blocks are told apart by their size.
+struct counting_allocator
+{
+   typedef std::size_t size_type;
+   typedef std::ptrdiff_t difference_type;
+
+   static int blocks;
+   static std::map<char *, size_type> sizes;
+   static size_type min_bytes;
+
+   static char * malloc BOOST_PREVENT_MACRO_SUBSTITUTION(const size_type bytes)
+   {
+      if(bytes < min_bytes)
+         return 0;
+      ++blocks;
+      char * const ret = new (std::nothrow) char[bytes];
+      sizes[ret] = bytes;
+      return ret;
+   }
+   static void free BOOST_PREVENT_MACRO_SUBSTITUTION(char * const block)
+   {
+      --blocks;
+      sizes.erase(block);
+      delete [] block;
+   }
+   static int blocks_of_at_least(const size_type bytes)
+   {
+      int n = 0;
+      for(std::map<char *, size_type>::const_iterator i = sizes.begin(); i != sizes.end(); ++i)
+         n += (i->second >= bytes);
+      return n;
+   }
+};
+
+int counting_allocator::blocks = 0;
+std::map<char *, counting_allocator::size_type> counting_allocator::sizes;
+counting_allocator::size_type counting_allocator::min_bytes = 0;
+
+// chunks are allocated from the pool, and their memory belongs to nobody else
+struct allocation
+{
+   char * p;
+   std::size_t n;
+   bool ordered;
+};
+
+static bool overlaps(const std::vector<allocation> & live, char * p, std::size_t bytes)
+{
+   std::less<char *> lt;
+   for(std::size_t i = 0; i < live.size(); ++i)
+   {
+      if(lt(p, live[i].p + live[i].n * sizeof(double)) && lt(live[i].p, p + bytes))
+         return true;
+   }
+   return false;
+}
+
+static void check_random_operations(bool mixed)
+{
+   boost::random::mt19937 gen(mixed ? 17 : 42);
+   boost::random::uniform_int_distribution<> op(0, 9);
+   boost::random::uniform_int_distribution<> size(1, 20);
+
+   {
+      boost::pool<counting_allocator> p(sizeof(double), 16);
+      std::vector<allocation> live;
+
+      for(int i = 0; i < 20000; ++i)
+      {
+         int o = op(gen);
+         if(o < 5 || live.empty())
+         {
+            allocation a;
+            a.n = (o == 0 && mixed) ? 1 : size(gen);
+            a.ordered = !(o == 0 && mixed);
+            a.p = static_cast<char *>(a.ordered ? p.ordered_malloc(a.n) : (p.malloc)());
+            BOOST_TEST(a.p != 0);
+            BOOST_TEST(p.is_from(a.p));
+            BOOST_TEST(!overlaps(live, a.p, a.n * sizeof(double)));
+            std::fill(a.p, a.p + a.n * sizeof(double), static_cast<char>(i));
+            live.push_back(a);
+         }
+         else
+         {
+            std::size_t k = static_cast<std::size_t>(gen() % live.size());
+            allocation a = live[k];
+            live[k] = live.back();
+            live.pop_back();
+            if(!a.ordered)
+               (p.free)(a.p);
+            else if(a.n == 1 && o == 9)
+               p.ordered_free(a.p);
+            else
+               p.ordered_free(a.p, a.n);
+         }
+
+         if(i % 5000 == 4999)
+            p.release_memory();
+      }
+
+      // the blocks that still hold chunks must be kept
+      int blocks = counting_allocator::blocks;
+      p.release_memory();
+      BOOST_TEST(counting_allocator::blocks <= blocks);
+      BOOST_TEST(live.empty() || counting_allocator::blocks > 0);
+      for(std::size_t k = 0; k < live.size(); ++k)
+         BOOST_TEST(p.is_from(live[k].p));
+
+      // once everything is freed, all blocks are empty
+      for(std::size_t k = 0; k < live.size(); ++k)
+      {
+         if(live[k].ordered)
+            p.ordered_free(live[k].p, live[k].n);
+         else
+            (p.free)(live[k].p);
+      }
+      BOOST_TEST(p.release_memory() || counting_allocator::blocks == 0);
+      BOOST_TEST(counting_allocator::blocks == 0);
+
+      // the pool works again after it has released its memory
+      void * q = p.ordered_malloc(5);
+      BOOST_TEST(q != 0);
+      p.ordered_free(q, 5);
+   }
+   BOOST_TEST(counting_allocator::blocks == 0);
+}
+
+int main()
+{
+   check_random_operations(false);
+   check_random_operations(true);
+
+   // without memory for its index, the pool walks the free list
+   counting_allocator::min_bytes = 16 * sizeof(double);
+   check_random_operations(false);
+   check_random_operations(true);
+   counting_allocator::min_bytes = 0;
+   BOOST_TEST(counting_allocator::blocks == 0);
+
+   // freed chunks are found again as a contiguous run
+   {
+      const std::size_t block_size = 64 * sizeof(double);
+      boost::pool<counting_allocator> p(sizeof(double), 64);
+      std::vector<void *> chunks;
+      for(int i = 0; i < 64; ++i)
+         chunks.push_back(p.ordered_malloc());
+      BOOST_TEST(counting_allocator::blocks_of_at_least(block_size) == 1);
+      for(int i = 0; i < 64; i += 2)
+         p.ordered_free(chunks[i]);
+      // no run of two chunks is free
+      void * two = p.ordered_malloc(2);
+      BOOST_TEST(counting_allocator::blocks_of_at_least(block_size) == 2);
+      p.ordered_free(two, 2);
+      // a partial release keeps the block that still holds chunks
+      BOOST_TEST(p.release_memory());
+      BOOST_TEST(counting_allocator::blocks_of_at_least(block_size) == 1);
+      p.ordered_free(chunks[11]);
+      // chunks 10, 11 and 12 are free now
+      BOOST_TEST(p.ordered_malloc(3) == chunks[10]);
+      BOOST_TEST(!p.release_memory());
+      BOOST_TEST(counting_allocator::blocks_of_at_least(block_size) == 1);
+   }
+   BOOST_TEST(counting_allocator::blocks == 0);
+
+   return boost::report_errors();
+}
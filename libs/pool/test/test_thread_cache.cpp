@@ -0,0 +1,117 @@
+/* Copyright (C) 2026 Joshua Napoli
+*
+* Use, modification and distribution is subject to the
+* Boost Software License, Version 1.0. (See accompanying
+* file LICENSE_1_0.txt or http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include <boost/pool/pool_alloc.hpp>
+#include <boost/pool/singleton_pool.hpp>
+#include <boost/pool/thread_cached_mutex.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+#include <boost/detail/lightweight_test.hpp>
+
+#include <list>
+#include <set>
+#include <vector>
+
+typedef boost::thread_cached_mutex<boost::details::pool::default_mutex, 8> cached_mutex;
+
+struct test_tag {};
+typedef boost::singleton_pool<test_tag, sizeof(int), boost::default_user_allocator_new_delete, cached_mutex> cached_pool;
+
+struct purge_tag {};
+typedef boost::singleton_pool<purge_tag, sizeof(double), boost::default_user_allocator_new_delete, cached_mutex> purge_pool;
+
+void use_list()
+{
+   std::list<int, boost::fast_pool_allocator<int, boost::default_user_allocator_new_delete, cached_mutex> > l;
+   for(int i = 0; i < 20000; ++i)
+   {
+      if(i % 3 == 2)
+         l.pop_front();
+      else
+         l.push_back(i);
+   }
+}
+
+// pool_allocator takes single objects from the cache, and arrays from the pool
+void use_pool_allocator()
+{
+   std::list<int, boost::pool_allocator<int, boost::default_user_allocator_new_delete, cached_mutex> > l;
+   std::vector<int, boost::pool_allocator<int, boost::default_user_allocator_new_delete, cached_mutex> > v;
+   typedef boost::pool_allocator<int, boost::default_user_allocator_new_delete, cached_mutex> int_allocator;
+   std::vector<int*> singles;
+   for(int i = 0; i < 20000; ++i)
+   {
+      if(i % 3 == 2)
+         l.pop_front();
+      else
+         l.push_back(i);
+      if(i % 100 == 0)
+         v.push_back(i);
+      singles.push_back(int_allocator::allocate(1));
+      if(i % 2 == 1)
+      {
+         int_allocator::deallocate(singles.back(), 1);
+         singles.pop_back();
+      }
+   }
+   for(std::size_t i = 0; i < singles.size(); ++i)
+      int_allocator::deallocate(singles[i], 1);
+}
+
+// frees chunks that another thread has allocated
+void free_chunks(std::vector<void*>* chunks)
+{
+   for(std::size_t i = 0; i < chunks->size(); ++i)
+      (cached_pool::free)((*chunks)[i]);
+}
+
+int main()
+{
+   // chunks are distinct, and come from the pool, also when they pass the cache
+   std::set<void*> chunks;
+   std::vector<void*> v;
+   for(int i = 0; i < 100; ++i)
+   {
+      void* p = (cached_pool::malloc)();
+      BOOST_TEST(p != 0);
+      BOOST_TEST(cached_pool::is_from(p));
+      BOOST_TEST(chunks.insert(p).second);
+      v.push_back(p);
+   }
+   for(std::size_t i = 0; i < v.size(); ++i)
+      (cached_pool::free)(v[i]);
+   chunks.clear();
+   for(std::size_t i = 0; i < v.size(); ++i)
+   {
+      v[i] = (cached_pool::malloc)();
+      BOOST_TEST(cached_pool::is_from(v[i]));
+      BOOST_TEST(chunks.insert(v[i]).second);
+   }
+
+   // chunks may be freed by a different thread
+   boost::thread t(boost::bind(&free_chunks, &v));
+   t.join();
+
+   // after purge_memory the cache is empty, so new chunks come from new memory
+   void* p = (purge_pool::malloc)();
+   (purge_pool::free)(p);
+   purge_pool::purge_memory();
+   p = (purge_pool::malloc)();
+   BOOST_TEST(purge_pool::is_from(p));
+   (purge_pool::free)(p);
+
+   boost::thread_group threads;
+   for(int i = 0; i < 4; ++i)
+   {
+      threads.create_thread(&use_list);
+      threads.create_thread(&use_pool_allocator);
+   }
+   threads.join_all();
+
+   return boost::report_errors();
+}
@@ -0,0 +1,94 @@
+//  (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Throughput of mutex against adaptive_mutex: every thread locks the mutex in a loop and updates a
+// counter, with a short or a longer critical section.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/adaptive_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/bind.hpp>
+#include <iostream>
+
+namespace
+{
+  typedef boost::chrono::high_resolution_clock Clock;
+  typedef boost::chrono::nanoseconds::rep rep;
+
+  template <class Mutex>
+  struct config
+  {
+    Mutex mtx;
+    unsigned long value;
+
+    config() : value(0)
+    {
+    }
+  };
+
+  template <class Mutex>
+  void locker(config<Mutex>& c, unsigned n, unsigned work)
+  {
+    for (unsigned i = 0; i < n; ++i)
+    {
+      boost::lock_guard<Mutex> lk(c.mtx);
+      for (unsigned w = 0; w <= work; ++w)
+      {
+        ++c.value;
+      }
+    }
+  }
+
+  // runs n critical sections on each of the threads and returns the time taken, in nanoseconds
+  template <class Mutex>
+  rep benchmark(config<Mutex>& c, unsigned threads, unsigned n, unsigned work)
+  {
+    boost::thread_group g;
+    Clock::time_point start = Clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      g.create_thread(boost::bind(locker<Mutex>, boost::ref(c), n, work));
+    }
+    g.join_all();
+    return boost::chrono::duration_cast<boost::chrono::nanoseconds>(Clock::now() - start).count();
+  }
+
+  void report(const char* what, unsigned threads, unsigned n, rep ns)
+  {
+    double const locks = double(threads) * n;
+    std::cout << what << " x " << threads << ": " << (ns ? locks * 1000000000.0 / ns : 0.0) << " locks/s" << std::endl;
+  }
+}
+
+int main()
+{
+  unsigned const n = 1000000;
+  unsigned const sizes[] = { 1, 2, 4, boost::thread::hardware_concurrency() };
+  unsigned const works[] = { 0, 100 };
+  for (unsigned w = 0; w < sizeof(works) / sizeof(works[0]); ++w)
+  {
+    std::cout << "critical section of " << works[w] + 1 << " increments" << std::endl;
+    for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+    {
+      unsigned const threads = sizes[s] ? sizes[s] : 1;
+      config<boost::mutex> plain;
+      rep plain_ns = benchmark(plain, threads, n, works[w]);
+      report("mutex", threads, n, plain_ns);
+      config<boost::adaptive_mutex> adaptive;
+      rep adaptive_ns = benchmark(adaptive, threads, n, works[w]);
+      report("adaptive_mutex", threads, n, adaptive_ns);
+      boost::adaptive_mutex::statistics st = adaptive.mtx.get_statistics();
+      std::cout << "  speedup: " << double(plain_ns) / double(adaptive_ns ? adaptive_ns : 1)
+                << ", contentions: " << st.contentions << ", parks: " << st.parks
+                << ", spin limit: " << st.spin_limit << std::endl;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,97 @@
+//  (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Task spawn throughput of boost::async: one thread per call (launch::async) against the
+// threads of a basic_thread_pool reused by async(executor&, f).
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/scoped_array.hpp>
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace
+{
+  typedef boost::chrono::high_resolution_clock Clock;
+  typedef boost::chrono::nanoseconds::rep rep;
+
+  int task()
+  {
+    return 1;
+  }
+
+  // spawns n tasks through spawn(), waits for all of them, and returns the best time of
+  // a few runs in nanoseconds
+  template <class Spawn>
+  rep benchmark(unsigned n, Spawn spawn)
+  {
+    rep best = (std::numeric_limits<rep>::max)();
+    for (int times = 5; times--;)
+    {
+      boost::scoped_array<boost::future<int> > futures(new boost::future<int>[n]);
+      Clock::time_point start = Clock::now();
+      for (unsigned i = 0; i < n; ++i)
+      {
+        futures[i] = spawn();
+      }
+      int sum = 0;
+      for (unsigned i = 0; i < n; ++i)
+      {
+        sum += futures[i].get();
+      }
+      best = (std::min)(best, boost::chrono::duration_cast<boost::chrono::nanoseconds>(Clock::now() - start).count());
+      if (sum != int(n)) std::cerr << "lost tasks" << std::endl;
+    }
+    return best;
+  }
+
+  struct thread_per_call
+  {
+    boost::future<int> operator()() const
+    {
+      return boost::async(boost::launch::async, &task);
+    }
+  };
+
+  struct on_pool
+  {
+    boost::basic_thread_pool* pool;
+    boost::future<int> operator()() const
+    {
+      return boost::async(*pool, &task);
+    }
+  };
+
+  void report(const char* what, unsigned n, rep ns)
+  {
+    std::cout << what << ": " << ns / n << " ns/task, "
+              << (ns ? (n * 1000000000.0 / ns) : 0.0) << " tasks/s" << std::endl;
+  }
+}
+
+int main()
+{
+  unsigned const n = 10000;
+
+  rep threads = benchmark(n, thread_per_call());
+  report("async(launch::async, f)", n, threads);
+
+  unsigned const sizes[] = { 1, 2, 4, boost::thread::hardware_concurrency() };
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+  {
+    boost::basic_thread_pool pool(sizes[s]);
+    on_pool spawn = { &pool };
+    rep pooled = benchmark(n, spawn);
+    std::cout << "basic_thread_pool(" << pool.size() << ") ";
+    report("async(pool, f)", n, pooled);
+    std::cout << "  speedup: " << double(threads) / double(pooled ? pooled : 1) << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,105 @@
+//  (C) Copyright 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See
+//  accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+// Read throughput of shared_mutex against striped_shared_mutex: every thread takes and releases
+// shared ownership in a loop, while one more thread takes exclusive ownership now and then.
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/striped_shared_mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/chrono/chrono.hpp>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+  typedef boost::chrono::high_resolution_clock Clock;
+  typedef boost::chrono::nanoseconds::rep rep;
+
+  template <class Mutex>
+  struct config
+  {
+    Mutex mtx;
+    int value;
+    boost::atomic<bool> stop;
+
+    config() : value(0), stop(false)
+    {
+    }
+  };
+
+  template <class Mutex>
+  void reader(config<Mutex>& c, unsigned n, int& sum)
+  {
+    int s = 0;
+    for (unsigned i = 0; i < n; ++i)
+    {
+      boost::shared_lock<Mutex> lk(c.mtx);
+      s += c.value;
+    }
+    sum = s;
+  }
+
+  template <class Mutex>
+  void writer(config<Mutex>& c)
+  {
+    while (!c.stop.load(boost::memory_order_relaxed))
+    {
+      {
+        boost::unique_lock<Mutex> lk(c.mtx);
+        ++c.value;
+      }
+      boost::this_thread::sleep_for(boost::chrono::milliseconds(1));
+    }
+  }
+
+  // runs n reads on each of the threads and returns the time taken, in nanoseconds
+  template <class Mutex>
+  rep benchmark(unsigned threads, unsigned n)
+  {
+    config<Mutex> c;
+    std::vector<int> sums(threads);
+    boost::thread w(boost::bind(writer<Mutex>, boost::ref(c)));
+    boost::thread_group g;
+    Clock::time_point start = Clock::now();
+    for (unsigned t = 0; t < threads; ++t)
+    {
+      g.create_thread(boost::bind(reader<Mutex>, boost::ref(c), n, boost::ref(sums[t])));
+    }
+    g.join_all();
+    rep ns = boost::chrono::duration_cast<boost::chrono::nanoseconds>(Clock::now() - start).count();
+    c.stop = true;
+    w.join();
+    return ns;
+  }
+
+  void report(const char* what, unsigned threads, unsigned n, rep ns)
+  {
+    double const reads = double(threads) * n;
+    std::cout << what << " x " << threads << ": " << (ns ? reads * 1000000000.0 / ns : 0.0) << " reads/s" << std::endl;
+  }
+}
+
+int main()
+{
+  unsigned const n = 1000000;
+  unsigned const sizes[] = { 1, 2, 4, boost::thread::hardware_concurrency() };
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+  {
+    unsigned const threads = sizes[s] ? sizes[s] : 1;
+    rep plain = benchmark<boost::shared_mutex>(threads, n);
+    report("shared_mutex", threads, n, plain);
+    rep striped = benchmark<boost::striped_shared_mutex>(threads, n);
+    report("striped_shared_mutex", threads, n, striped);
+    std::cout << "  speedup: " << double(plain) / double(striped ? striped : 1) << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,111 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/executors/basic_thread_pool.hpp>
+
+// class basic_thread_pool;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/bind.hpp>
+#include <set>
+
+boost::mutex mtx;
+int count = 0;
+std::set<boost::thread::id> ids;
+
+void f()
+{
+  boost::lock_guard<boost::mutex> lk(mtx);
+  ++count;
+  ids.insert(boost::this_thread::get_id());
+}
+
+void nap()
+{
+  boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+}
+
+void throw_error()
+{
+  throw 1;
+}
+
+void spawn(boost::basic_thread_pool* pool, int depth)
+{
+  f();
+  if (depth == 0) return;
+  pool->submit(boost::bind(&spawn, pool, depth - 1));
+  pool->submit(boost::bind(&spawn, pool, depth - 1));
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool pool(4);
+    BOOST_TEST(pool.size() == 4);
+    BOOST_TEST(!pool.closed());
+    for (int i = 0; i < 1000; ++i)
+    {
+      pool.submit(&f);
+    }
+    pool.close();
+    BOOST_TEST(pool.closed());
+    pool.join();
+    BOOST_TEST(count == 1000);
+    BOOST_TEST(ids.size() <= 4);
+    BOOST_TEST(ids.count(boost::this_thread::get_id()) == 0 || ids.size() == 1);
+    try
+    {
+      pool.submit(&f);
+      BOOST_TEST(false);
+    }
+    catch (boost::executors::executor_closed&)
+    {
+    }
+  }
+  count = 0;
+  {
+    // the destructor runs the pending closures, also the ones they submit
+    boost::basic_thread_pool pool(3);
+    pool.submit(boost::bind(&spawn, &pool, 10));
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(100));
+  }
+  BOOST_TEST(count == 2047);
+  count = 0;
+  {
+    // with no thread count, at least one worker is created
+    boost::basic_thread_pool pool(0);
+    BOOST_TEST(pool.size() == 1);
+    pool.submit(&f);
+  }
+  BOOST_TEST(count == 1);
+  {
+    // another thread can help running the closures
+    boost::basic_thread_pool pool(1);
+    pool.submit(&nap);
+    boost::this_thread::sleep_for(boost::chrono::milliseconds(20));
+    pool.submit(&f);
+    BOOST_TEST(pool.try_executing_one());
+    BOOST_TEST(count == 2);
+    BOOST_TEST(!pool.try_executing_one());
+  }
+  count = 0;
+  {
+    // an exception thrown by a closure does not stop its worker
+    boost::basic_thread_pool pool(1);
+    pool.submit(&throw_error);
+    pool.submit(&f);
+    pool.close();
+    pool.join();
+    BOOST_TEST(count == 1);
+  }
+  return boost::report_errors();
+}
+
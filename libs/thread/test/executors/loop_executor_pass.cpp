@@ -0,0 +1,105 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/executors/loop_executor.hpp>
+
+// class loop_executor;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/bind.hpp>
+#include <stdexcept>
+#include <vector>
+
+std::vector<int> done;
+
+void f(int i)
+{
+  done.push_back(i);
+}
+
+void resubmit(boost::loop_executor* ex, int i)
+{
+  done.push_back(i);
+  ex->submit(boost::bind(&f, i + 1));
+}
+
+void g()
+{
+  throw std::logic_error("g");
+}
+
+void submit_and_close(boost::loop_executor* ex)
+{
+  for (int i = 0; i < 100; ++i)
+  {
+    ex->submit(boost::bind(&f, i));
+  }
+  ex->close();
+}
+
+int main()
+{
+  {
+    boost::loop_executor ex;
+    BOOST_TEST(!ex.try_executing_one());
+    ex.submit(boost::bind(&f, 0));
+    ex.submit(boost::bind(&f, 1));
+    BOOST_TEST(done.empty());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(done.size() == 1 && done[0] == 0);
+    ex.submit(boost::bind(&resubmit, &ex, 2));
+    // the closure submitted by resubmit is not run
+    ex.run_queued_closures();
+    BOOST_TEST(done.size() == 3 && done[1] == 1 && done[2] == 2);
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(done.size() == 4 && done[3] == 3);
+  }
+  {
+    // the exceptions are propagated, and the remaining closures kept
+    done.clear();
+    boost::loop_executor ex;
+    ex.submit(&g);
+    ex.submit(boost::bind(&f, 0));
+    try
+    {
+      ex.run_queued_closures();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+    BOOST_TEST(done.empty());
+    ex.run_queued_closures();
+    BOOST_TEST(done.size() == 1);
+  }
+  {
+    // loop runs the closures in order until the executor is closed
+    done.clear();
+    boost::loop_executor ex;
+    boost::thread t(boost::bind(&submit_and_close, &ex));
+    ex.loop();
+    t.join();
+    BOOST_TEST(ex.closed());
+    BOOST_TEST(done.size() == 100);
+    for (std::size_t i = 0; i < done.size(); ++i)
+    {
+      BOOST_TEST(done[i] == int(i));
+    }
+    try
+    {
+      ex.submit(boost::bind(&f, 0));
+      BOOST_TEST(false);
+    }
+    catch (boost::executors::executor_closed&)
+    {
+    }
+  }
+  return boost::report_errors();
+}
+
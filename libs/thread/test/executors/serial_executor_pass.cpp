@@ -0,0 +1,108 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/executors/serial_executor.hpp>
+
+// template <class Executor>
+// class serial_executor;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/executors/serial_executor.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/thread/future.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <boost/bind.hpp>
+#include <vector>
+
+std::vector<int> done;
+int running = 0;
+bool overlapped = false;
+
+// the closures of a serial_executor are never run concurrently, so no lock is needed
+void f(int i)
+{
+  if (running++ != 0) overlapped = true;
+  boost::this_thread::yield();
+  done.push_back(i);
+  --running;
+}
+
+// runs the closures as they are submitted, on the submitting thread
+struct inline_executor
+{
+  void submit(boost::executors::work const& closure)
+  {
+    boost::executors::work w(closure);
+    w();
+  }
+};
+
+void submit_f(boost::serial_executor<inline_executor>* ex, int i)
+{
+  f(i);
+  ex->submit(boost::bind(&f, i + 1));
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool pool(4);
+    {
+      boost::serial_executor<boost::basic_thread_pool> ex(pool);
+      BOOST_TEST(&ex.underlying_executor() == &pool);
+      for (int i = 0; i < 1000; ++i)
+      {
+        ex.submit(boost::bind(&f, i));
+      }
+    }
+    // the destructor has waited for the closures
+    BOOST_TEST(!overlapped);
+    BOOST_TEST(done.size() == 1000);
+    for (std::size_t i = 0; i < done.size(); ++i)
+    {
+      BOOST_TEST(done[i] == int(i));
+    }
+  }
+  {
+    // the closures are handed one by one to the underlying executor
+    done.clear();
+    boost::loop_executor loop;
+    boost::serial_executor<boost::loop_executor> ex(loop);
+    ex.submit(boost::bind(&f, 0));
+    ex.submit(boost::bind(&f, 1));
+    loop.run_queued_closures();
+    BOOST_TEST(done.size() == 1);
+    loop.run_queued_closures();
+    BOOST_TEST(done.size() == 2);
+    BOOST_TEST(!loop.try_executing_one());
+
+    boost::future<std::size_t> r = boost::async(ex, boost::bind(&std::vector<int>::size, &done));
+    BOOST_TEST(loop.try_executing_one());
+    BOOST_TEST(r.get() == 2);
+
+    ex.close();
+    try
+    {
+      ex.submit(boost::bind(&f, 0));
+      BOOST_TEST(false);
+    }
+    catch (boost::executors::executor_closed&)
+    {
+    }
+  }
+  {
+    // the underlying executor is not called with the lock held, so that it can run the closure at once
+    done.clear();
+    inline_executor inl;
+    boost::serial_executor<inline_executor> ex(inl);
+    ex.submit(boost::bind(&submit_f, &ex, 0));
+    BOOST_TEST(done.size() == 2);
+    BOOST_TEST(done[0] == 0 && done[1] == 1);
+  }
+  return boost::report_errors();
+}
+
@@ -0,0 +1,185 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class Ex, class F, class... Args>
+//     future<typename result_of<F(Args...)>::type>
+//     async(Ex& ex, F&& f, Args&&... args);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <stdexcept>
+#include <algorithm>
+#include <vector>
+
+typedef boost::chrono::milliseconds ms;
+
+class A
+{
+    long data_;
+
+public:
+    typedef long result_type;
+
+    explicit A(long i) : data_(i) {}
+
+    long operator()() const
+    {
+      return data_;
+    }
+};
+
+class MoveOnly
+{
+public:
+  typedef int result_type;
+
+  BOOST_THREAD_MOVABLE_ONLY(MoveOnly)
+  MoveOnly()
+  {
+  }
+  MoveOnly(BOOST_THREAD_RV_REF(MoveOnly))
+  {}
+
+  int operator()()
+  {
+    return 3;
+  }
+};
+
+int f0()
+{
+  return 3;
+}
+
+int i = 0;
+
+int& f1()
+{
+  return i;
+}
+
+void f2()
+{
+  ++i;
+}
+
+int f3()
+{
+  throw std::logic_error("f3");
+}
+
+boost::thread::id f4()
+{
+  boost::this_thread::sleep_for(ms(10));
+  return boost::this_thread::get_id();
+}
+
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+int f5(int j, int k)
+{
+  return j + k;
+}
+#endif
+
+// spawns work on the pool it runs on, and helps running it while it waits
+int sum(boost::basic_thread_pool* pool, int n)
+{
+  if (n < 2) return n;
+  boost::future<int> l = boost::async(*pool, boost::bind(&sum, pool, n - 1));
+  int r = sum(pool, n - 2);
+  while (!l.is_ready())
+  {
+    if (!pool->try_executing_one()) boost::this_thread::yield();
+  }
+  return l.get() + r;
+}
+
+int main()
+{
+  {
+    boost::basic_thread_pool pool(4);
+    boost::future<int> f = boost::async(pool, f0);
+    BOOST_TEST(f.get() == 3);
+    boost::future<long> g = boost::async(pool, A(3));
+    BOOST_TEST(g.get() == 3);
+    boost::future<int> h = boost::async(pool, BOOST_THREAD_MAKE_RV_REF(MoveOnly()));
+    BOOST_TEST(h.get() == 3);
+    boost::future<int&> r = boost::async(pool, f1);
+    BOOST_TEST(&r.get() == &i);
+    boost::future<void> v = boost::async(pool, f2);
+    v.get();
+    BOOST_TEST(i == 1);
+#if defined BOOST_THREAD_PROVIDES_SIGNATURE_PACKAGED_TASK && defined(BOOST_THREAD_PROVIDES_VARIADIC_THREAD)
+    boost::future<int> a = boost::async(pool, f5, 1, 2);
+    BOOST_TEST(a.get() == 3);
+#endif
+  }
+  {
+    // the exceptions are stored in the future
+    boost::basic_thread_pool pool(2);
+    boost::future<int> f = boost::async(pool, f3);
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error&)
+    {
+    }
+  }
+  {
+    // the threads of the pool are reused
+    boost::basic_thread_pool pool(2);
+    boost::future<boost::thread::id> fs[20];
+    for (int k = 0; k < 20; ++k)
+    {
+      fs[k] = boost::async(pool, f4);
+    }
+    std::vector<boost::thread::id> ids;
+    for (int k = 0; k < 20; ++k)
+    {
+      boost::thread::id id = fs[k].get();
+      BOOST_TEST(id != boost::this_thread::get_id());
+      if (std::find(ids.begin(), ids.end(), id) == ids.end()) ids.push_back(id);
+    }
+    BOOST_TEST(ids.size() <= 2);
+  }
+  {
+    // nested work is shared between the workers
+    boost::basic_thread_pool pool(3);
+    BOOST_TEST(boost::async(pool, boost::bind(&sum, &pool, 15)).get() == 610);
+  }
+  {
+    // the function is run by the thread that runs the loop
+    boost::loop_executor ex;
+    boost::future<boost::thread::id> f = boost::async(ex, f4);
+    BOOST_TEST(!f.is_ready());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(f.is_ready());
+    BOOST_TEST(f.get() == boost::this_thread::get_id());
+  }
+  {
+    // a closed executor refuses the work
+    boost::loop_executor ex;
+    ex.close();
+    try
+    {
+      boost::async(ex, f0);
+      BOOST_TEST(false);
+    }
+    catch (boost::executors::executor_closed&)
+    {
+    }
+  }
+  return boost::report_errors();
+}
+
@@ -0,0 +1,228 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// class future<R>
+
+// template<typename F>
+// auto then(F&& func) -> future<decltype(func(*this))>;
+// template<typename F>
+// auto then(launch policy, F&& func) -> future<decltype(func(*this))>;
+// template<typename Ex, typename F>
+// auto then(Ex& ex, F&& func) -> future<decltype(func(*this))>;
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/thread/executors/loop_executor.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <stdexcept>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_CONTINUATION
+
+int p1()
+{
+  return 1;
+}
+
+int p2(boost::future<int>& f)
+{
+  return 2 * f.get();
+}
+
+boost::thread::id p3(boost::future<int>& f)
+{
+  f.get();
+  return boost::this_thread::get_id();
+}
+
+int n = 0;
+
+void p4(boost::future<int>& f)
+{
+  n = f.get();
+}
+
+int p5(boost::future<int>& f)
+{
+  f.get();
+  throw std::logic_error("p5");
+}
+
+int p6(boost::future<void>& f)
+{
+  f.get();
+  return 6;
+}
+
+struct twice
+{
+  typedef int result_type;
+
+  int operator()(boost::future<int>& f) const
+  {
+    return 2 * f.get();
+  }
+};
+
+int main()
+{
+  // the continuation is run inline by the thread making the future ready
+  {
+    boost::promise<int> p;
+    boost::future<int> f1 = p.get_future();
+    boost::future<boost::thread::id> f2 = f1.then(&p3);
+    BOOST_TEST(!f1.valid());
+    BOOST_TEST(f2.valid());
+    BOOST_TEST(!f2.is_ready());
+    p.set_value(1);
+    BOOST_TEST(f2.is_ready());
+    BOOST_TEST(f2.get() == boost::this_thread::get_id());
+  }
+  // or by the thread attaching it, if the future is already ready
+  {
+    boost::future<int> f1 = boost::make_future(3);
+    BOOST_TEST(f1.then(&p2).get() == 6);
+  }
+  // continuations are chained, and may be function objects
+  {
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(&p2).then(twice()).then(&p2);
+    p.set_value(1);
+    BOOST_TEST(f.get() == 8);
+  }
+  // void continuations, and continuations of futures of void
+  {
+    boost::promise<int> p;
+    boost::future<void> f = p.get_future().then(&p4);
+    p.set_value(4);
+    f.get();
+    BOOST_TEST(n == 4);
+    boost::promise<void> pv;
+    boost::future<int> fv = pv.get_future().then(&p6);
+    pv.set_value();
+    BOOST_TEST(fv.get() == 6);
+  }
+  // exceptions are transported to the future of the continuation
+  {
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(&p5);
+    p.set_value(1);
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error& e)
+    {
+      BOOST_TEST(std::string(e.what()) == "p5");
+    }
+    boost::promise<int> p2_;
+    boost::future<int> f2 = p2_.get_future().then(&p2);
+    p2_.set_exception(boost::copy_exception(std::logic_error("p2")));
+    try
+    {
+      f2.get();
+      BOOST_TEST(false);
+    }
+    catch (std::logic_error& e)
+    {
+      BOOST_TEST(std::string(e.what()) == "p2");
+    }
+  }
+  // a broken promise makes the continuation ready
+  {
+    boost::future<int> f;
+    {
+      boost::promise<int> p;
+      f = p.get_future().then(&p2);
+    }
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (boost::broken_promise&)
+    {
+    }
+  }
+  // continuations of async futures
+  {
+    boost::future<int> f = boost::async(boost::launch::async, &p1).then(&p2).then(&p2);
+    BOOST_TEST(f.get() == 4);
+  }
+  // deferred continuations are run by get()
+  {
+    boost::promise<int> p;
+    boost::future<boost::thread::id> f = p.get_future().then(boost::launch::deferred, &p3);
+    p.set_value(1);
+    BOOST_TEST(!f.is_ready());
+    BOOST_TEST(f.get() == boost::this_thread::get_id());
+  }
+  // launch::async continuations are run by a thread of their own
+  {
+    boost::promise<int> p;
+    boost::future<boost::thread::id> f = p.get_future().then(boost::launch::async, &p3);
+    p.set_value(1);
+    boost::thread::id id = f.get();
+    BOOST_TEST(id != boost::this_thread::get_id());
+    BOOST_TEST(id != boost::thread::id());
+  }
+  // continuations are submitted to the executor
+  {
+    boost::loop_executor ex;
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex, &p2);
+    p.set_value(5);
+    BOOST_TEST(!f.is_ready());
+    BOOST_TEST(ex.try_executing_one());
+    BOOST_TEST(f.get() == 10);
+  }
+  {
+    boost::basic_thread_pool pool(2);
+    boost::future<boost::thread::id> f = boost::make_future(1).then(pool, &p3);
+    boost::thread::id id = f.get();
+    BOOST_TEST(id != boost::this_thread::get_id());
+
+    boost::future<int> g = boost::async(pool, &p1).then(pool, &p2).then(pool, twice());
+    BOOST_TEST(g.get() == 4);
+  }
+  // a closed executor makes the continuation fail
+  {
+    boost::loop_executor ex;
+    ex.close();
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future().then(ex, &p2);
+    p.set_value(5);
+    try
+    {
+      f.get();
+      BOOST_TEST(false);
+    }
+    catch (boost::executors::executor_closed&)
+    {
+    }
+  }
+  // abandoned continuations don't keep the states alive
+  {
+    boost::promise<int> p;
+    p.get_future().then(&p2);
+    p.set_value(1);
+    boost::async(boost::launch::async, &p1).then(&p2);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,182 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class InputIterator>
+// future<vector<typename InputIterator::value_type>>
+//     when_all(InputIterator first, InputIterator last);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <stdexcept>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  return 123;
+}
+
+int runs = 0;
+
+int counted_p1(boost::future<int>& f)
+{
+  ++runs;
+  return f.get();
+}
+
+// a deferred continuation is run by the first thread waiting for its result
+boost::future<int> deferred_p1()
+{
+  return boost::make_future(123).then(boost::launch::deferred, &counted_p1);
+}
+
+int thr()
+{
+  throw std::logic_error("123");
+}
+
+int sum(boost::future<boost::container::vector<boost::future<int> > >& f)
+{
+  boost::container::vector<boost::future<int> > v;
+  f.get().swap(v);
+  int s = 0;
+  for (std::size_t i = 0; i < v.size(); ++i)
+  {
+    s += v[i].get();
+  }
+  return s;
+}
+
+int main()
+{
+  typedef boost::container::vector<boost::future<int> > futures;
+
+  // the result is ready once all the futures are
+  {
+    boost::promise<int> p[3];
+    boost::future<int> f[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      f[i] = p[i].get_future();
+    }
+    boost::future<futures> all = boost::when_all(f, f + 3);
+    BOOST_TEST(all.valid());
+    BOOST_TEST(!f[0].valid());
+    BOOST_TEST(!all.is_ready());
+    p[1].set_value(1);
+    p[0].set_value(0);
+    BOOST_TEST(!all.is_ready());
+    p[2].set_exception(boost::copy_exception(std::logic_error("2")));
+    BOOST_TEST(all.is_ready());
+    futures res;
+    all.get().swap(res);
+    BOOST_TEST(res.size() == 3);
+    BOOST_TEST(res[0].get() == 0);
+    BOOST_TEST(res[1].get() == 1);
+    BOOST_TEST(res[2].has_exception());
+  }
+  // ready futures
+  {
+    boost::future<int> f[2];
+    f[0] = boost::make_future(1);
+    f[1] = boost::make_future(2);
+    boost::future<futures> all = boost::when_all(f, f + 2);
+    BOOST_TEST(all.is_ready());
+    futures res;
+    all.get().swap(res);
+    BOOST_TEST(res[0].get() + res[1].get() == 3);
+  }
+  // an empty range
+  {
+    boost::future<futures> all = boost::when_all(static_cast<boost::future<int>*>(0), static_cast<boost::future<int>*>(0));
+    BOOST_TEST(all.is_ready());
+    BOOST_TEST(all.get().empty());
+  }
+  // futures run by threads and by executors, and a continuation of the result
+  {
+    boost::basic_thread_pool pool(2);
+    boost::future<int> f[4];
+    f[0] = boost::async(boost::launch::async, &p1);
+    f[1] = boost::async(pool, &p1);
+    f[2] = boost::async(pool, &p1);
+    f[3] = boost::async(pool, &thr);
+    boost::future<futures> all = boost::when_all(f, f + 3);
+    futures res;
+    all.get().swap(res);
+    BOOST_TEST(res.size() == 3);
+    for (std::size_t i = 0; i < res.size(); ++i)
+    {
+      BOOST_TEST(res[i].is_ready());
+      BOOST_TEST(res[i].get() == 123);
+    }
+    f[3].wait();
+    BOOST_TEST(f[3].has_exception());
+
+    f[0] = boost::async(pool, &p1);
+    f[1] = boost::async(pool, &p1);
+    BOOST_TEST(boost::when_all(f, f + 2).then(&sum).get() == 246);
+  }
+  // deferred futures are run by the thread waiting for the result, not by when_all()
+  {
+    boost::basic_thread_pool pool(1);
+    boost::future<int> f[3];
+    f[0] = deferred_p1();
+    f[1] = boost::async(pool, &p1);
+    f[2] = deferred_p1();
+    boost::future<futures> all = boost::when_all(f, f + 3);
+    BOOST_TEST(runs == 0);
+    BOOST_TEST(!all.is_ready());
+    futures res;
+    all.get().swap(res);
+    BOOST_TEST(runs == 2);
+    for (std::size_t i = 0; i < res.size(); ++i)
+    {
+      BOOST_TEST(res[i].get() == 123);
+    }
+
+    f[0] = deferred_p1();
+    f[1] = deferred_p1();
+    boost::future<int> s = boost::when_all(f, f + 2).then(&sum);
+    BOOST_TEST(runs == 2);
+    BOOST_TEST(s.get() == 246);
+    BOOST_TEST(runs == 4);
+  }
+  // shared futures are copied
+  {
+    boost::promise<int> p;
+    boost::shared_future<int> sf[2];
+    sf[0] = p.get_future().share();
+    sf[1] = sf[0];
+    boost::future<boost::container::vector<boost::shared_future<int> > > all = boost::when_all(sf, sf + 2);
+    BOOST_TEST(sf[0].valid());
+    BOOST_TEST(!all.is_ready());
+    p.set_value(3);
+    BOOST_TEST(all.is_ready());
+    BOOST_TEST(all.get()[1].get() == 3);
+  }
+  // an abandoned result doesn't prevent the futures from being ready
+  {
+    boost::promise<int> p;
+    boost::future<int> f = p.get_future();
+    boost::when_all(&f, &f + 1);
+    p.set_value(1);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,72 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class... Futures>
+// future<tuple<decay_t<Futures>...>> when_all(Futures&&... futures);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <string>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY \
+  && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_HDR_TUPLE && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+
+int p1()
+{
+  return 123;
+}
+
+std::string p2()
+{
+  return "abc";
+}
+
+int main()
+{
+  // the result is ready once all the futures are
+  {
+    boost::promise<int> p1_;
+    boost::promise<std::string> p2_;
+    boost::shared_future<int> sf = p1_.get_future().share();
+    boost::future<std::tuple<boost::shared_future<int>, boost::future<std::string> > > all =
+        boost::when_all(sf, p2_.get_future());
+    BOOST_TEST(sf.valid());
+    BOOST_TEST(!all.is_ready());
+    p1_.set_value(1);
+    BOOST_TEST(!all.is_ready());
+    p2_.set_value("abc");
+    BOOST_TEST(all.is_ready());
+    std::tuple<boost::shared_future<int>, boost::future<std::string> > res = all.get();
+    BOOST_TEST(std::get<0>(res).get() == 1);
+    BOOST_TEST(std::get<1>(res).get() == "abc");
+  }
+  // futures run by executors
+  {
+    boost::basic_thread_pool pool(2);
+    auto res = boost::when_all(boost::async(pool, &p1), boost::async(pool, &p2), boost::make_future(1.5)).get();
+    BOOST_TEST(std::get<0>(res).get() == 123);
+    BOOST_TEST(std::get<1>(res).get() == "abc");
+    BOOST_TEST(std::get<2>(res).get() == 1.5);
+  }
+  // no futures
+  {
+    BOOST_TEST(boost::when_all().is_ready());
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
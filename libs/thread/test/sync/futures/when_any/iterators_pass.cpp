@@ -0,0 +1,162 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class InputIterator>
+// future<vector<typename InputIterator::value_type>>
+//     when_any(InputIterator first, InputIterator last);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <stdexcept>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY
+
+int p1()
+{
+  return 123;
+}
+
+int runs = 0;
+
+int counted_p1(boost::future<int>& f)
+{
+  ++runs;
+  return f.get();
+}
+
+// a deferred continuation is run by the first thread waiting for its result
+boost::future<int> deferred_p1()
+{
+  return boost::make_future(123).then(boost::launch::deferred, &counted_p1);
+}
+
+int main()
+{
+  typedef boost::container::vector<boost::future<int> > futures;
+
+  // the result is ready once any of the futures is
+  {
+    boost::promise<int> p[3];
+    boost::future<int> f[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      f[i] = p[i].get_future();
+    }
+    boost::future<futures> any = boost::when_any(f, f + 3);
+    BOOST_TEST(any.valid());
+    BOOST_TEST(!f[0].valid());
+    BOOST_TEST(!any.is_ready());
+    p[1].set_value(1);
+    BOOST_TEST(any.is_ready());
+    futures res;
+    any.get().swap(res);
+    BOOST_TEST(res.size() == 3);
+    BOOST_TEST(!res[0].is_ready());
+    BOOST_TEST(res[1].get() == 1);
+    BOOST_TEST(!res[2].is_ready());
+    // the other futures are still usable
+    p[0].set_value(0);
+    p[2].set_exception(boost::copy_exception(std::logic_error("2")));
+    BOOST_TEST(res[0].get() == 0);
+    BOOST_TEST(res[2].has_exception());
+  }
+  // an exception makes the result ready as well
+  {
+    boost::promise<int> p[2];
+    boost::future<int> f[2];
+    f[0] = p[0].get_future();
+    f[1] = p[1].get_future();
+    boost::future<futures> any = boost::when_any(f, f + 2);
+    p[0].set_exception(boost::copy_exception(std::logic_error("0")));
+    BOOST_TEST(any.is_ready());
+    BOOST_TEST(any.get()[0].has_exception());
+  }
+  // a ready future
+  {
+    boost::promise<int> p;
+    boost::future<int> f[2];
+    f[0] = p.get_future();
+    f[1] = boost::make_future(2);
+    boost::future<futures> any = boost::when_any(f, f + 2);
+    BOOST_TEST(any.is_ready());
+  }
+  // an empty range
+  {
+    boost::future<futures> any = boost::when_any(static_cast<boost::future<int>*>(0), static_cast<boost::future<int>*>(0));
+    BOOST_TEST(any.is_ready());
+    BOOST_TEST(any.get().empty());
+  }
+  // futures run by executors
+  {
+    boost::basic_thread_pool pool(2);
+    boost::promise<int> p;
+    boost::future<int> f[2];
+    f[0] = p.get_future();
+    f[1] = boost::async(pool, &p1);
+    futures res;
+    boost::when_any(f, f + 2).get().swap(res);
+    BOOST_TEST(!res[0].is_ready());
+    BOOST_TEST(res[1].get() == 123);
+    p.set_value(0);
+  }
+  // deferred futures are run by the thread waiting for the result, until one of the futures is ready
+  {
+    boost::promise<int> p;
+    boost::future<int> f[3];
+    f[0] = p.get_future();
+    f[1] = deferred_p1();
+    f[2] = deferred_p1();
+    boost::future<futures> any = boost::when_any(f, f + 3);
+    BOOST_TEST(runs == 0);
+    BOOST_TEST(!any.is_ready());
+    futures res;
+    any.get().swap(res);
+    BOOST_TEST(runs == 1);
+    BOOST_TEST(res[1].get() == 123);
+    BOOST_TEST(!res[2].is_ready());
+    p.set_value(0);
+
+    // they are not run if another future is ready first
+    p = boost::promise<int>();
+    f[0] = p.get_future();
+    f[1] = deferred_p1();
+    any = boost::when_any(f, f + 2);
+    p.set_value(0);
+    BOOST_TEST(any.is_ready());
+    any.get().swap(res);
+    BOOST_TEST(runs == 1);
+    BOOST_TEST(res[0].get() == 0);
+  }
+  // shared futures are copied
+  {
+    boost::promise<int> p[2];
+    boost::shared_future<int> sf[2];
+    sf[0] = p[0].get_future().share();
+    sf[1] = p[1].get_future().share();
+    boost::future<boost::container::vector<boost::shared_future<int> > > any = boost::when_any(sf, sf + 2);
+    BOOST_TEST(sf[0].valid());
+    p[1].set_value(3);
+    BOOST_TEST(any.is_ready());
+    BOOST_TEST(any.get()[1].get() == 3);
+    BOOST_TEST(sf[1].get() == 3);
+    p[0].set_value(0);
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
@@ -0,0 +1,65 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/future.hpp>
+
+// template <class... Futures>
+// future<tuple<decay_t<Futures>...>> when_any(Futures&&... futures);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/future.hpp>
+#include <boost/thread/executors/basic_thread_pool.hpp>
+#include <boost/detail/lightweight_test.hpp>
+#include <string>
+
+#if defined BOOST_THREAD_PROVIDES_FUTURE_WHEN_ALL_WHEN_ANY \
+  && ! defined BOOST_NO_CXX11_VARIADIC_TEMPLATES && ! defined BOOST_NO_CXX11_HDR_TUPLE && ! defined BOOST_NO_CXX11_RVALUE_REFERENCES
+
+std::string p2()
+{
+  return "abc";
+}
+
+int main()
+{
+  // the result is ready once any of the futures is
+  {
+    boost::promise<int> p1_;
+    boost::promise<std::string> p2_;
+    boost::future<std::tuple<boost::future<int>, boost::future<std::string> > > any =
+        boost::when_any(p1_.get_future(), p2_.get_future());
+    BOOST_TEST(!any.is_ready());
+    p2_.set_value("abc");
+    BOOST_TEST(any.is_ready());
+    std::tuple<boost::future<int>, boost::future<std::string> > res = any.get();
+    BOOST_TEST(!std::get<0>(res).is_ready());
+    BOOST_TEST(std::get<1>(res).get() == "abc");
+    p1_.set_value(1);
+    BOOST_TEST(std::get<0>(res).get() == 1);
+  }
+  // futures run by executors
+  {
+    boost::basic_thread_pool pool(1);
+    boost::promise<int> p;
+    auto res = boost::when_any(p.get_future(), boost::async(pool, &p2)).get();
+    BOOST_TEST(std::get<1>(res).get() == "abc");
+    p.set_value(0);
+  }
+  // no futures
+  {
+    BOOST_TEST(boost::when_any().is_ready());
+  }
+
+  return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+  return 0;
+}
+#endif
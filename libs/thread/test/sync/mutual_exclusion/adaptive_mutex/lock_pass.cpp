@@ -0,0 +1,100 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/adaptive_mutex.hpp>
+
+// class adaptive_mutex;
+
+// void lock();
+// void unlock();
+// statistics get_statistics() const;
+// void reset_statistics();
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/adaptive_mutex.hpp>
+#include <boost/thread/lock_guard.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/lockable_concepts.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+BOOST_CONCEPT_ASSERT(( boost::TimedLockable<boost::adaptive_mutex> ));
+
+boost::adaptive_mutex m;
+
+typedef boost::chrono::milliseconds ms;
+
+boost::atomic<bool> done(false);
+
+void f()
+{
+  m.lock();
+  done = true;
+  m.unlock();
+}
+
+// only modified with m locked
+unsigned value = 0;
+
+void increment()
+{
+  for (int i = 0; i < 100000; ++i)
+  {
+    boost::lock_guard<boost::adaptive_mutex> lk(m);
+    ++value;
+  }
+}
+
+int main()
+{
+  // a thread blocks until the mutex is unlocked
+  {
+    m.lock();
+    boost::thread t(f);
+    boost::this_thread::sleep_for(ms(250));
+    BOOST_TEST(!done);
+    m.unlock();
+    t.join();
+    BOOST_TEST(done);
+
+    boost::adaptive_mutex::statistics s = m.get_statistics();
+    BOOST_TEST(s.acquisitions == 2);
+    BOOST_TEST(s.contentions == 1);
+    BOOST_TEST(s.parks >= 1);
+    BOOST_TEST(s.spins >= BOOST_THREAD_ADAPTIVE_MUTEX_MIN_SPINS);
+  }
+  // the counters are reset
+  {
+    m.reset_statistics();
+    {
+      boost::unique_lock<boost::adaptive_mutex> lk(m);
+      BOOST_TEST(lk.owns_lock());
+    }
+    boost::adaptive_mutex::statistics s = m.get_statistics();
+    BOOST_TEST(s.acquisitions == 1);
+    BOOST_TEST(s.contentions == 0);
+    BOOST_TEST(s.spins == 0);
+    BOOST_TEST(s.parks == 0);
+    BOOST_TEST(s.spin_limit >= BOOST_THREAD_ADAPTIVE_MUTEX_MIN_SPINS);
+    BOOST_TEST(s.spin_limit <= BOOST_THREAD_ADAPTIVE_MUTEX_MAX_SPINS);
+  }
+  // a stress test: no increment is lost
+  {
+    m.reset_statistics();
+    boost::thread_group g;
+    for (int i = 0; i < 4; ++i)
+    {
+      g.create_thread(increment);
+    }
+    g.join_all();
+    BOOST_TEST(value == 400000);
+    boost::adaptive_mutex::statistics s = m.get_statistics();
+    BOOST_TEST(s.acquisitions == 400000);
+    BOOST_TEST(s.contentions <= s.acquisitions);
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_shared_mutex.hpp>
+
+// class striped_shared_mutex;
+
+// striped_shared_mutex(const striped_shared_mutex&) = delete;
+
+#include <boost/thread/striped_shared_mutex.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+int main()
+{
+  boost::striped_shared_mutex m0;
+  boost::striped_shared_mutex m1(m0);
+}
+
+#include "../../../remove_error_code_unused_warning.hpp"
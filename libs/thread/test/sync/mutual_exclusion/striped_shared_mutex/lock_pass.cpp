@@ -0,0 +1,158 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_shared_mutex.hpp>
+
+// class striped_shared_mutex;
+
+// void lock();
+// bool try_lock();
+// void unlock();
+// void lock_shared();
+// bool try_lock_shared();
+// void unlock_shared();
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/striped_shared_mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::striped_shared_mutex m;
+
+typedef boost::chrono::milliseconds ms;
+
+bool try_lock()
+{
+  if (!m.try_lock()) return false;
+  m.unlock();
+  return true;
+}
+
+bool try_lock_shared()
+{
+  if (!m.try_lock_shared()) return false;
+  m.unlock_shared();
+  return true;
+}
+
+boost::atomic<bool> done(false);
+
+void no_shared()
+{
+  BOOST_TEST(!try_lock_shared());
+}
+
+void shared()
+{
+  m.lock_shared();
+  done = true;
+}
+
+void exclusive()
+{
+  m.lock();
+  done = true;
+}
+
+// the value, and its copy, are only modified by the writers
+unsigned value = 0;
+unsigned copy = 0;
+boost::atomic<unsigned> inconsistencies(0);
+boost::atomic<unsigned> readers(0);
+
+void reader()
+{
+  for (int i = 0; i < 20000; ++i)
+  {
+    boost::shared_lock<boost::striped_shared_mutex> lk(m);
+    ++readers;
+    if (value != copy)
+    {
+      ++inconsistencies;
+    }
+    --readers;
+  }
+}
+
+void writer()
+{
+  for (int i = 0; i < 2000; ++i)
+  {
+    boost::unique_lock<boost::striped_shared_mutex> lk(m);
+    if (readers != 0)
+    {
+      ++inconsistencies;
+    }
+    ++value;
+    boost::this_thread::yield();
+    ++copy;
+  }
+}
+
+int main()
+{
+  // exclusive ownership excludes all the other owners
+  {
+    m.lock();
+    BOOST_TEST(!try_lock());
+    BOOST_TEST(!try_lock_shared());
+    BOOST_TEST(!m.try_lock_upgrade());
+    m.unlock();
+    BOOST_TEST(try_lock());
+  }
+  // shared ownership excludes the exclusive owner only
+  {
+    m.lock_shared();
+    m.lock_shared();
+    BOOST_TEST(!try_lock());
+    BOOST_TEST(try_lock_shared());
+    BOOST_TEST(m.try_lock_upgrade());
+    m.unlock_upgrade();
+    m.unlock_shared();
+    BOOST_TEST(!try_lock());
+    m.unlock_shared();
+    BOOST_TEST(try_lock());
+  }
+  // readers are blocked by a writer, and the writer by the readers
+  {
+    m.lock();
+    boost::thread t(no_shared);
+    t.join();
+    boost::thread r(shared);
+    boost::this_thread::sleep_for(ms(100));
+    BOOST_TEST(!done);
+    m.unlock();
+    r.join();
+    BOOST_TEST(done);
+    done = false;
+    boost::thread w(exclusive);
+    boost::this_thread::sleep_for(ms(100));
+    BOOST_TEST(!done);
+    m.unlock_shared();
+    w.join();
+    BOOST_TEST(done);
+    BOOST_TEST(!try_lock_shared());
+    m.unlock();
+  }
+  // a stress test: the readers never see a partial update, nor the writers a reader
+  {
+    boost::thread_group g;
+    for (int i = 0; i < 4; ++i)
+    {
+      g.create_thread(reader);
+    }
+    g.create_thread(writer);
+    g.create_thread(writer);
+    g.join_all();
+    BOOST_TEST(inconsistencies == 0);
+    BOOST_TEST(value == 4000);
+    BOOST_TEST(copy == 4000);
+    BOOST_TEST(try_lock());
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_shared_mutex.hpp>
+
+// class striped_shared_mutex;
+
+// template <class Rep, class Period>
+//     bool try_lock_for(const chrono::duration<Rep, Period>& rel_time);
+// template <class Rep, class Period>
+//     bool try_lock_shared_for(const chrono::duration<Rep, Period>& rel_time);
+// template <class Rep, class Period>
+//     bool try_lock_upgrade_for(const chrono::duration<Rep, Period>& rel_time);
+// template <class Rep, class Period>
+//     bool try_unlock_upgrade_and_lock_for(const chrono::duration<Rep, Period>& rel_time);
+
+#define BOOST_THREAD_VERSION 4
+
+#include <boost/thread/striped_shared_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+boost::striped_shared_mutex m;
+
+typedef boost::chrono::steady_clock Clock;
+typedef Clock::time_point time_point;
+typedef boost::chrono::milliseconds ms;
+typedef boost::chrono::nanoseconds ns;
+
+void f1()
+{
+  time_point t0 = Clock::now();
+  // This test is spurious as it depends on the time the thread system switches the threads
+  BOOST_TEST(m.try_lock_for(ms(300)+ms(1000)) == true);
+  time_point t1 = Clock::now();
+  m.unlock();
+  ns d = t1 - t0 - ms(250);
+  BOOST_TEST(d < ns(5000000)+ms(1000)); // within 5ms
+}
+
+void f2()
+{
+  time_point t0 = Clock::now();
+  BOOST_TEST(m.try_lock_for(ms(250)) == false);
+  BOOST_TEST(m.try_lock_shared_for(ms(250)) == false);
+  BOOST_TEST(m.try_lock_upgrade_for(ms(250)) == false);
+  time_point t1 = Clock::now();
+  ns d = t1 - t0 - ms(750);
+  // This test is spurious as it depends on the time the thread system switches the threads
+  BOOST_TEST(d < ns(5000000)+ms(1000)); // within 5ms
+}
+
+void f3()
+{
+  BOOST_TEST(m.try_lock_shared_for(ms(300)+ms(1000)) == true);
+  m.unlock_shared();
+}
+
+void f4()
+{
+  m.lock_shared();
+  boost::this_thread::sleep_for(ms(300)+ms(1000));
+  m.unlock_shared();
+}
+
+int main()
+{
+  // the timed functions succeed once the writer leaves
+  {
+    m.lock();
+    boost::thread t(f1);
+    boost::thread t3(f3);
+    boost::this_thread::sleep_for(ms(250));
+    m.unlock();
+    t.join();
+    t3.join();
+  }
+  // or time out
+  {
+    m.lock();
+    boost::thread t(f2);
+    // This test is spurious as it depends on the time the thread system switches the threads
+    boost::this_thread::sleep_for(ms(750)+ms(1000));
+    m.unlock();
+    t.join();
+  }
+  // a writer that times out waiting for a reader lets the other readers in again
+  {
+    boost::thread t(f4);
+    boost::this_thread::sleep_for(ms(100));
+    BOOST_TEST(m.try_lock_for(ms(100)) == false);
+    BOOST_TEST(m.try_lock_shared());
+    m.unlock_shared();
+    m.lock_upgrade();
+    BOOST_TEST(m.try_unlock_upgrade_and_lock_for(ms(100)) == false);
+    BOOST_TEST(m.try_lock_shared());
+    m.unlock_shared();
+    m.unlock_upgrade();
+    t.join();
+    BOOST_TEST(m.try_lock());
+    m.unlock();
+  }
+
+  return boost::report_errors();
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2026 Joshua Napoli
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// <boost/thread/striped_shared_mutex.hpp>
+
+// class striped_shared_mutex;
+
+// void lock_upgrade();
+// bool try_lock_upgrade();
+// void unlock_upgrade();
+// void unlock_upgrade_and_lock();
+// bool try_unlock_upgrade_and_lock();
+// void unlock_and_lock_upgrade();
+// void unlock_and_lock_shared();
+// void unlock_upgrade_and_lock_shared();
+// bool try_unlock_shared_and_lock();
+// bool try_unlock_shared_and_lock_upgrade();
+
+#define BOOST_THREAD_VERSION 4
+#define BOOST_THREAD_PROVIDES_SHARED_MUTEX_UPWARDS_CONVERSIONS
+
+#include <boost/thread/striped_shared_mutex.hpp>
+#include <boost/thread/lock_types.hpp>
+#include <boost/thread/lockable_concepts.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/detail/lightweight_test.hpp>
+
+BOOST_CONCEPT_ASSERT(( boost::UpgradeLockable<boost::striped_shared_mutex> ));
+
+boost::striped_shared_mutex m;
+
+typedef boost::chrono::milliseconds ms;
+
+bool try_lock()
+{
+  if (!m.try_lock()) return false;
+  m.unlock();
+  return true;
+}
+
+bool try_lock_shared()
+{
+  if (!m.try_lock_shared()) return false;
+  m.unlock_shared();
+  return true;
+}
+
+bool try_lock_upgrade()
+{
+  if (!m.try_lock_upgrade()) return false;
+  m.unlock_upgrade();
+  return true;
+}
+
+boost::atomic<bool> locked(false);
+boost::atomic<bool> done(false);
+
+void shared()
+{
+  boost::shared_lock<boost::striped_shared_mutex> lk(m);
+  locked = true;
+  boost::this_thread::sleep_for(ms(100));
+  done = true;
+}
+
+int main()
+{
+  // upgrade ownership is shared with the readers only
+  {
+    boost::upgrade_lock<boost::striped_shared_mutex> lk(m);
+    BOOST_TEST(lk.owns_lock());
+    BOOST_TEST(try_lock_shared());
+    BOOST_TEST(!try_lock_upgrade());
+    BOOST_TEST(!try_lock());
+  }
+  BOOST_TEST(try_lock());
+  // upgrading waits for the readers to leave, and excludes them until it is downgraded
+  {
+    boost::upgrade_lock<boost::striped_shared_mutex> lk(m);
+    boost::thread t(shared);
+    while (!locked)
+    {
+      boost::this_thread::yield();
+    }
+    {
+      boost::upgrade_to_unique_lock<boost::striped_shared_mutex> ulk(lk);
+      BOOST_TEST(done);
+      BOOST_TEST(!try_lock_shared());
+      BOOST_TEST(!try_lock_upgrade());
+    }
+    BOOST_TEST(try_lock_shared());
+    BOOST_TEST(!try_lock_upgrade());
+    t.join();
+  }
+  // the conversions
+  {
+    m.lock_upgrade();
+    m.lock_shared();
+    BOOST_TEST(!m.try_unlock_upgrade_and_lock());
+    m.unlock_shared();
+    BOOST_TEST(m.try_unlock_upgrade_and_lock());
+    BOOST_TEST(!try_lock_shared());
+    m.unlock_and_lock_upgrade();
+    BOOST_TEST(try_lock_shared());
+    m.unlock_upgrade_and_lock();
+    m.unlock_and_lock_shared();
+    BOOST_TEST(try_lock_shared());
+    BOOST_TEST(!try_lock());
+    BOOST_TEST(try_lock_upgrade());
+    m.unlock_shared();
+    BOOST_TEST(try_lock());
+
+    m.lock_upgrade();
+    m.unlock_upgrade_and_lock_shared();
+    BOOST_TEST(try_lock_upgrade());
+    BOOST_TEST(!try_lock());
+    m.lock_shared();
+    BOOST_TEST(!m.try_unlock_shared_and_lock());
+    BOOST_TEST(m.try_unlock_shared_and_lock_upgrade());
+    BOOST_TEST(!m.try_unlock_shared_and_lock());
+    m.unlock_upgrade();
+    BOOST_TEST(m.try_unlock_shared_and_lock());
+    BOOST_TEST(!try_lock_shared());
+    m.unlock();
+    BOOST_TEST(try_lock());
+  }
+
+  return boost::report_errors();
+}
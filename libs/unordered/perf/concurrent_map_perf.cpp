@@ -0,0 +1,171 @@
+// Copyright 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares concurrent_unordered_map with an unordered_map protected by a
+// shared_mutex, running from 1 to 64 threads. Each operation is a lookup
+// (90%), an insert (5%) or an erase (5%) of a random key.
+//
+// Usage: concurrent_map_perf [number of elements] [operations per thread]
+
+#include <boost/concurrent_unordered_map.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+typedef boost::uint64_t key_type;
+
+// A simple xorshift generator, so that both containers see the same keys.
+struct random_keys
+{
+    boost::uint64_t state;
+
+    explicit random_keys(boost::uint64_t seed) : state(seed) {}
+
+    key_type operator()()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+class locked_map
+{
+public:
+    bool insert(key_type k, std::size_t v)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex_);
+        return map_.insert(std::make_pair(k, v)).second;
+    }
+
+    std::size_t count(key_type k) const
+    {
+        boost::shared_lock<boost::shared_mutex> lock(mutex_);
+        return map_.count(k);
+    }
+
+    std::size_t erase(key_type k)
+    {
+        boost::unique_lock<boost::shared_mutex> lock(mutex_);
+        return map_.erase(k);
+    }
+
+private:
+    mutable boost::shared_mutex mutex_;
+    boost::unordered_map<key_type, std::size_t> map_;
+};
+
+class sharded_map
+{
+public:
+    bool insert(key_type k, std::size_t v)
+    {
+        return map_.insert(std::make_pair(k, v));
+    }
+
+    std::size_t count(key_type k) const
+    {
+        return map_.count(k);
+    }
+
+    std::size_t erase(key_type k)
+    {
+        return map_.erase(k);
+    }
+
+private:
+    boost::concurrent_unordered_map<key_type, std::size_t> map_;
+};
+
+// The keys that are looked up, erased and inserted are drawn from twice the
+// initial number of elements, so that the size stays roughly the same.
+template <class Map>
+void run_thread(Map* m, std::vector<key_type> const* keys,
+        std::size_t operations, boost::uint64_t seed, std::size_t* checksum)
+{
+    random_keys gen(seed);
+    std::size_t n = keys->size();
+    std::size_t sum = 0;
+
+    for (std::size_t i = 0; i < operations; ++i) {
+        boost::uint64_t r = gen();
+        key_type k = (*keys)[static_cast<std::size_t>(r >> 8) % n];
+        switch (r % 20) {
+        case 0:
+            sum += m->insert(k, i);
+            break;
+        case 1:
+            sum += m->erase(k);
+            break;
+        default:
+            sum += m->count(k);
+            break;
+        }
+    }
+
+    *checksum = sum;
+}
+
+// The checksum is printed so that the lookups can't be optimised away.
+template <class Map>
+void run(char const* name, std::vector<key_type> const& keys,
+        std::size_t operations, int thread_count)
+{
+    Map m;
+    for (std::size_t i = 0; i < keys.size(); i += 2)
+        m.insert(keys[i], i);
+
+    std::vector<std::size_t> checksums(thread_count);
+    boost::posix_time::ptime start =
+        boost::posix_time::microsec_clock::universal_time();
+
+    boost::thread_group threads;
+    for (int i = 0; i < thread_count; ++i) {
+        threads.create_thread(boost::bind(&run_thread<Map>, &m, &keys,
+            operations, static_cast<boost::uint64_t>(i + 1) * 7919u,
+            &checksums[i]));
+    }
+    threads.join_all();
+
+    double seconds = static_cast<double>((
+        boost::posix_time::microsec_clock::universal_time() - start)
+            .total_microseconds()) / 1e6;
+
+    std::size_t checksum = 0;
+    for (int i = 0; i < thread_count; ++i) checksum += checksums[i];
+
+    std::printf("%-28s %2d threads %10.2f Mops/s (checksum %lu)\n",
+        name, thread_count,
+        static_cast<double>(operations) * thread_count / seconds / 1e6,
+        static_cast<unsigned long>(checksum));
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = argc > 1 ?
+        static_cast<std::size_t>(std::strtoul(argv[1], 0, 10)) : 1000000;
+    std::size_t operations = argc > 2 ?
+        static_cast<std::size_t>(std::strtoul(argv[2], 0, 10)) : 1000000;
+
+    random_keys gen(88172645463325252ull);
+    std::vector<key_type> keys;
+    keys.reserve(n * 2);
+    for (std::size_t i = 0; i < n * 2; ++i)
+        keys.push_back(gen());
+
+    for (int threads = 1; threads <= 64; threads *= 2) {
+        run<locked_map>("unordered_map+shared_mutex", keys, operations,
+            threads);
+        run<sharded_map>("concurrent_unordered_map", keys, operations,
+            threads);
+    }
+}
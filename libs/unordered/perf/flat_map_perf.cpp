@@ -0,0 +1,116 @@
+
+// Copyright 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compares unordered_flat_map with unordered_map for insertion, successful
+// and unsuccessful lookup, erasure, and a mix of the three.
+//
+// Usage: flat_map_perf [number of elements]
+
+#include <boost/unordered_flat_map.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/cstdint.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+typedef boost::uint64_t key_type;
+
+// A simple xorshift generator, so that both containers see the same keys.
+struct random_keys
+{
+    boost::uint64_t state;
+
+    explicit random_keys(boost::uint64_t seed) : state(seed) {}
+
+    key_type operator()()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+};
+
+double seconds_since(std::clock_t start)
+{
+    return static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+void report(char const* container, char const* test, double seconds,
+        std::size_t operations)
+{
+    std::printf("%-20s %-8s %10.2f ns/op\n", container, test,
+        seconds * 1e9 / static_cast<double>(operations));
+}
+
+// The checksums are printed so that the lookups can't be optimised away.
+template <class Map>
+void run(char const* name, std::vector<key_type> const& keys,
+        std::vector<key_type> const& missing)
+{
+    std::size_t n = keys.size();
+    std::size_t checksum = 0;
+    Map m;
+
+    std::clock_t start = std::clock();
+    for (std::size_t i = 0; i < n; ++i)
+        m[keys[i]] = i;
+    report(name, "insert", seconds_since(start), n);
+
+    start = std::clock();
+    for (std::size_t i = 0; i < n; ++i)
+        checksum += m.find(keys[i])->second;
+    report(name, "hit", seconds_since(start), n);
+
+    start = std::clock();
+    for (std::size_t i = 0; i < n; ++i)
+        checksum += m.count(missing[i]);
+    report(name, "miss", seconds_since(start), n);
+
+    // Replace half of the elements: each step erases one key, looks up
+    // another and inserts a new one.
+    start = std::clock();
+    for (std::size_t i = 0; i < n / 2; ++i) {
+        m.erase(keys[i]);
+        checksum += m.count(keys[n - 1 - i]);
+        m[missing[i]] = i;
+    }
+    report(name, "mixed", seconds_since(start), n / 2 * 3);
+
+    start = std::clock();
+    for (std::size_t i = n / 2; i < n; ++i)
+        checksum += m.erase(keys[i]);
+    for (std::size_t i = 0; i < n / 2; ++i)
+        checksum += m.erase(missing[i]);
+    report(name, "erase", seconds_since(start), n);
+
+    std::printf("%-20s checksum %lu, %lu left\n", name,
+        static_cast<unsigned long>(checksum),
+        static_cast<unsigned long>(m.size()));
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t n = argc > 1 ?
+        static_cast<std::size_t>(std::strtoul(argv[1], 0, 10)) : 1000000;
+
+    // Keys and missing keys are drawn from the same sequence, so that they
+    // can't collide.
+    random_keys gen(88172645463325252ull);
+    std::vector<key_type> keys, missing;
+    keys.reserve(n);
+    missing.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        keys.push_back(gen());
+        missing.push_back(gen());
+    }
+
+    run<boost::unordered_map<key_type, std::size_t> >(
+        "unordered_map", keys, missing);
+    run<boost::unordered_flat_map<key_type, std::size_t> >(
+        "unordered_flat_map", keys, missing);
+}
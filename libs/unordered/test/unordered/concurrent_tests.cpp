@@ -0,0 +1,173 @@
+
+// Copyright 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test checks concurrent_unordered_map against std::map, and then
+// modifies it from several threads at once.
+
+#include "../helpers/prefix.hpp"
+#include <boost/concurrent_unordered_map.hpp>
+#include "../helpers/postfix.hpp"
+
+#include "../helpers/test.hpp"
+#include <boost/bind.hpp>
+#include <boost/thread/thread.hpp>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef boost::concurrent_unordered_map<int, int> map_type;
+
+struct get_value
+{
+    int* result;
+    explicit get_value(int* r) : result(r) {}
+    void operator()(std::pair<const int, int> const& x) const {
+        *result = x.second;
+    }
+};
+
+struct add_value
+{
+    int n;
+    explicit add_value(int n_) : n(n_) {}
+    void operator()(std::pair<const int, int>& x) const { x.second += n; }
+};
+
+struct sum_values
+{
+    long sum;
+    std::size_t count;
+    sum_values() : sum(0), count(0) {}
+    void operator()(std::pair<const int, int> const& x) {
+        sum += x.second;
+        ++count;
+    }
+};
+
+UNORDERED_AUTO_TEST(concurrent_map_random_tests)
+{
+    std::srand(14878);
+
+    map_type x;
+    std::map<int, int> r;
+    BOOST_TEST(x.empty());
+
+    for (int i = 0; i < 100000; ++i) {
+        int k = std::rand() % 3000;
+        switch (std::rand() % 5) {
+        case 0:
+            BOOST_TEST(x.erase(k) == r.erase(k));
+            break;
+        case 1:
+            BOOST_TEST(x.insert(std::make_pair(k, i)) ==
+                r.insert(std::make_pair(k, i)).second);
+            break;
+        case 2:
+            BOOST_TEST(x.emplace(k, i) ==
+                r.insert(std::make_pair(k, i)).second);
+            break;
+        case 3:
+            if (!x.insert_or_visit(std::make_pair(k, i), add_value(1)))
+                ++r[k];
+            else
+                r[k] = i;
+            break;
+        default: {
+            int value = -1;
+            BOOST_TEST(x.visit(k, get_value(&value)) == r.count(k));
+            BOOST_TEST(x.count(k) == r.count(k));
+            if (r.count(k)) BOOST_TEST(value == r[k]);
+            break;
+        }
+        }
+    }
+
+    BOOST_TEST(x.size() == r.size());
+    BOOST_TEST(x.load_factor() <= x.max_load_factor());
+
+    map_type const& cx = x;
+    sum_values s = cx.for_each(sum_values());
+    long expected = 0;
+    for (std::map<int, int>::const_iterator it = r.begin(); it != r.end();
+            ++it)
+        expected += it->second;
+    BOOST_TEST(s.count == r.size());
+    BOOST_TEST(s.sum == expected);
+
+    x.clear();
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.count(0) == 0);
+}
+
+UNORDERED_AUTO_TEST(concurrent_map_rehash_tests)
+{
+    boost::concurrent_unordered_map<std::string, int> x;
+    x.reserve(100000);
+    std::size_t slots = x.bucket_count();
+    BOOST_TEST(slots >= 100000);
+
+    std::vector<std::pair<std::string, int> > values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(std::make_pair(
+            std::string(static_cast<std::size_t>(i % 50), 'a') +
+            static_cast<char>('a' + i / 50), i));
+    }
+    x.insert(values.begin(), values.end());
+    BOOST_TEST(x.size() == 1000);
+    BOOST_TEST(x.bucket_count() == slots);
+
+    x.rehash(0);
+    BOOST_TEST(x.bucket_count() < slots);
+    BOOST_TEST(x.size() == 1000);
+    for (int i = 0; i < 1000; ++i) BOOST_TEST(x.count(values[i].first) == 1);
+
+    boost::concurrent_unordered_map<std::string, int> y(
+        values.begin(), values.end());
+    BOOST_TEST(y.size() == 1000);
+}
+
+// Each thread inserts its own range of keys, and increments a shared set of
+// counters.
+
+const int thread_count = 8;
+const int keys_per_thread = 20000;
+const int shared_keys = 100;
+
+void insert_thread(map_type* x, int id)
+{
+    for (int i = 0; i < keys_per_thread; ++i) {
+        int k = id * keys_per_thread + i;
+        x->emplace(k, k);
+        x->insert_or_visit(std::make_pair(-1 - i % shared_keys, 1),
+            add_value(1));
+        if (i % 2) x->erase(k);
+    }
+}
+
+UNORDERED_AUTO_TEST(concurrent_map_thread_tests)
+{
+    map_type x;
+
+    boost::thread_group threads;
+    for (int i = 0; i < thread_count; ++i)
+        threads.create_thread(boost::bind(insert_thread, &x, i));
+    threads.join_all();
+
+    BOOST_TEST(x.size() ==
+        static_cast<std::size_t>(thread_count * keys_per_thread / 2 +
+            shared_keys));
+
+    for (int i = 0; i < thread_count * keys_per_thread; ++i)
+        BOOST_TEST(x.count(i) == (i % 2 ? 0u : 1u));
+
+    for (int i = 0; i < shared_keys; ++i) {
+        int value = 0;
+        x.visit(-1 - i, get_value(&value));
+        BOOST_TEST(value == thread_count * keys_per_thread / shared_keys);
+    }
+}
+
+RUN_TESTS()
@@ -0,0 +1,252 @@
+
+// Copyright 2026 Joshua Napoli.
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test checks the open addressing containers against std::map and
+// std::set.
+
+#include "../helpers/prefix.hpp"
+#include <boost/unordered_flat_set.hpp>
+#include <boost/unordered_flat_map.hpp>
+#include "../helpers/postfix.hpp"
+
+#include "../helpers/test.hpp"
+#include <cstdlib>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+template <class X, class Reference>
+bool same_contents(X const& x, Reference const& r)
+{
+    return x.size() == r.size() &&
+        static_cast<std::size_t>(std::distance(x.begin(), x.end())) ==
+            r.size() &&
+        Reference(x.begin(), x.end()) == r;
+}
+
+UNORDERED_AUTO_TEST(flat_map_random_tests)
+{
+    std::srand(14878);
+
+    boost::unordered_flat_map<int, int> x;
+    std::map<int, int> r;
+
+    for (int i = 0; i < 100000; ++i) {
+        int k = std::rand() % 3000;
+        switch (std::rand() % 5) {
+        case 0:
+            x[k] = i;
+            r[k] = i;
+            break;
+        case 1:
+            BOOST_TEST(x.erase(k) == r.erase(k));
+            break;
+        case 2:
+            BOOST_TEST(x.insert(std::make_pair(k, i)).second ==
+                r.insert(std::make_pair(k, i)).second);
+            break;
+        case 3:
+            BOOST_TEST(x.emplace(k, i).second ==
+                r.insert(std::make_pair(k, i)).second);
+            break;
+        default:
+            BOOST_TEST(x.count(k) == r.count(k));
+            if (r.count(k)) {
+                BOOST_TEST(x.at(k) == r[k]);
+                BOOST_TEST(x.find(k)->second == r[k]);
+            }
+            else {
+                BOOST_TEST(x.find(k) == x.end());
+            }
+            break;
+        }
+        BOOST_TEST(x.size() == r.size());
+    }
+
+    BOOST_TEST(same_contents(x, r));
+    BOOST_TEST(x.load_factor() <= x.max_load_factor());
+}
+
+UNORDERED_AUTO_TEST(flat_set_tests)
+{
+    boost::unordered_flat_set<std::string> x;
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.begin() == x.end());
+    BOOST_TEST(x.find("a") == x.end());
+    BOOST_TEST(x.erase("a") == 0);
+
+    BOOST_TEST(x.insert("a").second);
+    BOOST_TEST(x.emplace("b").second);
+    BOOST_TEST(!x.insert("a").second);
+    BOOST_TEST(x.size() == 2);
+    BOOST_TEST(*x.find("b") == "b");
+
+    std::vector<std::string> values;
+    std::set<std::string> r;
+    for (int i = 0; i < 500; ++i) {
+        values.push_back(std::string(1, static_cast<char>('a' + i % 26)) +
+            std::string(static_cast<std::size_t>(i % 7), 'x'));
+        r.insert(values.back());
+    }
+
+    boost::unordered_flat_set<std::string> y(values.begin(), values.end());
+    BOOST_TEST(same_contents(y, r));
+
+    x.insert(values.begin(), values.end());
+    BOOST_TEST(x == y);
+    BOOST_TEST(!(x != y));
+
+    x.erase(x.begin());
+    BOOST_TEST(x != y);
+    BOOST_TEST(x.size() + 1 == y.size());
+}
+
+UNORDERED_AUTO_TEST(flat_erase_tests)
+{
+    boost::unordered_flat_map<int, int> x;
+    for (int i = 0; i < 1000; ++i) x[i] = i;
+
+    // Erase every other element while iterating.
+    typedef boost::unordered_flat_map<int, int>::iterator iterator;
+    bool erase = false;
+    for (iterator it = x.begin(); it != x.end();) {
+        if ((erase = !erase)) it = x.erase(it);
+        else ++it;
+    }
+    BOOST_TEST(x.size() == 500);
+
+    std::size_t count = 0;
+    for (iterator it = x.begin(); it != x.end(); ++it) {
+        BOOST_TEST(x.find(it->first) == it);
+        ++count;
+    }
+    BOOST_TEST(count == 500);
+
+    BOOST_TEST(x.erase(x.begin(), x.end()) == x.end());
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.begin() == x.end());
+
+    // Repeatedly inserting and erasing leaves deleted slots, which must not
+    // make the container grow without bound.
+    std::size_t slots = 0;
+    for (int i = 0; i < 100000; ++i) {
+        x[i] = i;
+        if (i >= 100) BOOST_TEST(x.erase(i - 100) == 1);
+        if (i == 1000) slots = x.bucket_count();
+    }
+    BOOST_TEST(x.size() == 100);
+    BOOST_TEST(x.bucket_count() == slots);
+    for (int i = 99900; i < 100000; ++i) BOOST_TEST(x.at(i) == i);
+
+    x.clear();
+    BOOST_TEST(x.empty());
+    BOOST_TEST(x.find(99999) == x.end());
+}
+
+UNORDERED_AUTO_TEST(flat_rehash_tests)
+{
+    boost::unordered_flat_map<int, int> x;
+    x.reserve(1000);
+    std::size_t slots = x.bucket_count();
+    BOOST_TEST(static_cast<float>(slots) * x.max_load_factor() >= 1000);
+
+    for (int i = 0; i < 1000; ++i) x[i] = -i;
+    BOOST_TEST(x.bucket_count() == slots);
+
+    for (int i = 100; i < 1000; ++i) x.erase(i);
+    x.rehash(0);
+    BOOST_TEST(x.bucket_count() < slots);
+    BOOST_TEST(x.size() == 100);
+    for (int i = 0; i < 100; ++i) BOOST_TEST(x.at(i) == -i);
+
+    x.max_load_factor(0.5f);
+    BOOST_TEST(x.max_load_factor() == 0.5f);
+    x.rehash(0);
+    BOOST_TEST(x.load_factor() <= 0.5f);
+
+    // The maximum load factor can't be set above the default.
+    x.max_load_factor(1.0f);
+    BOOST_TEST(x.max_load_factor() < 1.0f);
+}
+
+UNORDERED_AUTO_TEST(flat_copy_tests)
+{
+    typedef boost::unordered_flat_map<std::string, std::vector<int> > map;
+
+    map x;
+    for (int i = 0; i < 300; ++i)
+        x[std::string(static_cast<std::size_t>(i), 'a')].push_back(i);
+
+    map y(x);
+    BOOST_TEST(x == y);
+
+    map z;
+    z["b"];
+    z = x;
+    BOOST_TEST(z == x);
+    z = z;
+    BOOST_TEST(z == x);
+
+    map w;
+    w.swap(z);
+    BOOST_TEST(z.empty());
+    BOOST_TEST(w == x);
+
+    w[std::string()].push_back(1000);
+    BOOST_TEST(w != x);
+    BOOST_TEST(w[std::string()].size() == 2);
+
+#if !defined(BOOST_NO_CXX11_RVALUE_REFERENCES)
+    map v(std::move(w));
+    BOOST_TEST(w.empty());
+    BOOST_TEST(v.size() == x.size());
+    w = std::move(v);
+    BOOST_TEST(v.empty());
+    BOOST_TEST(w.size() == x.size());
+#endif
+}
+
+// Counts the live instances, to check that every element constructed by
+// the container is destroyed.
+struct counted
+{
+    static int instances;
+    int value;
+
+    counted(int v) : value(v) { ++instances; }
+    counted(counted const& x) : value(x.value) { ++instances; }
+    ~counted() { --instances; }
+
+    bool operator==(counted const& x) const { return value == x.value; }
+};
+
+int counted::instances = 0;
+
+std::size_t hash_value(counted const& x)
+{
+    return boost::hash<int>()(x.value);
+}
+
+UNORDERED_AUTO_TEST(flat_lifetime_tests)
+{
+    {
+        boost::unordered_flat_set<counted> x;
+        for (int i = 0; i < 2000; ++i) x.insert(counted(i % 1500));
+        BOOST_TEST(counted::instances == 1500);
+
+        for (int i = 0; i < 1000; ++i) x.erase(counted(i));
+        BOOST_TEST(counted::instances == 500);
+
+        boost::unordered_flat_set<counted> y(x);
+        BOOST_TEST(counted::instances == 1000);
+        y.clear();
+        BOOST_TEST(counted::instances == 500);
+    }
+    BOOST_TEST(counted::instances == 0);
+}
+
+RUN_TESTS()